@@ -0,0 +1,144 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBatchImageProcessor_h
+#define itkBatchImageProcessor_h
+
+#include "itkMultiThreaderBase.h"
+#include "itkObjectFactory.h"
+#include "itkProcessObject.h"
+
+#include <functional>
+#include <vector>
+
+namespace itk
+{
+/** \class BatchImageProcessor
+ * \brief Runs a pipeline over a batch of images, processing several images
+ * at once.
+ *
+ * Multithreading a filter over the pixels of a small image barely pays
+ * off. BatchImageProcessor instead runs a pipeline over many images with
+ * one worker thread per image: each worker has its own copy of the
+ * pipeline, which it runs single-threaded over the images it takes from
+ * the batch in turn, so the throughput approaches the number of workers
+ * times that of a single thread.
+ *
+ * The copies of the pipeline are made by a factory, called once per
+ * worker before processing the first batch, and reused for the later
+ * batches. The objects captured by the factory, rather than created by
+ * it, are shared by the workers, and must support concurrent use: a
+ * transform is, as the filters only read it, but an interpolator is not,
+ * as the filters set its input image.
+ *
+   \code
+   using ProcessorType = itk::BatchImageProcessor<InputImageType, OutputImageType>;
+   auto processor = ProcessorType::New();
+   processor->SetPipelineFactory([transform]() {
+     auto resample = ResampleFilterType::New();
+     resample->SetTransform(transform);
+     resample->SetInterpolator(InterpolatorType::New());
+     resample->SetSize(size);
+     auto cast = CastFilterType::New();
+     cast->SetInput(resample->GetOutput());
+     return ProcessorType::MakePipeline(resample.GetPointer(), cast.GetPointer());
+   });
+   std::vector<OutputImageType::Pointer> outputs = processor->Process(inputs);
+   \endcode
+ *
+ * \ingroup ITKCommon
+ */
+template <typename TInputImage, typename TOutputImage>
+class ITK_TEMPLATE_EXPORT BatchImageProcessor : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BatchImageProcessor);
+
+  /** Standard class type aliases. */
+  using Self = BatchImageProcessor;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BatchImageProcessor, Object);
+
+  using InputImageType = TInputImage;
+  using InputImageConstPointer = typename InputImageType::ConstPointer;
+  using OutputImageType = TOutputImage;
+  using OutputImagePointer = typename OutputImageType::Pointer;
+
+  /** A pipeline processes an input image, and returns an output image of
+   * its own, which is not modified by its later calls. */
+  using PipelineType = std::function<OutputImagePointer(const InputImageType *)>;
+
+  /** Makes a copy of the pipeline for a worker. */
+  using PipelineFactoryType = std::function<PipelineType()>;
+
+  /** Set the factory of the pipeline. The copies made by the previous
+   * factory are released. */
+  void
+  SetPipelineFactory(PipelineFactoryType pipelineFactory);
+
+  /** Make a pipeline from its first and last filters: it sets the input of
+   * the first filter, updates the last one, and disconnects its output.
+   * The filters upstream of the last one, up to the first one, are held by
+   * the pipeline, and set to use a single work unit, as the pipelines run
+   * concurrently. */
+  template <typename TFirstFilter, typename TLastFilter>
+  static PipelineType
+  MakePipeline(TFirstFilter * firstFilter, TLastFilter * lastFilter);
+
+  /** Set/Get the maximum number of images processed at once, and of copies
+   * of the pipeline. Defaults to the global default number of threads. */
+  itkSetClampMacro(NumberOfWorkers, ThreadIdType, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkers, ThreadIdType);
+
+  /** Get the multi-threader which runs the workers. */
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+
+  /** Process the images, and return the outputs in the same order. Each
+   * pipeline is given a graft of its input, so the inputs are not modified
+   * and the same image may appear several times, but they are not updated:
+   * they must already hold their pixels. If the pipeline throws for some
+   * images, the others are still processed, and the exception of the first
+   * of these images is rethrown. */
+  std::vector<OutputImagePointer>
+  Process(const std::vector<InputImageConstPointer> & inputs);
+
+protected:
+  BatchImageProcessor();
+  ~BatchImageProcessor() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  PipelineFactoryType        m_PipelineFactory;
+  std::vector<PipelineType>  m_Pipelines;
+  ThreadIdType               m_NumberOfWorkers;
+  MultiThreaderBase::Pointer m_MultiThreader;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkBatchImageProcessor.hxx"
+#endif
+
+#endif
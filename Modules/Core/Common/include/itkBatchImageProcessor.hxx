@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBatchImageProcessor_hxx
+#define itkBatchImageProcessor_hxx
+
+#include "itkBatchImageProcessor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+BatchImageProcessor<TInputImage, TOutputImage>::BatchImageProcessor()
+  : m_NumberOfWorkers(MultiThreaderBase::GetGlobalDefaultNumberOfThreads())
+  , m_MultiThreader(MultiThreaderBase::New())
+{}
+
+template <typename TInputImage, typename TOutputImage>
+void
+BatchImageProcessor<TInputImage, TOutputImage>::SetPipelineFactory(PipelineFactoryType pipelineFactory)
+{
+  m_PipelineFactory = std::move(pipelineFactory);
+  m_Pipelines.clear();
+  this->Modified();
+}
+
+template <typename TInputImage, typename TOutputImage>
+template <typename TFirstFilter, typename TLastFilter>
+auto
+BatchImageProcessor<TInputImage, TOutputImage>::MakePipeline(TFirstFilter * firstFilter, TLastFilter * lastFilter)
+  -> PipelineType
+{
+  // The data objects only hold weak pointers to their sources, so the
+  // pipeline holds all its filters.
+  std::vector<ProcessObject::Pointer> filters;
+  std::vector<ProcessObject *>        filtersToVisit{ lastFilter };
+  while (!filtersToVisit.empty())
+  {
+    ProcessObject * const filter = filtersToVisit.back();
+    filtersToVisit.pop_back();
+    if (std::find(filters.begin(), filters.end(), filter) != filters.end())
+    {
+      continue;
+    }
+    filters.push_back(filter);
+    filter->SetNumberOfWorkUnits(1);
+    if (filter != firstFilter)
+    {
+      for (DataObject * input : filter->GetInputs())
+      {
+        if (input != nullptr && input->GetSource() != nullptr)
+        {
+          filtersToVisit.push_back(input->GetSource());
+        }
+      }
+    }
+  }
+
+  const typename TFirstFilter::Pointer first = firstFilter;
+  const typename TLastFilter::Pointer  last = lastFilter;
+  return [first, last, filters](const InputImageType * input) -> OutputImagePointer {
+    first->SetInput(input);
+    last->UpdateLargestPossibleRegion();
+    OutputImagePointer output = last->GetOutput();
+    output->DisconnectPipeline();
+    return output;
+  };
+}
+
+template <typename TInputImage, typename TOutputImage>
+auto
+BatchImageProcessor<TInputImage, TOutputImage>::Process(const std::vector<InputImageConstPointer> & inputs)
+  -> std::vector<OutputImagePointer>
+{
+  if (!m_PipelineFactory)
+  {
+    itkExceptionMacro("No pipeline factory is set.");
+  }
+
+  std::vector<OutputImagePointer> outputs(inputs.size());
+  const auto numberOfWorkers = static_cast<ThreadIdType>(std::min<SizeValueType>(m_NumberOfWorkers, inputs.size()));
+  while (m_Pipelines.size() < numberOfWorkers)
+  {
+    m_Pipelines.push_back(m_PipelineFactory());
+  }
+
+  // Each worker takes the next image of the batch, until none is left, so
+  // that the workers stay busy when the images take different times.
+  std::vector<std::exception_ptr> exceptions(inputs.size());
+  std::atomic<SizeValueType>      nextImage{ 0 };
+  m_MultiThreader->SetNumberOfWorkUnits(numberOfWorkers);
+  m_MultiThreader->SetGrainSize(1);
+  m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfWorkers,
+    [this, &inputs, &outputs, &exceptions, &nextImage](SizeValueType worker) {
+      for (SizeValueType image = nextImage++; image < inputs.size(); image = nextImage++)
+      {
+        try
+        {
+          // The pipeline sets the requested region of its input, so that it
+          // gets an image of its own, which shares the pixels of the input:
+          // an input may then be passed more than once.
+          const auto input = InputImageType::New();
+          input->Graft(inputs[image]);
+          outputs[image] = m_Pipelines[worker](input);
+        }
+        catch (...)
+        {
+          exceptions[image] = std::current_exception();
+        }
+      }
+    },
+    nullptr);
+
+  for (const std::exception_ptr & exception : exceptions)
+  {
+    if (exception != nullptr)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+  return outputs;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+BatchImageProcessor<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "PipelineFactory: " << (m_PipelineFactory ? "(set)" : "(none)") << std::endl;
+  os << indent << "NumberOfPipelines: " << m_Pipelines.size() << std::endl;
+  os << indent << "NumberOfWorkers: " << m_NumberOfWorkers << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,166 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkComponentConverter_h
+#define itkComponentConverter_h
+
+#include "itkIntTypes.h"
+#include "ITKCommonExport.h"
+#include <ostream>
+#include <type_traits>
+
+namespace itk
+{
+/** \class ComponentConverterEnums
+ *
+ * \brief enums for ComponentConverter
+ *
+ * \ingroup ITKCommon
+ */
+class ComponentConverterEnums
+{
+public:
+  /** \class InstructionSet
+   * \ingroup ITKCommon
+   * The instruction sets for which the conversion kernels are compiled.
+   *
+   * Baseline: the instructions the library is compiled for, e.g. SSE2 on
+   * x86-64.
+   * AVX2: 256-bit vectors.
+   * AVX512: 512-bit vectors, with the AVX512BW, AVX512DQ and AVX512VL
+   * extensions.
+   */
+  enum class InstructionSet : uint8_t
+  {
+    Baseline,
+    AVX2,
+    AVX512
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const ComponentConverterEnums::InstructionSet value);
+
+/** \class ComponentConverter
+ * \brief Converts contiguous arrays of scalars with vectorized kernels.
+ *
+ * Convert() is equivalent to
+   \code
+     std::transform(first, last, result, [](TInput x) { return static_cast<TOutput>(x); });
+   \endcode
+ * It is used by ImageAlgorithm::Copy(), and hence by CastImageFilter, to
+ * convert the pixels of Image, the components of VectorImage, and the
+ * components of fixed size pixels such as RGBPixel or Vector.
+ *
+ * Each pair of the scalar types, from signed char to double, has a kernel
+ * compiled for the baseline instruction set of the library and, with GCC
+ * and Clang on x86-64, for AVX2 and AVX-512, whose loops the compiler
+ * vectorizes with wider vectors. The widest instruction set supported by
+ * the processor is selected at run time. Other types, and short arrays,
+ * are converted inline.
+ *
+ * The results do not depend on the instruction set: the conversions of
+ * floating point values to integers truncate toward zero, like
+ * static_cast, and only differ from it for values out of the range of the
+ * output type, whose conversion is undefined.
+ *
+ * \sa ImageAlgorithm
+ * \ingroup ITKCommon
+ */
+struct ITKCommon_EXPORT ComponentConverter
+{
+  using InstructionSetEnum = ComponentConverterEnums::InstructionSet;
+
+  /** Whether a kernel converts the TInput values to TOutput. */
+  template <typename TInput, typename TOutput>
+  static constexpr bool
+  IsSupported()
+  {
+    return TypeIndex<TInput>::value >= 0 && TypeIndex<TOutput>::value >= 0;
+  }
+
+  /** Convert the values from first to last, and write them from result.
+   * Returns the end of the output values. The arrays must not overlap. */
+  template <typename TInput, typename TOutput>
+  static TOutput *
+  Convert(const TInput * first, const TInput * last, TOutput * result)
+  {
+    const auto numberOfValues = static_cast<SizeValueType>(last - first);
+    if (IsSupported<TInput, TOutput>() && numberOfValues >= MinimumNumberOfValues)
+    {
+      ConvertBuffer(TypeIndex<TInput>::value, first, TypeIndex<TOutput>::value, result, numberOfValues);
+      return result + numberOfValues;
+    }
+    for (; first != last; ++first, ++result)
+    {
+      *result = static_cast<TOutput>(*first);
+    }
+    return result;
+  }
+
+  /** Get the instruction set of the kernels used by Convert(): the widest
+   * one supported by the processor, up to the maximum instruction set. */
+  static InstructionSetEnum
+  GetInstructionSet();
+
+  /** Set/Get the maximum instruction set used by Convert(), e.g. to compare
+   * the kernels. Defaults to AVX512. */
+  static void
+  SetMaximumInstructionSet(InstructionSetEnum instructionSet);
+  static InstructionSetEnum
+  GetMaximumInstructionSet();
+
+  /** Whether the processor, and the compiler of the library, support the
+   * given instruction set. */
+  static bool
+  IsInstructionSetAvailable(InstructionSetEnum instructionSet);
+
+private:
+  /** The arrays shorter than this are converted inline. */
+  static constexpr SizeValueType MinimumNumberOfValues = 32;
+
+  /** The index of a type in the list of the types converted by the kernels,
+   * or -1. Plain char is converted as signed or unsigned char. */
+  template <typename T>
+  struct TypeIndex : std::integral_constant<int, -1>
+  {};
+
+  static void
+  ConvertBuffer(int inputType, const void * input, int outputType, void * output, SizeValueType numberOfValues);
+};
+
+/// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+// clang-format off
+template <> struct ComponentConverter::TypeIndex<signed char> : std::integral_constant<int, 0> {};
+template <> struct ComponentConverter::TypeIndex<unsigned char> : std::integral_constant<int, 1> {};
+template <> struct ComponentConverter::TypeIndex<short> : std::integral_constant<int, 2> {};
+template <> struct ComponentConverter::TypeIndex<unsigned short> : std::integral_constant<int, 3> {};
+template <> struct ComponentConverter::TypeIndex<int> : std::integral_constant<int, 4> {};
+template <> struct ComponentConverter::TypeIndex<unsigned int> : std::integral_constant<int, 5> {};
+template <> struct ComponentConverter::TypeIndex<long> : std::integral_constant<int, 6> {};
+template <> struct ComponentConverter::TypeIndex<unsigned long> : std::integral_constant<int, 7> {};
+template <> struct ComponentConverter::TypeIndex<long long> : std::integral_constant<int, 8> {};
+template <> struct ComponentConverter::TypeIndex<unsigned long long> : std::integral_constant<int, 9> {};
+template <> struct ComponentConverter::TypeIndex<float> : std::integral_constant<int, 10> {};
+template <> struct ComponentConverter::TypeIndex<double> : std::integral_constant<int, 11> {};
+template <> struct ComponentConverter::TypeIndex<char>
+  : std::integral_constant<int, std::is_signed<char>::value ? 0 : 1> {};
+// clang-format on
+/// \endcond
+} // end namespace itk
+
+#endif
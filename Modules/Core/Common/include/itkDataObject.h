@@ -509,6 +509,31 @@ public:
     return true;
   }
 
+  /** Get the number of bytes of the bulk data needed to buffer the
+   * RequestedRegion. Used to estimate the memory needed by an update of
+   * the pipeline, see EstimateMemoryForRequestedRegion(). The default
+   * implementation returns zero, for DataObjects whose size is unknown or
+   * negligible. */
+  virtual SizeValueType
+  GetRequestedRegionSizeInBytes() const
+  {
+    return 0;
+  }
+
+  /** Estimate the number of bytes of bulk data allocated by an update of
+   * this data object for its current RequestedRegion: the sum of
+   * GetRequestedRegionSizeInBytes() over this data object and the outputs
+   * of the upstream filters which need to execute, with the requested
+   * regions they get from this one, including the padding needed by
+   * neighborhood filters and the enlargement by filters which cannot
+   * stream. This propagates the RequestedRegion up the pipeline, as
+   * PropagateRequestedRegion() does, but does not execute any filter.
+   * Data objects without a source, and data already buffered, are not
+   * counted. The buffers allocated internally by filters are not known,
+   * and are not counted either. */
+  SizeValueType
+  EstimateMemoryForRequestedRegion();
+
   /** Copy information from the specified data set.  This method is
    * part of the pipeline execution model. By default, a ProcessObject
    * will copy meta-data from the first input to all of its
@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkDefaultPlanarVectorPixelAccessor_h
+#define itkDefaultPlanarVectorPixelAccessor_h
+
+#include "itkMacro.h"
+#include "itkVariableLengthVector.h"
+#include "itkIntTypes.h"
+
+namespace itk
+{
+/** \class DefaultPlanarVectorPixelAccessor
+ * \brief Give access to the pixels of a PlanarVectorImage.
+ *
+ * DefaultPlanarVectorPixelAccessor provides PlanarVectorImage with the
+ * same interface that DefaultVectorPixelAccessor provides to VectorImage.
+ * The internal value given to Get() and Set() is the first component of
+ * a pixel, and the following components are ComponentStride elements
+ * apart, in the next planes of the buffer.
+ *
+ * Since the components of a pixel are not contiguous, Get() returns a
+ * VariableLengthVector holding a copy of the components, rather than
+ * referring to the buffer.
+ *
+ * The VectorLength and the ComponentStride must be set before the
+ * accessor can be used.
+ *
+ * \sa PlanarVectorImage
+ * \sa DefaultVectorPixelAccessor
+ *
+ * \ingroup ImageAdaptors
+ * \ingroup ITKCommon
+ */
+template <typename TType>
+class ITK_TEMPLATE_EXPORT DefaultPlanarVectorPixelAccessor
+{
+public:
+  using VectorLengthType = unsigned int;
+
+  /** External type alias. It defines the external aspect that this class
+   * will exhibit. Here it is a VariableLengthVector, which manages a copy
+   * of the components of the pixel. */
+  using ExternalType = VariableLengthVector<TType>;
+
+  /** Internal type alias. It defines the internal real representation of data. */
+  using InternalType = TType;
+
+  /** Set output using the value in input */
+  inline void
+  Set(InternalType & output, const ExternalType & input, const SizeValueType itkNotUsed(offset)) const
+  {
+    InternalType * component = &output;
+    for (VectorLengthType i = 0; i < m_VectorLength; ++i, component += m_ComponentStride)
+    {
+      *component = input[i];
+    }
+  }
+
+  /** Get the value from input */
+  inline ExternalType
+  Get(const InternalType & input, const SizeValueType itkNotUsed(offset)) const
+  {
+    ExternalType         value(m_VectorLength);
+    const InternalType * component = &input;
+    for (VectorLengthType i = 0; i < m_VectorLength; ++i, component += m_ComponentStride)
+    {
+      value[i] = *component;
+    }
+    return value;
+  }
+
+  /** Set/Get the length of each vector in the PlanarVectorImage */
+  void
+  SetVectorLength(VectorLengthType l)
+  {
+    m_VectorLength = l;
+  }
+  VectorLengthType
+  GetVectorLength() const
+  {
+    return m_VectorLength;
+  }
+
+  /** Set/Get the number of elements between two components of a pixel,
+   * which is the number of pixels of the buffer. */
+  void
+  SetComponentStride(SizeValueType stride)
+  {
+    m_ComponentStride = stride;
+  }
+  SizeValueType
+  GetComponentStride() const
+  {
+    return m_ComponentStride;
+  }
+
+  DefaultPlanarVectorPixelAccessor() = default;
+
+  /** Constructor to initialize VectorLength and ComponentStride at
+   * construction time */
+  DefaultPlanarVectorPixelAccessor(VectorLengthType l, SizeValueType stride)
+    : m_VectorLength(l)
+    , m_ComponentStride(stride)
+  {}
+
+  ~DefaultPlanarVectorPixelAccessor() = default;
+
+private:
+  VectorLengthType m_VectorLength{ 0 };
+  SizeValueType    m_ComponentStride{ 0 };
+};
+} // end namespace itk
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "itkMacro.h"
 #include "itkVariableLengthVector.h"
+#include "itkVariableLengthVectorReference.h"
 #include "itkIntTypes.h"
 
 namespace itk
@@ -82,6 +83,19 @@ public:
     return ExternalType((&input) + (offset * m_OffsetMultiplier), m_VectorLength);
   }
 
+  /** Get a reference to the components of the pixel, which does not copy
+   * them. */
+  inline VariableLengthVectorReference<InternalType>
+  GetReference(InternalType & input, const SizeValueType offset) const
+  {
+    return { (&input) + (offset * m_OffsetMultiplier), m_VectorLength };
+  }
+  inline VariableLengthVectorReference<const InternalType>
+  GetReference(const InternalType & input, const SizeValueType offset) const
+  {
+    return { (&input) + (offset * m_OffsetMultiplier), m_VectorLength };
+  }
+
   /** Set the length of each vector in the VectorImage */
   void
   SetVectorLength(VectorLengthType l)
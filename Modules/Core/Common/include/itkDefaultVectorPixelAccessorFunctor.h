@@ -19,6 +19,7 @@
 #define itkDefaultVectorPixelAccessorFunctor_h
 
 #include "itkMacro.h"
+#include "itkVariableLengthVectorReference.h"
 
 namespace itk
 {
@@ -111,6 +112,19 @@ public:
     return m_PixelAccessor.Get(input, &input - m_Begin);
   }
 
+  /** Get a reference to the components of the pixel, which does not copy
+   * them. Only supported by the DefaultVectorPixelAccessor of VectorImage. */
+  inline VariableLengthVectorReference<InternalPixelType>
+  GetReference(InternalPixelType & input) const
+  {
+    return m_PixelAccessor.GetReference(input, &input - m_Begin);
+  }
+  inline VariableLengthVectorReference<const InternalPixelType>
+  GetReference(const InternalPixelType & input) const
+  {
+    return m_PixelAccessor.GetReference(input, &input - m_Begin);
+  }
+
 private:
   PixelAccessorType   m_PixelAccessor;    // The pixel accessor
   InternalPixelType * m_Begin{ nullptr }; // Begin of the buffer
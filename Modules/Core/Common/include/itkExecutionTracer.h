@@ -0,0 +1,170 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkExecutionTracer_h
+#define itkExecutionTracer_h
+
+#include "itkMacro.h"
+#include "itkIntTypes.h"
+#include <atomic>
+#include <ostream>
+#include <string>
+
+namespace itk
+{
+/** \class ExecutionTracer
+ * \brief Records the execution of pipelines as a Chrome trace.
+ *
+ * When tracing is started, ITK records a span for each
+ * ProcessObject::UpdateOutputData() and ProcessObject::GenerateData()
+ * call, for each parallel region of a MultiThreaderBase and for each of
+ * its work units, and an event for each pixel buffer allocated by an
+ * ImportImageContainer. Each event has the time, the duration and the
+ * thread of the operation, as well as the size of the work (the number of
+ * pixels or of array indices processed) or the number of bytes allocated.
+ *
+ * The events are written in the Chrome trace event JSON format, which is
+ * displayed by chrome://tracing and https://ui.perfetto.dev, to the file
+ * given to Start() when Stop() is called, or at exit. Tracing is also
+ * started when the environment variable ITK_TRACE_FILE is set to the name
+ * of a file.
+ *
+ * When tracing is not started, the instrumented code only checks
+ * GetEnabled(), which is a relaxed atomic load: the names and sizes of the
+ * events are not computed, and the functors of the parallel regions are
+ * not wrapped.
+ *
+ * \code
+ * itk::ExecutionTracer::Start("pipeline.json");
+ * writer->Update();
+ * itk::ExecutionTracer::Stop();
+ * \endcode
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ExecutionTracer
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ExecutionTracer);
+
+  /** Start recording events, which are written to the given file by
+   * Stop(). Events recorded previously and not written yet are
+   * discarded. */
+  static void
+  Start(const std::string & fileName);
+
+  /** Stop recording events, and write them to the file given to Start().
+   * Throws an exception when the file cannot be written. */
+  static void
+  Stop();
+
+  /** Tell whether events are being recorded. */
+  static bool
+  GetEnabled()
+  {
+    return m_Enabled.load(std::memory_order_relaxed);
+  }
+
+  /** Write the events recorded so far as a Chrome trace. */
+  static void
+  WriteTrace(std::ostream & os);
+
+  /** Get the number of events recorded so far. */
+  static SizeValueType
+  GetNumberOfEvents();
+
+  /** Get the time elapsed since tracing was started, in microseconds. */
+  static double
+  GetTimeStamp();
+
+  /** Record a span of the calling thread, which started at the given time
+   * stamp and ends now. The size of the work, i.e. the number of pixels or
+   * of array indices processed, is omitted from the event when it is
+   * zero. */
+  static void
+  AddSpan(const char * category, std::string name, double startTimeStamp, SizeValueType size = 0);
+
+  /** Record the allocation of a buffer by the calling thread. */
+  static void
+  AddAllocation(const char * name, SizeValueType numberOfBytes);
+
+  /** \class Span
+   * \brief Records a span from its construction to its destruction.
+   *
+   * The category and the name must remain valid until the span is
+   * destroyed, e.g. be string literals or the result of GetNameOfClass().
+   * A default constructed span records nothing until Start() is called,
+   * so that its arguments are only computed when tracing is enabled:
+   *
+   * \code
+   * itk::ExecutionTracer::Span span;
+   * if (itk::ExecutionTracer::GetEnabled())
+   * {
+   *   span.Start("ParallelRegion", filter->GetNameOfClass(), region.GetNumberOfPixels());
+   * }
+   * \endcode
+   * \ingroup ITKCommon
+   */
+  class Span
+  {
+  public:
+    ITK_DISALLOW_COPY_AND_MOVE(Span);
+
+    Span() = default;
+
+    Span(const char * category, const char * name, SizeValueType size = 0)
+    {
+      if (ExecutionTracer::GetEnabled())
+      {
+        this->Start(category, name, size);
+      }
+    }
+
+    /** Start recording the span now, regardless of whether tracing is
+     * enabled. */
+    void
+    Start(const char * category, const char * name, SizeValueType size = 0)
+    {
+      m_Category = category;
+      m_Name = name;
+      m_Size = size;
+      m_StartTimeStamp = ExecutionTracer::GetTimeStamp();
+    }
+
+    ~Span()
+    {
+      if (m_Category != nullptr)
+      {
+        ExecutionTracer::AddSpan(m_Category, m_Name, m_StartTimeStamp, m_Size);
+      }
+    }
+
+  private:
+    const char *  m_Category{ nullptr };
+    const char *  m_Name{ nullptr };
+    SizeValueType m_Size{ 0 };
+    double        m_StartTimeStamp{ 0.0 };
+  };
+
+private:
+  ExecutionTracer() = default;
+
+  static std::atomic<bool> m_Enabled;
+};
+} // end namespace itk
+
+#endif
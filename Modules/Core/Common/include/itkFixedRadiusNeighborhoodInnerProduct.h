@@ -0,0 +1,310 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFixedRadiusNeighborhoodInnerProduct_h
+#define itkFixedRadiusNeighborhoodInnerProduct_h
+
+#include "itkDefaultPixelAccessor.h"
+#include "itkMath.h"
+#include "itkNeighborhood.h"
+#include "itkNumericTraits.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace itk
+{
+/** \class FixedRadiusNeighborhoodInnerProduct
+ * \brief Computes the inner products of a small neighborhood operator with
+ * the neighborhoods of all the pixels of a region, with loops whose number of
+ * iterations is known at compile time.
+ *
+ * NeighborhoodInnerProduct computes one inner product at a time, with a
+ * ConstNeighborhoodIterator, for operators of any size. For the common
+ * small operators, the inner products of the pixels which are not at the
+ * boundary of the image, i.e. those of the non-boundary region computed by
+ * NeighborhoodAlgorithm::ImageBoundaryFacesCalculator, are instead computed
+ * by Evaluate() directly over the pixel buffers, with a stencil of
+ * (2 * VRadius + 1) ^ VStencilDimension offsets which is a compile-time
+ * constant. The loop over the operator coefficients is then fully unrolled,
+ * and the loop over the pixels of a line may be vectorized by the compiler.
+ *
+ * The supported operators are:
+ * - operators of radius 1 or 2 in all the dimensions of a 2D or 3D image,
+ *   e.g. the LaplacianOperator and the SobelOperator,
+ * - operators of radius 1 or 2 along a single dimension of an image of any
+ *   dimension, e.g. the DerivativeOperator.
+ *
+ * The results are the same as those of NeighborhoodInnerProduct: the
+ * products are accumulated in the same order, with the same types.
+ *
+ * \tparam TImage         Type of the input image, whose pixels must be stored
+ * contiguously, as the scalar pixels of Image.
+ * \tparam TOperator      The value type of the operator.
+ * \tparam TComputation   The value type used as the return type of the
+ * inner product calculation.
+ *
+ * \sa NeighborhoodInnerProduct
+ * \sa NeighborhoodOperatorImageFilter
+ * \ingroup Operators
+ * \ingroup ITKCommon
+ */
+template <typename TImage, typename TOperator = typename TImage::PixelType, typename TComputation = TOperator>
+class FixedRadiusNeighborhoodInnerProduct
+{
+public:
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  using ImagePixelType = typename TImage::PixelType;
+  using OperatorPixelType = TOperator;
+  using OutputPixelType = TComputation;
+  using OperatorType = Neighborhood<OperatorPixelType, ImageDimension>;
+  using RegionType = typename TImage::RegionType;
+
+  /** Whether the pixels of the input and output image types are supported by
+   * Evaluate(): scalar pixels, stored contiguously. */
+  template <typename TOutputImage>
+  static constexpr bool
+  SupportsImageTypes()
+  {
+    return HasScalarBufferPixels<TImage>() && HasScalarBufferPixels<TOutputImage>() &&
+           std::is_arithmetic<OutputPixelType>::value &&
+           static_cast<unsigned int>(TOutputImage::ImageDimension) == ImageDimension;
+  }
+
+  /** Whether Evaluate() supports the radius of the operator. */
+  static bool
+  IsSupported(const OperatorType & op)
+  {
+    unsigned int stencilDimension = 0;
+    return GetStencilRadius(op, stencilDimension) != 0;
+  }
+
+  /** Computes the inner products of the operator with the neighborhoods of
+   * the pixels of the region, and writes them, cast to the output pixel
+   * type, at the same indices of the output image. The neighborhoods must be
+   * inside the buffered region of the input image, and the region inside the
+   * buffered region of the output image.
+   * \pre `IsSupported(op)` and `SupportsImageTypes<TOutputImage>()` */
+  template <typename TOutputImage>
+  static void
+  Evaluate(const TImage & input, const OperatorType & op, TOutputImage & output, const RegionType & region)
+  {
+    static_assert(SupportsImageTypes<TOutputImage>(), "The image types must have scalar, contiguous pixels");
+
+    unsigned int       stencilDimension = 0;
+    const unsigned int radius = GetStencilRadius(op, stencilDimension);
+    itkAssertOrThrowMacro(radius != 0, "The radius of the operator is not supported");
+
+    const typename TImage::OffsetValueType * const inputOffsetTable = input.GetOffsetTable();
+    if (stencilDimension < ImageDimension)
+    {
+      // A one-dimensional operator, along stencilDimension.
+      const OffsetValueType strides[] = { inputOffsetTable[stencilDimension] };
+      if (radius == 1)
+      {
+        EvaluateStencil<1, 1>(input, op, output, region, strides);
+      }
+      else
+      {
+        EvaluateStencil<1, 2>(input, op, output, region, strides);
+      }
+    }
+    else
+    {
+      EvaluateFullStencil(input, op, output, region, radius, std::integral_constant<bool, (ImageDimension <= 3)>());
+    }
+  }
+
+private:
+  template <typename TAnyImage>
+  static constexpr bool
+  HasScalarBufferPixels()
+  {
+    return std::is_arithmetic<typename TAnyImage::PixelType>::value &&
+           std::is_same<typename TAnyImage::PixelType, typename TAnyImage::InternalPixelType>::value &&
+           std::is_same<typename TAnyImage::AccessorType, DefaultPixelAccessor<typename TAnyImage::PixelType>>::value;
+  }
+
+  /** The offsets of the (2 * VRadius + 1) ^ VStencilDimension pixels of a
+   * stencil, in the order of the coefficients of a Neighborhood: the first
+   * dimension varies the fastest. */
+  template <unsigned int VStencilDimension, unsigned int VRadius>
+  struct StencilOffsets
+  {
+    static constexpr unsigned int Width = 2 * VRadius + 1;
+    static constexpr unsigned int Size = Math::UnsignedPower<unsigned int>(Width, VStencilDimension);
+
+    int m_Values[Size][VStencilDimension];
+  };
+
+  template <unsigned int VStencilDimension, unsigned int VRadius>
+  static constexpr StencilOffsets<VStencilDimension, VRadius>
+  MakeStencilOffsets()
+  {
+    using TableType = StencilOffsets<VStencilDimension, VRadius>;
+    TableType table{};
+    for (unsigned int i = 0; i < TableType::Size; ++i)
+    {
+      unsigned int rest = i;
+      for (unsigned int j = 0; j < VStencilDimension; ++j)
+      {
+        table.m_Values[i][j] = static_cast<int>(rest % TableType::Width) - static_cast<int>(VRadius);
+        rest /= TableType::Width;
+      }
+    }
+    return table;
+  }
+
+  /** Returns the radius of the stencil of the operator, 1 or 2, or 0 when the
+   * operator is not supported. stencilDimension is set to the dimension of a
+   * one-dimensional operator, or to ImageDimension. */
+  static unsigned int
+  GetStencilRadius(const OperatorType & op, unsigned int & stencilDimension)
+  {
+    unsigned int radius = 0;
+    unsigned int numberOfNonZeroRadii = 0;
+    for (unsigned int i = 0; i < ImageDimension; ++i)
+    {
+      const auto r = static_cast<unsigned int>(op.GetRadius(i));
+      if (r != 0)
+      {
+        if (radius != 0 && r != radius)
+        {
+          return 0;
+        }
+        radius = r;
+        stencilDimension = i;
+        ++numberOfNonZeroRadii;
+      }
+    }
+    if (radius > 2)
+    {
+      return 0;
+    }
+    if (numberOfNonZeroRadii == 1)
+    {
+      return radius;
+    }
+    stencilDimension = ImageDimension;
+    return (numberOfNonZeroRadii == ImageDimension && ImageDimension <= 3) ? radius : 0;
+  }
+
+  template <typename TOutputImage>
+  static void
+  EvaluateFullStencil(const TImage &       input,
+                      const OperatorType & op,
+                      TOutputImage &       output,
+                      const RegionType &   region,
+                      unsigned int         radius,
+                      std::true_type)
+  {
+    OffsetValueType strides[ImageDimension];
+    std::copy_n(input.GetOffsetTable(), ImageDimension, strides);
+    if (radius == 1)
+    {
+      EvaluateStencil<ImageDimension, 1>(input, op, output, region, strides);
+    }
+    else
+    {
+      EvaluateStencil<ImageDimension, 2>(input, op, output, region, strides);
+    }
+  }
+
+  template <typename TOutputImage>
+  static void
+  EvaluateFullStencil(const TImage &,
+                      const OperatorType &,
+                      TOutputImage &,
+                      const RegionType &,
+                      unsigned int,
+                      std::false_type)
+  {}
+
+  template <unsigned int VStencilDimension, unsigned int VRadius, typename TOutputImage>
+  static void
+  EvaluateStencil(const TImage &       input,
+                  const OperatorType & op,
+                  TOutputImage &       output,
+                  const RegionType &   region,
+                  const OffsetValueType (&strides)[VStencilDimension])
+  {
+    using InputPixelRealType = typename NumericTraits<ImagePixelType>::RealType;
+    using AccumulateRealType = typename NumericTraits<InputPixelRealType>::AccumulateType;
+    using OutputPixelValueType = typename NumericTraits<OutputPixelType>::ValueType;
+    using OutputImagePixelType = typename TOutputImage::PixelType;
+    using TableType = StencilOffsets<VStencilDimension, VRadius>;
+
+    constexpr TableType stencilOffsets = MakeStencilOffsets<VStencilDimension, VRadius>();
+
+    itkAssertOrThrowMacro(op.Size() == TableType::Size, "The size of the operator does not match its radius");
+
+    // The coefficients, and the offsets of the pixels in the input buffer.
+    OutputPixelValueType coefficients[TableType::Size];
+    OffsetValueType      bufferOffsets[TableType::Size];
+    for (unsigned int k = 0; k < TableType::Size; ++k)
+    {
+      coefficients[k] = static_cast<OutputPixelValueType>(op[k]);
+      bufferOffsets[k] = 0;
+      for (unsigned int j = 0; j < VStencilDimension; ++j)
+      {
+        bufferOffsets[k] += stencilOffsets.m_Values[k][j] * strides[j];
+      }
+    }
+
+    const SizeValueType lineLength = region.GetSize(0);
+    if (lineLength == 0)
+    {
+      return;
+    }
+    const SizeValueType numberOfLines = region.GetNumberOfPixels() / lineLength;
+
+    const ImagePixelType * const inputBuffer = input.GetBufferPointer();
+    OutputImagePixelType * const outputBuffer = output.GetBufferPointer();
+    typename TImage::IndexType   index = region.GetIndex();
+
+    for (SizeValueType line = 0; line < numberOfLines; ++line)
+    {
+      const ImagePixelType * const in = inputBuffer + input.ComputeOffset(index);
+      OutputImagePixelType * const out = outputBuffer + output.ComputeOffset(index);
+
+      for (SizeValueType x = 0; x < lineLength; ++x)
+      {
+        AccumulateRealType sum = NumericTraits<AccumulateRealType>::ZeroValue();
+        for (unsigned int k = 0; k < TableType::Size; ++k)
+        {
+          sum += static_cast<AccumulateRealType>(coefficients[k] *
+                                                 static_cast<InputPixelRealType>(in[x + bufferOffsets[k]]));
+        }
+        out[x] = static_cast<OutputImagePixelType>(static_cast<OutputPixelType>(sum));
+      }
+
+      // Move to the next line, carrying to the higher dimensions.
+      for (unsigned int i = 1; i < ImageDimension; ++i)
+      {
+        if (static_cast<SizeValueType>(++index[i] - region.GetIndex(i)) < region.GetSize(i))
+        {
+          break;
+        }
+        index[i] = region.GetIndex(i);
+      }
+    }
+  }
+};
+} // end namespace itk
+
+#endif
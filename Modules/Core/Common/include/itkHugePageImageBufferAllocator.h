@@ -0,0 +1,78 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkHugePageImageBufferAllocator_h
+#define itkHugePageImageBufferAllocator_h
+
+#include "itkAlignedImageBufferAllocator.h"
+
+namespace itk
+{
+/** \class HugePageImageBufferAllocator
+ * \brief Allocates pixel buffers backed by transparent huge pages.
+ *
+ * Buffers of at least GetMinimumBufferSize() bytes are aligned to the
+ * huge page size (2 MiB) and, on Linux, madvise(MADV_HUGEPAGE) asks the
+ * kernel to back them by transparent huge pages. This reduces the number
+ * of TLB misses when traversing large volumes. Smaller buffers, and all
+ * buffers on other platforms, are allocated like by the
+ * AlignedImageBufferAllocator superclass.
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT HugePageImageBufferAllocator : public AlignedImageBufferAllocator
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(HugePageImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = HugePageImageBufferAllocator;
+  using Superclass = AlignedImageBufferAllocator;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(HugePageImageBufferAllocator, AlignedImageBufferAllocator);
+
+  void *
+  Allocate(SizeValueType numberOfBytes) override;
+
+  /** The size of a transparent huge page on x86-64 and AArch64 Linux. */
+  static constexpr SizeValueType HugePageSize = 2 * 1024 * 1024;
+
+  /** Set/Get the size (in bytes) from which buffers are backed by huge
+   * pages. Defaults to HugePageSize. */
+  itkSetMacro(MinimumBufferSize, SizeValueType);
+  itkGetConstMacro(MinimumBufferSize, SizeValueType);
+
+protected:
+  HugePageImageBufferAllocator() = default;
+  ~HugePageImageBufferAllocator() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  SizeValueType m_MinimumBufferSize{ HugePageSize };
+};
+
+} // end namespace itk
+
+#endif
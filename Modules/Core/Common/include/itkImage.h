@@ -320,6 +320,13 @@ public:
   unsigned int
   GetNumberOfComponentsPerPixel() const override;
 
+  /** Get the number of bytes of the pixels of the RequestedRegion. */
+  SizeValueType
+  GetRequestedRegionSizeInBytes() const override
+  {
+    return this->GetRequestedRegion().GetNumberOfPixels() * sizeof(typename PixelContainer::Element);
+  }
+
   /** Returns (image1 == image2).
    * \note `operator==` and `operator!=` are defined as function templates
    * (rather than as non-templates), just to allow template instantiation of
@@ -70,7 +70,15 @@ Image<TPixel, VImageDimension>::Initialize()
   // Replace the handle to the buffer. This is the safest thing to do,
   // since the same container can be shared by multiple images (e.g.
   // Grafted outputs and in place filters).
+  // Keep the memory placement policy and the allocator which were set
+  // for this image.
+  const PixelContainerPointer previousBuffer = m_Buffer;
   m_Buffer = PixelContainer::New();
+  if (previousBuffer)
+  {
+    m_Buffer->SetMemoryPlacement(previousBuffer->GetMemoryPlacement());
+    m_Buffer->SetAllocator(previousBuffer->GetModifiableAllocator());
+  }
 }
 
 
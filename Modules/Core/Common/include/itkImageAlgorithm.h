@@ -19,6 +19,8 @@
 #define itkImageAlgorithm_h
 
 #include "itkImageRegionIterator.h"
+#include "itkComponentConverter.h"
+#include "itkFixedArray.h"
 
 #include <type_traits>
 
@@ -28,6 +30,9 @@ namespace itk
 template <typename TPixelType, unsigned int VImageDimension>
 class VectorImage;
 
+template <typename TPixelType, unsigned int VImageDimension>
+class PlanarVectorImage;
+
 
 /** \class ImageAlgorithm
  *  \brief A container of static functions which can operate on Images
@@ -111,6 +116,36 @@ struct ImageAlgorithm
       std::is_convertible<typename _ImageType1::PixelType, typename _ImageType2::PixelType>());
   }
 
+  template <typename TPixel1, typename TPixel2, unsigned int VImageDimension>
+  static void
+  Copy(const VectorImage<TPixel1, VImageDimension> *                            inImage,
+       PlanarVectorImage<TPixel2, VImageDimension> *                            outImage,
+       const typename VectorImage<TPixel1, VImageDimension>::RegionType &       inRegion,
+       const typename PlanarVectorImage<TPixel2, VImageDimension>::RegionType & outRegion)
+  {
+    ImageAlgorithm::DispatchedComponentCopy(inImage, outImage, inRegion, outRegion);
+  }
+
+  template <typename TPixel1, typename TPixel2, unsigned int VImageDimension>
+  static void
+  Copy(const PlanarVectorImage<TPixel1, VImageDimension> *                      inImage,
+       VectorImage<TPixel2, VImageDimension> *                                  outImage,
+       const typename PlanarVectorImage<TPixel1, VImageDimension>::RegionType & inRegion,
+       const typename VectorImage<TPixel2, VImageDimension>::RegionType &       outRegion)
+  {
+    ImageAlgorithm::DispatchedComponentCopy(inImage, outImage, inRegion, outRegion);
+  }
+
+  template <typename TPixel1, typename TPixel2, unsigned int VImageDimension>
+  static void
+  Copy(const PlanarVectorImage<TPixel1, VImageDimension> *                      inImage,
+       PlanarVectorImage<TPixel2, VImageDimension> *                            outImage,
+       const typename PlanarVectorImage<TPixel1, VImageDimension>::RegionType & inRegion,
+       const typename PlanarVectorImage<TPixel2, VImageDimension>::RegionType & outRegion)
+  {
+    ImageAlgorithm::DispatchedComponentCopy(inImage, outImage, inRegion, outRegion);
+  }
+
   /// \endcond
 
   /**
@@ -155,6 +190,17 @@ private:
                  FalseType                                    isSpecialized = FalseType());
 
 
+  /** Copy the components of the pixels of images whose components are
+   * stored with strides, interleaved as in VectorImage or in planes as in
+   * PlanarVectorImage, one line at a time.
+   */
+  template <typename InputImageType, typename OutputImageType>
+  static void
+  DispatchedComponentCopy(const InputImageType *                       inImage,
+                          OutputImageType *                            outImage,
+                          const typename InputImageType::RegionType &  inRegion,
+                          const typename OutputImageType::RegionType & outRegion);
+
   /** A utility class to get the number of internal pixels to make up
    * a pixel.
    */
@@ -182,6 +228,47 @@ private:
   };
   /// \endcond
 
+  /** A utility class to get the distances, in internal pixels, between the
+   * first components of two consecutive pixels, and between two
+   * consecutive components of a pixel.
+   */
+  template <typename TImageType>
+  struct ComponentStrides;
+
+  /// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+  template <typename TPixelType, unsigned int VImageDimension>
+  struct ComponentStrides<VectorImage<TPixelType, VImageDimension>>
+  {
+    using ImageType = VectorImage<TPixelType, VImageDimension>;
+    static SizeValueType
+    GetPixelStride(const ImageType * i)
+    {
+      return i->GetNumberOfComponentsPerPixel();
+    }
+    static SizeValueType
+    GetComponentStride(const ImageType *)
+    {
+      return 1;
+    }
+  };
+
+  template <typename TPixelType, unsigned int VImageDimension>
+  struct ComponentStrides<PlanarVectorImage<TPixelType, VImageDimension>>
+  {
+    using ImageType = PlanarVectorImage<TPixelType, VImageDimension>;
+    static SizeValueType
+    GetPixelStride(const ImageType *)
+    {
+      return 1;
+    }
+    static SizeValueType
+    GetComponentStride(const ImageType * i)
+    {
+      return i->GetComponentStride();
+    }
+  };
+  /// \endcond
+
   /** Unary functor just for static_cast operator */
   template <typename TInputType, typename TOutputType>
   struct StaticCast
@@ -210,9 +297,69 @@ private:
   static TOutputType *
   CopyHelper(const TInputType * first, const TInputType * last, TOutputType * result)
   {
-    return std::transform(first, last, result, StaticCast<TInputType, TOutputType>());
+    return ConvertHelper(first, last, result, ComponentsAreConvertible<TInputType, TOutputType>());
   }
   /// \endcond
+
+  /** The fixed size array, e.g. the RGBPixel or Vector, of which a pixel
+   * type derives, or void. Only used to deduce the type. */
+  template <typename TValue, unsigned int VLength>
+  static FixedArray<TValue, VLength>
+  FixedArrayBase(const FixedArray<TValue, VLength> *);
+  static void
+  FixedArrayBase(const void *);
+
+  /** The components of a pixel: a scalar has one component, and a fixed
+   * size array has Length components when it has no other member. */
+  template <typename TPixel, typename TArray = decltype(FixedArrayBase(static_cast<const TPixel *>(nullptr)))>
+  struct PixelComponents
+  {
+    using ValueType = typename TArray::ValueType;
+    static constexpr unsigned int Length = sizeof(TPixel) == sizeof(TArray) ? TArray::Length : 0;
+  };
+
+  /// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+  template <typename TPixel>
+  struct PixelComponents<TPixel, void>
+  {
+    using ValueType = TPixel;
+    static constexpr unsigned int Length = 1;
+  };
+  /// \endcond
+
+  /** Whether the pixels are converted as arrays of components by
+   * ComponentConverter, which is equivalent to their static_cast. */
+  template <typename TInputType, typename TOutputType>
+  using ComponentsAreConvertible =
+    std::integral_constant<bool,
+                           PixelComponents<TInputType>::Length != 0 &&
+                             PixelComponents<TInputType>::Length == PixelComponents<TOutputType>::Length &&
+                             ComponentConverter::IsSupported<typename PixelComponents<TInputType>::ValueType,
+                                                             typename PixelComponents<TOutputType>::ValueType>()>;
+
+  /** Convert the pixels with std::transform. */
+  template <typename TInputType, typename TOutputType>
+  static TOutputType *
+  ConvertHelper(const TInputType * first, const TInputType * last, TOutputType * result, FalseType)
+  {
+    return std::transform(first, last, result, StaticCast<TInputType, TOutputType>());
+  }
+
+  /** Convert the components of the pixels with ComponentConverter. */
+  template <typename TInputType, typename TOutputType>
+  static TOutputType *
+  ConvertHelper(const TInputType * first, const TInputType * last, TOutputType * result, TrueType)
+  {
+    using InputComponentType = typename PixelComponents<TInputType>::ValueType;
+    using OutputComponentType = typename PixelComponents<TOutputType>::ValueType;
+    constexpr unsigned int Length = PixelComponents<TInputType>::Length;
+
+    const auto * const inputComponents = reinterpret_cast<const InputComponentType *>(first);
+    ComponentConverter::Convert(inputComponents,
+                                inputComponents + Length * static_cast<size_t>(last - first),
+                                reinterpret_cast<OutputComponentType *>(result));
+    return result + (last - first);
+  }
 };
 } // end namespace itk
 
@@ -168,6 +168,75 @@ ImageAlgorithm::DispatchedCopy(const InputImageType *                       inIm
 }
 
 
+template <typename InputImageType, typename OutputImageType>
+void
+ImageAlgorithm::DispatchedComponentCopy(const InputImageType *                       inImage,
+                                        OutputImageType *                            outImage,
+                                        const typename InputImageType::RegionType &  inRegion,
+                                        const typename OutputImageType::RegionType & outRegion)
+{
+  using InputComponentType = typename InputImageType::InternalPixelType;
+  using OutputComponentType = typename OutputImageType::InternalPixelType;
+  constexpr unsigned int ImageDimension = InputImageType::ImageDimension;
+
+  const unsigned int numberOfComponents = inImage->GetNumberOfComponentsPerPixel();
+  if (inRegion.GetSize() != outRegion.GetSize() || numberOfComponents != outImage->GetNumberOfComponentsPerPixel())
+  {
+    ImageAlgorithm::DispatchedCopy<InputImageType, OutputImageType>(inImage, outImage, inRegion, outRegion);
+    return;
+  }
+  if (inRegion.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  const SizeValueType inPixelStride = ComponentStrides<InputImageType>::GetPixelStride(inImage);
+  const SizeValueType inComponentStride = ComponentStrides<InputImageType>::GetComponentStride(inImage);
+  const SizeValueType outPixelStride = ComponentStrides<OutputImageType>::GetPixelStride(outImage);
+  const SizeValueType outComponentStride = ComponentStrides<OutputImageType>::GetComponentStride(outImage);
+  const SizeValueType lineLength = inRegion.GetSize(0);
+
+  Offset<ImageDimension> position{};
+  while (true)
+  {
+    const InputComponentType * const in =
+      inImage->GetBufferPointer() + inImage->ComputeOffset(inRegion.GetIndex() + position) * inPixelStride;
+    OutputComponentType * const out =
+      outImage->GetBufferPointer() + outImage->ComputeOffset(outRegion.GetIndex() + position) * outPixelStride;
+
+    for (unsigned int k = 0; k < numberOfComponents; ++k)
+    {
+      const InputComponentType * const inComponent = in + k * inComponentStride;
+      OutputComponentType * const      outComponent = out + k * outComponentStride;
+      if (inPixelStride == 1 && outPixelStride == 1)
+      {
+        CopyHelper(inComponent, inComponent + lineLength, outComponent);
+      }
+      else
+      {
+        for (SizeValueType i = 0; i < lineLength; ++i)
+        {
+          outComponent[i * outPixelStride] = static_cast<OutputComponentType>(inComponent[i * inPixelStride]);
+        }
+      }
+    }
+
+    // Move to the next line, carrying to the higher dimensions.
+    unsigned int dimension = 1;
+    while (dimension < ImageDimension &&
+           static_cast<SizeValueType>(++position[dimension]) == inRegion.GetSize(dimension))
+    {
+      position[dimension] = 0;
+      ++dimension;
+    }
+    if (dimension >= ImageDimension)
+    {
+      return;
+    }
+  }
+}
+
+
 template <typename InputImageType, typename OutputImageType>
 typename OutputImageType::RegionType
 ImageAlgorithm::EnlargeRegionOverBox(const typename InputImageType::RegionType & inputRegion,
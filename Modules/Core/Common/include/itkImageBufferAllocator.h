@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferAllocator_h
+#define itkImageBufferAllocator_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include "itkIntTypes.h"
+#include <string>
+
+namespace itk
+{
+/** \class ImageBufferAllocator
+ * \brief Abstract base class of the allocators of pixel buffers.
+ *
+ * An ImageBufferAllocator provides the raw memory of the buffers managed
+ * by ImportImageContainer, and therefore of the pixel containers of
+ * Image and VectorImage. The container constructs and destroys the
+ * elements itself, the allocator only deals with bytes.
+ *
+ * Subclasses guarantee a minimum alignment of the buffers they return,
+ * which filters can query through the pixel container, in order to
+ * select a fast path using aligned loads and stores. Users may derive
+ * their own allocators, for example to serve buffers from an arena.
+ *
+ * The allocator used by newly constructed pixel containers is set by
+ * SetGlobalDefaultAllocator(). When no global default allocator is set,
+ * containers keep allocating their buffers with operator new[].
+ *
+ * \sa AlignedImageBufferAllocator
+ * \sa HugePageImageBufferAllocator
+ * \sa ImageBufferPool
+ * \sa MemoryMappedImageBufferAllocator
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferAllocator : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = ImageBufferAllocator;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageBufferAllocator, Object);
+
+  /** Allocate an uninitialized buffer of the given number of bytes,
+   * aligned to at least GetAlignment() bytes. Returns nullptr when the
+   * memory cannot be allocated. Must be thread safe. */
+  virtual void *
+  Allocate(SizeValueType numberOfBytes) = 0;
+
+  /** Release a buffer previously returned by Allocate() for the same
+   * number of bytes. Must be thread safe. */
+  virtual void
+  Deallocate(void * buffer, SizeValueType numberOfBytes) = 0;
+
+  /** Get the alignment (in bytes, a power of two) of the buffers
+   * returned by Allocate(). */
+  virtual SizeValueType
+  GetAlignment() const = 0;
+
+  /** Tell whether the buffers returned by Allocate() hold data already,
+   * e.g. the contents of a mapped file. Unless they are asked to
+   * initialize them, pixel containers neither construct the elements of
+   * such buffers nor place their pages, which would overwrite the data.
+   * Returns false by default. */
+  virtual bool
+  GetBuffersHoldData() const
+  {
+    return false;
+  }
+
+  /** Set/Get the allocator with which new pixel containers are
+   * constructed. The initial value is determined by environment variable
+   * ITK_GLOBAL_DEFAULT_IMAGE_BUFFER_ALLOCATOR: "Aligned" selects an
+   * AlignedImageBufferAllocator, "HugePage" a HugePageImageBufferAllocator,
+   * "Pool" an ImageBufferPool and "MemoryMapped" a
+   * MemoryMappedImageBufferAllocator creating scratch files. Otherwise, it
+   * is nullptr, meaning that buffers are allocated by operator new[]. */
+  static void
+  SetGlobalDefaultAllocator(Self * allocator);
+  static Pointer
+  GetGlobalDefaultAllocator();
+
+  /** Create an allocator from its name, as accepted by the environment
+   * variable ITK_GLOBAL_DEFAULT_IMAGE_BUFFER_ALLOCATOR (case insensitive).
+   * Returns nullptr for unknown names and for "New". */
+  static Pointer
+  CreateAllocatorFromString(std::string allocatorString);
+
+  /** Tell whether the address is a multiple of the alignment. */
+  static bool
+  IsAligned(const void * buffer, SizeValueType alignment)
+  {
+    return alignment != 0 && reinterpret_cast<uintptr_t>(buffer) % alignment == 0;
+  }
+
+protected:
+  ImageBufferAllocator() = default;
+  ~ImageBufferAllocator() override = default;
+};
+
+} // end namespace itk
+
+#endif
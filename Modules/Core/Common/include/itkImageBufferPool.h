@@ -0,0 +1,176 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferPool_h
+#define itkImageBufferPool_h
+
+#include "itkImageBufferAllocator.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace itk
+{
+/** \class ImageBufferPool
+ * \brief Recycles the pixel buffers released by pixel containers.
+ *
+ * An ImageBufferPool is an ImageBufferAllocator which keeps the buffers
+ * it is given back, instead of releasing them to its upstream allocator,
+ * and hands them out again to subsequent allocations of the same number
+ * of bytes and alignment. Pipelines which repeatedly process images of
+ * the same size then stop paying for the allocation and the page faults
+ * of their intermediate buffers: buffers freed by ReleaseDataFlag,
+ * ReleaseDataBeforeUpdateFlag, or by destroying an image are reused by
+ * the next ImageSource::AllocateOutputs() call.
+ *
+ * To use the pool for all images, make it the global default allocator:
+ * \code
+ * auto pool = itk::ImageBufferPool::New();
+ * pool->SetMaximumCachedBytes(4ULL << 30);
+ * itk::ImageBufferAllocator::SetGlobalDefaultAllocator(pool);
+ * \endcode
+ * or set the environment variable ITK_GLOBAL_DEFAULT_IMAGE_BUFFER_ALLOCATOR
+ * to "Pool".
+ *
+ * The bytes kept in the pool are bounded by SetMaximumCachedBytes(). When
+ * a released buffer does not fit, the least recently released buffers are
+ * returned to the upstream allocator first. Trim() explicitly releases
+ * cached buffers. A recycled buffer is not cleared, unless its container
+ * is asked to initialize its elements.
+ *
+ * All methods are thread safe.
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferPool : public ImageBufferAllocator
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageBufferPool);
+
+  /** Standard class type aliases. */
+  using Self = ImageBufferPool;
+  using Superclass = ImageBufferAllocator;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageBufferPool, ImageBufferAllocator);
+
+  void *
+  Allocate(SizeValueType numberOfBytes) override;
+
+  /** Cache the buffer for reuse, or release it to the allocator which
+   * allocated it. A buffer which was not allocated by the pool is released
+   * to the upstream allocator. */
+  void
+  Deallocate(void * buffer, SizeValueType numberOfBytes) override;
+
+  SizeValueType
+  GetAlignment() const override;
+
+  /** Set/Get the allocator of the buffers which are not found in the pool.
+   * Defaults to an AlignedImageBufferAllocator. Setting another allocator
+   * releases all cached buffers, while the buffers in use are released to
+   * the allocator which provided them when they are deallocated. */
+  void
+  SetUpstreamAllocator(ImageBufferAllocator * allocator);
+  ImageBufferAllocator *
+  GetUpstreamAllocator() const;
+
+  /** Set/Get the maximum number of bytes of the buffers kept in the pool
+   * for reuse. Defaults to 1 GiB. Lowering it trims the pool. */
+  void
+  SetMaximumCachedBytes(SizeValueType numberOfBytes);
+  SizeValueType
+  GetMaximumCachedBytes() const;
+
+  /** Release cached buffers to the upstream allocator, least recently
+   * released first, until at most maximumCachedBytes bytes are cached.
+   * Trim() releases all of them. */
+  void
+  Trim(SizeValueType maximumCachedBytes = 0);
+
+  /** Get the number of bytes of the buffers currently kept in the pool. */
+  SizeValueType
+  GetCachedBytes() const;
+
+  /** Get the number of bytes of the buffers currently in use, i.e.
+   * allocated and not yet deallocated. */
+  SizeValueType
+  GetBytesInUse() const;
+
+  /** Get the highest number of bytes obtained from the upstream allocator
+   * at the same time, i.e. in use plus cached. */
+  SizeValueType
+  GetPeakBytes() const;
+
+  /** Get the number of allocations served from the pool (hits) and by
+   * the upstream allocator (misses). */
+  SizeValueType
+  GetNumberOfHits() const;
+  SizeValueType
+  GetNumberOfMisses() const;
+
+  /** Reset the numbers of hits and misses, and the peak bytes to the
+   * current number of bytes obtained from the upstream allocator. */
+  void
+  ResetStatistics();
+
+protected:
+  ImageBufferPool();
+  ~ImageBufferPool() override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  struct CachedBuffer
+  {
+    void *                        m_Buffer;
+    SizeValueType                 m_NumberOfBytes;
+    SizeValueType                 m_Alignment;
+    ImageBufferAllocator::Pointer m_Allocator;
+  };
+
+  /** Release the least recently released buffers until at most
+   * maximumCachedBytes are cached. The mutex must be locked. */
+  void
+  TrimWithLock(SizeValueType maximumCachedBytes);
+
+  mutable std::mutex            m_Mutex;
+  ImageBufferAllocator::Pointer m_UpstreamAllocator;
+
+  /** The cached buffers, the most recently released one first. */
+  std::list<CachedBuffer> m_CachedBuffers;
+
+  /** The allocators of the buffers in use. */
+  std::unordered_map<void *, ImageBufferAllocator::Pointer> m_BuffersInUse;
+
+  SizeValueType m_MaximumCachedBytes{ SizeValueType{ 1 } << 30 };
+  SizeValueType m_CachedBytes{ 0 };
+  SizeValueType m_BytesInUse{ 0 };
+  SizeValueType m_PeakBytes{ 0 };
+  SizeValueType m_NumberOfHits{ 0 };
+  SizeValueType m_NumberOfMisses{ 0 };
+};
+
+} // end namespace itk
+
+#endif
@@ -60,6 +60,10 @@ namespace itk
    }
    \endcode
  *
+ * For a VectorImage, the iterators return a VariableLengthVectorReference to
+ * the components of the pixel, so that the pixels are read, assigned, and
+ * modified in place without allocating a VariableLengthVector.
+ *
  * \author Niels Dekker, LKEB, Leiden University Medical Center
  *
  * \see ImageIterator
@@ -87,6 +91,14 @@ private:
     std::is_same<typename TImage::AccessorType, DefaultPixelAccessor<PixelType>>::value &&
     std::is_same<AccessorFunctorType, DefaultPixelAccessorFunctor<std::remove_const_t<TImage>>>::value;
 
+  // Tells whether or not the pixels are the variable length vectors of a
+  // VectorImage. If so, iterator::operator*() returns a
+  // VariableLengthVectorReference to the components of the pixel, which
+  // supports arithmetic without copying them.
+  constexpr static bool SupportsVectorPixelReference =
+    std::is_same<typename TImage::AccessorType, DefaultVectorPixelAccessor<InternalPixelType>>::value &&
+    std::is_same<AccessorFunctorType, DefaultVectorPixelAccessorFunctor<std::remove_const_t<TImage>>>::value;
+
   // Tells whether or not this range is using a pointer as iterator.
   constexpr static bool UsingPointerAsIterator = SupportsDirectPixelAccess;
 
@@ -269,6 +281,23 @@ private:
     };
 
 
+    // Wraps the reference to the components of a pixel of a VectorImage,
+    // retrieved by the AccessorFunctor.
+    class VectorPixelReferenceWrapper final
+    {
+    public:
+      VariableLengthVectorReference<QualifiedInternalPixelType> m_Reference;
+
+      explicit VectorPixelReferenceWrapper(QualifiedInternalPixelType &        internalPixel,
+                                           const OptionalAccessorFunctorType & accessorFunctor) noexcept
+        : m_Reference(accessorFunctor.GetReference(internalPixel))
+      {}
+
+      // Converts implicitly to the reference.
+      operator VariableLengthVectorReference<QualifiedInternalPixelType>() const noexcept { return m_Reference; }
+    };
+
+
     // QualifiedIterator data members (strictly private):
 
     // The accessor functor of the image.
@@ -291,7 +320,12 @@ private:
     // Types conforming the iterator requirements of the C++ standard library:
     using difference_type = std::ptrdiff_t;
     using value_type = PixelType;
-    using reference = std::conditional_t<SupportsDirectPixelAccess, QualifiedPixelType &, PixelProxy<IsImageTypeConst>>;
+    using reference = std::conditional_t<
+      SupportsDirectPixelAccess,
+      QualifiedPixelType &,
+      std::conditional_t<SupportsVectorPixelReference,
+                         VariableLengthVectorReference<QualifiedInternalPixelType>,
+                         PixelProxy<IsImageTypeConst>>>;
     using pointer = QualifiedPixelType *;
     using iterator_category = std::random_access_iterator_tag;
 
@@ -323,7 +357,10 @@ private:
     {
       assert(m_InternalPixelPointer != nullptr);
 
-      using PixelWrapper = std::conditional_t<SupportsDirectPixelAccess, PixelReferenceWrapper, reference>;
+      using PixelWrapper = std::conditional_t<
+        SupportsDirectPixelAccess,
+        PixelReferenceWrapper,
+        std::conditional_t<SupportsVectorPixelReference, VectorPixelReferenceWrapper, reference>>;
 
       return PixelWrapper{ *m_InternalPixelPointer, m_OptionalAccessorFunctor };
     }
@@ -0,0 +1,159 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageReduceFilter_h
+#define itkImageReduceFilter_h
+
+#include "itkImageSink.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace itk
+{
+
+/** \class ImageReduceFilter
+ * \brief Base class for the filters which reduce an image to an
+ * accumulator, e.g. statistics or a histogram, in parallel.
+ *
+ * The region of each streamed chunk of the input is split into blocks
+ * along its slowest dimensions. Each block is accumulated by
+ * AccumulateRegion() into its own accumulator, made by MakeAccumulator(),
+ * and the accumulators of the blocks are merged by MergeAccumulators()
+ * pairwise, along a binary tree. The blocks are processed by the work
+ * units of the MultiThreaderBase, and the levels of the tree are merged
+ * in parallel, so that no lock is held.
+ *
+ * The blocks, and the shape of the tree, only depend on the region of the
+ * chunk, MinimumNumberOfPixelsPerBlock and MaximumNumberOfBlocks, and not
+ * on the number of work units: floating point sums are the same whatever
+ * the number of threads. The accumulators are padded so that the
+ * accumulators of neighboring blocks do not share a cache line.
+ *
+ * A subclass implements AccumulateRegion() and MergeAccumulators(), and
+ * reads the accumulator of the whole input with GetAccumulator() in
+ * AfterStreamedGenerateData(). TAccumulator must be default
+ * constructible and movable.
+ *
+ * \ingroup ITKCommon
+ */
+template <typename TInputImage, typename TAccumulator>
+class ITK_TEMPLATE_EXPORT ImageReduceFilter : public ImageSink<TInputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageReduceFilter);
+
+  /** Standard class type aliases. */
+  using Self = ImageReduceFilter;
+  using Superclass = ImageSink<TInputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageReduceFilter, ImageSink);
+
+  /** Some convenient type alias. */
+  using InputImageType = TInputImage;
+  using InputImageRegionType = typename Superclass::InputImageRegionType;
+  using AccumulatorType = TAccumulator;
+
+  /** Set/Get the maximum number of blocks of a streamed chunk, which bounds
+   * the number of accumulators. Defaults to 256. */
+  itkSetClampMacro(MaximumNumberOfBlocks, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(MaximumNumberOfBlocks, unsigned int);
+
+  /** Set/Get the minimum number of pixels of a block, unless the chunk is
+   * smaller. Defaults to 4096. */
+  itkSetClampMacro(MinimumNumberOfPixelsPerBlock, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(MinimumNumberOfPixelsPerBlock, SizeValueType);
+
+protected:
+  ImageReduceFilter() = default;
+  ~ImageReduceFilter() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Returns the identity of the reduction, into which a block is
+   * accumulated. */
+  virtual AccumulatorType
+  MakeAccumulator()
+  {
+    return AccumulatorType();
+  }
+
+  /** Returns the number of blocks requested for the region of a chunk: the
+   * number of pixels of the region divided by MinimumNumberOfPixelsPerBlock,
+   * up to MaximumNumberOfBlocks. The region may be split into fewer blocks.
+   * A subclass whose merges are exact whatever their order, e.g. integer
+   * counts, may request fewer blocks to save the memory of the
+   * accumulators. */
+  virtual unsigned int
+  GetRequestedNumberOfBlocks(const InputImageRegionType & region) const;
+
+  /** Accumulates the pixels of a region of the input. It is called
+   * concurrently, for different blocks. */
+  virtual void
+  AccumulateRegion(const InputImageRegionType & region, AccumulatorType & accumulator) = 0;
+
+  /** Merges the second accumulator into the first one, whose block precedes
+   * the block of the second one. The second one may be moved from. */
+  virtual void
+  MergeAccumulators(AccumulatorType & accumulator, AccumulatorType & other) = 0;
+
+  /** Accumulates the blocks of the chunk, and merges them into the
+   * accumulator of the previous chunks. */
+  void
+  StreamedGenerateData(unsigned int inputRequestedRegionNumber) override;
+
+  /** Not called: the regions of the blocks are passed to
+   * AccumulateRegion(). */
+  void
+  ThreadedStreamedGenerateData(const InputImageRegionType &) final
+  {}
+
+  /** Get the accumulator of the chunks streamed so far. */
+  AccumulatorType &
+  GetAccumulator()
+  {
+    return m_Accumulator;
+  }
+  const AccumulatorType &
+  GetAccumulator() const
+  {
+    return m_Accumulator;
+  }
+
+private:
+  struct AccumulatorHolder
+  {
+    AccumulatorType m_Accumulator;
+  };
+  itkPadStruct(ITK_CACHE_LINE_ALIGNMENT, AccumulatorHolder, PaddedAccumulatorHolder);
+
+  unsigned int  m_MaximumNumberOfBlocks{ 256 };
+  SizeValueType m_MinimumNumberOfPixelsPerBlock{ 4096 };
+
+  AccumulatorType m_Accumulator;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkImageReduceFilter.hxx"
+#endif
+
+#endif
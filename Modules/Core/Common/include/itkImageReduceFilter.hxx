@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageReduceFilter_hxx
+#define itkImageReduceFilter_hxx
+
+#include "itkImageReduceFilter.h"
+#include "itkImageRegionSplitterSlowDimension.h"
+#include "itkProgressTransformer.h"
+
+namespace itk
+{
+
+template <typename TInputImage, typename TAccumulator>
+unsigned int
+ImageReduceFilter<TInputImage, TAccumulator>::GetRequestedNumberOfBlocks(const InputImageRegionType & region) const
+{
+  const SizeValueType numberOfBlocks = region.GetNumberOfPixels() / m_MinimumNumberOfPixelsPerBlock;
+  return static_cast<unsigned int>(
+    std::max(std::min(numberOfBlocks, SizeValueType{ m_MaximumNumberOfBlocks }), SizeValueType{ 1 }));
+}
+
+template <typename TInputImage, typename TAccumulator>
+void
+ImageReduceFilter<TInputImage, TAccumulator>::StreamedGenerateData(unsigned int inputRequestedRegionNumber)
+{
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+
+  // calculate the progress range for this streamed chunk
+  const unsigned int  total = this->GetNumberOfInputRequestedRegions();
+  const float         oldProgress = float(inputRequestedRegionNumber) / (total);
+  const float         newProgress = float(inputRequestedRegionNumber + 1) / (total);
+  ProgressTransformer pt(oldProgress, newProgress, this);
+
+  // The blocks do not depend on the number of work units, so neither do the
+  // results.
+  const InputImageRegionType & region = this->GetCurrentInputRegion();
+  const auto                   splitter = ImageRegionSplitterSlowDimension::New();
+  const unsigned int           numberOfBlocks =
+    splitter->GetNumberOfSplits(region, this->GetRequestedNumberOfBlocks(region));
+
+  std::vector<PaddedAccumulatorHolder> holders(numberOfBlocks);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfBlocks,
+    [this, &region, &splitter, &holders, numberOfBlocks](SizeValueType block) {
+      InputImageRegionType blockRegion = region;
+      splitter->GetSplit(static_cast<unsigned int>(block), numberOfBlocks, blockRegion);
+      AccumulatorType & accumulator = holders[block].m_Accumulator;
+      accumulator = this->MakeAccumulator();
+      this->AccumulateRegion(blockRegion, accumulator);
+    },
+    pt.GetProcessObject());
+
+  // Merge the accumulators pairwise, the pairs of a level of the tree in
+  // parallel, so that holders[0] accumulates all the blocks.
+  for (SizeValueType stride = 1; stride < numberOfBlocks; stride *= 2)
+  {
+    const SizeValueType numberOfPairs = (numberOfBlocks + stride - 1) / (2 * stride);
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfPairs,
+      [this, &holders, stride](SizeValueType pair) {
+        const SizeValueType block = 2 * stride * pair;
+        this->MergeAccumulators(holders[block].m_Accumulator, holders[block + stride].m_Accumulator);
+      },
+      nullptr);
+  }
+
+  if (inputRequestedRegionNumber == 0)
+  {
+    m_Accumulator = std::move(holders[0].m_Accumulator);
+  }
+  else
+  {
+    this->MergeAccumulators(m_Accumulator, holders[0].m_Accumulator);
+  }
+}
+
+template <typename TInputImage, typename TAccumulator>
+void
+ImageReduceFilter<TInputImage, TAccumulator>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "MaximumNumberOfBlocks: " << m_MaximumNumberOfBlocks << std::endl;
+  os << indent << "MinimumNumberOfPixelsPerBlock: " << m_MinimumNumberOfPixelsPerBlock << std::endl;
+}
+
+} // end namespace itk
+
+#endif
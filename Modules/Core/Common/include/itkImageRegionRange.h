@@ -59,6 +59,9 @@ namespace itk
    }
    \endcode
  *
+ * Like ImageBufferRange, the iterators return a VariableLengthVectorReference
+ * to the pixels of a VectorImage.
+ *
  * \author Niels Dekker, LKEB, Leiden University Medical Center
  *
  * \see ImageRegionIterator
@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageRegionSplitterZOrderTile_h
+#define itkImageRegionSplitterZOrderTile_h
+
+#include "itkImageRegionSplitterBase.h"
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+/** \class ImageRegionSplitterZOrderTile
+ * \brief Divide an image region into cache-sized tiles, in Z-order
+ *
+ * ImageRegionSplitterZOrderTile divides an ImageRegion into tiles small
+ * enough for the data a filter accesses while computing a tile to fit in
+ * a given number of bytes, typically the size of a core's L2 cache. The
+ * working set of a tile is estimated as GetBytesPerPixel() times its
+ * number of pixels.
+ *
+ * The region is halved along its longest dimension, repeatedly, until the
+ * tiles fit, so that the tiles are close to cubes. The split i is the
+ * tile whose grid coordinates interleave the bits of i (Morton order,
+ * also called Z-order), so that consecutive splits are neighbors, and a
+ * run of consecutive splits forms a compact block, sharing the rows of
+ * the input neighborhoods.
+ *
+ * When fewer pieces are requested than the number of tiles needed, the
+ * tiles are made larger. Therefore, this splitter is meant to be queried
+ * for a large number of pieces, which a multi-threader then processes as
+ * many small work units, as done by ImageSource when its
+ * GetDynamicImageRegionSplitter() returns such a splitter.
+ *
+ * \sa ImageToImageFilter::SetCacheBlocking
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+
+class ITKCommon_EXPORT ImageRegionSplitterZOrderTile : public ImageRegionSplitterBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageRegionSplitterZOrderTile);
+
+  /** Standard class type aliases. */
+  using Self = ImageRegionSplitterZOrderTile;
+  using Superclass = ImageRegionSplitterBase;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageRegionSplitterZOrderTile, ImageRegionSplitterBase);
+
+  /** Set/Get the maximum working set of a tile, in bytes. Defaults to
+   * 256 KiB. */
+  itkSetClampMacro(TileSizeInBytes, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(TileSizeInBytes, SizeValueType);
+
+  /** Set/Get the number of bytes accessed per pixel of a tile, e.g. the
+   * sum of the sizes of an input and an output pixel. Defaults to 8. */
+  itkSetClampMacro(BytesPerPixel, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(BytesPerPixel, SizeValueType);
+
+protected:
+  ImageRegionSplitterZOrderTile();
+
+  unsigned int
+  GetNumberOfSplitsInternal(unsigned int         dim,
+                            const IndexValueType regionIndex[],
+                            const SizeValueType  regionSize[],
+                            unsigned int         requestedNumber) const override;
+
+  unsigned int
+  GetSplitInternal(unsigned int   dim,
+                   unsigned int   i,
+                   unsigned int   numberOfPieces,
+                   IndexValueType regionIndex[],
+                   SizeValueType  regionSize[]) const override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Compute the number of times each dimension is halved, such that the
+   * tiles fit within the byte budget and there are at most requestedNumber
+   * of them. Returns the total number of halvings. */
+  unsigned int
+  ComputeTileLevels(unsigned int        dim,
+                    const SizeValueType regionSize[],
+                    unsigned int        requestedNumber,
+                    unsigned int        levels[]) const;
+
+  SizeValueType m_TileSizeInBytes{ 256 * 1024 };
+  SizeValueType m_BytesPerPixel{ 8 };
+};
+} // end namespace itk
+
+#endif
@@ -186,6 +186,9 @@ protected:
   itkSetObjectMacro(RegionSplitter, SplitterType);
   itkGetModifiableObjectMacro(RegionSplitter, SplitterType);
 
+  /** Get the region of the input streamed by the current call to
+   * StreamedGenerateData(). */
+  itkGetConstReferenceMacro(CurrentInputRegion, InputImageRegionType);
 
 private:
   unsigned int          m_NumberOfStreamDivisions{ 1 };
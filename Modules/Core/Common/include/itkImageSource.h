@@ -360,6 +360,23 @@ protected:
   virtual const ImageRegionSplitterBase *
   GetImageRegionSplitter() const;
 
+  /** \brief Get the image splitter to split the image for dynamic multi-threading.
+   *
+   * With dynamic multi-threading, the requested region is split by the
+   * multi-threader, into about GetNumberOfWorkUnits() pieces, unless this
+   * method returns a splitter. Then the region is split into as many
+   * pieces as this splitter provides, which the multi-threader processes
+   * as an array of work items. The default implementation returns
+   * nullptr.
+   *
+   * \sa ImageRegionSplitterZOrderTile
+   */
+  virtual const ImageRegionSplitterBase *
+  GetDynamicImageRegionSplitter() const
+  {
+    return nullptr;
+  }
+
   /** Split the output's RequestedRegion into "pieces" pieces, returning
    * region "i" as "splitRegion". This method is called concurrently
    * "pieces" times. The  regions must not overlap. The method returns the number
@@ -228,12 +228,32 @@ ImageSource<TOutputImage>::GenerateData()
   {
     this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
     this->GetMultiThreader()->SetUpdateProgress(this->GetThreaderUpdateProgress());
-    this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
-      this->GetOutput()->GetRequestedRegion(),
-      [this](const OutputImageRegionType & outputRegionForThread) {
-        this->DynamicThreadedGenerateData(outputRegionForThread);
-      },
-      this);
+
+    const OutputImageRegionType     requestedRegion = this->GetOutput()->GetRequestedRegion();
+    const ImageRegionSplitterBase * splitter = this->GetDynamicImageRegionSplitter();
+    if (splitter == nullptr)
+    {
+      this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+        requestedRegion,
+        [this](const OutputImageRegionType & outputRegionForThread) {
+          this->DynamicThreadedGenerateData(outputRegionForThread);
+        },
+        this);
+    }
+    else
+    {
+      const unsigned int numberOfPieces =
+        splitter->GetNumberOfSplits(requestedRegion, NumericTraits<unsigned int>::max());
+      this->GetMultiThreader()->ParallelizeArray(
+        0,
+        numberOfPieces,
+        [this, splitter, numberOfPieces, &requestedRegion](SizeValueType piece) {
+          OutputImageRegionType outputRegionForThread = requestedRegion;
+          splitter->GetSplit(static_cast<unsigned int>(piece), numberOfPieces, outputRegionForThread);
+          this->DynamicThreadedGenerateData(outputRegionForThread);
+        },
+        this);
+    }
   }
 
   // Call a method that can be overridden by a subclass to perform
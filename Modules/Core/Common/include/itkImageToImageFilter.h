@@ -32,6 +32,7 @@
 #include "itkConceptChecking.h"
 #include "itkImageToImageFilterDetail.h"
 #include "itkImageToImageFilterCommon.h"
+#include "itkImageRegionSplitterZOrderTile.h"
 
 namespace itk
 {
@@ -216,6 +217,38 @@ public:
   using ImageToImageFilterCommon::SetGlobalDefaultCoordinateTolerance;
   using ImageToImageFilterCommon::GetGlobalDefaultCoordinateTolerance;
 
+  /** get/set whether the output is generated by cache-sized tiles
+   *
+   * When on, and the filter uses dynamic multi-threading, the output
+   * requested region is split into many small tiles, processed in
+   * Z-order, instead of into about one region per work unit. The tiles
+   * are sized such that their input and output pixels fit in
+   * CacheBlockSize bytes, so filters computing each output pixel from a
+   * neighborhood of input pixels find most of these input pixels in the
+   * cache. Off by default; stencil-heavy filters turn it on in their
+   * constructor.
+   *
+   * \sa ImageRegionSplitterZOrderTile
+   */
+  itkSetMacro(CacheBlocking, bool);
+  itkGetConstMacro(CacheBlocking, bool);
+  itkBooleanMacro(CacheBlocking);
+
+  /** get/set the size (in bytes) of the working set of a tile, when
+   * CacheBlocking is on. The number of bytes per pixel is estimated from
+   * the sizes of the input and output pixel types. */
+  itkSetClampMacro(CacheBlockSize, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(CacheBlockSize, SizeValueType);
+
+  /** get/set the global default cache block size
+   *
+   * This value is used to initialize the CacheBlockSize upon class
+   * construction of \b any ImageToImage filter. Defaults to 256 KiB. This
+   * has no effect on currently constructed classes.
+   */
+  using ImageToImageFilterCommon::SetGlobalDefaultCacheBlockSize;
+  using ImageToImageFilterCommon::GetGlobalDefaultCacheBlockSize;
+
 
 protected:
   ImageToImageFilter();
@@ -224,6 +257,11 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Returns an ImageRegionSplitterZOrderTile when CacheBlocking is on,
+   * and nullptr otherwise. */
+  const ImageRegionSplitterBase *
+  GetDynamicImageRegionSplitter() const override;
+
   /** \brief Verifies that the input images occupy the same physical
    * space and the each index is at the same physical location.
    *
@@ -380,6 +418,12 @@ private:
    */
   double m_CoordinateTolerance;
   double m_DirectionTolerance;
+
+  bool          m_CacheBlocking{ false };
+  SizeValueType m_CacheBlockSize;
+
+  /** Created on first use, as most filters do not need it. */
+  mutable ImageRegionSplitterZOrderTile::Pointer m_CacheBlockSplitter;
 };
 } // end namespace itk
 
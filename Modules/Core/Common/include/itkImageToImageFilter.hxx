@@ -40,6 +40,7 @@ template <typename TInputImage, typename TOutputImage>
 ImageToImageFilter<TInputImage, TOutputImage>::ImageToImageFilter()
   : m_CoordinateTolerance(Self::GetGlobalDefaultCoordinateTolerance())
   , m_DirectionTolerance(Self::GetGlobalDefaultDirectionTolerance())
+  , m_CacheBlockSize(Self::GetGlobalDefaultCacheBlockSize())
 {
   // Modify superclass default values, can be overridden by subclasses
   this->SetNumberOfRequiredInputs(1);
@@ -134,6 +135,23 @@ ImageToImageFilter<TInputImage, TOutputImage>::CallCopyInputRegionToOutputRegion
 }
 
 
+template <typename TInputImage, typename TOutputImage>
+const ImageRegionSplitterBase *
+ImageToImageFilter<TInputImage, TOutputImage>::GetDynamicImageRegionSplitter() const
+{
+  if (!m_CacheBlocking)
+  {
+    return nullptr;
+  }
+  if (m_CacheBlockSplitter.IsNull())
+  {
+    m_CacheBlockSplitter = ImageRegionSplitterZOrderTile::New();
+  }
+  m_CacheBlockSplitter->SetTileSizeInBytes(m_CacheBlockSize);
+  m_CacheBlockSplitter->SetBytesPerPixel(sizeof(InputImagePixelType) + sizeof(OutputImagePixelType));
+  return m_CacheBlockSplitter;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 ImageToImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
@@ -141,6 +159,8 @@ ImageToImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Inde
   Superclass::PrintSelf(os, indent);
   os << indent << "CoordinateTolerance: " << this->m_CoordinateTolerance << std::endl;
   os << indent << "DirectionTolerance: " << this->m_DirectionTolerance << std::endl;
+  os << indent << "CacheBlocking: " << (this->m_CacheBlocking ? "On" : "Off") << std::endl;
+  os << indent << "CacheBlockSize: " << this->m_CacheBlockSize << std::endl;
 }
 
 
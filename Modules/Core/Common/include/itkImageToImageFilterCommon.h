@@ -19,6 +19,7 @@
 #define itkImageToImageFilterCommon_h
 
 #include "ITKCommonExport.h"
+#include "itkIntTypes.h"
 
 namespace itk
 {
@@ -46,6 +47,10 @@ public:
   SetGlobalDefaultDirectionTolerance(double);
   static double
   GetGlobalDefaultDirectionTolerance();
+  static void
+  SetGlobalDefaultCacheBlockSize(SizeValueType);
+  static SizeValueType
+  GetGlobalDefaultCacheBlockSize();
 };
 
 } // end namespace itk
@@ -20,6 +20,8 @@
 
 #include "itkObject.h"
 #include "itkObjectFactory.h"
+#include "itkImportImageContainerCommon.h"
+#include "itkImageBufferAllocator.h"
 #include <utility>
 
 namespace itk
@@ -57,6 +59,8 @@ public:
   using ElementIdentifier = TElementIdentifier;
   using Element = TElement;
 
+  using MemoryPlacementEnum = ImportImageContainerEnums::MemoryPlacement;
+
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -151,6 +155,44 @@ public:
   itkGetConstMacro(ContainerManageMemory, bool);
   itkBooleanMacro(ContainerManageMemory);
 
+  /** Set/Get the policy deciding where the pages of the buffers allocated
+   * by this container are placed on a NUMA system. It only affects
+   * subsequent allocations of element types which are trivially default
+   * constructible. Defaults to
+   * ImportImageContainerCommon::GetGlobalDefaultMemoryPlacement().
+   * \sa ImportImageContainerEnums::MemoryPlacement */
+  itkSetEnumMacro(MemoryPlacement, MemoryPlacementEnum);
+  itkGetConstMacro(MemoryPlacement, MemoryPlacementEnum);
+
+  /** Set/Get the allocator of the buffers subsequently allocated by this
+   * container. When it is nullptr, buffers are allocated by operator
+   * new[]. Defaults to ImageBufferAllocator::GetGlobalDefaultAllocator().
+   * A buffer is always released by the allocator which allocated it. */
+  itkSetObjectMacro(Allocator, ImageBufferAllocator);
+  itkGetModifiableObjectMacro(Allocator, ImageBufferAllocator);
+
+  /** Get the allocator of the current buffer, which releases it. It is
+   * nullptr when the buffer was allocated by operator new[] or imported. */
+  itkGetConstObjectMacro(BufferAllocator, ImageBufferAllocator);
+
+  /** Get the alignment (in bytes) guaranteed for the current buffer: the
+   * alignment of its allocator, or the alignment of the element type when
+   * it was allocated by operator new[] or imported. */
+  SizeValueType
+  GetBufferAlignment() const
+  {
+    return m_BufferAllocator ? m_BufferAllocator->GetAlignment() : alignof(TElement);
+  }
+
+  /** Tell whether the current buffer starts at a multiple of the given
+   * alignment (in bytes), for example to select a code path using aligned
+   * SIMD loads and stores. */
+  bool
+  IsBufferAligned(SizeValueType alignment) const
+  {
+    return ImageBufferAllocator::IsAligned(m_ImportPointer, alignment);
+  }
+
 protected:
   ImportImageContainer();
   ~ImportImageContainer() override;
@@ -169,6 +211,13 @@ protected:
   virtual TElement *
   AllocateElements(ElementIdentifier size, bool UseDefaultConstructor = false) const;
 
+  /** Construct the elements of a buffer obtained from the allocator,
+   * following the same initialization rules as AllocateElements(). If a
+   * constructor throws, the elements constructed so far are destroyed
+   * before the exception is passed on. */
+  void
+  ConstructElements(TElement * data, ElementIdentifier size, bool UseDefaultConstructor) const;
+
   virtual void
   DeallocateManagedMemory();
 
@@ -199,10 +248,15 @@ protected:
   }
 
 private:
-  TElement *         m_ImportPointer;
-  TElementIdentifier m_Size;
-  TElementIdentifier m_Capacity;
-  bool               m_ContainerManageMemory;
+  TElement *          m_ImportPointer;
+  TElementIdentifier  m_Size;
+  TElementIdentifier  m_Capacity;
+  bool                m_ContainerManageMemory;
+  MemoryPlacementEnum m_MemoryPlacement;
+
+  ImageBufferAllocator::Pointer m_Allocator;
+  /** The allocator of m_ImportPointer, nullptr for operator new[]. */
+  ImageBufferAllocator::Pointer m_BufferAllocator;
 };
 } // end namespace itk
 
@@ -29,7 +29,10 @@
 #define itkImportImageContainer_hxx
 
 #include "itkImportImageContainer.h"
+#include "itkExecutionTracer.h"
 #include <algorithm> // For copy_n.
+#include <new>
+#include <type_traits>
 
 namespace itk
 {
@@ -40,6 +43,8 @@ ImportImageContainer<TElementIdentifier, TElement>::ImportImageContainer()
   m_ContainerManageMemory = true;
   m_Capacity = 0;
   m_Size = 0;
+  m_MemoryPlacement = ImportImageContainerCommon::GetGlobalDefaultMemoryPlacement();
+  m_Allocator = ImageBufferAllocator::GetGlobalDefaultAllocator();
 }
 
 template <typename TElementIdentifier, typename TElement>
@@ -70,6 +75,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocator = m_Allocator;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -84,6 +90,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
   else
   {
     m_ImportPointer = this->AllocateElements(size, UseDefaultConstructor);
+    m_BufferAllocator = m_Allocator;
     m_Capacity = size;
     m_Size = size;
     m_ContainerManageMemory = true;
@@ -110,6 +117,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Squeeze()
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocator = m_Allocator;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -168,11 +176,23 @@ ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIden
   // Encapsulate all image memory allocation here to throw an
   // exception when memory allocation fails even when the compiler
   // does not do this by default.
-  TElement * data;
+  TElement * data = nullptr;
 
+  const bool placeBuffer = !m_Allocator && m_MemoryPlacement != MemoryPlacementEnum::Default &&
+                           std::is_trivially_default_constructible<TElement>::value;
   try
   {
-    if (UseDefaultConstructor)
+    if (m_Allocator)
+    {
+      data = static_cast<TElement *>(m_Allocator->Allocate(size * sizeof(TElement)));
+    }
+    else if (placeBuffer)
+    {
+      // Leave the pages untouched, so that they are placed by the threads
+      // which touch them first.
+      data = new TElement[size];
+    }
+    else if (UseDefaultConstructor)
     {
       data = new TElement[size](); // POD types initialized to 0, others use default constructor.
     }
@@ -181,7 +201,7 @@ ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIden
       data = new TElement[size]; // Faster but uninitialized
     }
   }
-  catch (...)
+  catch (const std::bad_alloc &)
   {
     data = nullptr;
   }
@@ -191,9 +211,80 @@ ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIden
     // of memory.  Do not use the exception macro.
     throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
   }
+
+  // An exception thrown while initializing the elements is passed on,
+  // after releasing the buffer. The elements of a buffer holding data, e.g.
+  // a mapped file, are left as they are, unless they are to be initialized.
+  if (m_Allocator && (UseDefaultConstructor || !m_Allocator->GetBuffersHoldData()))
+  {
+    try
+    {
+      this->ConstructElements(data, size, UseDefaultConstructor);
+    }
+    catch (...)
+    {
+      m_Allocator->Deallocate(data, size * sizeof(TElement));
+      throw;
+    }
+  }
+  else if (placeBuffer)
+  {
+    try
+    {
+      ImportImageContainerCommon::PlaceBuffer(data, size * sizeof(TElement), UseDefaultConstructor, m_MemoryPlacement);
+    }
+    catch (...)
+    {
+      delete[] data;
+      throw;
+    }
+  }
+  if (ExecutionTracer::GetEnabled())
+  {
+    ExecutionTracer::AddAllocation(this->GetNameOfClass(), size * sizeof(TElement));
+  }
   return data;
 }
 
+template <typename TElementIdentifier, typename TElement>
+void
+ImportImageContainer<TElementIdentifier, TElement>::ConstructElements(TElement *        data,
+                                                                      ElementIdentifier size,
+                                                                      bool              UseDefaultConstructor) const
+{
+  if (std::is_trivially_default_constructible<TElement>::value)
+  {
+    // Zero-fills the buffer when requested, like new TElement[size]() would.
+    ImportImageContainerCommon::PlaceBuffer(data, size * sizeof(TElement), UseDefaultConstructor, m_MemoryPlacement);
+  }
+  else
+  {
+    ElementIdentifier i = 0;
+    try
+    {
+      for (; i < size; ++i)
+      {
+        if (UseDefaultConstructor)
+        {
+          new (data + i) TElement();
+        }
+        else
+        {
+          new (data + i) TElement;
+        }
+      }
+    }
+    catch (...)
+    {
+      while (i > 0)
+      {
+        data[--i].~TElement();
+      }
+      throw;
+    }
+  }
+}
+
 template <typename TElementIdentifier, typename TElement>
 void
 ImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
@@ -201,9 +292,24 @@ ImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
   // Encapsulate all image memory deallocation here
   if (m_ContainerManageMemory)
   {
-    delete[] m_ImportPointer;
+    if (m_BufferAllocator)
+    {
+      if (!std::is_trivially_destructible<TElement>::value && m_ImportPointer)
+      {
+        for (ElementIdentifier i = 0; i < m_Capacity; ++i)
+        {
+          m_ImportPointer[i].~TElement();
+        }
+      }
+      m_BufferAllocator->Deallocate(m_ImportPointer, m_Capacity * sizeof(TElement));
+    }
+    else
+    {
+      delete[] m_ImportPointer;
+    }
   }
   m_ImportPointer = nullptr;
+  m_BufferAllocator = nullptr;
   m_Capacity = 0;
   m_Size = 0;
 }
@@ -218,6 +324,9 @@ ImportImageContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os,
   os << indent << "Container manages memory: " << (m_ContainerManageMemory ? "true" : "false") << std::endl;
   os << indent << "Size: " << m_Size << std::endl;
   os << indent << "Capacity: " << m_Capacity << std::endl;
+  os << indent << "MemoryPlacement: " << m_MemoryPlacement << std::endl;
+  itkPrintSelfObjectMacro(Allocator);
+  itkPrintSelfObjectMacro(BufferAllocator);
 }
 } // end namespace itk
 
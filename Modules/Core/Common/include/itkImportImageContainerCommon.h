@@ -0,0 +1,107 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImportImageContainerCommon_h
+#define itkImportImageContainerCommon_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include <ostream>
+#include <string>
+
+namespace itk
+{
+
+/** \class ImportImageContainerEnums
+ *
+ * \brief enums for ImportImageContainer
+ *
+ * \ingroup ITKCommon
+ */
+class ImportImageContainerEnums
+{
+public:
+  /** \class MemoryPlacement
+   * \ingroup ITKCommon
+   * Policy deciding on which NUMA node the pages of a newly allocated
+   * pixel buffer are placed.
+   *
+   * Default: pages are placed wherever they are first touched, which is
+   * the allocating thread when the buffer is initialized.
+   * ParallelFirstTouch: the buffer is split into one contiguous chunk per
+   * work unit, like the default image region splitter does, and each chunk
+   * is first touched by a thread of the multi-threader pool.
+   * Interleaved: pages are interleaved round-robin across all NUMA nodes
+   * (Linux only, otherwise equivalent to ParallelFirstTouch).
+   */
+  enum class MemoryPlacement : uint8_t
+  {
+    Default,
+    ParallelFirstTouch,
+    Interleaved
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const ImportImageContainerEnums::MemoryPlacement value);
+
+/** \class ImportImageContainerCommon
+ * \brief Code of ImportImageContainer common between templates
+ *
+ * This class provides common non-templated code which can be compiled
+ * and used by all templated versions of ImportImageContainer.
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImportImageContainerCommon
+{
+public:
+  using MemoryPlacementEnum = ImportImageContainerEnums::MemoryPlacement;
+
+  /** Set/Get the memory placement policy with which new pixel containers
+   * are constructed. The initial value is taken from environment variable
+   * ITK_GLOBAL_DEFAULT_MEMORY_PLACEMENT (e.g. "ParallelFirstTouch"), when
+   * it is set, and is MemoryPlacement::Default otherwise. */
+  static void
+  SetGlobalDefaultMemoryPlacement(MemoryPlacementEnum placement);
+  static MemoryPlacementEnum
+  GetGlobalDefaultMemoryPlacement();
+
+  /** Set/Get the size (in bytes) below which a buffer is always allocated
+   * with the Default memory placement, because dispatching threads would
+   * cost more than it could save. */
+  static void
+  SetGlobalMemoryPlacementMinimumBufferSize(SizeValueType numberOfBytes);
+  static SizeValueType
+  GetGlobalMemoryPlacementMinimumBufferSize();
+
+  /** Convert a memory placement name (case insensitive) into its enum
+   * type. Returns MemoryPlacement::Default for unknown names. */
+  static MemoryPlacementEnum
+  MemoryPlacementFromString(std::string placementString);
+
+  /** Place the pages of a newly allocated, not yet touched buffer
+   * according to the placement policy. When zeroFill is true, the whole
+   * buffer is set to zero bytes, otherwise only one byte per page is
+   * written. */
+  static void
+  PlaceBuffer(void * buffer, SizeValueType numberOfBytes, bool zeroFill, MemoryPlacementEnum placement);
+};
+
+} // end namespace itk
+
+#endif
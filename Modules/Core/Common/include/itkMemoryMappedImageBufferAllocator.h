@@ -0,0 +1,206 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedImageBufferAllocator_h
+#define itkMemoryMappedImageBufferAllocator_h
+
+#include "itkImageBufferAllocator.h"
+#include <map>
+#include <mutex>
+
+namespace itk
+{
+/** \class MemoryMappedImageBufferAllocatorEnums
+ *
+ * \brief enums for MemoryMappedImageBufferAllocator
+ *
+ * \ingroup ITKCommon
+ */
+class MemoryMappedImageBufferAllocatorEnums
+{
+public:
+  /** \class Mode
+   * \ingroup ITKCommon
+   * Which file backs the buffers, and whether it is modified.
+   *
+   * ReadOnly: the buffers map the FileName, from the Offset. Pixels
+   * written to a buffer are private to it, the file is not modified.
+   * ReadWrite: the buffers map the FileName, from the Offset, which is
+   * extended when it is too short. Pixels written to a buffer are written
+   * to the file.
+   * Scratch: each buffer maps a new temporary file in the
+   * ScratchDirectory, which is removed immediately, so that the operating
+   * system can page the buffer out to disk rather than to swap.
+   */
+  enum class Mode : uint8_t
+  {
+    ReadOnly,
+    ReadWrite,
+    Scratch
+  };
+
+  /** \class Advice
+   * \ingroup ITKCommon
+   * Expected access pattern of a range of a buffer, passed to madvise().
+   */
+  enum class Advice : uint8_t
+  {
+    Normal,
+    Sequential,
+    Random,
+    WillNeed,
+    DontNeed
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const MemoryMappedImageBufferAllocatorEnums::Mode value);
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const MemoryMappedImageBufferAllocatorEnums::Advice value);
+
+/** \class MemoryMappedImageBufferAllocator
+ * \brief Allocates pixel buffers which are memory-mapped files.
+ *
+ * Volumes which do not fit in memory can be processed by filters which
+ * only access a few slabs at a time, when their pixel buffers are
+ * memory-mapped files: the operating system reads the pages when they are
+ * accessed, and evicts them under memory pressure. The allocator of the
+ * pixel container of an image is set by
+ * ImportImageContainer::SetAllocator():
+ * \code
+ * auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+ * allocator->SetFileName("volume.raw");
+ * allocator->SetMode(itk::MemoryMappedImageBufferAllocator::ModeEnum::ReadOnly);
+ * image->GetPixelContainer()->SetAllocator(allocator);
+ * image->Allocate(); // the pixels are those of the file
+ * \endcode
+ *
+ * The pixels of a buffer are neither initialized by Image::Allocate(),
+ * unless it is asked to, nor placed according to the MemoryPlacement of
+ * the pixel container, so that the buffer has the content of the file.
+ * ImageFileReader maps the pixel data of a file this way when
+ * UseMemoryMapping is on, and the data are stored raw.
+ *
+ * Advise() tells the operating system which part of a buffer is about to
+ * be accessed, or is not needed anymore.
+ *
+ * Memory mapping is only implemented on POSIX systems. On other systems,
+ * Allocate() returns nullptr, so that the allocation of the pixel
+ * container fails.
+ *
+ * \sa ImageBufferAllocator
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT MemoryMappedImageBufferAllocator : public ImageBufferAllocator
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MemoryMappedImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = MemoryMappedImageBufferAllocator;
+  using Superclass = ImageBufferAllocator;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using ModeEnum = MemoryMappedImageBufferAllocatorEnums::Mode;
+  using AdviceEnum = MemoryMappedImageBufferAllocatorEnums::Advice;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(MemoryMappedImageBufferAllocator, ImageBufferAllocator);
+
+  void *
+  Allocate(SizeValueType numberOfBytes) override;
+
+  void
+  Deallocate(void * buffer, SizeValueType numberOfBytes) override;
+
+  /** The alignment of the buffers is the page size, unless the Offset is
+   * not a multiple of it. */
+  SizeValueType
+  GetAlignment() const override;
+
+  /** The buffers hold the contents of the file in ReadOnly and ReadWrite
+   * modes. */
+  bool
+  GetBuffersHoldData() const override
+  {
+    return m_Mode != ModeEnum::Scratch;
+  }
+
+  /** Set/Get the file mapped in ReadOnly and ReadWrite modes. */
+  itkSetStringMacro(FileName);
+  itkGetStringMacro(FileName);
+
+  /** Set/Get the offset (in bytes) of the buffers in the file, e.g. the
+   * size of its header. Defaults to zero. */
+  itkSetMacro(Offset, SizeValueType);
+  itkGetConstMacro(Offset, SizeValueType);
+
+  /** Set/Get the mode. Defaults to Scratch. */
+  itkSetEnumMacro(Mode, ModeEnum);
+  itkGetEnumMacro(Mode, ModeEnum);
+
+  /** Set/Get the directory of the temporary files of the Scratch mode.
+   * Defaults to the TMPDIR environment variable, or /tmp. */
+  itkSetStringMacro(ScratchDirectory);
+  itkGetStringMacro(ScratchDirectory);
+
+  /** Set/Get the advice given for each new buffer. Defaults to Normal. */
+  itkSetEnumMacro(Advice, AdviceEnum);
+  itkGetEnumMacro(Advice, AdviceEnum);
+
+  /** Get the number of buffers currently mapped. */
+  SizeValueType
+  GetNumberOfMappedBuffers() const;
+
+  /** Give advice about the expected access to a range of bytes of a
+   * buffer. The range is extended to whole pages. Returns false when the
+   * advice could not be given. */
+  static bool
+  Advise(const void * address, SizeValueType numberOfBytes, AdviceEnum advice);
+
+protected:
+  MemoryMappedImageBufferAllocator();
+  ~MemoryMappedImageBufferAllocator() override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** The page-aligned address and length of a mapping. */
+  struct Mapping
+  {
+    void *        m_Address;
+    SizeValueType m_Length;
+  };
+
+  std::string   m_FileName;
+  SizeValueType m_Offset{ 0 };
+  ModeEnum      m_Mode{ ModeEnum::Scratch };
+  std::string   m_ScratchDirectory;
+  AdviceEnum    m_Advice{ AdviceEnum::Normal };
+
+  mutable std::mutex        m_Mutex;
+  std::map<void *, Mapping> m_Mappings;
+};
+
+} // end namespace itk
+
+#endif
@@ -44,7 +44,18 @@ namespace itk
  * non-constant operation is done, if the dictionary is not unique to
  * this object, then a deep copy is performed. This make is very cheap
  * to create multiple copies of the same dictionary if they are never
- * modified.
+ * modified, e.g. when the dictionary of an ImageIO is propagated to the
+ * output of a reader, or to each entry of the MetaDataDictionaryArray of
+ * ImageSeriesReader. Default constructed and cleared dictionaries share
+ * a single empty map, so that they do not allocate until an entry is
+ * added.
+ *
+ * The non-constant Begin(), End() and Find() return iterators through
+ * which the entries may be replaced, so they also make a shared
+ * dictionary unique. Code which only reads the entries should use a
+ * constant reference to the dictionary, so that it does not copy it.
+ * The copy of a dictionary shares its MetaDataObjects with the original,
+ * which are replaced, rather than modified, when an entry is set.
  *
  * \ingroup ITKCommon
  * \sphinx
@@ -72,12 +83,13 @@ public:
   MetaDataDictionary();
   // Copy Constructor
   MetaDataDictionary(const MetaDataDictionary &);
-  MetaDataDictionary(MetaDataDictionary &&) = default;
+  // Move Constructor, leaves the moved from dictionary empty
+  MetaDataDictionary(MetaDataDictionary &&) noexcept;
   // operator =
   MetaDataDictionary &
   operator=(const MetaDataDictionary &);
   MetaDataDictionary &
-  operator=(MetaDataDictionary &&) = default;
+  operator=(MetaDataDictionary &&) noexcept;
 
   // Destructor
   virtual ~MetaDataDictionary();
@@ -176,6 +188,10 @@ private:
   bool
   MakeUnique();
 
+  /** The map shared by the empty dictionaries. */
+  static const std::shared_ptr<MetaDataDictionaryMapType> &
+  GetEmptyDictionary();
+
   std::shared_ptr<MetaDataDictionaryMapType> m_Dictionary;
 };
 
@@ -32,9 +32,11 @@
 #include "itkThreadSupport.h"
 #include "itkObjectFactory.h"
 #include "itkIntTypes.h"
+#include "itkNumericTraits.h"
 #include "itkImageRegion.h"
 #include "itkImageIORegion.h"
 #include "itkSingletonMacro.h"
+#include <atomic>
 #include <functional>
 #include <thread>
 #include "itkProgressReporter.h"
@@ -63,7 +65,8 @@ public:
     First = Platform,
     Pool,
     TBB,
-    Last = TBB,
+    WorkStealing,
+    Last = WorkStealing,
     Unknown = -1
   };
 
@@ -138,6 +141,51 @@ public:
   SetUpdateProgress(bool updates);
   itkGetConstMacro(UpdateProgress, bool);
 
+  /** Set/Get the minimum amount of work of a work unit: the number of
+   * pixels of a ParallelizeImageRegion() call, or of array indices of a
+   * ParallelizeArray() call. A call is split into at most
+   * GetNumberOfWorkUnits() work units of at least GrainSize pixels or
+   * indices each. A call with less than twice GrainSize pixels or indices
+   * is executed on the calling thread, which saves waking up and joining
+   * the worker threads, whose latency exceeds the processing time of small
+   * images. Set it before a call to give a hint on the cost of processing
+   * a pixel or an index. Zero, the default unless
+   * GetGlobalDefaultGrainSize() is set, selects the grain size from the
+   * kind of call: DefaultImageRegionGrainSize pixels, or
+   * DefaultArrayGrainSize indices. */
+  itkSetMacro(GrainSize, SizeValueType);
+  itkGetConstMacro(GrainSize, SizeValueType);
+
+  /** The grain size of ParallelizeImageRegion() calls when GrainSize is
+   * zero. Processing a pixel takes a few nanoseconds, so that a work unit
+   * of fewer pixels, e.g. a 64x64 slice, costs less than waking up a
+   * worker thread. */
+  static constexpr SizeValueType DefaultImageRegionGrainSize = 4096;
+
+  /** The grain size of ParallelizeArray() calls when GrainSize is zero. The
+   * indices of an array are usually coarse tasks, e.g. slices or labels,
+   * each worth a work unit. */
+  static constexpr SizeValueType DefaultArrayGrainSize = 1;
+
+  /** Get the number of ParallelizeArray() and ParallelizeImageRegion()
+   * calls executed on the calling thread, because they did not have
+   * enough work for two work units, and the number of calls executed in
+   * parallel. */
+  SizeValueType
+  GetNumberOfSerialExecutions() const
+  {
+    return m_NumberOfSerialExecutions;
+  }
+  SizeValueType
+  GetNumberOfParallelExecutions() const
+  {
+    return m_NumberOfParallelExecutions;
+  }
+
+  /** Reset the numbers of serial and parallel executions to zero. */
+  void
+  ResetExecutionCounters();
+
   /** Set/Get the maximum number of threads to use when multithreading.  It
    * will be clamped to the range [ 1, ITK_MAX_THREADS ] because several arrays
    * are already statically allocated using the ITK_MAX_THREADS number.
@@ -163,6 +211,7 @@ public:
   static constexpr ThreaderEnum First = ThreaderEnum::First;
   static constexpr ThreaderEnum Pool = ThreaderEnum::Pool;
   static constexpr ThreaderEnum TBB = ThreaderEnum::TBB;
+  static constexpr ThreaderEnum WorkStealing = ThreaderEnum::WorkStealing;
   static constexpr ThreaderEnum Last = ThreaderEnum::Last;
   static constexpr ThreaderEnum Unknown = ThreaderEnum::Unknown;
 #endif
@@ -186,6 +235,9 @@ public:
       case ThreaderEnum::TBB:
         return "TBB";
         break;
+      case ThreaderEnum::WorkStealing:
+        return "WorkStealing";
+        break;
       case ThreaderEnum::Unknown:
       default:
         return "Unknown";
@@ -218,6 +270,26 @@ public:
   static ThreadIdType
   GetGlobalDefaultNumberOfThreads();
 
+  /** Set/Get the value which is used to initialize the GrainSize in the
+   * constructor. The initial value is read from the environment variable
+   * ITK_GLOBAL_DEFAULT_GRAIN_SIZE, and is 0 when it is not set, which
+   * selects the grain size from the kind of call. */
+  static void
+  SetGlobalDefaultGrainSize(SizeValueType grainSize);
+  static SizeValueType
+  GetGlobalDefaultGrainSize();
+
+  /** Get the numbers of serial and parallel executions of all the
+   * multi-threaders, see GetNumberOfSerialExecutions(). */
+  static SizeValueType
+  GetGlobalNumberOfSerialExecutions();
+  static SizeValueType
+  GetGlobalNumberOfParallelExecutions();
+
+  /** Reset the global numbers of serial and parallel executions to zero. */
+  static void
+  ResetGlobalExecutionCounters();
+
 #if !defined(ITK_LEGACY_REMOVE)
   /** Get/Set the number of threads to use.
    * DEPRECATED! Use WorkUnits and MaximumNumberOfThreads instead. */
@@ -447,6 +519,30 @@ protected:
   static ITK_THREAD_RETURN_FUNCTION_CALL_CONVENTION
   ParallelizeImageRegionHelper(void * arg);
 
+  /** Wrap the functor of an image region so that each call is recorded as
+   * a work unit by the ExecutionTracer. Only used while it is enabled, as
+   * wrapping the functor is not free. The functor of an array is called
+   * once per index, so its work units are recorded by the threaders. */
+  static ThreadingFunctorType
+  TraceWorkUnits(unsigned int dimension, ThreadingFunctorType funcP);
+
+  /** Compute the number of work units of a call processing workSize pixels
+   * or array indices: at most m_NumberOfWorkUnits, with at least GrainSize
+   * pixels or indices each, or defaultGrainSize when GrainSize is zero.
+   * Returns 1 when the call is to be executed on the calling thread.
+   * Updates the execution counters. */
+  ThreadIdType
+  ComputeNumberOfWorkUnits(SizeValueType workSize, SizeValueType defaultGrainSize);
+
+  /** Execute the SingleMethod with the given number of work units, leaving
+   * m_NumberOfWorkUnits unchanged. Used by the default ParallelizeArray()
+   * and ParallelizeImageRegion() to honor the GrainSize. The default
+   * implementation calls SingleMethodExecute(), i.e. uses m_NumberOfWorkUnits
+   * work units; threaders relying on the default parallelization override
+   * it. */
+  virtual void
+  SingleMethodExecuteWithWorkUnits(ThreadIdType numberOfWorkUnits);
+
   /** The number of work units to create. */
   ThreadIdType m_NumberOfWorkUnits;
 
@@ -481,6 +577,10 @@ private:
 
   bool m_UpdateProgress{ true };
 
+  SizeValueType              m_GrainSize;
+  std::atomic<SizeValueType> m_NumberOfSerialExecutions{ 0 };
+  std::atomic<SizeValueType> m_NumberOfParallelExecutions{ 0 };
+
   static MultiThreaderBaseGlobals * m_PimplGlobals;
   /** Friends of Multithreader.
    * ProcessObject is a friend so that it can call PrintSelf() on its
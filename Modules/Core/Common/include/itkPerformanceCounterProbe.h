@@ -0,0 +1,186 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPerformanceCounterProbe_h
+#define itkPerformanceCounterProbe_h
+
+#include "itkResourceProbe.h"
+#include "itkIntTypes.h"
+
+#include <array>
+
+namespace itk
+{
+/** \class PerformanceCounterProbeEnums
+ *
+ * \brief enums for PerformanceCounterProbe
+ *
+ * \ingroup ITKCommon
+ */
+class PerformanceCounterProbeEnums
+{
+public:
+  /** \class Event
+   * \ingroup ITKCommon
+   * The events counted by PerformanceCounterProbe.
+   *
+   * Cycles: CPU cycles.
+   * Instructions: retired instructions.
+   * CacheMisses: last level cache misses.
+   * BranchMisses: mispredicted branches.
+   * TaskClock: CPU time, in nanoseconds, counted by the kernel rather than
+   * by the processor.
+   */
+  enum class Event : uint8_t
+  {
+    Cycles,
+    Instructions,
+    CacheMisses,
+    BranchMisses,
+    TaskClock
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const PerformanceCounterProbeEnums::Event value);
+
+/** \class PerformanceCounterProbe
+ *
+ *  \brief Counts the CPU cycles, instructions, cache misses and branch
+ *  misses between two points in code.
+ *
+ *   This class allows the user to count hardware events between the
+ *   execution of two pieces of code, like TimeProbe measures the time. The
+ *   probed value is the number of CPU cycles, and the other events are
+ *   counted alongside. Report() and JSONReport() print the instructions
+ *   per cycle (IPC), the total cache and branch misses and, when the number
+ *   of pixels processed between each Start() and Stop() is set, the cycles
+ *   and misses per pixel.
+ *
+ *   The events are counted with the perf_event_open() system call of Linux,
+ *   for every thread of the process, including the threads of the pool of
+ *   the MultiThreaderBase, and the threads created while the probe runs.
+ *   The counters are opened by Start() and closed by Stop(), which hence
+ *   cost a few system calls per thread.
+ *
+ *   An event which cannot be counted, e.g. on other systems, in virtual
+ *   machines without hardware counters, or when
+ *   /proc/sys/kernel/perf_event_paranoid forbids it, is reported as zero:
+ *   see IsEventAvailable().
+ *
+ *   \sa TimeProbe, PerformanceCounterProbesCollectorBase
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PerformanceCounterProbe : public ResourceProbe<OffsetValueType, double>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PerformanceCounterProbe);
+
+  using Superclass = ResourceProbe<OffsetValueType, double>;
+
+  using EventEnum = PerformanceCounterProbeEnums::Event;
+
+  /** Type of the counts of events. */
+  using CountValueType = OffsetValueType;
+
+  /** Number of events counted by the probe. */
+  static constexpr unsigned int NumberOfEvents = 5;
+
+  PerformanceCounterProbe();
+  ~PerformanceCounterProbe() override;
+
+  /** Start counting the events. */
+  void
+  Start() override;
+
+  /** Stop counting the events, and accumulate their counts.
+   *
+   * If a matching Start() has not been called before, there is no
+   * effect.
+   **/
+  void
+  Stop() override;
+
+  /** Reset the probe */
+  void
+  Reset() override;
+
+  /** Returns the number of CPU cycles since the last Start(), or zero when
+   * the probe is stopped. */
+  CountValueType
+  GetInstantValue() const override;
+
+  /** Whether the event could be counted by the last Start(). */
+  bool
+  IsEventAvailable(EventEnum event) const;
+
+  /** Returns the accumulated count of an event between the starts and stops
+   * of the probe. */
+  CountValueType
+  GetEventTotal(EventEnum event) const;
+
+  /** Set/Get the number of pixels processed between each Start() and Stop(),
+   * to compute the counts of events per pixel. Defaults to zero, for which
+   * the counts per pixel are reported as zero. */
+  void
+  SetNumberOfPixels(SizeValueType numberOfPixels);
+  SizeValueType
+  GetNumberOfPixels() const;
+
+  /** Returns the number of instructions per cycle, or zero when the cycles
+   * could not be counted. */
+  double
+  GetInstructionsPerCycle() const;
+
+  /** Returns the mean count of an event per pixel, or zero when the number
+   * of pixels is not set. */
+  double
+  GetEventsPerPixel(EventEnum event) const;
+
+protected:
+  DerivedMetricsType
+  GetDerivedMetrics() const override;
+
+private:
+  using CountsType = std::array<CountValueType, NumberOfEvents>;
+
+  void
+  OpenCounters();
+
+  void
+  CloseCounters();
+
+  CountsType
+  ReadCounters() const;
+
+  /** File descriptors of the counters of each event, one per thread. */
+  std::array<std::vector<int>, NumberOfEvents> m_FileDescriptors;
+
+  std::array<bool, NumberOfEvents> m_EventAvailable{};
+
+  /** Counts read by the last call to GetInstantValue(). */
+  mutable CountsType m_InstantCounts{};
+
+  CountsType m_StartCounts{};
+  CountsType m_TotalCounts{};
+
+  SizeValueType m_NumberOfPixels{ 0 };
+};
+} // end namespace itk
+
+#endif // itkPerformanceCounterProbe_h
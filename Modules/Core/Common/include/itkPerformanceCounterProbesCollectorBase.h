@@ -0,0 +1,52 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPerformanceCounterProbesCollectorBase_h
+#define itkPerformanceCounterProbesCollectorBase_h
+
+#include "itkMacro.h"
+#include "itkPerformanceCounterProbe.h"
+#include "itkResourceProbesCollectorBase.h"
+
+namespace itk
+{
+/** \class PerformanceCounterProbesCollectorBase
+ *  \brief Aggregates a set of performance counter probes.
+ *
+ *  This class defines a set of PerformanceCounterProbes and assign names to
+ *  them. The user can start and stop each one of the probes by addressing
+ *  them by name.
+ *
+ *  \sa PerformanceCounterProbe
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PerformanceCounterProbesCollectorBase
+  : public ResourceProbesCollectorBase<PerformanceCounterProbe>
+{
+public:
+  ~PerformanceCounterProbesCollectorBase() override;
+
+  /** Set the number of pixels processed between each start and stop of a
+   * probe, to report the counts of events per pixel. If the probe does not
+   * exist, it will be created. */
+  void
+  SetNumberOfPixels(const char * id, SizeValueType numberOfPixels);
+};
+} // end namespace itk
+
+#endif // itkPerformanceCounterProbesCollectorBase_h
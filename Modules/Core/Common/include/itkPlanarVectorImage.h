@@ -0,0 +1,401 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImage_h
+#define itkPlanarVectorImage_h
+
+#include "itkImage.h"
+#include "itkImportImageContainer.h"
+#include "itkDefaultPlanarVectorPixelAccessor.h"
+#include "itkDefaultVectorPixelAccessorFunctor.h"
+#include "itkPlanarVectorImageNeighborhoodAccessorFunctor.h"
+#include "itkWeakPointer.h"
+
+namespace itk
+{
+/** \class PlanarVectorImage
+ *  \brief Templated n-dimensional vector image class, whose components are
+ *  stored in planes.
+ *
+ * PlanarVectorImage has the same API as VectorImage: each pixel is a
+ * VariableLengthVector of \e k measurements of type \e TPixel. The
+ * difference lies in the memory organization. VectorImage interleaves the
+ * components of the pixels, whereas PlanarVectorImage stores all the
+ * values of a component contiguously, followed by those of the next
+ * component (a structure of arrays):
+ *   P00 P10 P20 ... P(n-1)0 P01 P11 P21 ... P(n-1)1 P02 ...
+ * where Pi0 represents the 0th measurement of the pixel at index i, and
+ * n is the number of pixels of the buffered region.
+ *
+ * This layout suits the algorithms which process one component at a time,
+ * such as the per-component smoothing of a displacement field, or the
+ * statistics of each channel: a component is available as a scalar Image
+ * through GetComponentImage(), which refers to the buffer of this image
+ * without copying it.
+ *
+ * Since the components of a pixel are not contiguous, GetPixel() and the
+ * iterators return a VariableLengthVector holding a copy of them, which
+ * cannot be used to modify the image: use SetPixel() and the Set()
+ * methods of the iterators instead.
+ *
+ * CastImageFilter and ImageAlgorithm::Copy() convert between VectorImage
+ * and PlanarVectorImage. ImageFileReader and ImageFileWriter read and
+ * write PlanarVectorImage, without reordering the components when the
+ * ImageIO supports planar buffers, e.g. for the files which store their
+ * components in planes.
+ *
+ * \sa VectorImage
+ * \sa DefaultPlanarVectorPixelAccessor
+ * \sa ImageIOBase::SetUsePlanarComponents()
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension = 3>
+class ITK_TEMPLATE_EXPORT PlanarVectorImage : public ImageBase<VImageDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PlanarVectorImage);
+
+  /** Standard class type aliases */
+  using Self = PlanarVectorImage;
+  using Superclass = ImageBase<VImageDimension>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using ConstWeakPointer = WeakPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(PlanarVectorImage, ImageBase);
+
+  /** Pixel type alias support Used to declare pixel type in filters
+   * or other operations. This is not the actual pixel type contained in
+   * the buffer, ie m_Buffer. The image exhibits an external API of an
+   * VariableLengthVector< T > and internally stores its data as type T. */
+  using PixelType = VariableLengthVector<TPixel>;
+
+  /** This is the actual pixel type contained in the buffer. Each component
+   * of the vector pixels is stored in a plane of InternalPixelType. */
+  using InternalPixelType = TPixel;
+
+  /** Typedef alias for PixelType */
+  using ValueType = PixelType;
+
+  using IOPixelType = InternalPixelType;
+
+  /** Accessor type that convert data between internal and external
+   *  representations.  */
+  using AccessorType = DefaultPlanarVectorPixelAccessor<InternalPixelType>;
+
+  /** Functor to provide a common API between DefaultPixelAccessor and
+   * DefaultPlanarVectorPixelAccessor */
+  using AccessorFunctorType = DefaultVectorPixelAccessorFunctor<Self>;
+
+  /** Typedef for the functor used to access a neighborhood of pixel
+   * pointers. */
+  using NeighborhoodAccessorFunctorType = PlanarVectorImageNeighborhoodAccessorFunctor<Self>;
+
+  /** Dimension of the image.  This constant is used by functions that are
+   * templated over image type (as opposed to being templated over pixel type
+   * and dimension) when they need compile time access to the dimension of
+   * the image. */
+  static constexpr unsigned int ImageDimension = VImageDimension;
+
+  /** Index type alias support An index is used to access pixel values. */
+  using IndexType = typename Superclass::IndexType;
+  using IndexValueType = typename Superclass::IndexValueType;
+
+  /** Offset type alias support An offset is used to access pixel values. */
+  using OffsetType = typename Superclass::OffsetType;
+
+  /** Size type alias support A size is used to define region bounds. */
+  using SizeType = typename Superclass::SizeType;
+
+  /** Container used to store pixels in the image. */
+  using PixelContainer = ImportImageContainer<SizeValueType, InternalPixelType>;
+
+  /** Direction type alias support A matrix of direction cosines. */
+  using DirectionType = typename Superclass::DirectionType;
+
+  /** Region type alias support A region is used to specify a subset of an image.
+   */
+  using RegionType = typename Superclass::RegionType;
+
+  /** Spacing type alias support  Spacing holds the size of a pixel.  The
+   * spacing is the geometric distance between image samples. */
+  using SpacingType = typename Superclass::SpacingType;
+
+  /** Origin type alias support  The origin is the geometric coordinates
+   * of the index (0,0). */
+  using PointType = typename Superclass::PointType;
+
+  /** A pointer to the pixel container. */
+  using PixelContainerPointer = typename PixelContainer::Pointer;
+  using PixelContainerConstPointer = typename PixelContainer::ConstPointer;
+
+  /** Offset type alias (relative position between indices) */
+  using OffsetValueType = typename Superclass::OffsetValueType;
+
+  using VectorLengthType = unsigned int;
+
+  /** The type of the scalar images of the components. */
+  using ComponentImageType = Image<InternalPixelType, VImageDimension>;
+  using ComponentImagePointer = typename ComponentImageType::Pointer;
+  using ComponentImageConstPointer = typename ComponentImageType::ConstPointer;
+
+  /**
+   * \brief A structure which enable changing any image class' pixel
+   * type to another.
+   *
+   * As for VectorImage, the rebinds to a scalar type and to a
+   * VariableLengthVector of it result in the same type.
+   *
+   * \sa Image::Rebind
+   * \deprecated Use template alias RebindImageType instead
+   */
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+  struct Rebind
+  {
+    using Type = itk::PlanarVectorImage<UPixelType, NUImageDimension>;
+  };
+
+  /// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+  template <typename UElementType, unsigned int NUImageDimension>
+  struct Rebind<VariableLengthVector<UElementType>, NUImageDimension>
+  {
+    using Type = itk::PlanarVectorImage<UElementType, NUImageDimension>;
+  };
+  /// \endcond
+
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+  using RebindImageType = typename Rebind<UPixelType, NUImageDimension>::Type;
+
+  /** Allocate the image memory. The size of the image must
+   * already be set, e.g. by calling SetRegions(). */
+  void
+  Allocate(bool UseDefaultConstructor = false) override;
+
+  /** Restore the data object to its initial state. This means releasing
+   * memory. */
+  void
+  Initialize() override;
+
+  /** Fill the image buffer with a value.  Be sure to call Allocate()
+   * first. */
+  void
+  FillBuffer(const PixelType & value);
+
+  /** \brief Set a pixel value.
+   *
+   * Allocate() needs to have been called first -- for efficiency,
+   * this function does not check that the image has actually been
+   * allocated yet. */
+  void
+  SetPixel(const IndexType & index, const PixelType & value)
+  {
+    this->GetPixelAccessor().Set((*m_Buffer)[this->FastComputeOffset(index)], value, 0);
+  }
+
+  /** \brief Get a pixel, holding a copy of its components.
+   *
+   * For efficiency, this function does not check that the
+   * image has actually been allocated yet. */
+  PixelType
+  GetPixel(const IndexType & index) const
+  {
+    return this->GetPixelAccessor().Get((*m_Buffer)[this->FastComputeOffset(index)], 0);
+  }
+
+  /** \brief Access a pixel, holding a copy of its components.
+   *
+   * For efficiency, this function does not check that the
+   * image has actually been allocated yet. */
+  PixelType operator[](const IndexType & index) const { return this->GetPixel(index); }
+
+  /** Return a pointer to the beginning of the buffer, which is the first
+   * value of the first component.  This is used by the image iterator
+   * class. */
+  InternalPixelType *
+  GetBufferPointer()
+  {
+    return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
+  }
+  const InternalPixelType *
+  GetBufferPointer() const
+  {
+    return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
+  }
+
+  /** Return a pointer to the first value of a component in the buffer. */
+  InternalPixelType *
+  GetComponentBufferPointer(unsigned int component)
+  {
+    return this->GetBufferPointer() + component * this->GetComponentStride();
+  }
+  const InternalPixelType *
+  GetComponentBufferPointer(unsigned int component) const
+  {
+    return this->GetBufferPointer() + component * this->GetComponentStride();
+  }
+
+  /** Get the number of elements between two components of a pixel in the
+   * buffer, which is the number of pixels of the buffered region. */
+  SizeValueType
+  GetComponentStride() const
+  {
+    return this->GetOffsetTable()[VImageDimension];
+  }
+
+  /** Get a scalar image of a component, which refers to the buffer of this
+   * image, without copying it: modifying its pixels modifies the
+   * component. It has the same information and regions as this image. It
+   * keeps the pixel container of this image alive, so that it remains valid
+   * when this image is released or reinitialized, but not when this image
+   * is allocated again with a larger buffered region. */
+  ComponentImagePointer
+  GetComponentImage(unsigned int component);
+  ComponentImageConstPointer
+  GetComponentImage(unsigned int component) const;
+
+  /** Return a pointer to the container. */
+  PixelContainer *
+  GetPixelContainer()
+  {
+    return m_Buffer.GetPointer();
+  }
+
+  /** Return a pointer to the container. */
+  const PixelContainer *
+  GetPixelContainer() const
+  {
+    return m_Buffer.GetPointer();
+  }
+
+  /** Set the container to use. Note that this does not cause the
+   * DataObject to be modified. */
+  void
+  SetPixelContainer(PixelContainer * container);
+
+  /** Graft the data and information from one image to another. This
+   * is a convenience method to setup a second image with all the meta
+   * information of another image and use the same pixel
+   * container. \sa VectorImage::Graft() */
+  virtual void
+  Graft(const Self * image);
+
+  /** Return the Pixel Accessor object */
+  AccessorType
+  GetPixelAccessor()
+  {
+    return AccessorType(m_VectorLength, this->GetComponentStride());
+  }
+
+  /** Return the Pixel Accesor object */
+  const AccessorType
+  GetPixelAccessor() const
+  {
+    return AccessorType(m_VectorLength, this->GetComponentStride());
+  }
+
+  /** Return the NeighborhoodAccessor functor */
+  NeighborhoodAccessorFunctorType
+  GetNeighborhoodAccessor()
+  {
+    return NeighborhoodAccessorFunctorType(m_VectorLength, this->GetComponentStride());
+  }
+
+  /** Return the NeighborhoodAccessor functor */
+  const NeighborhoodAccessorFunctorType
+  GetNeighborhoodAccessor() const
+  {
+    return NeighborhoodAccessorFunctorType(m_VectorLength, this->GetComponentStride());
+  }
+
+  /** Set/Get macros for the length of each vector in the vector image */
+  itkSetMacro(VectorLength, VectorLengthType);
+  itkGetConstReferenceMacro(VectorLength, VectorLengthType);
+
+  /** Get/Set the number of components each pixel has, ie the VectorLength */
+  unsigned int
+  GetNumberOfComponentsPerPixel() const override;
+
+  void
+  SetNumberOfComponentsPerPixel(unsigned int n) override;
+
+  /** Get the number of bytes of the pixels of the RequestedRegion. */
+  SizeValueType
+  GetRequestedRegionSizeInBytes() const override
+  {
+    return this->GetRequestedRegion().GetNumberOfPixels() * m_VectorLength * sizeof(InternalPixelType);
+  }
+
+protected:
+  PlanarVectorImage();
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  ~PlanarVectorImage() override = default;
+  void
+  Graft(const DataObject * data) override;
+  using Superclass::Graft;
+
+private:
+  /** \class ComponentPixelContainer
+   * The container of the pixels of a component image: it refers to a plane
+   * of the buffer of the vector image, and keeps its container alive. */
+  class ComponentPixelContainer : public PixelContainer
+  {
+  public:
+    ITK_DISALLOW_COPY_AND_MOVE(ComponentPixelContainer);
+
+    using Self = ComponentPixelContainer;
+    using Superclass = PixelContainer;
+    using Pointer = SmartPointer<Self>;
+    using ConstPointer = SmartPointer<const Self>;
+
+    itkNewMacro(Self);
+    itkTypeMacro(ComponentPixelContainer, ImportImageContainer);
+
+    void
+    SetVectorImageContainer(const PixelContainer * container)
+    {
+      m_VectorImageContainer = container;
+    }
+
+  protected:
+    ComponentPixelContainer() = default;
+    ~ComponentPixelContainer() override = default;
+
+  private:
+    PixelContainerConstPointer m_VectorImageContainer;
+  };
+
+  /** Length of the "vector pixel" */
+  VectorLengthType m_VectorLength{ 0 };
+
+  /** Memory for the current buffer. */
+  PixelContainerPointer m_Buffer;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkPlanarVectorImage.hxx"
+#endif
+
+#endif
@@ -0,0 +1,188 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImage_hxx
+#define itkPlanarVectorImage_hxx
+
+#include "itkPlanarVectorImage.h"
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TPixel, unsigned int VImageDimension>
+PlanarVectorImage<TPixel, VImageDimension>::PlanarVectorImage()
+{
+  m_Buffer = PixelContainer::New();
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::Allocate(const bool UseDefaultConstructor)
+{
+  if (m_VectorLength == 0)
+  {
+    itkExceptionMacro(<< "Cannot allocate PlanarVectorImage with VectorLength = 0");
+  }
+
+  this->ComputeOffsetTable();
+  const SizeValueType num = this->GetOffsetTable()[VImageDimension];
+
+  m_Buffer->Reserve(num * m_VectorLength, UseDefaultConstructor);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::Initialize()
+{
+  //
+  // We don't modify ourselves because the "ReleaseData" methods depend upon
+  // no modification when initialized.
+  //
+
+  // Call the superclass which should initialize the BufferedRegion ivar.
+  Superclass::Initialize();
+
+  // Replace the handle to the buffer. This is the safest thing to do,
+  // since the same container can be shared by multiple images (e.g.
+  // Grafted outputs, in place filters and component images).
+  // Keep the memory placement policy and the allocator which were set
+  // for this image.
+  const PixelContainerPointer previousBuffer = m_Buffer;
+  m_Buffer = PixelContainer::New();
+  if (previousBuffer)
+  {
+    m_Buffer->SetMemoryPlacement(previousBuffer->GetMemoryPlacement());
+    m_Buffer->SetAllocator(previousBuffer->GetModifiableAllocator());
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::FillBuffer(const PixelType & value)
+{
+  const SizeValueType numberOfPixels = this->GetBufferedRegion().GetNumberOfPixels();
+
+  for (VectorLengthType i = 0; i < m_VectorLength; ++i)
+  {
+    std::fill_n(this->GetBufferPointer() + i * numberOfPixels, numberOfPixels, value[i]);
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+auto
+PlanarVectorImage<TPixel, VImageDimension>::GetComponentImage(unsigned int component) -> ComponentImagePointer
+{
+  if (component >= m_VectorLength)
+  {
+    itkExceptionMacro(<< "Component " << component << " is out of the range [0, " << m_VectorLength << ")");
+  }
+
+  const SizeValueType numberOfPixels = this->GetBufferedRegion().GetNumberOfPixels();
+  auto                container = ComponentPixelContainer::New();
+  container->SetImportPointer(this->GetBufferPointer() + component * numberOfPixels, numberOfPixels, false);
+  container->SetVectorImageContainer(m_Buffer);
+
+  ComponentImagePointer image = ComponentImageType::New();
+  image->CopyInformation(this);
+  image->SetBufferedRegion(this->GetBufferedRegion());
+  image->SetRequestedRegion(this->GetRequestedRegion());
+  image->SetPixelContainer(container);
+  return image;
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+auto
+PlanarVectorImage<TPixel, VImageDimension>::GetComponentImage(unsigned int component) const
+  -> ComponentImageConstPointer
+{
+  return const_cast<Self *>(this)->GetComponentImage(component).GetPointer();
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::SetPixelContainer(PixelContainer * container)
+{
+  if (m_Buffer != container)
+  {
+    m_Buffer = container;
+    this->Modified();
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::Graft(const Self * image)
+{
+  if (image == nullptr)
+  {
+    return;
+  }
+  // call the superclass' implementation
+  Superclass::Graft(image);
+
+  // Now copy anything remaining that is needed
+  this->SetPixelContainer(const_cast<PixelContainer *>(image->GetPixelContainer()));
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::Graft(const DataObject * data)
+{
+  if (data == nullptr)
+  {
+    return;
+  }
+  // Attempt to cast data to a PlanarVectorImage
+  const auto * imgData = dynamic_cast<const Self *>(data);
+
+  if (imgData == nullptr)
+  {
+    // pointer could not be cast back down
+    itkExceptionMacro(<< "itk::PlanarVectorImage::Graft() cannot cast " << typeid(data).name() << " to "
+                      << typeid(const Self *).name());
+  }
+  this->Graft(imgData);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+unsigned int
+PlanarVectorImage<TPixel, VImageDimension>::GetNumberOfComponentsPerPixel() const
+{
+  return this->m_VectorLength;
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::SetNumberOfComponentsPerPixel(unsigned int n)
+{
+  this->SetVectorLength(static_cast<VectorLengthType>(n));
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+PlanarVectorImage<TPixel, VImageDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "VectorLength: " << m_VectorLength << std::endl;
+  os << indent << "PixelContainer: " << std::endl;
+  m_Buffer->Print(os, indent.GetNextIndent());
+}
+} // end namespace itk
+
+#endif
@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImageNeighborhoodAccessorFunctor_h
+#define itkPlanarVectorImageNeighborhoodAccessorFunctor_h
+
+#include "itkVariableLengthVector.h"
+#include "itkImageBoundaryCondition.h"
+#include "itkImageBase.h"
+
+namespace itk
+{
+/** \class PlanarVectorImageNeighborhoodAccessorFunctor
+ * \brief Provides accessor interfaces to Access pixels and is meant to be
+ * used on pointers to pixels held by the Neighborhood class.
+ *
+ * The pointers of the neighborhood point to the first component of the
+ * pixels of a PlanarVectorImage, and the following components are
+ * ComponentStride elements apart.
+ *
+ * A typical user should not need to use this class. The class is internally
+ * used by the neighborhood iterators.
+ *
+ * \sa VectorImageNeighborhoodAccessorFunctor
+ * \ingroup ITKCommon
+ */
+template <typename TImage>
+class PlanarVectorImageNeighborhoodAccessorFunctor
+{
+public:
+  using ImageType = TImage;
+  using PixelType = typename ImageType::PixelType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using VectorLengthType = unsigned int;
+  using OffsetType = typename ImageType::OffsetType;
+
+  using NeighborhoodType = Neighborhood<InternalPixelType *, TImage::ImageDimension>;
+
+  template <typename TOutput = ImageType>
+  using ImageBoundaryConditionType = ImageBoundaryCondition<ImageType, TOutput>;
+
+  PlanarVectorImageNeighborhoodAccessorFunctor(VectorLengthType length, SizeValueType componentStride)
+    : m_VectorLength(length)
+    , m_ComponentStride(componentStride)
+  {}
+  PlanarVectorImageNeighborhoodAccessorFunctor() = default;
+
+  /** Set the pointer index to the start of the buffer. It is not needed
+   * to access the pixels of a PlanarVectorImage, but is part of the
+   * interface used by the neighborhood iterators. */
+  inline void
+  SetBegin(const InternalPixelType * itkNotUsed(begin))
+  {}
+
+  /** Method to dereference a pixel pointer. This is used from the
+   * ConstNeighborhoodIterator as the equivalent operation to (*it).
+   * A PixelType holding a copy of the components of the pixel is returned. */
+  inline PixelType
+  Get(const InternalPixelType * pixelPointer) const
+  {
+    PixelType value(m_VectorLength);
+    for (VectorLengthType i = 0; i < m_VectorLength; ++i, pixelPointer += m_ComponentStride)
+    {
+      value[i] = *pixelPointer;
+    }
+    return value;
+  }
+
+  /** Method to set the pixel value at a certain pixel pointer */
+  inline void
+  Set(InternalPixelType * pixelPointer, const PixelType & p) const
+  {
+    for (VectorLengthType i = 0; i < m_VectorLength; ++i, pixelPointer += m_ComponentStride)
+    {
+      *pixelPointer = p[i];
+    }
+  }
+
+  template <typename TOutput>
+  inline typename ImageBoundaryConditionType<TOutput>::OutputPixelType
+  BoundaryCondition(const OffsetType &                          point_index,
+                    const OffsetType &                          boundary_offset,
+                    const NeighborhoodType *                    data,
+                    const ImageBoundaryConditionType<TOutput> * boundaryCondition) const
+  {
+    return boundaryCondition->operator()(point_index, boundary_offset, data, *this);
+  }
+
+  /** Methods to Set/Get vector length. */
+  void
+  SetVectorLength(VectorLengthType length)
+  {
+    m_VectorLength = length;
+  }
+  VectorLengthType
+  GetVectorLength()
+  {
+    return m_VectorLength;
+  }
+
+  /** Methods to Set/Get the number of elements between two components of
+   * a pixel. */
+  void
+  SetComponentStride(SizeValueType componentStride)
+  {
+    m_ComponentStride = componentStride;
+  }
+  SizeValueType
+  GetComponentStride()
+  {
+    return m_ComponentStride;
+  }
+
+private:
+  VectorLengthType m_VectorLength{ 0 };
+  SizeValueType    m_ComponentStride{ 0 };
+};
+} // end namespace itk
+
+#endif
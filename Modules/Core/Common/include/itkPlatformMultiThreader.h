@@ -157,6 +157,9 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  void
+  SingleMethodExecuteWithWorkUnits(ThreadIdType numberOfWorkUnits) override;
+
 private:
   /** An array of thread info containing a thread id
    *  (0, 1, 2, .. ITK_MAX_THREADS-1), the thread count, and a pointer
@@ -37,6 +37,13 @@ namespace itk
  * \brief A class for performing multithreaded execution with a thread
  * pool back end
  *
+ * Work unit i, beyond the one of the calling thread, is handed to thread
+ * i - 1 of the ThreadPool, unless that thread is busy, so that successive
+ * parallel regions process the same parts of the data on the same threads.
+ * With the threads of the pool pinned to CPUs, see
+ * ThreadPool::SetThreadPlacement(), this keeps the memory first touched by
+ * a work unit local to the CPU which processes it.
+ *
  * \ingroup OSSystemObjects
  *
  * \ingroup ITKCommon
@@ -23,6 +23,7 @@
 
 #include <iostream> // For cout.
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ITKCommonExport.h"
@@ -159,6 +160,18 @@ public:
   PrintJSONSystemInformation(std::ostream & os = std::cout);
 
 protected:
+  /** Names and values of metrics derived from the probed values. */
+  using DerivedMetricsType = std::vector<std::pair<std::string, double>>;
+
+  /** Returns the metrics derived from the probed values, which Report()
+   * and JSONReport() print after the statistics of the probe. There are
+   * none by default. */
+  virtual DerivedMetricsType
+  GetDerivedMetrics() const
+  {
+    return {};
+  }
+
   /** Update the Min and Max values with an input value */
   virtual void
   UpdateMinimumMaximumMeasuredValue(ValueType value);
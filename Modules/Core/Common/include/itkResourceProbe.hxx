@@ -290,6 +290,17 @@ ResourceProbe<ValueType, MeanType>::Report(std::ostream & os, bool printSystemIn
        << std::setw(tabwidth) << this->GetMinimum() << std::left << std::setw(tabwidth) << this->GetMean() << std::left
        << std::setw(tabwidth) << this->GetMaximum() << std::left << std::setw(tabwidth) << this->GetStandardDeviation();
   }
+  for (const auto & metric : this->GetDerivedMetrics())
+  {
+    if (useTabs)
+    {
+      ss << std::left << '\t' << metric.second;
+    }
+    else
+    {
+      ss << std::left << std::setw(tabwidth) << metric.second;
+    }
+  }
   os << ss.str() << std::endl;
 }
 
@@ -427,6 +438,10 @@ ResourceProbe<ValueType, MeanType>::JSONReport(std::ostream & os)
   PrintJSONvar(os, "Total", this->GetTotal());
   PrintJSONvar(os, "StandardDeviation", this->GetStandardDeviation());
   PrintJSONvar(os, "StandardError", this->GetStandardError());
+  for (const auto & metric : this->GetDerivedMetrics())
+  {
+    PrintJSONvar(os, metric.first.c_str(), metric.second);
+  }
 
   PrintJSONvar(os, "TotalDifference", this->GetMaximum() - this->GetMinimum());
   PrintJSONvar(os, "MeanMinimumDifference", this->GetMean() - this->GetMinimum());
@@ -477,6 +492,17 @@ ResourceProbe<ValueType, MeanType>::PrintReportHead(std::ostream & os, bool useT
        << std::string("Max (") + this->m_UnitString + std::string(")") << std::left << std::setw(tabwidth)
        << std::string("StdDev (") + this->m_UnitString + std::string(")");
   }
+  for (const auto & metric : this->GetDerivedMetrics())
+  {
+    if (useTabs)
+    {
+      ss << std::left << '\t' << metric.first;
+    }
+    else
+    {
+      ss << std::left << std::setw(tabwidth) << metric.first;
+    }
+  }
 
   os << ss.str() << std::endl;
 }
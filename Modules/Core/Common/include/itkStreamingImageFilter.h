@@ -90,6 +90,26 @@ public:
   itkSetObjectMacro(RegionSplitter, SplitterType);
   itkGetModifiableObjectMacro(RegionSplitter, SplitterType);
 
+  /** Set/Get the number of bytes of bulk data the update may allocate.
+   * When not zero, the number of pieces is the smallest one for which
+   * EstimatePeakMemory() does not exceed the budget, instead of
+   * NumberOfStreamDivisions. The shape of the pieces is still given by the
+   * RegionSplitter. When the budget cannot be met, the output is streamed
+   * in as many pieces as the RegionSplitter can make. Zero, the default,
+   * means no budget. */
+  itkSetMacro(MemoryBudget, SizeValueType);
+  itkGetConstMacro(MemoryBudget, SizeValueType);
+
+  /** Estimate the peak number of bytes of bulk data allocated by an update
+   * of the RequestedRegion of the output in the given number of pieces:
+   * the output buffer, and the buffers of the upstream pipeline for the
+   * largest piece, as estimated by
+   * DataObject::EstimateMemoryForRequestedRegion(). The information of the output must be up to date, e.g. after
+   * GetOutput()->UpdateOutputInformation(). Changes the requested regions
+   * of the upstream pipeline, but does not execute it. */
+  SizeValueType
+  EstimatePeakMemory(unsigned int numberOfStreamDivisions);
+
   /** Override UpdateOutputData() from ProcessObject to divide upstream
    * updates into pieces. This filter does not have a GenerateData()
    * or ThreadedGenerateData() method.  Instead, all the work is done
@@ -100,7 +120,8 @@ public:
 
   /** Override PropagateRequestedRegion from ProcessObject
    *  Since inside UpdateOutputData we iterate over streaming pieces
-   *  we don't need to proapage up the pipeline
+   *  we don't need to proapage up the pipeline. The number of pieces is
+   *  computed here, before the update.
    */
   void
   PropagateRequestedRegion(DataObject * output) override;
@@ -118,9 +139,16 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Compute the number of pieces to divide the given output region,
+   * from the NumberOfStreamDivisions or the MemoryBudget. */
+  unsigned int
+  ComputeNumberOfStreamDivisions(const OutputImageRegionType & outputRegion);
+
 private:
   unsigned int          m_NumberOfStreamDivisions;
   RegionSplitterPointer m_RegionSplitter;
+  SizeValueType         m_MemoryBudget{ 0 };
+  unsigned int          m_NumberOfPieces{ 1 };
 };
 } // end namespace itk
 
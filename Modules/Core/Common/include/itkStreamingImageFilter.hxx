@@ -21,6 +21,7 @@
 #include "itkCommand.h"
 #include "itkImageAlgorithm.h"
 #include "itkImageRegionSplitterSlowDimension.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -47,6 +48,7 @@ StreamingImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, In
   Superclass::PrintSelf(os, indent);
 
   os << indent << "Number of stream divisions: " << m_NumberOfStreamDivisions << std::endl;
+  os << indent << "Memory budget: " << m_MemoryBudget << std::endl;
 
   itkPrintSelfObjectMacro(RegionSplitter);
 }
@@ -84,6 +86,11 @@ StreamingImageFilter<TInputImage, TOutputImage>::PropagateRequestedRegion(DataOb
    */
   this->GenerateOutputRequestedRegion(output);
 
+  // The number of pieces is computed now, from the output information,
+  // since estimating the memory of a piece propagates its requested region
+  // up the pipeline, which must not be done while updating.
+  m_NumberOfPieces = this->ComputeNumberOfStreamDivisions(this->GetOutput(0)->GetRequestedRegion());
+
   // we don't call GenerateInputRequestedRegion since the requested
   // regions are manage when the pipeline is execute
 
@@ -91,6 +98,93 @@ StreamingImageFilter<TInputImage, TOutputImage>::PropagateRequestedRegion(DataOb
   // because the pipeline managed later
 }
 
+/**
+ *
+ */
+template <typename TInputImage, typename TOutputImage>
+SizeValueType
+StreamingImageFilter<TInputImage, TOutputImage>::EstimatePeakMemory(unsigned int numberOfStreamDivisions)
+{
+  auto * inputPtr = const_cast<InputImageType *>(this->GetInput(0));
+  if (inputPtr == nullptr)
+  {
+    itkExceptionMacro(<< "Input not set");
+  }
+  OutputImageType *           outputPtr = this->GetOutput(0);
+  const OutputImageRegionType outputRegion = outputPtr->GetRequestedRegion();
+
+  // The pieces may differ in size, e.g. by a slice, so that the largest
+  // one is estimated.
+  const unsigned int numDivisions =
+    m_RegionSplitter->GetNumberOfSplits(outputRegion, std::max(numberOfStreamDivisions, 1u));
+  InputImageRegionType largestStreamRegion;
+  for (unsigned int i = 0; i < numDivisions; ++i)
+  {
+    InputImageRegionType streamRegion = outputRegion;
+    m_RegionSplitter->GetSplit(i, numDivisions, streamRegion);
+    if (streamRegion.GetNumberOfPixels() > largestStreamRegion.GetNumberOfPixels())
+    {
+      largestStreamRegion = streamRegion;
+    }
+  }
+  inputPtr->SetRequestedRegion(largestStreamRegion);
+
+  SizeValueType numberOfBytes = outputPtr->GetRequestedRegionSizeInBytes();
+  numberOfBytes += inputPtr->EstimateMemoryForRequestedRegion();
+  return numberOfBytes;
+}
+
+/**
+ *
+ */
+template <typename TInputImage, typename TOutputImage>
+unsigned int
+StreamingImageFilter<TInputImage, TOutputImage>::ComputeNumberOfStreamDivisions(
+  const OutputImageRegionType & outputRegion)
+{
+  if (m_MemoryBudget == 0)
+  {
+    // The minimum of what the user specified via SetNumberOfStreamDivisions()
+    // and what the Splitter thinks is a reasonable value.
+    return std::min(m_NumberOfStreamDivisions,
+                    m_RegionSplitter->GetNumberOfSplits(outputRegion, m_NumberOfStreamDivisions));
+  }
+
+  // Double the number of pieces until the budget is met, or the splitter
+  // cannot make more pieces.
+  const unsigned int maximumNumberOfDivisions =
+    m_RegionSplitter->GetNumberOfSplits(outputRegion, NumericTraits<unsigned int>::max());
+  unsigned int numberOfDivisionsOverBudget = 0;
+  unsigned int numDivisions = 1;
+  while (this->EstimatePeakMemory(numDivisions) > m_MemoryBudget)
+  {
+    if (numDivisions >= maximumNumberOfDivisions)
+    {
+      itkWarningMacro(<< "The memory budget of " << m_MemoryBudget << " bytes cannot be met with "
+                      << maximumNumberOfDivisions << " pieces.");
+      return maximumNumberOfDivisions;
+    }
+    numberOfDivisionsOverBudget = numDivisions;
+    numDivisions = static_cast<unsigned int>(std::min<SizeValueType>(2 * SizeValueType{ numDivisions },
+                                                                     maximumNumberOfDivisions));
+  }
+
+  // Then search the smallest number of pieces meeting the budget.
+  while (numDivisions - numberOfDivisionsOverBudget > 1)
+  {
+    const unsigned int middle = numberOfDivisionsOverBudget + (numDivisions - numberOfDivisionsOverBudget) / 2;
+    if (this->EstimatePeakMemory(middle) > m_MemoryBudget)
+    {
+      numberOfDivisionsOverBudget = middle;
+    }
+    else
+    {
+      numDivisions = middle;
+    }
+  }
+  return m_RegionSplitter->GetNumberOfSplits(outputRegion, numDivisions);
+}
+
 /**
  *
  */
@@ -149,18 +243,10 @@ StreamingImageFilter<TInputImage, TOutputImage>::UpdateOutputData(DataObject * i
   auto * inputPtr = const_cast<InputImageType *>(this->GetInput(0));
 
   /**
-   * Determine of number of pieces to divide the input.  This will be the
-   * minimum of what the user specified via SetNumberOfStreamDivisions()
-   * and what the Splitter thinks is a reasonable value.
+   * The number of pieces to divide the input was determined by
+   * PropagateRequestedRegion().
    */
-  unsigned int numDivisions, numDivisionsFromSplitter;
-
-  numDivisions = m_NumberOfStreamDivisions;
-  numDivisionsFromSplitter = m_RegionSplitter->GetNumberOfSplits(outputRegion, m_NumberOfStreamDivisions);
-  if (numDivisionsFromSplitter < numDivisions)
-  {
-    numDivisions = numDivisionsFromSplitter;
-  }
+  const unsigned int numDivisions = m_NumberOfPieces;
 
   /**
    * Loop over the number of pieces, execute the upstream pipeline on each
@@ -25,7 +25,11 @@
 #include <functional>
 #include <future>
 #include <condition_variable>
+#include <limits>
+#include <memory>
+#include <ostream>
 #include <thread>
+#include <vector>
 
 #include "itkObject.h"
 #include "itkObjectFactory.h"
@@ -41,7 +45,23 @@ namespace itk
  *
  * Thread pool is called and initialized from within the PoolMultiThreader.
  * Initially the thread pool is started with GlobalDefaultNumberOfThreads.
- * The jobs are submitted via AddWork method.
+ * The jobs are submitted via AddWork method, or via AddWorkToThread,
+ * which hands the job to a given thread of the pool.
+ *
+ * Each thread has its own queue, of the jobs handed to it. A thread runs
+ * the jobs of its own queue first, then those submitted with AddWork. An
+ * idle thread also takes the jobs queued for a busy thread, and the jobs
+ * beyond the first one queued for any other thread, so that the jobs
+ * handed to a thread only wait for it while no other thread is idle.
+ *
+ * The threads may be pinned to CPUs with SetThreadAffinity() or
+ * SetThreadPlacement(), or with environment variables:
+ * - ITK_THREAD_AFFINITY: "compact", "spread", or a list of CPUs such as
+ *   "0-7,16-23", to which the threads are pinned in turn.
+ * - ITK_THREAD_AFFINITY_NUMA_NODE: the NUMA node to which the threads are
+ *   limited.
+ *
+ * Pinning is supported on Linux and Windows, and has no effect elsewhere.
  *
  * This implementation heavily borrows from:
  * https://github.com/progschj/ThreadPool
@@ -50,6 +70,37 @@ namespace itk
  * \ingroup ITKCommon
  */
 
+/** \class ThreadPoolEnums
+ *
+ * \brief enums for ThreadPool
+ *
+ * \ingroup ITKCommon
+ */
+class ThreadPoolEnums
+{
+public:
+  /** \class ThreadPlacement
+   * \ingroup ITKCommon
+   * How the threads of the pool are pinned to the CPUs available to the
+   * process.
+   *
+   * Unpinned: the threads may run on any CPU.
+   * Compact: thread i is pinned to the i-th CPU, filling the hardware
+   * threads of a core, then the cores of a socket, before the next socket.
+   * Spread: thread i is pinned to the i-th CPU, taking one core of each
+   * socket in turn, before the other hardware threads of the cores.
+   */
+  enum class ThreadPlacement : uint8_t
+  {
+    Unpinned,
+    Compact,
+    Spread
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const ThreadPoolEnums::ThreadPlacement value);
+
 struct ThreadPoolGlobals;
 
 class ITKCommon_EXPORT ThreadPool : public Object
@@ -63,6 +114,8 @@ public:
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
+  using ThreadPlacementEnum = ThreadPoolEnums::ThreadPlacement;
+
   /** Run-time type information (and related methods). */
   itkTypeMacro(ThreadPool, Object);
 
@@ -85,18 +138,30 @@ auto result = pool->AddWork([](int param) { return param; }, 7);
   template <class Function, class... Arguments>
   auto
   AddWork(Function && function, Arguments &&... arguments) -> std::future<std::result_of_t<Function(Arguments...)>>
+  {
+    return this->AddWorkToThread(AnyThread, std::forward<Function>(function), std::forward<Arguments>(arguments)...);
+  }
+
+  /** Add this job to the queue of thread threadIndex of the pool, modulo
+   * the number of threads. Handing the work units of successive parallel
+   * regions to the same threads keeps the data they first touched local
+   * to them. */
+  template <class Function, class... Arguments>
+  auto
+  AddWorkToThread(ThreadIdType threadIndex, Function && function, Arguments &&... arguments)
+    -> std::future<std::result_of_t<Function(Arguments...)>>
   {
     using return_type = std::result_of_t<Function(Arguments...)>;
 
     auto task = std::make_shared<std::packaged_task<return_type()>>(
-      std::bind(std::forward<Function>(function), std::forward<Arguments>(arguments)...));
+      [bound = std::bind(std::forward<Function>(function), std::forward<Arguments>(arguments)...)]() mutable {
+        // The thread may be handed new jobs once the future is ready.
+        const ThreadReleaser releaser;
+        return bound();
+      });
 
     std::future<return_type> res = task->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->GetMutex());
-      m_WorkQueue.emplace_back([task]() { (*task)(); });
-    }
-    m_Condition.notify_one();
+    this->Submit([task]() { (*task)(); }, threadIndex);
     return res;
   }
 
@@ -114,6 +179,32 @@ auto result = pool->AddWork([](int param) { return param; }, 7);
   int
   GetNumberOfCurrentlyIdleThreads() const;
 
+  /** Whether the calling thread is one of the threads of the pool. */
+  bool
+  IsWorkerThread() const;
+
+  /** Pin thread i of the pool to CPU cpus[i % cpus.size()], including the
+   * threads added later. An empty list unpins the threads. Throws if a CPU
+   * is not available to the process. */
+  void
+  SetThreadAffinity(const std::vector<unsigned int> & cpus);
+
+  /** Pin the threads of the pool according to the placement, to the CPUs
+   * of NUMA node numaNode if it is not negative. The Unpinned threads of a
+   * NUMA node may run on any of its CPUs. Throws if no CPU is available. */
+  void
+  SetThreadPlacement(ThreadPlacementEnum placement, int numaNode = -1);
+
+  /** Get the CPUs to which thread threadIndex of the pool is pinned, or an
+   * empty list if it may run on any CPU. */
+  std::vector<unsigned int>
+  GetThreadAffinity(ThreadIdType threadIndex) const;
+
+  /** Get the CPUs available to the process, of NUMA node numaNode if it is
+   * not negative, in the order in which the given placement pins threads. */
+  static std::vector<unsigned int>
+  GetPlacementCPUs(ThreadPlacementEnum placement, int numaNode = -1);
+
   /** Set/Get wait for threads.
   This function should be used carefully, probably only during static
   initialization phase to disable waiting for threads when ITK is built as a
@@ -135,30 +226,76 @@ protected:
   void
   CleanUp();
 
-  ~ThreadPool() override { this->CleanUp(); }
+  ~ThreadPool() override;
 
   static void
   PrepareForFork();
   static void
   ResumeFromFork();
 
+  /** The threadIndex of the jobs which may run on any thread. */
+  static constexpr ThreadIdType AnyThread = std::numeric_limits<ThreadIdType>::max();
+
+  /** Queue the job for the given thread, and wake up a thread to run it. */
+  void
+  Submit(std::function<void()> job, ThreadIdType threadIndex);
+
 private:
+  /** The queue and state of a thread of the pool. */
+  struct ThreadState;
+
+  /** Marks the calling thread of the pool as available for new jobs, when
+   * the job it runs is done. */
+  struct ThreadReleaser
+  {
+    ~ThreadReleaser() { ThreadPool::ReleaseCurrentThread(); }
+  };
+
+  static void
+  ReleaseCurrentThread();
+
+  /** Start a thread, and its queue. The mutex must be locked. */
+  void
+  StartThread();
+
+  /** Take the next job for thread threadIndex, if any. The mutex must be
+   * locked. */
+  std::function<void()>
+  TakeJob(ThreadIdType threadIndex);
+
+  /** Wake up an idle thread, if any. The mutex must be locked. */
+  void
+  WakeIdleThread();
+
+  /** Set the affinity of the threads, see m_AffinityCPUs. The mutex must be
+   * locked. */
+  void
+  SetAffinityCPUs(const std::vector<unsigned int> & cpus, bool pinToSingleCPUs);
+
+  /** Apply the affinity to thread threadIndex. The mutex must be locked. */
+  void
+  ApplyThreadAffinity(ThreadIdType threadIndex);
+
   /** Only used to synchronize the global variable across static libraries.*/
   itkGetGlobalDeclarationMacro(ThreadPoolGlobals, PimplGlobals);
 
-  /** This is a list of jobs submitted to the thread pool.
-   * This is the only place where the jobs are submitted.
+  /** This is a list of the jobs which may run on any thread.
    * Filled by AddWork, emptied by ThreadExecute. */
   std::deque<std::function<void()>> m_WorkQueue;
 
-  /** When a thread is idle, it is waiting on m_Condition.
-   * AddWork signals it to resume a (random) thread. */
-  std::condition_variable m_Condition;
+  /** The queue and state of each thread. When a thread is idle, it waits
+   * on the condition variable of its state. */
+  std::vector<std::unique_ptr<ThreadState>> m_ThreadStates;
 
   /** Vector to hold all thread handles.
    * Thread handles are used to delete (join) the threads. */
   std::vector<std::thread> m_Threads;
 
+  /** The CPUs to which the threads are pinned, and whether each thread is
+   * pinned to one of them in turn, or may run on any of them. */
+  std::vector<unsigned int> m_AffinityCPUs;
+  bool                      m_PinToSingleCPUs{ true };
+
   /* Has destruction started? */
   bool m_Stopping{ false };
 
@@ -167,7 +304,7 @@ private:
 
   /** The continuously running thread function */
   static void
-  ThreadExecute();
+  ThreadExecute(ThreadIdType threadIndex);
 };
 
 } // namespace itk
@@ -0,0 +1,260 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImage_h
+#define itkTiledImage_h
+
+#include "itkImageBase.h"
+#include "itkTiledImageContainer.h"
+#include "itkTiledImagePixelAccessor.h"
+#include "itkTiledImagePixelAccessorFunctor.h"
+#include "itkTiledImageNeighborhoodAccessorFunctor.h"
+#include <type_traits>
+
+namespace itk
+{
+/** \class TiledImage
+ *  \brief Templated n-dimensional image class, whose pixels are stored in
+ *  compressed bricks.
+ *
+ * Label maps and masks are mostly made of background, but Image stores
+ * each of their pixels. A TiledImage splits its buffered region in bricks
+ * of BrickSize pixels, which are stored by a TiledImageContainer: a brick
+ * whose pixels are all equal only stores their value, other bricks are
+ * run-length encoded, and the bricks being accessed are decompressed in a
+ * cache of a few bricks. A newly allocated image only stores one value
+ * per brick.
+ *
+ * The pixels are accessed through the pixel accessor of the image, like
+ * those of a VectorImage, so that the image iterators, e.g.
+ * ImageRegionConstIterator, ImageRegionIterator, ImageScanlineIterator and
+ * the neighborhood iterators, and the filters using them, e.g.
+ * thresholding or connected component filters, read and write a
+ * TiledImage like an Image. Value() and the direct access to the buffer
+ * are not supported, since the pixels are not stored contiguously.
+ *
+ * The pixels must be trivially copyable. The iterators are best used in
+ * the order of the bricks, e.g. by processing a brick-aligned region per
+ * thread, since each move to another brick queries the container.
+ * GetPixel() and SetPixel() query it for each pixel.
+ *
+ * \sa TiledImageContainer
+ * \sa Image
+ * \sa VectorImage
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension = 3>
+class ITK_TEMPLATE_EXPORT TiledImage : public ImageBase<VImageDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(TiledImage);
+
+  /** Standard class type aliases */
+  using Self = TiledImage;
+  using Superclass = ImageBase<VImageDimension>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using ConstWeakPointer = WeakPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(TiledImage, ImageBase);
+
+  /** Pixel type alias support. */
+  using PixelType = TPixel;
+
+  /** This is the actual pixel type contained in the buffer, which only
+   * encodes the offsets of the pixels. */
+  using InternalPixelType = TiledImageInternalPixel;
+
+  using ValueType = PixelType;
+  using IOPixelType = PixelType;
+
+  /** Accessor type that converts data between internal and external
+   *  representations. */
+  using AccessorType = TiledImagePixelAccessor<PixelType, VImageDimension>;
+  using AccessorFunctorType = TiledImagePixelAccessorFunctor<Self>;
+
+  /** Typedef for the functor used to access a neighborhood of pixel
+   * pointers. */
+  using NeighborhoodAccessorFunctorType = TiledImageNeighborhoodAccessorFunctor<Self>;
+
+  /** Dimension of the image. */
+  static constexpr unsigned int ImageDimension = VImageDimension;
+
+  using IndexType = typename Superclass::IndexType;
+  using IndexValueType = typename Superclass::IndexValueType;
+  using OffsetType = typename Superclass::OffsetType;
+  using OffsetValueType = typename Superclass::OffsetValueType;
+  using SizeType = typename Superclass::SizeType;
+  using SizeValueType = typename Superclass::SizeValueType;
+  using DirectionType = typename Superclass::DirectionType;
+  using RegionType = typename Superclass::RegionType;
+  using SpacingType = typename Superclass::SpacingType;
+  using PointType = typename Superclass::PointType;
+
+  /** Container used to store the pixels in the image. */
+  using PixelContainer = TiledImageContainer;
+  using PixelContainerPointer = typename PixelContainer::Pointer;
+  using PixelContainerConstPointer = typename PixelContainer::ConstPointer;
+
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+  struct Rebind
+  {
+    using Type = itk::TiledImage<UPixelType, NUImageDimension>;
+  };
+
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+  using RebindImageType = typename Rebind<UPixelType, NUImageDimension>::Type;
+
+  static_assert(std::is_trivially_copyable<PixelType>::value, "The pixels of a TiledImage must be trivially copyable.");
+
+  /** Allocate the bricks of the buffered region. Their pixels are all
+   * zero, whether initializePixels is true or not, which costs one value
+   * per brick. */
+  void
+  Allocate(bool initializePixels = false) override;
+
+  /** Restore the data object to its initial state. This means releasing
+   * memory. */
+  void
+  Initialize() override;
+
+  /** Fill the image buffer with a value. The bricks all become uniform. */
+  void
+  FillBuffer(const PixelType & value);
+
+  /** Set a pixel value. */
+  void
+  SetPixel(const IndexType & index, const PixelType & value)
+  {
+    const OffsetValueType offset = this->FastComputeOffset(index);
+    this->GetPixelAccessor().Set(m_Buffer->GetInternalPixels()[offset], value, offset);
+  }
+
+  /** Get a pixel value. */
+  PixelType
+  GetPixel(const IndexType & index) const
+  {
+    const OffsetValueType offset = this->FastComputeOffset(index);
+    return this->GetPixelAccessor().Get(m_Buffer->GetInternalPixels()[offset], offset);
+  }
+
+  /** Return a pointer to the internal pixels, from which the iterators
+   * compute the offsets of the pixels. It is nullptr when the image is not
+   * allocated.
+   * \sa TiledImageContainer::GetInternalPixels() */
+  InternalPixelType *
+  GetBufferPointer()
+  {
+    return m_Buffer->GetInternalPixels();
+  }
+  const InternalPixelType *
+  GetBufferPointer() const
+  {
+    return m_Buffer->GetInternalPixels();
+  }
+
+  /** Return a pointer to the container. */
+  PixelContainer *
+  GetPixelContainer()
+  {
+    return m_Buffer.GetPointer();
+  }
+  const PixelContainer *
+  GetPixelContainer() const
+  {
+    return m_Buffer.GetPointer();
+  }
+
+  /** Set the container to use, e.g. to share the bricks of another image
+   * with the same buffered region and brick size. */
+  void
+  SetPixelContainer(PixelContainer * container);
+
+  /** Graft the data and information from one image to another. */
+  virtual void
+  Graft(const Self * image);
+
+  /** Set/Get the size (in pixels) of the bricks. It is used by the next
+   * Allocate(). Defaults to 32 pixels along each dimension. */
+  itkSetMacro(BrickSize, SizeType);
+  itkGetConstReferenceMacro(BrickSize, SizeType);
+
+  /** Return the pixel accessor, which maps the offsets of the pixels to
+   * the bricks. */
+  AccessorType
+  GetPixelAccessor()
+  {
+    return AccessorType(m_Buffer.GetPointer(),
+                        this->GetOffsetTable(),
+                        this->GetBufferedRegion().GetSize(),
+                        m_BrickSize);
+  }
+  const AccessorType
+  GetPixelAccessor() const
+  {
+    return AccessorType(const_cast<PixelContainer *>(m_Buffer.GetPointer()),
+                        this->GetOffsetTable(),
+                        this->GetBufferedRegion().GetSize(),
+                        m_BrickSize);
+  }
+
+  /** Return the NeighborhoodAccessor functor */
+  NeighborhoodAccessorFunctorType
+  GetNeighborhoodAccessor()
+  {
+    return NeighborhoodAccessorFunctorType(this->GetPixelAccessor());
+  }
+  const NeighborhoodAccessorFunctorType
+  GetNeighborhoodAccessor() const
+  {
+    return NeighborhoodAccessorFunctorType(this->GetPixelAccessor());
+  }
+
+  unsigned int
+  GetNumberOfComponentsPerPixel() const override;
+
+  /** The decompressed bricks of the cache, rather than the whole requested
+   * region, are counted, since the other bricks are mostly uniform. */
+  SizeValueType
+  GetRequestedRegionSizeInBytes() const override;
+
+protected:
+  TiledImage();
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+  ~TiledImage() override = default;
+
+  void
+  Graft(const DataObject * data) override;
+  using Superclass::Graft;
+
+private:
+  SizeType              m_BrickSize;
+  PixelContainerPointer m_Buffer;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkTiledImage.hxx"
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImage_hxx
+#define itkTiledImage_hxx
+
+#include "itkTiledImage.h"
+#include "itkNumericTraits.h"
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TPixel, unsigned int VImageDimension>
+TiledImage<TPixel, VImageDimension>::TiledImage()
+{
+  m_BrickSize.Fill(32);
+  m_Buffer = PixelContainer::New();
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::Allocate(bool itkNotUsed(initializePixels))
+{
+  this->ComputeOffsetTable();
+
+  const SizeType & bufferSize = this->GetBufferedRegion().GetSize();
+  SizeValueType    numberOfBricks = 1;
+  SizeValueType    numberOfPixelsPerBrick = 1;
+  for (unsigned int i = 0; i < VImageDimension; ++i)
+  {
+    if (m_BrickSize[i] == 0)
+    {
+      itkExceptionMacro(<< "The brick size must be positive: " << m_BrickSize);
+    }
+    numberOfBricks *= (bufferSize[i] + m_BrickSize[i] - 1) / m_BrickSize[i];
+    numberOfPixelsPerBrick *= m_BrickSize[i];
+  }
+
+  const PixelType zero{};
+  m_Buffer->Allocate(numberOfBricks, numberOfPixelsPerBrick, sizeof(PixelType), &zero);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::Initialize()
+{
+  //
+  // We don't modify ourselves because the "ReleaseData" methods depend upon
+  // no modification when initialized.
+  //
+
+  // Call the superclass which should initialize the BufferedRegion ivar.
+  Superclass::Initialize();
+
+  // Replace the handle to the container, which may be shared by other
+  // images, keeping the cache capacity which was set for this image.
+  const PixelContainerPointer previousBuffer = m_Buffer;
+  m_Buffer = PixelContainer::New();
+  m_Buffer->SetCacheCapacity(previousBuffer->GetCacheCapacity());
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::FillBuffer(const PixelType & value)
+{
+  m_Buffer->Fill(&value);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::SetPixelContainer(PixelContainer * container)
+{
+  if (m_Buffer != container)
+  {
+    m_Buffer = container;
+    this->Modified();
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::Graft(const Self * image)
+{
+  // call the superclass' implementation
+  Superclass::Graft(image);
+
+  if (image)
+  {
+    // Now copy anything remaining that is needed
+    m_BrickSize = image->GetBrickSize();
+    this->SetPixelContainer(const_cast<PixelContainer *>(image->GetPixelContainer()));
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::Graft(const DataObject * data)
+{
+  if (data)
+  {
+    // Attempt to cast data to a TiledImage
+    const auto * const imgData = dynamic_cast<const Self *>(data);
+
+    if (imgData != nullptr)
+    {
+      this->Graft(imgData);
+    }
+    else
+    {
+      // pointer could not be cast back down
+      itkExceptionMacro(<< "itk::TiledImage::Graft() cannot cast " << typeid(data).name() << " to "
+                        << typeid(const Self *).name());
+    }
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+unsigned int
+TiledImage<TPixel, VImageDimension>::GetNumberOfComponentsPerPixel() const
+{
+  const auto p = PixelType();
+  return NumericTraits<PixelType>::GetLength(p);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+auto
+TiledImage<TPixel, VImageDimension>::GetRequestedRegionSizeInBytes() const -> SizeValueType
+{
+  SizeValueType numberOfPixelsPerBrick = 1;
+  for (unsigned int i = 0; i < VImageDimension; ++i)
+  {
+    numberOfPixelsPerBrick *= m_BrickSize[i];
+  }
+  const SizeValueType numberOfPixels = this->GetRequestedRegion().GetNumberOfPixels();
+  return std::min(numberOfPixels, m_Buffer->GetCacheCapacity() * numberOfPixelsPerBrick) * sizeof(PixelType);
+}
+
+template <typename TPixel, unsigned int VImageDimension>
+void
+TiledImage<TPixel, VImageDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "BrickSize: " << m_BrickSize << std::endl;
+  os << indent << "PixelContainer: " << std::endl;
+  m_Buffer->Print(os, indent.GetNextIndent());
+}
+} // end namespace itk
+
+#endif
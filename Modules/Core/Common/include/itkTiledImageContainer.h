@@ -0,0 +1,253 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImageContainer_h
+#define itkTiledImageContainer_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+/** \class TiledImageContainerEnums
+ *
+ * \brief enums for TiledImageContainer
+ *
+ * \ingroup ITKCommon
+ */
+class TiledImageContainerEnums
+{
+public:
+  /** \class BrickEncoding
+   * \ingroup ITKCommon
+   * How the elements of a brick are stored while it is not cached.
+   *
+   * Uniform: all its elements have the same value, which is stored once.
+   * RunLength: its runs of equal elements are stored as (count, value) pairs.
+   * Raw: its elements are stored as they are, when run-length encoding would
+   * not make them smaller.
+   */
+  enum class BrickEncoding : uint8_t
+  {
+    Uniform,
+    RunLength,
+    Raw
+  };
+};
+// Define how to print enumeration
+extern ITKCommon_EXPORT std::ostream &
+                        operator<<(std::ostream & out, const TiledImageContainerEnums::BrickEncoding value);
+
+/** \class TiledImageInternalPixel
+ * \brief The internal pixel type of TiledImage.
+ *
+ * A TiledImage does not store its pixels contiguously, so that its buffer
+ * pointer does not point to pixels: it points to an array of internal
+ * pixels, one per element of the TiledImageContainer, whose distance from
+ * the first one is the offset of the pixel, which the pixel accessor maps
+ * to its brick. Internal pixels are empty, and never accessed.
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+struct TiledImageInternalPixel
+{};
+
+/** \class TiledImageContainer
+ * \brief Stores the pixels of a TiledImage as compressed bricks.
+ *
+ * The elements are split in bricks of a fixed number of elements. While it
+ * is not accessed, a brick is stored compressed: as a single value when
+ * all its elements are equal, which is the case of most bricks of label
+ * maps and masks, or run-length encoded. The bricks being accessed are
+ * decompressed on demand, and kept in a least recently used cache of
+ * CacheCapacity bricks. A brick evicted from the cache is compressed again
+ * when it was modified.
+ *
+ * Each brick is accessed through AcquireBrick(), which shares the
+ * ownership of its decompressed elements with the caller, so that a brick
+ * is not evicted while it is accessed: the cache may temporarily hold more
+ * bricks than its capacity. Different threads may access the same brick,
+ * provided they do not write the same elements.
+ *
+ * The container does not know the pixel type: the elements are only
+ * compared and copied as blocks of ElementSize bytes, so that they must be
+ * trivially copyable.
+ *
+ * \sa TiledImage
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT TiledImageContainer : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(TiledImageContainer);
+
+  /** Standard class type aliases. */
+  using Self = TiledImageContainer;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using BrickEncodingEnum = TiledImageContainerEnums::BrickEncoding;
+
+  /** The decompressed elements of a brick, shared by the cache and the
+   * accessors of the brick. */
+  using BrickBuffer = std::shared_ptr<std::vector<char>>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(TiledImageContainer, Object);
+
+  /** Allocate the given number of bricks, whose elements all have the given
+   * value. No memory is allocated for their elements until they are
+   * written. */
+  void
+  Allocate(SizeValueType numberOfBricks,
+           SizeValueType numberOfElementsPerBrick,
+           SizeValueType elementSize,
+           const void *  value);
+
+  /** Release all the bricks. */
+  void
+  Initialize();
+
+  /** Set all the elements to the given value. The bricks must not be
+   * accessed meanwhile. */
+  void
+  Fill(const void * value);
+
+  /** Get the elements of a brick, to read or to write them. When the brick
+   * is uniform and only read, its value is copied to uniformValue and
+   * nullptr is returned, so that it is not decompressed. Otherwise, the
+   * returned elements are valid as long as the buffer is held. */
+  char *
+  AcquireBrick(SizeValueType brickIndex, bool forWriting, BrickBuffer & buffer, void * uniformValue);
+
+  /** Get a number which changes whenever a uniform brick starts being
+   * written, or all the bricks are filled, so that the uniform values
+   * returned by AcquireBrick() may be outdated. */
+  SizeValueType
+  GetGeneration() const
+  {
+    return m_Generation.load(std::memory_order_acquire);
+  }
+
+  /** Compress the cached bricks which were modified, and release the
+   * cached bricks which are not being accessed. */
+  void
+  Flush();
+
+  /** Set/Get the maximum number of decompressed bricks kept in the cache.
+   * Defaults to 64. */
+  void
+  SetCacheCapacity(SizeValueType capacity);
+  SizeValueType
+  GetCacheCapacity() const;
+
+  /** Get the internal pixels of the elements, from which the iterators of
+   * TiledImage compute the offsets of the pixels. nullptr when no brick is
+   * allocated. They are never accessed: only address space is reserved for
+   * them, no memory is committed. */
+  TiledImageInternalPixel *
+  GetInternalPixels() const
+  {
+    return m_InternalPixels;
+  }
+
+  /** Get the number of bricks. */
+  SizeValueType
+  GetNumberOfBricks() const;
+
+  itkGetConstMacro(NumberOfElementsPerBrick, SizeValueType);
+  itkGetConstMacro(ElementSize, SizeValueType);
+
+  /** Get the number of bricks stored uniform. */
+  SizeValueType
+  GetNumberOfUniformBricks() const;
+
+  /** Get the number of decompressed bricks in the cache. */
+  SizeValueType
+  GetNumberOfCachedBricks() const;
+
+  /** Get the number of bytes of the compressed bricks. */
+  SizeValueType
+  GetCompressedSizeInBytes() const;
+
+  /** Get the number of bytes of the decompressed bricks in the cache. */
+  SizeValueType
+  GetCacheSizeInBytes() const;
+
+  /** Get the encoding of a brick while it is not cached. */
+  BrickEncodingEnum
+  GetBrickEncoding(SizeValueType brickIndex) const;
+
+protected:
+  TiledImageContainer() = default;
+  ~TiledImageContainer() override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  struct Brick
+  {
+    BrickEncodingEnum                  m_Encoding{ BrickEncodingEnum::Uniform };
+    std::vector<char>                  m_Data; // The uniform value, or the encoded elements.
+    BrickBuffer                        m_Buffer;
+    bool                               m_IsModified{ false };
+    std::list<SizeValueType>::iterator m_CachePosition;
+  };
+
+  void
+  Encode(Brick & brick) const;
+
+  void
+  Decode(const Brick & brick, char * elements) const;
+
+  /** Reserve the address space of the internal pixels of the given number
+   * of elements, releasing the previous one. */
+  void
+  ReserveInternalPixels(SizeValueType numberOfElements);
+
+  /** Release the least recently used bricks which are not accessed, while
+   * the cache holds more bricks than its capacity. */
+  void
+  EvictBricks(bool evictAll);
+
+  SizeValueType m_NumberOfElementsPerBrick{ 0 };
+  SizeValueType m_ElementSize{ 0 };
+  SizeValueType m_CacheCapacity{ 64 };
+
+  mutable std::mutex         m_Mutex;
+  std::vector<Brick>         m_Bricks;
+  std::list<SizeValueType>   m_CachedBricks; // Most recently used first.
+  std::atomic<SizeValueType> m_Generation{ 0 };
+
+  TiledImageInternalPixel * m_InternalPixels{ nullptr };
+  SizeValueType             m_NumberOfInternalPixels{ 0 };
+};
+} // end namespace itk
+
+#endif
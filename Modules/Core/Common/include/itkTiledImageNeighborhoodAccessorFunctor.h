@@ -0,0 +1,96 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImageNeighborhoodAccessorFunctor_h
+#define itkTiledImageNeighborhoodAccessorFunctor_h
+
+#include "itkImageBoundaryCondition.h"
+#include "itkNeighborhood.h"
+
+namespace itk
+{
+/** \class TiledImageNeighborhoodAccessorFunctor
+ * \brief Provides accessor interfaces to access pixels of a TiledImage
+ * through neighborhood iterators.
+ *
+ * Like VectorImageNeighborhoodAccessorFunctor, the functor passes the
+ * offset of the internal pixel, from the beginning of the buffer, to the
+ * pixel accessor of the image.
+ *
+ * \sa TiledImage
+ * \sa TiledImagePixelAccessor
+ * \ingroup ImageAdaptors
+ * \ingroup ITKCommon
+ */
+template <typename TImage>
+class TiledImageNeighborhoodAccessorFunctor
+{
+public:
+  using ImageType = TImage;
+  using PixelType = typename ImageType::PixelType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using PixelAccessorType = typename ImageType::AccessorType;
+  using OffsetType = typename ImageType::OffsetType;
+
+  using NeighborhoodType = Neighborhood<InternalPixelType *, TImage::ImageDimension>;
+
+  template <typename TOutput = ImageType>
+  using ImageBoundaryConditionType = ImageBoundaryCondition<ImageType, TOutput>;
+
+  TiledImageNeighborhoodAccessorFunctor(const PixelAccessorType & accessor)
+    : m_PixelAccessor(accessor)
+  {}
+  TiledImageNeighborhoodAccessorFunctor() = default;
+
+  /** Set the pointer index to the start of the buffer. */
+  inline void
+  SetBegin(const InternalPixelType * begin)
+  {
+    this->m_Begin = begin;
+  }
+
+  /** Method to dereference a pixel pointer. */
+  inline PixelType
+  Get(const InternalPixelType * pixelPointer) const
+  {
+    return m_PixelAccessor.Get(*pixelPointer, pixelPointer - m_Begin);
+  }
+
+  /** Method to set the pixel value at a certain pixel pointer */
+  inline void
+  Set(InternalPixelType * const pixelPointer, const PixelType & p) const
+  {
+    m_PixelAccessor.Set(*pixelPointer, p, pixelPointer - m_Begin);
+  }
+
+  template <typename TOutput>
+  inline typename ImageBoundaryConditionType<TOutput>::OutputPixelType
+  BoundaryCondition(const OffsetType &                          point_index,
+                    const OffsetType &                          boundary_offset,
+                    const NeighborhoodType *                    data,
+                    const ImageBoundaryConditionType<TOutput> * boundaryCondition) const
+  {
+    return boundaryCondition->operator()(point_index, boundary_offset, data, *this);
+  }
+
+private:
+  PixelAccessorType         m_PixelAccessor;
+  const InternalPixelType * m_Begin{ nullptr }; // Begin of the buffer.
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,144 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImagePixelAccessor_h
+#define itkTiledImagePixelAccessor_h
+
+#include "itkTiledImageContainer.h"
+#include "itkSize.h"
+#include <limits>
+
+namespace itk
+{
+/** \class TiledImagePixelAccessor
+ * \brief Gives access to the pixels of a TiledImage.
+ *
+ * The accessor maps the offset of a pixel to its brick, and to its element
+ * in the brick. It keeps the last brick it accessed, so that the
+ * container is only queried when an iterator moves to another brick: each
+ * iterator should thus have its own accessor, as the image iterators do.
+ *
+ * \sa TiledImage
+ * \sa TiledImagePixelAccessorFunctor
+ * \ingroup ImageAdaptors
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension>
+class ITK_TEMPLATE_EXPORT TiledImagePixelAccessor
+{
+public:
+  using ExternalType = TPixel;
+  using InternalType = TiledImageInternalPixel;
+  using SizeType = Size<VImageDimension>;
+
+  TiledImagePixelAccessor() = default;
+
+  /** Constructor from the container, the offset table and the size of the
+   * buffered region, and the size of the bricks. */
+  TiledImagePixelAccessor(TiledImageContainer *   container,
+                          const OffsetValueType * offsetTable,
+                          const SizeType &        bufferSize,
+                          const SizeType &        brickSize)
+    : m_Container(container)
+  {
+    SizeValueType brickStride = 1;
+    SizeValueType elementStride = 1;
+    for (unsigned int i = 0; i < VImageDimension; ++i)
+    {
+      m_OffsetTable[i] = static_cast<SizeValueType>(offsetTable[i]);
+      m_BrickSize[i] = brickSize[i];
+      m_BrickStride[i] = brickStride;
+      m_ElementStride[i] = elementStride;
+      brickStride *= (bufferSize[i] + brickSize[i] - 1) / brickSize[i];
+      elementStride *= brickSize[i];
+    }
+  }
+
+  /** Set the pixel at the given offset. */
+  inline void
+  Set(InternalType & itkNotUsed(output), const ExternalType & input, SizeValueType offset) const
+  {
+    SizeValueType       element;
+    const SizeValueType brickIndex = this->ComputeBrickIndex(offset, element);
+    if (brickIndex != m_BrickIndex || !m_IsWritable)
+    {
+      this->AcquireBrick(brickIndex, true);
+    }
+    m_Elements[element] = input;
+  }
+
+  /** Get the pixel at the given offset. */
+  inline ExternalType
+  Get(const InternalType & itkNotUsed(input), SizeValueType offset) const
+  {
+    SizeValueType       element;
+    const SizeValueType brickIndex = this->ComputeBrickIndex(offset, element);
+    if (brickIndex != m_BrickIndex || (m_Elements == nullptr && m_Generation != m_Container->GetGeneration()))
+    {
+      this->AcquireBrick(brickIndex, false);
+    }
+    return m_Elements ? m_Elements[element] : m_UniformValue;
+  }
+
+private:
+  /** Compute the index of the brick of the pixel at the given offset, and
+   * the index of its element in the brick. */
+  inline SizeValueType
+  ComputeBrickIndex(SizeValueType offset, SizeValueType & element) const
+  {
+    SizeValueType brickIndex = 0;
+    element = 0;
+    for (unsigned int i = VImageDimension - 1; i > 0; --i)
+    {
+      const SizeValueType index = offset / m_OffsetTable[i];
+      offset -= index * m_OffsetTable[i];
+      brickIndex += (index / m_BrickSize[i]) * m_BrickStride[i];
+      element += (index % m_BrickSize[i]) * m_ElementStride[i];
+    }
+    brickIndex += offset / m_BrickSize[0];
+    element += offset % m_BrickSize[0];
+    return brickIndex;
+  }
+
+  void
+  AcquireBrick(SizeValueType brickIndex, bool forWriting) const
+  {
+    // Read before acquiring the brick, so that any later change is seen.
+    m_Generation = m_Container->GetGeneration();
+    m_Elements =
+      reinterpret_cast<TPixel *>(m_Container->AcquireBrick(brickIndex, forWriting, m_Buffer, &m_UniformValue));
+    m_BrickIndex = brickIndex;
+    m_IsWritable = forWriting;
+  }
+
+  TiledImageContainer * m_Container{ nullptr };
+  SizeValueType         m_OffsetTable[VImageDimension]{};
+  SizeValueType         m_BrickSize[VImageDimension]{};
+  SizeValueType         m_BrickStride[VImageDimension]{};
+  SizeValueType         m_ElementStride[VImageDimension]{};
+
+  // The last brick accessed.
+  mutable SizeValueType                    m_BrickIndex{ std::numeric_limits<SizeValueType>::max() };
+  mutable TPixel *                         m_Elements{ nullptr };
+  mutable TPixel                           m_UniformValue{};
+  mutable bool                             m_IsWritable{ false };
+  mutable SizeValueType                    m_Generation{ 0 };
+  mutable TiledImageContainer::BrickBuffer m_Buffer;
+};
+} // end namespace itk
+
+#endif
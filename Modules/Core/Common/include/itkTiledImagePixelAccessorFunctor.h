@@ -0,0 +1,100 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledImagePixelAccessorFunctor_h
+#define itkTiledImagePixelAccessorFunctor_h
+
+#include "itkMacro.h"
+
+namespace itk
+{
+/** \class TiledImagePixelAccessorFunctor
+ * \brief Provides the common API of the pixel accessor functors for TiledImage.
+ *
+ * Like DefaultVectorPixelAccessorFunctor, the functor passes the offset of
+ * the internal pixel, from the beginning of the buffer, to the pixel
+ * accessor, which maps it to the brick of the pixel.
+ *
+ * \sa TiledImagePixelAccessor
+ * \sa DefaultPixelAccessorFunctor
+ * \sa DefaultVectorPixelAccessorFunctor
+ * \ingroup ImageAdaptors
+ * \ingroup ITKCommon
+ */
+template <typename TImageType>
+class TiledImagePixelAccessorFunctor
+{
+public:
+  using ImageType = TImageType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using ExternalPixelType = typename ImageType::PixelType;
+  using PixelAccessorType = typename ImageType::AccessorType;
+  using VectorLengthType = unsigned int;
+
+  template <typename UImageType>
+  struct Rebind
+  {
+    using Type = TiledImagePixelAccessorFunctor<UImageType>;
+  };
+
+  static void
+  SetVectorLength(ImageType *, VectorLengthType)
+  {}
+
+  static VectorLengthType
+  GetVectorLength(const ImageType *)
+  {
+    return 1;
+  }
+
+  TiledImagePixelAccessorFunctor() = default;
+
+  /** Set the PixelAccessor. This is set at construction time by the image iterators. */
+  inline void
+  SetPixelAccessor(const PixelAccessorType & accessor)
+  {
+    m_PixelAccessor = accessor;
+  }
+
+  /** Set the pointer index to the start of the buffer. */
+  inline void
+  SetBegin(const InternalPixelType * begin)
+  {
+    this->m_Begin = begin;
+  }
+
+  /** Set output using the value in input */
+  inline void
+  Set(InternalPixelType & output, const ExternalPixelType & input) const
+  {
+    m_PixelAccessor.Set(output, input, (&output) - m_Begin);
+  }
+
+  /** Get the value from input */
+  inline ExternalPixelType
+  Get(const InternalPixelType & input) const
+  {
+    return m_PixelAccessor.Get(input, &input - m_Begin);
+  }
+
+private:
+  PixelAccessorType         m_PixelAccessor;    // The pixel accessor
+  const InternalPixelType * m_Begin{ nullptr }; // Begin of the buffer
+};
+} // namespace itk
+
+#endif
@@ -34,6 +34,9 @@ namespace itk
 template <typename TExpr1, typename TExpr2, typename TBinaryOp>
 struct VariableLengthVectorExpression;
 
+template <typename TValue>
+class VariableLengthVectorReference;
+
 /** \class VariableLengthVector
  * \brief Represents an array whose length can be defined at run-time.
  *
@@ -554,6 +557,24 @@ public:
   Self &
   operator=(const Self & v);
 
+  /** Assignment from the elements referenced by a \c
+   * VariableLengthVectorReference, without a temporary vector.
+   * \post \c m_LetArrayManageMemory is true
+   * \post <tt>GetSize() == v.GetSize()</tt>, modulo precision
+   */
+  template <typename T>
+  Self &
+  operator=(const VariableLengthVectorReference<T> & v)
+  {
+    ElementIdentifier const N = v.Size();
+    this->SetSize(N, DontShrinkToFit(), DumpOldValues());
+    for (ElementIdentifier i = 0; i < N; ++i)
+    {
+      this->m_Data[i] = static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+
   /** Fast Assignment.
    * \pre \c m_LetArrayManageMemory is true: the \c VariableLengthVector is not
    * a proxy, checked with an assertion. Call <tt>SetSize(GetSize(), NeverReallocate(),
@@ -848,6 +869,35 @@ public:
     return *this;
   }
 
+  /** Element-wise addition and subtraction of the elements referenced by a
+   * \c VariableLengthVectorReference, e.g. a pixel of an ImageBufferRange
+   * over a VectorImage.
+   * \throw None
+   * \pre `Size() == v.Size()`, checked with an assertion
+   */
+  template <typename T>
+  Self &
+  operator+=(const VariableLengthVectorReference<T> & v)
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumElements == v.GetSize());
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] += static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+  template <typename T>
+  Self &
+  operator-=(const VariableLengthVectorReference<T> & v)
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumElements == v.GetSize());
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] -= static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+
   /** Add scalar 's' to each element of the vector. */
   Self &
   operator+=(TValue s)
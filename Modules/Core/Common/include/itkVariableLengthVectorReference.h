@@ -0,0 +1,482 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkVariableLengthVectorReference_h
+#define itkVariableLengthVectorReference_h
+
+#include "itkVariableLengthVector.h"
+#include "itkMath.h"
+
+#include <type_traits>
+
+namespace itk
+{
+/** \class VariableLengthVectorReference
+ * \brief A reference to the elements of a variable length vector, which
+ * neither owns nor copies them.
+ *
+ * VariableLengthVectorReference is to a VariableLengthVector what a C++
+ * reference is to a fixed size pixel: it points to the components of a
+ * pixel stored in the buffer of a VectorImage, and its assignment and
+ * compound assignment operators modify these components in place. It is the
+ * \c reference type of the iterators of ImageBufferRange and ImageRegionRange
+ * over a VectorImage, so that
+   \code
+   for (auto && pixel : ImageBufferRange<VectorImageType>{ *image })
+   {
+     pixel *= 2.0;
+     pixel += offset;
+   }
+   \endcode
+ * does not allocate any memory. A reference is also an operand of the
+ * arithmetic expression templates of VariableLengthVector, e.g.
+ * `*it = *it1 + *it2 * 0.5` is evaluated element by element, without a
+ * temporary vector.
+ *
+ * The reference is converted to an owning VariableLengthVector, which copies
+ * the elements, when it is converted to the pixel type of the image, e.g. by
+ * `PixelType pixel = *it`. Hence the iterators of the ranges can be passed to
+ * standard algorithms, like \c std::sort, which store pixel values
+ * temporarily. The \c swap() overload swaps the referenced elements.
+ *
+ * \tparam TValue Type of the elements, const qualified for a read-only
+ * reference.
+ *
+ * \sa VariableLengthVector
+ * \sa ImageBufferRange
+ * \ingroup DataRepresentation
+ * \ingroup ITKCommon
+ */
+template <typename TValue>
+class VariableLengthVectorReference
+{
+public:
+  /** The element type, without its const qualifier. */
+  using ValueType = std::remove_const_t<TValue>;
+  using ComponentType = ValueType;
+  using RealValueType = typename NumericTraits<ValueType>::RealType;
+  using VectorType = VariableLengthVector<ValueType>;
+  using ElementIdentifier = unsigned int;
+
+  VariableLengthVectorReference() = delete;
+  VariableLengthVectorReference(const VariableLengthVectorReference &) noexcept = default;
+  ~VariableLengthVectorReference() = default;
+
+  /** Refers to the \c size elements starting at \c data. */
+  VariableLengthVectorReference(TValue * data, unsigned int size) noexcept
+    : m_Data(data)
+    , m_NumElements(size)
+  {}
+
+  /** Refers to the elements of a vector. */
+  VariableLengthVectorReference(
+    std::conditional_t<std::is_const<TValue>::value, const VectorType, VectorType> & v) noexcept
+    : m_Data(v.GetDataPointer())
+    , m_NumElements(v.GetSize())
+  {}
+
+  /** Allows implicit conversion from a non-const to a const reference. */
+  template <typename T, typename = std::enable_if_t<std::is_same<const T, TValue>::value>>
+  VariableLengthVectorReference(const VariableLengthVectorReference<T> & ref) noexcept
+    : m_Data(ref.GetDataPointer())
+    , m_NumElements(ref.GetSize())
+  {}
+
+  /** Copies the referenced elements of \c ref into the referenced elements.
+   * Like the assignment of a C++ reference, the assignment does not rebind
+   * the reference.
+   * \pre `Size() == ref.Size()`, checked with an assertion
+   */
+  VariableLengthVectorReference &
+  operator=(const VariableLengthVectorReference & ref) noexcept
+  {
+    return this->Assign(ref);
+  }
+
+  /** Copies the elements of a vector, a reference, or an expression template
+   * into the referenced elements, casting them to the ValueType.
+   * \pre `Size() == v.Size()`, checked with an assertion
+   */
+  template <typename TArray>
+  std::enable_if_t<mpl::IsArray<TArray>::Value, VariableLengthVectorReference &>
+  operator=(const TArray & v) noexcept
+  {
+    return this->Assign(v);
+  }
+
+  /** Assigns the value \c v to each referenced element. */
+  VariableLengthVectorReference &
+  operator=(const ValueType & v) noexcept
+  {
+    this->Fill(v);
+    return *this;
+  }
+
+  /** Set all the referenced elements to \c v. */
+  void
+  Fill(const ValueType & v) noexcept
+  {
+    std::fill_n(m_Data, m_NumElements, v);
+  }
+
+  /** Element-wise compound assignment with a vector, a reference, or an
+   * expression template.
+   * \pre `Size() == v.Size()`, checked with an assertion
+   */
+  template <typename TArray>
+  std::enable_if_t<mpl::IsArray<TArray>::Value, VariableLengthVectorReference &>
+  operator+=(const TArray & v) noexcept
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumElements == v.Size());
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] += static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+  template <typename TArray>
+  std::enable_if_t<mpl::IsArray<TArray>::Value, VariableLengthVectorReference &>
+  operator-=(const TArray & v) noexcept
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumElements == v.Size());
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] -= static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+
+  /** Adds or subtracts a scalar to each referenced element. */
+  VariableLengthVectorReference &
+  operator+=(ValueType s) noexcept
+  {
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] += s;
+    }
+    return *this;
+  }
+  VariableLengthVectorReference &
+  operator-=(ValueType s) noexcept
+  {
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] -= s;
+    }
+    return *this;
+  }
+
+  /** Multiplies each referenced element by a scalar, cast to the ValueType. */
+  template <typename T>
+  std::enable_if_t<mpl::IsNumber<T>::Value, VariableLengthVectorReference &>
+  operator*=(T s) noexcept
+  {
+    const auto sc = static_cast<ValueType>(s);
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] *= sc;
+    }
+    return *this;
+  }
+
+  /** Divides each referenced element by a scalar. Like VariableLengthVector,
+   * the division is computed with the RealValueType. */
+  template <typename T>
+  std::enable_if_t<mpl::IsNumber<T>::Value, VariableLengthVectorReference &>
+  operator/=(T s) noexcept
+  {
+    const RealValueType sc = s;
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] = static_cast<ValueType>(static_cast<RealValueType>(m_Data[i]) / sc);
+    }
+    return *this;
+  }
+
+  /** Returns an owning copy of the referenced elements. */
+  operator VectorType() const
+  {
+    VectorType result(m_NumElements);
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      result[i] = m_Data[i];
+    }
+    return result;
+  }
+
+  /** Return the number of referenced elements. */
+  unsigned int
+  Size() const noexcept
+  {
+    return m_NumElements;
+  }
+  unsigned int
+  GetSize() const noexcept
+  {
+    return m_NumElements;
+  }
+  unsigned int
+  GetNumberOfElements() const noexcept
+  {
+    return m_NumElements;
+  }
+
+  /** Return a reference to the element at specified index. No range checking.
+   * As for a C++ reference, the constness of the VariableLengthVectorReference
+   * itself does not apply to the referenced elements. */
+  TValue & operator[](unsigned int i) const noexcept { return m_Data[i]; }
+
+  /** Get/Set one element. */
+  const TValue &
+  GetElement(unsigned int i) const noexcept
+  {
+    return m_Data[i];
+  }
+  void
+  SetElement(unsigned int i, const ValueType & value) const noexcept
+  {
+    m_Data[i] = value;
+  }
+
+  /** Return a pointer to the referenced elements. */
+  TValue *
+  GetDataPointer() const noexcept
+  {
+    return m_Data;
+  }
+
+  /** Returns the Euclidean norm of the referenced elements. */
+  RealValueType
+  GetNorm() const
+  {
+    return itk::GetNorm(*this);
+  }
+
+  /** Returns the squared Euclidean norm of the referenced elements. */
+  RealValueType
+  GetSquaredNorm() const
+  {
+    return itk::GetSquaredNorm(*this);
+  }
+
+  /** Swaps the referenced elements, not the references.
+   * \pre `lhs.Size() == rhs.Size()`, checked with an assertion
+   */
+  friend void
+  swap(VariableLengthVectorReference lhs, VariableLengthVectorReference rhs) noexcept
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(lhs.m_NumElements == rhs.m_NumElements);
+    std::swap_ranges(lhs.m_Data, lhs.m_Data + lhs.m_NumElements, rhs.m_Data);
+  }
+
+private:
+  template <typename TArray>
+  VariableLengthVectorReference &
+  Assign(const TArray & v) noexcept
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumElements == v.Size());
+    for (ElementIdentifier i = 0; i < m_NumElements; ++i)
+    {
+      m_Data[i] = static_cast<ValueType>(v[i]);
+    }
+    return *this;
+  }
+
+  TValue *     m_Data;
+  unsigned int m_NumElements;
+};
+
+/// \cond HIDE_META_PROGRAMMING
+namespace mpl
+{
+/// \cond SPECIALIZATION_IMPLEMENTATION
+template <typename T>
+struct IsArray<itk::VariableLengthVectorReference<T>> : TrueType
+{};
+/// \endcond
+} // namespace mpl
+
+namespace Details
+{
+/// \cond SPECIALIZATION_IMPLEMENTATION
+template <typename T>
+struct GetType<VariableLengthVectorReference<T>>
+{
+  using Type = std::remove_const_t<T>;
+  static Type
+  Load(VariableLengthVectorReference<T> const & v, unsigned int idx)
+  {
+    return v[idx];
+  }
+};
+
+template <typename T>
+struct IsVariableLengthVectorReference : FalseType
+{};
+template <typename T>
+struct IsVariableLengthVectorReference<VariableLengthVectorReference<T>> : TrueType
+{};
+
+template <typename TArray1, typename TArray2>
+inline bool
+ElementsAreEqual(const TArray1 & lhs, const TArray2 & rhs)
+{
+  if (lhs.Size() != rhs.Size())
+  {
+    return false;
+  }
+  for (unsigned int i = 0; i < lhs.Size(); ++i)
+  {
+    if (Math::NotExactlyEquals(lhs[i], rhs[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+/// \endcond
+} // namespace Details
+/// \endcond
+
+/**\name Comparison of the referenced elements */
+//@{
+/** Element-wise comparison of a VariableLengthVectorReference with a vector,
+ * a reference, or an expression template.
+ * \relates itk::VariableLengthVectorReference
+ */
+template <typename T, typename TArray>
+inline std::enable_if_t<mpl::IsArray<TArray>::Value, bool>
+operator==(const VariableLengthVectorReference<T> & lhs, const TArray & rhs)
+{
+  return Details::ElementsAreEqual(lhs, rhs);
+}
+template <typename TArray, typename T>
+inline std::enable_if_t<mpl::IsArray<TArray>::Value && !Details::IsVariableLengthVectorReference<TArray>::Value, bool>
+operator==(const TArray & lhs, const VariableLengthVectorReference<T> & rhs)
+{
+  return Details::ElementsAreEqual(lhs, rhs);
+}
+template <typename T, typename TArray>
+inline std::enable_if_t<mpl::IsArray<TArray>::Value, bool>
+operator!=(const VariableLengthVectorReference<T> & lhs, const TArray & rhs)
+{
+  return !(lhs == rhs);
+}
+template <typename TArray, typename T>
+inline std::enable_if_t<mpl::IsArray<TArray>::Value && !Details::IsVariableLengthVectorReference<TArray>::Value, bool>
+operator!=(const TArray & lhs, const VariableLengthVectorReference<T> & rhs)
+{
+  return !(lhs == rhs);
+}
+//@}
+
+/** Serialization of \c VariableLengthVectorReference
+ * \relates itk::VariableLengthVectorReference
+ */
+template <typename T>
+std::ostream &
+operator<<(std::ostream & os, const VariableLengthVectorReference<T> & v)
+{
+  os << "[";
+  if (v.Size() != 0)
+  {
+    os << v[0];
+    for (unsigned int i = 1, N = v.Size(); i != N; ++i)
+    {
+      os << ", " << v[i];
+    }
+  }
+  return os << "]";
+}
+
+/** \brief Define numeric traits for VariableLengthVectorReference.
+ *
+ * The traits are those of the VariableLengthVector of the referenced
+ * elements: the values returned by ZeroValue(), OneValue(), etc. are owning
+ * vectors of the length of the reference.
+ *
+ * \sa NumericTraits<VariableLengthVector<T>>
+ * \ingroup DataRepresentation
+ * \ingroup ITKCommon
+ */
+template <typename T>
+class NumericTraits<VariableLengthVectorReference<T>>
+  : public NumericTraits<VariableLengthVector<std::remove_const_t<T>>>
+{
+public:
+  using Superclass = NumericTraits<VariableLengthVector<std::remove_const_t<T>>>;
+  using ValueType = std::remove_const_t<T>;
+  using typename Superclass::Self;
+  using ReferenceType = VariableLengthVectorReference<T>;
+
+  using Superclass::max;
+  using Superclass::min;
+  using Superclass::ZeroValue;
+  using Superclass::OneValue;
+  using Superclass::NonpositiveMin;
+  using Superclass::GetLength;
+
+  static const Self
+  max(const ReferenceType & a)
+  {
+    return FilledVector(a, NumericTraits<ValueType>::max());
+  }
+
+  static const Self
+  min(const ReferenceType & a)
+  {
+    return FilledVector(a, NumericTraits<ValueType>::min());
+  }
+
+  static const Self
+  ZeroValue(const ReferenceType & a)
+  {
+    return FilledVector(a, NumericTraits<ValueType>::ZeroValue());
+  }
+
+  static const Self
+  OneValue(const ReferenceType & a)
+  {
+    return FilledVector(a, NumericTraits<ValueType>::OneValue());
+  }
+
+  static const Self
+  NonpositiveMin(const ReferenceType & a)
+  {
+    return FilledVector(a, NumericTraits<ValueType>::NonpositiveMin());
+  }
+
+  /** Return the number of referenced elements. A reference cannot be
+   * resized, hence there is no SetLength(). */
+  static unsigned int
+  GetLength(const ReferenceType & m)
+  {
+    return m.GetSize();
+  }
+
+private:
+  static Self
+  FilledVector(const ReferenceType & a, const ValueType & value)
+  {
+    Self b(a.Size());
+    b.Fill(value);
+    return b;
+  }
+};
+} // namespace itk
+
+#endif
@@ -366,6 +366,13 @@ public:
   void
   SetNumberOfComponentsPerPixel(unsigned int n) override;
 
+  /** Get the number of bytes of the pixels of the RequestedRegion. */
+  SizeValueType
+  GetRequestedRegionSizeInBytes() const override
+  {
+    return this->GetRequestedRegion().GetNumberOfPixels() * m_VectorLength * sizeof(InternalPixelType);
+  }
+
 protected:
   VectorImage();
   void
@@ -0,0 +1,273 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWorkStealingThreadPool_h
+#define itkWorkStealingThreadPool_h
+
+#include "itkConfigure.h"
+#include "itkIntTypes.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include "itkSingletonMacro.h"
+
+
+namespace itk
+{
+
+/** \class WorkStealingDeque
+ * \brief Lock-free double-ended task queue owned by one worker thread.
+ *
+ * Implements the dynamic circular work-stealing deque of Chase and Lev,
+ * using the C11 memory model formulation of Le, Pop, Cohen and Zappa Nardelli
+ * ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+ *
+ * Only the owning thread may call Push() and Pop(), which operate on the
+ * bottom end of the deque in LIFO order. Any thread may call Steal(), which
+ * takes the oldest task from the top end. The deque stores non-owning task
+ * pointers; ownership is managed by WorkStealingThreadPool.
+ *
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT WorkStealingDeque
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(WorkStealingDeque);
+
+  using TaskType = std::function<void()>;
+
+  explicit WorkStealingDeque(int64_t initialCapacity = 256);
+  ~WorkStealingDeque();
+
+  /** Add a task to the bottom of the deque. Owner thread only. */
+  void
+  Push(TaskType * task);
+
+  /** Remove the most recently pushed task, or return nullptr if the deque is
+   * empty. Owner thread only. */
+  TaskType *
+  Pop();
+
+  /** Remove the oldest task, or return nullptr if the deque is empty or if
+   * another thread won the race for that task. Safe from any thread. */
+  TaskType *
+  Steal();
+
+  /** The approximate number of tasks in the deque. */
+  int64_t
+  GetApproximateSize() const;
+
+private:
+  class RingBuffer;
+
+  std::atomic<int64_t> m_Top{ 0 };
+  // Keep the two indices on separate cache lines, since thieves write m_Top
+  // while the owner writes m_Bottom.
+  char                 m_Padding[64 - sizeof(std::atomic<int64_t>)];
+  std::atomic<int64_t> m_Bottom{ 0 };
+
+  std::atomic<RingBuffer *> m_Buffer;
+
+  /** Buffers replaced by Push() when growing. Thieves may still be reading
+   * them, so they are only released when the deque is destroyed. */
+  std::vector<std::unique_ptr<RingBuffer>> m_RetiredBuffers;
+};
+
+
+/**
+ * \class WorkStealingThreadPool
+ * \brief Thread pool in which every worker owns a lock-free task deque,
+ * and idle workers steal tasks from each other.
+ *
+ * Work submitted by a worker thread (for example by a nested call to
+ * WorkStealingMultiThreader::ParallelizeImageRegion) is pushed onto that
+ * worker's own deque, so nested parallel regions run on the same pool
+ * without contending on a shared queue. Work submitted by any other thread
+ * is placed in a shared injection queue. Threads waiting for a result can
+ * call WaitFor(), which executes pending tasks instead of blocking, so
+ * nested parallel regions cannot deadlock the pool.
+ *
+ * This pool is the back end of WorkStealingMultiThreader, and is
+ * initialized with GlobalDefaultNumberOfThreads worker threads.
+ *
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+
+struct WorkStealingThreadPoolGlobals;
+
+class ITKCommon_EXPORT WorkStealingThreadPool : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(WorkStealingThreadPool);
+
+  /** Standard class type aliases. */
+  using Self = WorkStealingThreadPool;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using TaskType = WorkStealingDeque::TaskType;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(WorkStealingThreadPool, Object);
+
+  /** Returns the global instance */
+  static Pointer
+  New();
+
+  /** Returns the global singleton instance of the WorkStealingThreadPool */
+  static Pointer
+  GetInstance();
+
+  /** Add this job to the thread pool.
+   *
+   * When called from one of the pool's worker threads, the job is pushed
+   * onto that worker's own deque. Otherwise it is placed in the shared
+   * injection queue. The returned std::future should be waited upon with
+   * WaitFor(), to let the waiting thread help with pending work. */
+  template <class Function, class... Arguments>
+  auto
+  AddWork(Function && function, Arguments &&... arguments) -> std::future<std::result_of_t<Function(Arguments...)>>
+  {
+    using return_type = std::result_of_t<Function(Arguments...)>;
+
+    auto task = std::make_shared<std::packaged_task<return_type()>>(
+      std::bind(std::forward<Function>(function), std::forward<Arguments>(arguments)...));
+
+    std::future<return_type> res = task->get_future();
+    this->Submit(new TaskType([task]() { (*task)(); }));
+    return res;
+  }
+
+  /** Block until the future is ready, executing other pending tasks of
+   * this pool in the meantime. */
+  template <class T>
+  void
+  WaitFor(const std::future<T> & future)
+  {
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+      if (!this->ExecutePendingTask())
+      {
+        future.wait_for(std::chrono::microseconds(100));
+      }
+    }
+  }
+
+  /** Take one pending task from this pool, and execute it on the calling
+   * thread. Returns false when no task could be found. */
+  bool
+  ExecutePendingTask();
+
+  /** Can call this method if we want to add extra threads to the pool. */
+  void
+  AddThreads(ThreadIdType count);
+
+  ThreadIdType
+  GetMaximumNumberOfThreads() const
+  {
+    return m_NumberOfWorkers.load(std::memory_order_acquire);
+  }
+
+  /** The approximate number of idle threads. */
+  int
+  GetNumberOfCurrentlyIdleThreads() const;
+
+  /** Whether the calling thread is one of this pool's worker threads. */
+  bool
+  IsWorkerThread() const;
+
+protected:
+  WorkStealingThreadPool();
+
+  /** Stop the pool and release threads. To be called by the destructor and atfork. */
+  void
+  CleanUp();
+
+  ~WorkStealingThreadPool() override;
+
+  static void
+  PrepareForFork();
+  static void
+  ResumeFromFork();
+
+  /** Queue the task, and wake up an idle worker. Takes ownership of task. */
+  void
+  Submit(TaskType * task);
+
+  /** Look for a task in the worker's own deque, in the injection queue,
+   * and in the other workers' deques, in that order. A workerIndex beyond
+   * the number of workers denotes a thread outside the pool. */
+  TaskType *
+  FindTask(ThreadIdType workerIndex);
+
+private:
+  /** Only used to synchronize the global variable across static libraries.*/
+  itkGetGlobalDeclarationMacro(WorkStealingThreadPoolGlobals, PimplGlobals);
+
+  /** Start a worker thread, and its deque. Not concurrent thread safe. */
+  void
+  StartWorker();
+
+  /** One deque per worker thread. It is reserved for ITK_MAX_THREADS
+   * entries at construction, so it never reallocates, and thieves may read
+   * the first m_NumberOfWorkers entries without locking. */
+  std::vector<std::unique_ptr<WorkStealingDeque>> m_Deques;
+
+  /** Jobs submitted by threads which are not workers of this pool. */
+  std::deque<TaskType *> m_InjectionQueue;
+
+  /** Number of tasks which were submitted, but not yet taken by a thread. */
+  std::atomic<int64_t> m_NumberOfQueuedTasks{ 0 };
+
+  /** Number of workers which are waiting on m_Condition. */
+  std::atomic<int> m_NumberOfSleepingWorkers{ 0 };
+
+  std::atomic<ThreadIdType> m_NumberOfWorkers{ 0 };
+
+  /** When a worker finds no task, it waits on m_Condition. */
+  std::condition_variable m_Condition;
+
+  /** Vector to hold all thread handles.
+   * Thread handles are used to delete (join) the threads. */
+  std::vector<std::thread> m_Threads;
+
+  /* Has destruction started? */
+  bool m_Stopping{ false };
+
+  /** To lock on the internal variables */
+  static WorkStealingThreadPoolGlobals * m_PimplGlobals;
+
+  /** The continuously running thread function */
+  static void
+  ThreadExecute(ThreadIdType workerIndex);
+};
+
+} // namespace itk
+#endif
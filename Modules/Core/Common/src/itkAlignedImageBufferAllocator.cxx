@@ -0,0 +1,85 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkAlignedImageBufferAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#if defined(_WIN32)
+#  include <malloc.h>
+#endif
+
+namespace itk
+{
+
+void *
+AlignedImageBufferAllocator::AllocateAligned(SizeValueType numberOfBytes, SizeValueType alignment)
+{
+  // Zero byte allocations still have to return a unique pointer.
+  numberOfBytes = std::max<SizeValueType>(numberOfBytes, 1);
+#if defined(_WIN32)
+  return _aligned_malloc(numberOfBytes, alignment);
+#else
+  void * buffer = nullptr;
+  if (posix_memalign(&buffer, alignment, numberOfBytes) != 0)
+  {
+    return nullptr;
+  }
+  return buffer;
+#endif
+}
+
+void *
+AlignedImageBufferAllocator::Allocate(SizeValueType numberOfBytes)
+{
+  return AllocateAligned(numberOfBytes, m_Alignment);
+}
+
+void
+AlignedImageBufferAllocator::Deallocate(void * buffer, SizeValueType itkNotUsed(numberOfBytes))
+{
+#if defined(_WIN32)
+  _aligned_free(buffer);
+#else
+  free(buffer);
+#endif
+}
+
+void
+AlignedImageBufferAllocator::SetAlignment(SizeValueType alignment)
+{
+  SizeValueType powerOfTwo = sizeof(void *);
+  while (powerOfTwo < alignment)
+  {
+    powerOfTwo *= 2;
+  }
+  if (m_Alignment != powerOfTwo)
+  {
+    m_Alignment = powerOfTwo;
+    this->Modified();
+  }
+}
+
+void
+AlignedImageBufferAllocator::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Alignment: " << m_Alignment << std::endl;
+}
+
+} // end namespace itk
@@ -0,0 +1,245 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkComponentConverter.h"
+#include <array>
+#include <atomic>
+#include <tuple>
+#include <utility>
+
+// The kernels are compiled for AVX2 and AVX-512 with the target attribute
+// of GCC and Clang, and selected with __builtin_cpu_supports().
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__amd64__)) &&                      \
+  !defined(ITK_WRAPPING_PARSER)
+#  define ITK_COMPONENT_CONVERTER_TARGETS 1
+#  define ITK_COMPONENT_CONVERTER_AVX2 __attribute__((target("avx2")))
+#  define ITK_COMPONENT_CONVERTER_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#else
+#  define ITK_COMPONENT_CONVERTER_TARGETS 0
+#endif
+
+namespace itk
+{
+namespace
+{
+// The order of the types matches ComponentConverter::TypeIndex.
+using ComponentTypes = std::tuple<signed char,
+                                  unsigned char,
+                                  short,
+                                  unsigned short,
+                                  int,
+                                  unsigned int,
+                                  long,
+                                  unsigned long,
+                                  long long,
+                                  unsigned long long,
+                                  float,
+                                  double>;
+
+constexpr size_t NumberOfComponentTypes = std::tuple_size<ComponentTypes>::value;
+
+using ConvertFunctionType = void (*)(const void *, void *, SizeValueType);
+using ConvertFunctionRow = std::array<ConvertFunctionType, NumberOfComponentTypes>;
+using ConvertFunctionTable = std::array<ConvertFunctionRow, NumberOfComponentTypes>;
+
+// The loops are written so that the compiler vectorizes them: the kernels
+// only differ by the instruction set they are compiled for.
+struct BaselineKernel
+{
+  template <typename TInput, typename TOutput>
+  static void
+  Convert(const void * input, void * output, SizeValueType numberOfValues)
+  {
+    const auto * const in = static_cast<const TInput *>(input);
+    auto * const       out = static_cast<TOutput *>(output);
+    for (SizeValueType i = 0; i < numberOfValues; ++i)
+    {
+      out[i] = static_cast<TOutput>(in[i]);
+    }
+  }
+};
+
+#if ITK_COMPONENT_CONVERTER_TARGETS
+struct AVX2Kernel
+{
+  template <typename TInput, typename TOutput>
+  ITK_COMPONENT_CONVERTER_AVX2 static void
+  Convert(const void * input, void * output, SizeValueType numberOfValues)
+  {
+    const auto * const in = static_cast<const TInput *>(input);
+    auto * const       out = static_cast<TOutput *>(output);
+    for (SizeValueType i = 0; i < numberOfValues; ++i)
+    {
+      out[i] = static_cast<TOutput>(in[i]);
+    }
+  }
+};
+
+struct AVX512Kernel
+{
+  template <typename TInput, typename TOutput>
+  ITK_COMPONENT_CONVERTER_AVX512 static void
+  Convert(const void * input, void * output, SizeValueType numberOfValues)
+  {
+    const auto * const in = static_cast<const TInput *>(input);
+    auto * const       out = static_cast<TOutput *>(output);
+    for (SizeValueType i = 0; i < numberOfValues; ++i)
+    {
+      out[i] = static_cast<TOutput>(in[i]);
+    }
+  }
+};
+#endif
+
+template <typename TKernel, typename TInput, size_t... VOutputIndices>
+constexpr ConvertFunctionRow
+MakeConvertFunctionRow(std::index_sequence<VOutputIndices...>)
+{
+  return { { &TKernel::template Convert<TInput, std::tuple_element_t<VOutputIndices, ComponentTypes>>... } };
+}
+
+template <typename TKernel, size_t... VInputIndices>
+constexpr ConvertFunctionTable
+MakeConvertFunctionTable(std::index_sequence<VInputIndices...>)
+{
+  return { { MakeConvertFunctionRow<TKernel, std::tuple_element_t<VInputIndices, ComponentTypes>>(
+    std::make_index_sequence<NumberOfComponentTypes>())... } };
+}
+
+template <typename TKernel>
+const ConvertFunctionTable &
+GetConvertFunctionTable()
+{
+  static const ConvertFunctionTable table =
+    MakeConvertFunctionTable<TKernel>(std::make_index_sequence<NumberOfComponentTypes>());
+  return table;
+}
+
+bool
+ProcessorSupports(ComponentConverterEnums::InstructionSet instructionSet)
+{
+  switch (instructionSet)
+  {
+    case ComponentConverterEnums::InstructionSet::Baseline:
+      return true;
+#if ITK_COMPONENT_CONVERTER_TARGETS
+    case ComponentConverterEnums::InstructionSet::AVX2:
+      return __builtin_cpu_supports("avx2");
+    case ComponentConverterEnums::InstructionSet::AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+#endif
+    default:
+      return false;
+  }
+}
+
+std::atomic<ComponentConverterEnums::InstructionSet> maximumInstructionSet{
+  ComponentConverterEnums::InstructionSet::AVX512
+};
+
+// The table of the widest instruction set supported, up to the maximum.
+std::atomic<const ConvertFunctionTable *> convertFunctionTable{ nullptr };
+
+const ConvertFunctionTable &
+SelectConvertFunctionTable()
+{
+  switch (ComponentConverter::GetInstructionSet())
+  {
+#if ITK_COMPONENT_CONVERTER_TARGETS
+    case ComponentConverterEnums::InstructionSet::AVX512:
+      return GetConvertFunctionTable<AVX512Kernel>();
+    case ComponentConverterEnums::InstructionSet::AVX2:
+      return GetConvertFunctionTable<AVX2Kernel>();
+#endif
+    default:
+      return GetConvertFunctionTable<BaselineKernel>();
+  }
+}
+} // end anonymous namespace
+
+auto
+ComponentConverter::GetInstructionSet() -> InstructionSetEnum
+{
+  const InstructionSetEnum maximum = maximumInstructionSet;
+  for (const auto instructionSet : { InstructionSetEnum::AVX512, InstructionSetEnum::AVX2 })
+  {
+    if (instructionSet <= maximum && IsInstructionSetAvailable(instructionSet))
+    {
+      return instructionSet;
+    }
+  }
+  return InstructionSetEnum::Baseline;
+}
+
+void
+ComponentConverter::SetMaximumInstructionSet(InstructionSetEnum instructionSet)
+{
+  maximumInstructionSet = instructionSet;
+  convertFunctionTable = &SelectConvertFunctionTable();
+}
+
+auto
+ComponentConverter::GetMaximumInstructionSet() -> InstructionSetEnum
+{
+  return maximumInstructionSet;
+}
+
+bool
+ComponentConverter::IsInstructionSetAvailable(InstructionSetEnum instructionSet)
+{
+  static const bool available[] = { ProcessorSupports(InstructionSetEnum::Baseline),
+                                    ProcessorSupports(InstructionSetEnum::AVX2),
+                                    ProcessorSupports(InstructionSetEnum::AVX512) };
+  const auto        index = static_cast<size_t>(instructionSet);
+  return index < sizeof(available) / sizeof(available[0]) && available[index];
+}
+
+void
+ComponentConverter::ConvertBuffer(int           inputType,
+                                  const void *  input,
+                                  int           outputType,
+                                  void *        output,
+                                  SizeValueType numberOfValues)
+{
+  const ConvertFunctionTable * table = convertFunctionTable;
+  if (table == nullptr)
+  {
+    table = &SelectConvertFunctionTable();
+    convertFunctionTable = table;
+  }
+  (*table)[inputType][outputType](input, output, numberOfValues);
+}
+
+std::ostream &
+operator<<(std::ostream & out, const ComponentConverterEnums::InstructionSet value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case ComponentConverterEnums::InstructionSet::Baseline:
+        return "itk::ComponentConverterEnums::InstructionSet::Baseline";
+      case ComponentConverterEnums::InstructionSet::AVX2:
+        return "itk::ComponentConverterEnums::InstructionSet::AVX2";
+      case ComponentConverterEnums::InstructionSet::AVX512:
+        return "itk::ComponentConverterEnums::InstructionSet::AVX512";
+      default:
+        return "INVALID VALUE FOR itk::ComponentConverterEnums::InstructionSet";
+    }
+  }();
+}
+} // end namespace itk
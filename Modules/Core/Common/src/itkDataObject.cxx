@@ -28,6 +28,9 @@
 #include "itkProcessObject.h"
 #include "itkSingleton.h"
 
+#include <set>
+#include <vector>
+
 namespace itk
 {
 
@@ -362,6 +365,53 @@ DataObject::PropagateRequestedRegion()
   }
 }
 
+//----------------------------------------------------------------------------
+SizeValueType
+DataObject::EstimateMemoryForRequestedRegion()
+{
+  this->UpdateOutputInformation();
+  this->PropagateRequestedRegion();
+
+  // Walk the part of the pipeline which needs to execute, counting each
+  // output once, even if it is the input of several filters.
+  SizeValueType                numberOfBytes = 0;
+  std::set<const DataObject *> visited;
+  std::vector<DataObject *>    dataObjects{ this };
+  while (!dataObjects.empty())
+  {
+    DataObject * const dataObject = dataObjects.back();
+    dataObjects.pop_back();
+    if (!visited.insert(dataObject).second)
+    {
+      continue;
+    }
+    ProcessObject * const source = dataObject->GetSource();
+    if (source == nullptr || !(dataObject->m_UpdateMTime < dataObject->m_PipelineMTime || dataObject->m_DataReleased ||
+                               dataObject->RequestedRegionIsOutsideOfTheBufferedRegion()))
+    {
+      continue;
+    }
+    numberOfBytes += dataObject->GetRequestedRegionSizeInBytes();
+
+    // The source allocates all its outputs when it executes.
+    for (const auto & output : source->GetOutputs())
+    {
+      if (output && visited.insert(output.GetPointer()).second)
+      {
+        numberOfBytes += output->GetRequestedRegionSizeInBytes();
+      }
+    }
+    for (const auto & input : source->GetInputs())
+    {
+      if (input)
+      {
+        dataObjects.push_back(input.GetPointer());
+      }
+    }
+  }
+  return numberOfBytes;
+}
+
 //----------------------------------------------------------------------------
 void
 DataObject::UpdateOutputData()
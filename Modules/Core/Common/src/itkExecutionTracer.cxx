@@ -0,0 +1,257 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkExecutionTracer.h"
+#include "itksys/SystemTools.hxx"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+
+std::atomic<bool> ExecutionTracer::m_Enabled{ false };
+
+namespace
+{
+struct TraceEvent
+{
+  char          m_Phase;
+  const char *  m_Category;
+  std::string   m_Name;
+  double        m_TimeStamp;
+  double        m_Duration;
+  unsigned int  m_ThreadID;
+  SizeValueType m_Value;
+};
+
+struct ExecutionTracerGlobals
+{
+  std::mutex                m_Mutex;
+  std::vector<TraceEvent>   m_Events;
+  std::string               m_FileName;
+  std::atomic<std::int64_t> m_StartTime{ 0 };
+  std::atomic<unsigned int> m_NumberOfThreads{ 0 };
+};
+
+ExecutionTracerGlobals &
+GetExecutionTracerGlobals()
+{
+  static ExecutionTracerGlobals globals;
+  return globals;
+}
+
+std::int64_t
+GetSteadyClockTime()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+/** A small identifier of the calling thread, numbered in the order the
+ * threads record their first event. */
+unsigned int
+GetTraceThreadID()
+{
+  thread_local const unsigned int threadID = GetExecutionTracerGlobals().m_NumberOfThreads++;
+  return threadID;
+}
+
+void
+WriteJSONString(std::ostream & os, const std::string & str)
+{
+  os << '"';
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      os << ' ';
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+/** Starts tracing when ITK_TRACE_FILE is set, and writes the trace of a
+ * tracing still started at exit. */
+class ExecutionTracerEnvironmentInitializer
+{
+public:
+  ExecutionTracerEnvironmentInitializer()
+  {
+    // Construct the globals first, so that they are destroyed last.
+    GetExecutionTracerGlobals();
+
+    std::string fileName;
+    if (itksys::SystemTools::GetEnv("ITK_TRACE_FILE", fileName) && !fileName.empty())
+    {
+      ExecutionTracer::Start(fileName);
+    }
+  }
+
+  ~ExecutionTracerEnvironmentInitializer()
+  {
+    if (ExecutionTracer::GetEnabled())
+    {
+      try
+      {
+        ExecutionTracer::Stop();
+      }
+      catch (const ExceptionObject & e)
+      {
+        std::cerr << e.GetDescription() << std::endl;
+      }
+    }
+  }
+};
+
+const ExecutionTracerEnvironmentInitializer executionTracerEnvironmentInitializer;
+} // namespace
+
+
+void
+ExecutionTracer::Start(const std::string & fileName)
+{
+  ExecutionTracerGlobals &    globals = GetExecutionTracerGlobals();
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+  globals.m_Events.clear();
+  globals.m_FileName = fileName;
+  globals.m_StartTime = GetSteadyClockTime();
+  m_Enabled = true;
+}
+
+void
+ExecutionTracer::Stop()
+{
+  m_Enabled = false;
+
+  ExecutionTracerGlobals & globals = GetExecutionTracerGlobals();
+  std::string              fileName;
+  {
+    std::lock_guard<std::mutex> lock(globals.m_Mutex);
+    fileName = globals.m_FileName;
+  }
+  if (fileName.empty())
+  {
+    return;
+  }
+
+  std::ofstream file(fileName.c_str());
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot open trace file " << fileName);
+  }
+  WriteTrace(file);
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot write trace file " << fileName);
+  }
+
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+  globals.m_Events.clear();
+  globals.m_FileName.clear();
+}
+
+void
+ExecutionTracer::WriteTrace(std::ostream & os)
+{
+  ExecutionTracerGlobals &    globals = GetExecutionTracerGlobals();
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+
+  os << "{\"traceEvents\":[";
+  const char * separator = "\n";
+  for (const TraceEvent & event : globals.m_Events)
+  {
+    os << separator << "{\"name\":";
+    WriteJSONString(os, event.m_Name);
+    os << ",\"cat\":\"" << event.m_Category << "\",\"ph\":\"" << event.m_Phase << '"' << std::fixed
+       << std::setprecision(3) << ",\"ts\":" << event.m_TimeStamp;
+    if (event.m_Phase == 'X')
+    {
+      os << ",\"dur\":" << event.m_Duration;
+    }
+    else
+    {
+      os << ",\"s\":\"t\"";
+    }
+    os << ",\"pid\":1,\"tid\":" << event.m_ThreadID;
+    if (event.m_Value != 0)
+    {
+      os << ",\"args\":{\"" << (event.m_Phase == 'X' ? "size" : "bytes") << "\":" << event.m_Value << '}';
+    }
+    os << '}';
+    separator = ",\n";
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+SizeValueType
+ExecutionTracer::GetNumberOfEvents()
+{
+  ExecutionTracerGlobals &    globals = GetExecutionTracerGlobals();
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+  return globals.m_Events.size();
+}
+
+double
+ExecutionTracer::GetTimeStamp()
+{
+  return (GetSteadyClockTime() - GetExecutionTracerGlobals().m_StartTime) * 1e-3;
+}
+
+void
+ExecutionTracer::AddSpan(const char * category, std::string name, double startTimeStamp, SizeValueType size)
+{
+  const double       duration = GetTimeStamp() - startTimeStamp;
+  const unsigned int threadID = GetTraceThreadID();
+
+  ExecutionTracerGlobals &    globals = GetExecutionTracerGlobals();
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+  if (m_Enabled)
+  {
+    globals.m_Events.push_back(
+      TraceEvent{ 'X', category, std::move(name), startTimeStamp, duration, threadID, size });
+  }
+}
+
+void
+ExecutionTracer::AddAllocation(const char * name, SizeValueType numberOfBytes)
+{
+  const double       timeStamp = GetTimeStamp();
+  const unsigned int threadID = GetTraceThreadID();
+
+  ExecutionTracerGlobals &    globals = GetExecutionTracerGlobals();
+  std::lock_guard<std::mutex> lock(globals.m_Mutex);
+  if (m_Enabled)
+  {
+    globals.m_Events.push_back(TraceEvent{ 'i', "Allocation", name, timeStamp, 0.0, threadID, numberOfBytes });
+  }
+}
+
+} // end namespace itk
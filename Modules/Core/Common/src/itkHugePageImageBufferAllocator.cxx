@@ -0,0 +1,60 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkHugePageImageBufferAllocator.h"
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+
+namespace itk
+{
+
+constexpr SizeValueType HugePageImageBufferAllocator::HugePageSize;
+
+void *
+HugePageImageBufferAllocator::Allocate(SizeValueType numberOfBytes)
+{
+  if (numberOfBytes < m_MinimumBufferSize)
+  {
+    return Superclass::Allocate(numberOfBytes);
+  }
+
+  // Round the size up to whole huge pages, so that the last one can be
+  // backed by a huge page as well.
+  const SizeValueType hugePagesSize = (numberOfBytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+  void * const        buffer = AllocateAligned(hugePagesSize, HugePageSize);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (buffer != nullptr)
+  {
+    // Only a hint: when transparent huge pages are disabled, the buffer is
+    // backed by regular pages.
+    madvise(buffer, hugePagesSize, MADV_HUGEPAGE);
+  }
+#endif
+  return buffer;
+}
+
+void
+HugePageImageBufferAllocator::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "MinimumBufferSize: " << m_MinimumBufferSize << std::endl;
+}
+
+} // end namespace itk
@@ -0,0 +1,88 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferAllocator.h"
+#include "itkAlignedImageBufferAllocator.h"
+#include "itkHugePageImageBufferAllocator.h"
+#include "itkImageBufferPool.h"
+#include "itkMemoryMappedImageBufferAllocator.h"
+#include "itksys/SystemTools.hxx"
+
+#include <mutex>
+
+namespace itk
+{
+
+namespace
+{
+std::mutex                    globalDefaultAllocatorLock;
+bool                          globalDefaultAllocatorIsInitialized = false;
+ImageBufferAllocator::Pointer globalDefaultAllocator;
+} // namespace
+
+
+void
+ImageBufferAllocator::SetGlobalDefaultAllocator(Self * allocator)
+{
+  std::lock_guard<std::mutex> lock(globalDefaultAllocatorLock);
+  globalDefaultAllocator = allocator;
+  globalDefaultAllocatorIsInitialized = true;
+}
+
+ImageBufferAllocator::Pointer
+ImageBufferAllocator::GetGlobalDefaultAllocator()
+{
+  std::lock_guard<std::mutex> lock(globalDefaultAllocatorLock);
+  if (!globalDefaultAllocatorIsInitialized)
+  {
+    std::string envVar;
+    if (itksys::SystemTools::GetEnv("ITK_GLOBAL_DEFAULT_IMAGE_BUFFER_ALLOCATOR", envVar))
+    {
+      globalDefaultAllocator = CreateAllocatorFromString(envVar);
+    }
+    globalDefaultAllocatorIsInitialized = true;
+  }
+  return globalDefaultAllocator;
+}
+
+ImageBufferAllocator::Pointer
+ImageBufferAllocator::CreateAllocatorFromString(std::string allocatorString)
+{
+  allocatorString = itksys::SystemTools::UpperCase(allocatorString);
+  if (allocatorString == "ALIGNED")
+  {
+    return AlignedImageBufferAllocator::New().GetPointer();
+  }
+  else if (allocatorString == "HUGEPAGE")
+  {
+    return HugePageImageBufferAllocator::New().GetPointer();
+  }
+  else if (allocatorString == "POOL")
+  {
+    return ImageBufferPool::New().GetPointer();
+  }
+  else if (allocatorString == "MEMORYMAPPED")
+  {
+    return MemoryMappedImageBufferAllocator::New().GetPointer();
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+
+} // end namespace itk
@@ -0,0 +1,235 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferPool.h"
+#include "itkAlignedImageBufferAllocator.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+ImageBufferPool::ImageBufferPool()
+  : m_UpstreamAllocator(AlignedImageBufferAllocator::New().GetPointer())
+{}
+
+ImageBufferPool::~ImageBufferPool()
+{
+  this->TrimWithLock(0);
+}
+
+void *
+ImageBufferPool::Allocate(SizeValueType numberOfBytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  const SizeValueType alignment = m_UpstreamAllocator->GetAlignment();
+  const auto          isReusable = [this, numberOfBytes, alignment](const CachedBuffer & cached) {
+    return cached.m_NumberOfBytes == numberOfBytes && cached.m_Alignment == alignment &&
+           cached.m_Allocator == m_UpstreamAllocator;
+  };
+  // The most recently released buffer first, as its pages are the most
+  // likely to still be in the caches.
+  const auto cachedBuffer = std::find_if(m_CachedBuffers.begin(), m_CachedBuffers.end(), isReusable);
+  if (cachedBuffer != m_CachedBuffers.end())
+  {
+    void * const buffer = cachedBuffer->m_Buffer;
+    m_BuffersInUse.emplace(buffer, m_UpstreamAllocator);
+    m_CachedBuffers.erase(cachedBuffer);
+    m_CachedBytes -= numberOfBytes;
+    m_BytesInUse += numberOfBytes;
+    ++m_NumberOfHits;
+    return buffer;
+  }
+
+  ++m_NumberOfMisses;
+  void * const buffer = m_UpstreamAllocator->Allocate(numberOfBytes);
+  if (buffer != nullptr)
+  {
+    m_BuffersInUse.emplace(buffer, m_UpstreamAllocator);
+    m_BytesInUse += numberOfBytes;
+    m_PeakBytes = std::max(m_PeakBytes, m_BytesInUse + m_CachedBytes);
+  }
+  return buffer;
+}
+
+void
+ImageBufferPool::Deallocate(void * buffer, SizeValueType numberOfBytes)
+{
+  if (buffer == nullptr)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  const auto bufferInUse = m_BuffersInUse.find(buffer);
+  if (bufferInUse == m_BuffersInUse.end())
+  {
+    // Not allocated by this pool, so it can only come from the upstream
+    // allocator, for example a buffer allocated before the pool was set.
+    m_UpstreamAllocator->Deallocate(buffer, numberOfBytes);
+    return;
+  }
+  const ImageBufferAllocator::Pointer allocator = std::move(bufferInUse->second);
+  m_BuffersInUse.erase(bufferInUse);
+  m_BytesInUse -= numberOfBytes;
+
+  if (numberOfBytes > m_MaximumCachedBytes || allocator != m_UpstreamAllocator)
+  {
+    allocator->Deallocate(buffer, numberOfBytes);
+    return;
+  }
+  // Make room for the released buffer within the maximum.
+  this->TrimWithLock(m_MaximumCachedBytes - numberOfBytes);
+  m_CachedBuffers.push_front(CachedBuffer{ buffer, numberOfBytes, allocator->GetAlignment(), allocator });
+  m_CachedBytes += numberOfBytes;
+}
+
+SizeValueType
+ImageBufferPool::GetAlignment() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_UpstreamAllocator->GetAlignment();
+}
+
+void
+ImageBufferPool::SetUpstreamAllocator(ImageBufferAllocator * allocator)
+{
+  itkAssertOrThrowMacro(allocator != nullptr, "The upstream allocator of an ImageBufferPool cannot be null.");
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_UpstreamAllocator == allocator)
+    {
+      return;
+    }
+    // The cached buffers could not be reused anymore.
+    this->TrimWithLock(0);
+    m_UpstreamAllocator = allocator;
+  }
+  this->Modified();
+}
+
+ImageBufferAllocator *
+ImageBufferPool::GetUpstreamAllocator() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_UpstreamAllocator.GetPointer();
+}
+
+void
+ImageBufferPool::SetMaximumCachedBytes(SizeValueType numberOfBytes)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_MaximumCachedBytes == numberOfBytes)
+    {
+      return;
+    }
+    m_MaximumCachedBytes = numberOfBytes;
+    this->TrimWithLock(numberOfBytes);
+  }
+  this->Modified();
+}
+
+SizeValueType
+ImageBufferPool::GetMaximumCachedBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MaximumCachedBytes;
+}
+
+void
+ImageBufferPool::Trim(SizeValueType maximumCachedBytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  this->TrimWithLock(maximumCachedBytes);
+}
+
+void
+ImageBufferPool::TrimWithLock(SizeValueType maximumCachedBytes)
+{
+  while (m_CachedBytes > maximumCachedBytes)
+  {
+    const CachedBuffer & leastRecent = m_CachedBuffers.back();
+    leastRecent.m_Allocator->Deallocate(leastRecent.m_Buffer, leastRecent.m_NumberOfBytes);
+    m_CachedBytes -= leastRecent.m_NumberOfBytes;
+    m_CachedBuffers.pop_back();
+  }
+}
+
+SizeValueType
+ImageBufferPool::GetCachedBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CachedBytes;
+}
+
+SizeValueType
+ImageBufferPool::GetBytesInUse() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_BytesInUse;
+}
+
+SizeValueType
+ImageBufferPool::GetPeakBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_PeakBytes;
+}
+
+SizeValueType
+ImageBufferPool::GetNumberOfHits() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumberOfHits;
+}
+
+SizeValueType
+ImageBufferPool::GetNumberOfMisses() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumberOfMisses;
+}
+
+void
+ImageBufferPool::ResetStatistics()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_NumberOfHits = 0;
+  m_NumberOfMisses = 0;
+  m_PeakBytes = m_BytesInUse + m_CachedBytes;
+}
+
+void
+ImageBufferPool::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  os << indent << "UpstreamAllocator: " << m_UpstreamAllocator.GetPointer() << std::endl;
+  os << indent << "MaximumCachedBytes: " << m_MaximumCachedBytes << std::endl;
+  os << indent << "NumberOfCachedBuffers: " << m_CachedBuffers.size() << std::endl;
+  os << indent << "NumberOfBuffersInUse: " << m_BuffersInUse.size() << std::endl;
+  os << indent << "CachedBytes: " << m_CachedBytes << std::endl;
+  os << indent << "BytesInUse: " << m_BytesInUse << std::endl;
+  os << indent << "PeakBytes: " << m_PeakBytes << std::endl;
+  os << indent << "NumberOfHits: " << m_NumberOfHits << std::endl;
+  os << indent << "NumberOfMisses: " << m_NumberOfMisses << std::endl;
+}
+
+} // end namespace itk
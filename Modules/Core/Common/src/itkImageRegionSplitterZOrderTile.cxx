@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageRegionSplitterZOrderTile.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace itk
+{
+
+ImageRegionSplitterZOrderTile::ImageRegionSplitterZOrderTile() = default;
+
+unsigned int
+ImageRegionSplitterZOrderTile::ComputeTileLevels(unsigned int        dim,
+                                                 const SizeValueType regionSize[],
+                                                 unsigned int        requestedNumber,
+                                                 unsigned int        levels[]) const
+{
+  const double maximumPixelsPerTile = std::max(1.0, double(m_TileSizeInBytes) / double(m_BytesPerPixel));
+
+  std::vector<SizeValueType> tileSize(regionSize, regionSize + dim);
+  std::fill_n(levels, dim, 0u);
+
+  unsigned int totalLevels = 0;
+  while (true)
+  {
+    double pixelsPerTile = 1.0;
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+      pixelsPerTile *= tileSize[d];
+    }
+    // Stop when the tiles fit, or when doubling their number would exceed
+    // the request (or the range of unsigned int).
+    if (pixelsPerTile <= maximumPixelsPerTile || totalLevels + 1 >= 8 * sizeof(unsigned int) ||
+        (1u << (totalLevels + 1)) > requestedNumber)
+    {
+      return totalLevels;
+    }
+
+    // Halve the longest tile dimension, the slowest one among equals, so
+    // that the tiles keep long rows.
+    unsigned int longest = 0;
+    for (unsigned int d = 1; d < dim; ++d)
+    {
+      if (tileSize[d] >= tileSize[longest])
+      {
+        longest = d;
+      }
+    }
+    // Each of the halves must keep at least one pixel.
+    if (regionSize[longest] < (SizeValueType{ 2 } << levels[longest]))
+    {
+      return totalLevels;
+    }
+    ++levels[longest];
+    ++totalLevels;
+    tileSize[longest] = (regionSize[longest] + (SizeValueType{ 1 } << levels[longest]) - 1) >> levels[longest];
+  }
+}
+
+unsigned int
+ImageRegionSplitterZOrderTile::GetNumberOfSplitsInternal(unsigned int         dim,
+                                                         const IndexValueType itkNotUsed(regionIndex)[],
+                                                         const SizeValueType  regionSize[],
+                                                         unsigned int         requestedNumber) const
+{
+  std::vector<unsigned int> levels(dim);
+  return 1u << this->ComputeTileLevels(dim, regionSize, requestedNumber, &levels[0]);
+}
+
+unsigned int
+ImageRegionSplitterZOrderTile::GetSplitInternal(unsigned int   dim,
+                                                unsigned int   i,
+                                                unsigned int   numberOfPieces,
+                                                IndexValueType regionIndex[],
+                                                SizeValueType  regionSize[]) const
+{
+  std::vector<unsigned int> levels(dim);
+  const unsigned int        totalLevels = this->ComputeTileLevels(dim, regionSize, numberOfPieces, &levels[0]);
+  const unsigned int        maximumLevel = *std::max_element(levels.begin(), levels.end());
+
+  // Deinterleave the bits of i into the tile coordinates: bit b of the
+  // coordinates of all the dimensions which are split at least b+1 times,
+  // from the fastest dimension to the slowest one, then bit b+1, etc.
+  std::vector<SizeValueType> tile(dim, 0);
+  unsigned int               bit = 0;
+  for (unsigned int level = 0; level < maximumLevel; ++level)
+  {
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+      if (level < levels[d])
+      {
+        tile[d] |= SizeValueType{ (i >> bit) & 1u } << level;
+        ++bit;
+      }
+    }
+  }
+
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    const SizeValueType begin = (tile[d] * regionSize[d]) >> levels[d];
+    const SizeValueType end = ((tile[d] + 1) * regionSize[d]) >> levels[d];
+    regionIndex[d] += static_cast<IndexValueType>(begin);
+    regionSize[d] = end - begin;
+  }
+
+  return 1u << totalLevels;
+}
+
+void
+ImageRegionSplitterZOrderTile::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "TileSizeInBytes: " << m_TileSizeInBytes << std::endl;
+  os << indent << "BytesPerPixel: " << m_BytesPerPixel << std::endl;
+}
+
+} // end namespace itk
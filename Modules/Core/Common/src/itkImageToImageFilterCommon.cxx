@@ -23,8 +23,9 @@ namespace itk
 
 namespace
 {
-double globalDefaultCoordinateTolerance = 1.0e-6;
-double globalDefaultDirectionTolerance = 1.0e-6;
+double        globalDefaultCoordinateTolerance = 1.0e-6;
+double        globalDefaultDirectionTolerance = 1.0e-6;
+SizeValueType globalDefaultCacheBlockSize = 256 * 1024;
 } // namespace
 
 void
@@ -51,4 +52,16 @@ ImageToImageFilterCommon::GetGlobalDefaultDirectionTolerance()
   return globalDefaultDirectionTolerance;
 }
 
+void
+ImageToImageFilterCommon::SetGlobalDefaultCacheBlockSize(SizeValueType numberOfBytes)
+{
+  globalDefaultCacheBlockSize = numberOfBytes;
+}
+
+SizeValueType
+ImageToImageFilterCommon::GetGlobalDefaultCacheBlockSize()
+{
+  return globalDefaultCacheBlockSize;
+}
+
 } // namespace itk
@@ -0,0 +1,270 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImportImageContainerCommon.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
+#include "itkWorkStealingThreadPool.h"
+#include "itksys/SystemTools.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#if !defined(_WIN32)
+#  include <unistd.h>
+#endif
+#if defined(__linux__)
+#  include <fstream>
+#  include <sys/syscall.h>
+#  include <vector>
+#endif
+
+namespace itk
+{
+
+namespace
+{
+using MemoryPlacementEnum = ImportImageContainerEnums::MemoryPlacement;
+
+std::mutex                 globalDefaultMemoryPlacementLock;
+bool                       globalDefaultMemoryPlacementIsInitialized = false;
+MemoryPlacementEnum        globalDefaultMemoryPlacement = MemoryPlacementEnum::Default;
+std::atomic<SizeValueType> globalMemoryPlacementMinimumBufferSize{ 4 * 1024 * 1024 };
+
+SizeValueType
+GetPageSize()
+{
+#if defined(_SC_PAGESIZE)
+  const long pageSize = sysconf(_SC_PAGESIZE);
+  if (pageSize > 0)
+  {
+    return static_cast<SizeValueType>(pageSize);
+  }
+#endif
+  return 4096;
+}
+
+/** Whether the caller runs on a thread of the pool of the default threader,
+ * i.e. inside a parallel region, where the buffer is placed serially rather
+ * than by nesting parallelism. */
+bool
+IsCalledFromThreadPool()
+{
+  switch (MultiThreaderBase::GetGlobalDefaultThreader())
+  {
+    case MultiThreaderBase::ThreaderEnum::Pool:
+      return ThreadPool::GetInstance()->IsWorkerThread();
+    case MultiThreaderBase::ThreaderEnum::WorkStealing:
+      return WorkStealingThreadPool::GetInstance()->IsWorkerThread();
+    default:
+      return false;
+  }
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+/** Ask the kernel to interleave the pages of the buffer across all NUMA
+ * nodes. Returns false when the policy could not be applied. */
+bool
+InterleavePages(void * buffer, SizeValueType numberOfBytes, SizeValueType pageSize)
+{
+  // The possible nodes are listed like "0", "0-1" or "0,2-3".
+  std::ifstream possibleNodes("/sys/devices/system/node/possible");
+  std::string   nodeList;
+  if (!(possibleNodes >> nodeList) || nodeList.empty())
+  {
+    return false;
+  }
+  const std::string::size_type separator = nodeList.find_last_of("-,");
+  const int maximumNode = std::atoi(nodeList.substr(separator == std::string::npos ? 0 : separator + 1).c_str());
+
+  constexpr int              bitsPerLong = 8 * sizeof(unsigned long);
+  std::vector<unsigned long> nodeMask(maximumNode / bitsPerLong + 1, 0);
+  for (int node = 0; node <= maximumNode; ++node)
+  {
+    nodeMask[node / bitsPerLong] |= 1UL << (node % bitsPerLong);
+  }
+
+  // mbind only accepts whole pages.
+  const auto    address = reinterpret_cast<uintptr_t>(buffer);
+  const auto    begin = (address + pageSize - 1) / pageSize * pageSize;
+  const auto    end = (address + numberOfBytes) / pageSize * pageSize;
+  constexpr int mpolInterleave = 3; // MPOL_INTERLEAVE, from <linux/mempolicy.h>
+  if (end <= begin)
+  {
+    return false;
+  }
+  return syscall(SYS_mbind, begin, end - begin, mpolInterleave, nodeMask.data(), maximumNode + 2, 0) == 0;
+}
+#endif
+} // namespace
+
+
+void
+ImportImageContainerCommon::SetGlobalDefaultMemoryPlacement(MemoryPlacementEnum placement)
+{
+  std::lock_guard<std::mutex> lock(globalDefaultMemoryPlacementLock);
+  globalDefaultMemoryPlacement = placement;
+  globalDefaultMemoryPlacementIsInitialized = true;
+}
+
+ImportImageContainerCommon::MemoryPlacementEnum
+ImportImageContainerCommon::GetGlobalDefaultMemoryPlacement()
+{
+  std::lock_guard<std::mutex> lock(globalDefaultMemoryPlacementLock);
+  if (!globalDefaultMemoryPlacementIsInitialized)
+  {
+    std::string envVar;
+    if (itksys::SystemTools::GetEnv("ITK_GLOBAL_DEFAULT_MEMORY_PLACEMENT", envVar))
+    {
+      globalDefaultMemoryPlacement = MemoryPlacementFromString(envVar);
+    }
+    globalDefaultMemoryPlacementIsInitialized = true;
+  }
+  return globalDefaultMemoryPlacement;
+}
+
+void
+ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(SizeValueType numberOfBytes)
+{
+  globalMemoryPlacementMinimumBufferSize.store(numberOfBytes);
+}
+
+SizeValueType
+ImportImageContainerCommon::GetGlobalMemoryPlacementMinimumBufferSize()
+{
+  return globalMemoryPlacementMinimumBufferSize.load();
+}
+
+ImportImageContainerCommon::MemoryPlacementEnum
+ImportImageContainerCommon::MemoryPlacementFromString(std::string placementString)
+{
+  placementString = itksys::SystemTools::UpperCase(placementString);
+  if (placementString == "PARALLELFIRSTTOUCH")
+  {
+    return MemoryPlacementEnum::ParallelFirstTouch;
+  }
+  else if (placementString == "INTERLEAVED")
+  {
+    return MemoryPlacementEnum::Interleaved;
+  }
+  else
+  {
+    return MemoryPlacementEnum::Default;
+  }
+}
+
+void
+ImportImageContainerCommon::PlaceBuffer(void *              buffer,
+                                        SizeValueType       numberOfBytes,
+                                        bool                zeroFill,
+                                        MemoryPlacementEnum placement)
+{
+  if (placement == MemoryPlacementEnum::Default || numberOfBytes < globalMemoryPlacementMinimumBufferSize.load())
+  {
+    if (zeroFill)
+    {
+      std::memset(buffer, 0, numberOfBytes);
+    }
+    return;
+  }
+
+  const SizeValueType pageSize = GetPageSize();
+
+#if defined(__linux__) && defined(SYS_mbind)
+  if (placement == MemoryPlacementEnum::Interleaved)
+  {
+    // On failure, the pages are still placed by the parallel first touch.
+    InterleavePages(buffer, numberOfBytes, pageSize);
+  }
+#endif
+
+  auto * bytes = static_cast<char *>(buffer);
+
+  // Inside a parallel region the calling thread touches the pages itself,
+  // as it is the one that will most likely write them.
+  if (IsCalledFromThreadPool())
+  {
+    if (zeroFill)
+    {
+      std::memset(bytes, 0, numberOfBytes);
+    }
+    else
+    {
+      for (SizeValueType offset = 0; offset < numberOfBytes; offset += pageSize)
+      {
+        bytes[offset] = 0;
+      }
+    }
+    return;
+  }
+
+  // One chunk of whole pages per work unit, in buffer order, so that the
+  // chunks match the slabs of the default (slowest dimension) region
+  // splitter which the filters writing this buffer will use.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  const SizeValueType        numberOfChunks = threader->GetNumberOfWorkUnits();
+  const SizeValueType        pagesPerChunk = (numberOfBytes / pageSize + numberOfChunks) / numberOfChunks;
+  const SizeValueType        chunkSize = pagesPerChunk * pageSize;
+
+  threader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [bytes, numberOfBytes, chunkSize, pageSize, zeroFill](SizeValueType chunk) {
+      const SizeValueType begin = chunk * chunkSize;
+      if (begin >= numberOfBytes)
+      {
+        return;
+      }
+      const SizeValueType end = std::min(begin + chunkSize, numberOfBytes);
+      if (zeroFill)
+      {
+        std::memset(bytes + begin, 0, end - begin);
+      }
+      else
+      {
+        for (SizeValueType offset = begin; offset < end; offset += pageSize)
+        {
+          bytes[offset] = 0;
+        }
+      }
+    },
+    nullptr);
+}
+
+/** Print enum values */
+std::ostream &
+operator<<(std::ostream & out, const ImportImageContainerEnums::MemoryPlacement value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case ImportImageContainerEnums::MemoryPlacement::Default:
+        return "itk::ImportImageContainerEnums::MemoryPlacement::Default";
+      case ImportImageContainerEnums::MemoryPlacement::ParallelFirstTouch:
+        return "itk::ImportImageContainerEnums::MemoryPlacement::ParallelFirstTouch";
+      case ImportImageContainerEnums::MemoryPlacement::Interleaved:
+        return "itk::ImportImageContainerEnums::MemoryPlacement::Interleaved";
+      default:
+        return "INVALID VALUE FOR itk::ImportImageContainerEnums::MemoryPlacement";
+    }
+  }();
+}
+
+} // end namespace itk
@@ -0,0 +1,290 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMemoryMappedImageBufferAllocator.h"
+#include "itksys/SystemTools.hxx"
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define ITK_HAS_MMAP
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  include <cstdlib>
+#  include <vector>
+#endif
+
+namespace itk
+{
+
+namespace
+{
+SizeValueType
+GetPageSize()
+{
+#ifdef ITK_HAS_MMAP
+  static const SizeValueType pageSize = static_cast<SizeValueType>(sysconf(_SC_PAGESIZE));
+  return pageSize;
+#else
+  return 4096;
+#endif
+}
+
+#ifdef ITK_HAS_MMAP
+/** Open the file backing a new buffer, or return -1. */
+int
+OpenFile(MemoryMappedImageBufferAllocatorEnums::Mode mode,
+         const std::string &                         fileName,
+         const std::string &                         scratchDirectory)
+{
+  switch (mode)
+  {
+    case MemoryMappedImageBufferAllocatorEnums::Mode::ReadOnly:
+      return open(fileName.c_str(), O_RDONLY);
+    case MemoryMappedImageBufferAllocatorEnums::Mode::ReadWrite:
+      return open(fileName.c_str(), O_RDWR | O_CREAT, 0666);
+    case MemoryMappedImageBufferAllocatorEnums::Mode::Scratch:
+    default:
+    {
+      std::string directory = scratchDirectory;
+      if (directory.empty() && !itksys::SystemTools::GetEnv("TMPDIR", directory))
+      {
+        directory = "/tmp";
+      }
+      const std::string templateName = directory + "/itkImageBuffer-XXXXXX";
+      std::vector<char> name(templateName.begin(), templateName.end());
+      name.push_back('\0');
+      const int fileDescriptor = mkstemp(name.data());
+      if (fileDescriptor >= 0)
+      {
+        // The file is removed when the buffer is unmapped.
+        unlink(name.data());
+      }
+      return fileDescriptor;
+    }
+  }
+}
+#endif
+} // namespace
+
+
+MemoryMappedImageBufferAllocator::MemoryMappedImageBufferAllocator() = default;
+
+MemoryMappedImageBufferAllocator::~MemoryMappedImageBufferAllocator()
+{
+#ifdef ITK_HAS_MMAP
+  // Buffers are normally released by their containers, which hold the
+  // allocator, so that this only releases leaked mappings.
+  for (const auto & mapping : m_Mappings)
+  {
+    munmap(mapping.second.m_Address, mapping.second.m_Length);
+  }
+#endif
+}
+
+void *
+MemoryMappedImageBufferAllocator::Allocate(SizeValueType numberOfBytes)
+{
+#ifdef ITK_HAS_MMAP
+  // Map from the page containing the offset.
+  const SizeValueType offset = (m_Mode == ModeEnum::Scratch) ? 0 : m_Offset;
+  const SizeValueType pageOffset = offset % GetPageSize();
+  const SizeValueType length = pageOffset + std::max(numberOfBytes, SizeValueType{ 1 });
+
+  const int fileDescriptor = OpenFile(m_Mode, m_FileName, m_ScratchDirectory);
+  if (fileDescriptor < 0)
+  {
+    return nullptr;
+  }
+
+  struct stat fileStatus;
+  bool        isLongEnough = false;
+  if (fstat(fileDescriptor, &fileStatus) == 0)
+  {
+    isLongEnough = static_cast<SizeValueType>(fileStatus.st_size) >= offset + numberOfBytes;
+  }
+  if (!isLongEnough && m_Mode != ModeEnum::ReadOnly)
+  {
+    isLongEnough = (ftruncate(fileDescriptor, static_cast<off_t>(offset + numberOfBytes)) == 0);
+  }
+
+  void * address = MAP_FAILED;
+  if (isLongEnough)
+  {
+    // Read-only buffers are mapped privately, so that writing to them,
+    // e.g. by an in-place filter, does not modify the file.
+    address = mmap(nullptr,
+                   length,
+                   PROT_READ | PROT_WRITE,
+                   (m_Mode == ModeEnum::ReadOnly) ? MAP_PRIVATE : MAP_SHARED,
+                   fileDescriptor,
+                   static_cast<off_t>(offset - pageOffset));
+  }
+  // The mapping keeps the file open.
+  close(fileDescriptor);
+  if (address == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+  void * const buffer = static_cast<char *>(address) + pageOffset;
+  if (m_Advice != AdviceEnum::Normal)
+  {
+    Advise(buffer, numberOfBytes, m_Advice);
+  }
+
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Mappings[buffer] = Mapping{ address, length };
+  return buffer;
+#else
+  (void)numberOfBytes;
+  return nullptr;
+#endif
+}
+
+void
+MemoryMappedImageBufferAllocator::Deallocate(void * buffer, SizeValueType itkNotUsed(numberOfBytes))
+{
+  Mapping mapping;
+  {
+    const std::lock_guard<std::mutex> lock(m_Mutex);
+    const auto                        it = m_Mappings.find(buffer);
+    if (it == m_Mappings.end())
+    {
+      return;
+    }
+    mapping = it->second;
+    m_Mappings.erase(it);
+  }
+#ifdef ITK_HAS_MMAP
+  munmap(mapping.m_Address, mapping.m_Length);
+#endif
+}
+
+SizeValueType
+MemoryMappedImageBufferAllocator::GetAlignment() const
+{
+  const SizeValueType pageOffset = (m_Mode == ModeEnum::Scratch) ? 0 : m_Offset % GetPageSize();
+  if (pageOffset == 0)
+  {
+    return GetPageSize();
+  }
+  // The largest power of two dividing the offset within the page.
+  return pageOffset & (~pageOffset + 1);
+}
+
+SizeValueType
+MemoryMappedImageBufferAllocator::GetNumberOfMappedBuffers() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Mappings.size();
+}
+
+bool
+MemoryMappedImageBufferAllocator::Advise(const void * address, SizeValueType numberOfBytes, AdviceEnum advice)
+{
+#ifdef ITK_HAS_MMAP
+  if (numberOfBytes == 0)
+  {
+    return false;
+  }
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(address) / GetPageSize() * GetPageSize();
+  const uintptr_t end = reinterpret_cast<uintptr_t>(address) + numberOfBytes;
+
+  int posixAdvice = MADV_NORMAL;
+  switch (advice)
+  {
+    case AdviceEnum::Sequential:
+      posixAdvice = MADV_SEQUENTIAL;
+      break;
+    case AdviceEnum::Random:
+      posixAdvice = MADV_RANDOM;
+      break;
+    case AdviceEnum::WillNeed:
+      posixAdvice = MADV_WILLNEED;
+      break;
+    case AdviceEnum::DontNeed:
+      posixAdvice = MADV_DONTNEED;
+      break;
+    case AdviceEnum::Normal:
+    default:
+      break;
+  }
+  return madvise(reinterpret_cast<void *>(begin), end - begin, posixAdvice) == 0;
+#else
+  (void)address;
+  (void)numberOfBytes;
+  (void)advice;
+  return false;
+#endif
+}
+
+void
+MemoryMappedImageBufferAllocator::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileName: " << m_FileName << std::endl;
+  os << indent << "Offset: " << m_Offset << std::endl;
+  os << indent << "Mode: " << m_Mode << std::endl;
+  os << indent << "ScratchDirectory: " << m_ScratchDirectory << std::endl;
+  os << indent << "Advice: " << m_Advice << std::endl;
+  os << indent << "NumberOfMappedBuffers: " << this->GetNumberOfMappedBuffers() << std::endl;
+}
+
+std::ostream &
+operator<<(std::ostream & out, const MemoryMappedImageBufferAllocatorEnums::Mode value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case MemoryMappedImageBufferAllocatorEnums::Mode::ReadOnly:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Mode::ReadOnly";
+      case MemoryMappedImageBufferAllocatorEnums::Mode::ReadWrite:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Mode::ReadWrite";
+      case MemoryMappedImageBufferAllocatorEnums::Mode::Scratch:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Mode::Scratch";
+      default:
+        return "INVALID VALUE FOR itk::MemoryMappedImageBufferAllocatorEnums::Mode";
+    }
+  }();
+}
+
+std::ostream &
+operator<<(std::ostream & out, const MemoryMappedImageBufferAllocatorEnums::Advice value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case MemoryMappedImageBufferAllocatorEnums::Advice::Normal:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Advice::Normal";
+      case MemoryMappedImageBufferAllocatorEnums::Advice::Sequential:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Advice::Sequential";
+      case MemoryMappedImageBufferAllocatorEnums::Advice::Random:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Advice::Random";
+      case MemoryMappedImageBufferAllocatorEnums::Advice::WillNeed:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Advice::WillNeed";
+      case MemoryMappedImageBufferAllocatorEnums::Advice::DontNeed:
+        return "itk::MemoryMappedImageBufferAllocatorEnums::Advice::DontNeed";
+      default:
+        return "INVALID VALUE FOR itk::MemoryMappedImageBufferAllocatorEnums::Advice";
+    }
+  }();
+}
+
+} // end namespace itk
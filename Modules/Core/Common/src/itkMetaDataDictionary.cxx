@@ -20,7 +20,7 @@
 namespace itk
 {
 MetaDataDictionary::MetaDataDictionary()
-  : m_Dictionary(std::make_shared<MetaDataDictionaryMapType>())
+  : m_Dictionary(GetEmptyDictionary())
 {}
 
 MetaDataDictionary::~MetaDataDictionary() = default;
@@ -29,6 +29,12 @@ MetaDataDictionary::~MetaDataDictionary() = default;
 //       as is thee default behavior for copy constructors.
 MetaDataDictionary::MetaDataDictionary(const MetaDataDictionary &) = default;
 
+MetaDataDictionary::MetaDataDictionary(MetaDataDictionary && old) noexcept
+  : m_Dictionary(std::move(old.m_Dictionary))
+{
+  old.m_Dictionary = GetEmptyDictionary();
+}
+
 MetaDataDictionary &
 MetaDataDictionary::operator=(const MetaDataDictionary & old)
 {
@@ -40,6 +46,17 @@ MetaDataDictionary::operator=(const MetaDataDictionary & old)
   return *this;
 }
 
+MetaDataDictionary &
+MetaDataDictionary::operator=(MetaDataDictionary && old) noexcept
+{
+  if (this != &old)
+  {
+    m_Dictionary = std::move(old.m_Dictionary);
+    old.m_Dictionary = GetEmptyDictionary();
+  }
+  return *this;
+}
+
 void
 MetaDataDictionary::Print(std::ostream & os) const
 {
@@ -72,13 +89,14 @@ const MetaDataObjectBase * MetaDataDictionary::operator[](const std::string & ke
 const MetaDataObjectBase *
 MetaDataDictionary::Get(const std::string & key) const
 {
-  if (!this->HasKey(key))
+  // Look up the key without the non-constant operator[] of the map, which
+  // must not be called on a map shared with other dictionaries.
+  const auto iter = m_Dictionary->find(key);
+  if (iter == m_Dictionary->end())
   {
     itkGenericExceptionMacro(<< "Key '" << key << "' does not exist ");
   }
-  MetaDataObjectBase::Pointer entry = (*m_Dictionary)[key];
-  const MetaDataObjectBase *  constentry = entry.GetPointer();
-  return constentry;
+  return iter->second.GetPointer();
 }
 
 void
@@ -150,8 +168,8 @@ MetaDataDictionary::Find(const std::string & key) const
 void
 MetaDataDictionary::Clear()
 {
-  // Construct a new one instead of enforcing uniqueness then clearing
-  this->m_Dictionary = std::make_shared<MetaDataDictionaryMapType>();
+  // Share the empty map instead of enforcing uniqueness then clearing
+  this->m_Dictionary = GetEmptyDictionary();
 }
 
 void
@@ -165,6 +183,8 @@ MetaDataDictionary::Swap(MetaDataDictionary & other)
 bool
 MetaDataDictionary::MakeUnique()
 {
+  // The empty map is always shared, as it is also held by
+  // GetEmptyDictionary().
   if (m_Dictionary.use_count() > 1)
   {
     // copy the shared dictionary.
@@ -174,6 +194,13 @@ MetaDataDictionary::MakeUnique()
   return false;
 }
 
+const std::shared_ptr<MetaDataDictionary::MetaDataDictionaryMapType> &
+MetaDataDictionary::GetEmptyDictionary()
+{
+  static const auto emptyDictionary = std::make_shared<MetaDataDictionaryMapType>();
+  return emptyDictionary;
+}
+
 bool
 MetaDataDictionary::Erase(const std::string & key)
 {
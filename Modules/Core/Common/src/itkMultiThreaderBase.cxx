@@ -30,6 +30,7 @@
 
 #if defined(ITK_USE_POOL_MULTI_THREADER)
 #  include "itkPoolMultiThreader.h"
+#  include "itkWorkStealingMultiThreader.h"
 #endif
 #include "itkNumericTraits.h"
 #include <mutex>
@@ -39,7 +40,9 @@
 #include "itkImageSourceCommon.h"
 #include "itkSingleton.h"
 #include "itkProcessObject.h"
+#include "itkExecutionTracer.h"
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <algorithm>
 #include <cctype>
@@ -82,10 +85,22 @@ struct MultiThreaderBaseGlobals
   //  m_GlobalMaximumNumberOfThreads and larger or equal to 1 once it has been
   //  initialized in the constructor of the first MultiThreaderBase instantiation.
   ThreadIdType m_GlobalDefaultNumberOfThreads{ 0 };
+
+  // Global value used to initialize the grain size of new multi-threaders,
+  // read from the environment variable ITK_GLOBAL_DEFAULT_GRAIN_SIZE once.
+  SizeValueType     m_GlobalDefaultGrainSize{ 0 };
+  std::atomic<bool> m_GlobalDefaultGrainSizeIsInitialized{ false };
+
+  // Numbers of calls executed serially and in parallel by all multi-threaders.
+  std::atomic<SizeValueType> m_GlobalNumberOfSerialExecutions{ 0 };
+  std::atomic<SizeValueType> m_GlobalNumberOfParallelExecutions{ 0 };
 };
 
 itkGetGlobalSimpleMacro(MultiThreaderBase, MultiThreaderBaseGlobals, PimplGlobals);
 
+constexpr SizeValueType MultiThreaderBase::DefaultImageRegionGrainSize;
+constexpr SizeValueType MultiThreaderBase::DefaultArrayGrainSize;
+
 
 #if !defined(ITK_LEGACY_REMOVE)
 void
@@ -188,6 +203,10 @@ MultiThreaderBase::ThreaderTypeFromString(std::string threaderString)
   {
     return ThreaderEnum::TBB;
   }
+  else if (threaderString == "WORKSTEALING")
+  {
+    return ThreaderEnum::WorkStealing;
+  }
   else
   {
     return ThreaderEnum::Unknown;
@@ -406,6 +425,12 @@ MultiThreaderBase::New()
         return TBBMultiThreader::New();
 #else
         itkGenericExceptionMacro("ITK has been built without TBB support!");
+#endif
+      case ThreaderEnum::WorkStealing:
+#if defined(ITK_USE_POOL_MULTI_THREADER)
+        return WorkStealingMultiThreader::New();
+#else
+        itkGenericExceptionMacro("ITK has been built without WorkStealingMultiThreader support!");
 #endif
       default:
         itkGenericExceptionMacro("MultiThreaderBase::GetGlobalDefaultThreader returned Unknown!");
@@ -416,10 +441,91 @@ MultiThreaderBase::New()
 }
 
 
+void
+MultiThreaderBase::SetGlobalDefaultGrainSize(SizeValueType grainSize)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  std::lock_guard<std::mutex> lock(m_PimplGlobals->globalDefaultInitializerLock);
+  m_PimplGlobals->m_GlobalDefaultGrainSize = grainSize;
+  m_PimplGlobals->m_GlobalDefaultGrainSizeIsInitialized = true;
+}
+
+SizeValueType
+MultiThreaderBase::GetGlobalDefaultGrainSize()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  if (!m_PimplGlobals->m_GlobalDefaultGrainSizeIsInitialized)
+  {
+    std::lock_guard<std::mutex> lock(m_PimplGlobals->globalDefaultInitializerLock);
+    if (!m_PimplGlobals->m_GlobalDefaultGrainSizeIsInitialized)
+    {
+      std::string envVar;
+      if (itksys::SystemTools::GetEnv("ITK_GLOBAL_DEFAULT_GRAIN_SIZE", envVar))
+      {
+        m_PimplGlobals->m_GlobalDefaultGrainSize =
+          static_cast<SizeValueType>(std::strtoull(envVar.c_str(), nullptr, 10));
+      }
+      m_PimplGlobals->m_GlobalDefaultGrainSizeIsInitialized = true;
+    }
+  }
+  return m_PimplGlobals->m_GlobalDefaultGrainSize;
+}
+
+SizeValueType
+MultiThreaderBase::GetGlobalNumberOfSerialExecutions()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_GlobalNumberOfSerialExecutions;
+}
+
+SizeValueType
+MultiThreaderBase::GetGlobalNumberOfParallelExecutions()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_GlobalNumberOfParallelExecutions;
+}
+
+void
+MultiThreaderBase::ResetGlobalExecutionCounters()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_GlobalNumberOfSerialExecutions = 0;
+  m_PimplGlobals->m_GlobalNumberOfParallelExecutions = 0;
+}
+
+void
+MultiThreaderBase::ResetExecutionCounters()
+{
+  m_NumberOfSerialExecutions = 0;
+  m_NumberOfParallelExecutions = 0;
+}
+
+ThreadIdType
+MultiThreaderBase::ComputeNumberOfWorkUnits(SizeValueType workSize, SizeValueType defaultGrainSize)
+{
+  const SizeValueType grainSize = std::max(m_GrainSize > 0 ? m_GrainSize : defaultGrainSize, SizeValueType{ 1 });
+  const ThreadIdType  numberOfWorkUnits = static_cast<ThreadIdType>(
+    std::max(std::min(SizeValueType{ m_NumberOfWorkUnits }, workSize / grainSize), SizeValueType{ 1 }));
+  if (numberOfWorkUnits > 1)
+  {
+    ++m_NumberOfParallelExecutions;
+    ++m_PimplGlobals->m_GlobalNumberOfParallelExecutions;
+  }
+  else
+  {
+    ++m_NumberOfSerialExecutions;
+    ++m_PimplGlobals->m_GlobalNumberOfSerialExecutions;
+  }
+  return numberOfWorkUnits;
+}
+
 MultiThreaderBase::MultiThreaderBase()
 {
   m_MaximumNumberOfThreads = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
   m_NumberOfWorkUnits = m_MaximumNumberOfThreads;
+  m_GrainSize = MultiThreaderBase::GetGlobalDefaultGrainSize();
 }
 
 MultiThreaderBase::~MultiThreaderBase() = default;
@@ -462,6 +568,13 @@ MultiThreaderBase::ParallelizeArray(SizeValueType             firstIndex,
                                     ArrayThreadingFunctorType aFunc,
                                     ProcessObject *           filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start(
+      "ParallelRegion", filter ? filter->GetNameOfClass() : this->GetNameOfClass(), lastIndexPlus1 - firstIndex);
+  }
+
   // This implementation simply delegates parallelization to the old interface
   // SetSingleMethod+SingleMethodExecute. This method is meant to be overloaded!
 
@@ -472,20 +585,26 @@ MultiThreaderBase::ParallelizeArray(SizeValueType             firstIndex,
   // Upon destruction, progress will be set to 1.0
   ProgressReporter progress(filter, 0, 1);
 
-  if (firstIndex + 1 < lastIndexPlus1)
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    lastIndexPlus1 > firstIndex ? lastIndexPlus1 - firstIndex : 0, DefaultArrayGrainSize);
+  if (numberOfWorkUnits > 1)
   {
     struct ArrayCallback acParams
     {
       aFunc, firstIndex, lastIndexPlus1, filter
     };
     this->SetSingleMethod(&MultiThreaderBase::ParallelizeArrayHelper, &acParams);
-    this->SingleMethodExecute();
+    this->SingleMethodExecuteWithWorkUnits(numberOfWorkUnits);
   }
-  else if (firstIndex + 1 == lastIndexPlus1)
+  else
   {
-    aFunc(firstIndex);
+    // Not worth waking up other threads.
+    const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", lastIndexPlus1 - firstIndex);
+    for (SizeValueType i = firstIndex; i < lastIndexPlus1; ++i)
+    {
+      aFunc(i);
+    }
   }
-  // else nothing needs to be executed
 }
 
 ITK_THREAD_RETURN_FUNCTION_CALL_CONVENTION
@@ -509,6 +628,7 @@ MultiThreaderBase::ParallelizeArrayHelper(void * arg)
 
   TotalProgressReporter reporter(acParams->filter, range);
 
+  const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", afterLast - first);
   for (SizeValueType i = first; i < afterLast; ++i)
   {
     acParams->functor(i);
@@ -527,6 +647,15 @@ MultiThreaderBase::ParallelizeImageRegion(unsigned int
                                           MultiThreaderBase::ThreadingFunctorType funcP,
                                           ProcessObject *                         filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start("ParallelRegion",
+               filter ? filter->GetNameOfClass() : this->GetNameOfClass(),
+               std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()));
+    funcP = Self::TraceWorkUnits(dimension, std::move(funcP));
+  }
+
   // This implementation simply delegates parallelization to the old interface
   // SetSingleMethod+SingleMethodExecute. This method is meant to be overloaded!
   if (!this->GetUpdateProgress())
@@ -535,11 +664,29 @@ MultiThreaderBase::ParallelizeImageRegion(unsigned int
   }
   ProgressReporter progress(filter, 0, 1);
 
-  struct RegionAndCallback rnc
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()), DefaultImageRegionGrainSize);
+  if (numberOfWorkUnits > 1)
   {
-    funcP, dimension, index, size, filter
-  };
-  this->SetSingleMethod(&MultiThreaderBase::ParallelizeImageRegionHelper, &rnc);
+    struct RegionAndCallback rnc
+    {
+      funcP, dimension, index, size, filter
+    };
+    this->SetSingleMethod(&MultiThreaderBase::ParallelizeImageRegionHelper, &rnc);
+    this->SingleMethodExecuteWithWorkUnits(numberOfWorkUnits);
+  }
+  else
+  {
+    // Not worth waking up other threads.
+    funcP(index, size);
+  }
+}
+
+void
+MultiThreaderBase::SingleMethodExecuteWithWorkUnits(ThreadIdType itkNotUsed(numberOfWorkUnits))
+{
+  // The helpers split the work according to the number of work units they
+  // are called with, so any number of work units is correct.
   this->SingleMethodExecute();
 }
 
@@ -573,6 +720,16 @@ MultiThreaderBase::ParallelizeImageRegionHelper(void * arg)
   return ITK_THREAD_RETURN_DEFAULT_VALUE;
 }
 
+MultiThreaderBase::ThreadingFunctorType
+MultiThreaderBase::TraceWorkUnits(unsigned int dimension, ThreadingFunctorType funcP)
+{
+  return [dimension, funcP](const IndexValueType index[], const SizeValueType size[]) {
+    const ExecutionTracer::Span span(
+      "WorkUnit", "WorkUnit", std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()));
+    funcP(index, size);
+  };
+}
+
 // Print method for the multithreader
 void
 MultiThreaderBase::PrintSelf(std::ostream & os, Indent indent) const
@@ -581,6 +738,9 @@ MultiThreaderBase::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "Number of Work Units: " << m_NumberOfWorkUnits << "\n";
   os << indent << "Number of Threads: " << m_MaximumNumberOfThreads << "\n";
+  os << indent << "Grain Size: " << m_GrainSize << "\n";
+  os << indent << "Number of Serial Executions: " << m_NumberOfSerialExecutions << "\n";
+  os << indent << "Number of Parallel Executions: " << m_NumberOfParallelExecutions << "\n";
   os << indent << "Global Maximum Number Of Threads: " << m_PimplGlobals->m_GlobalMaximumNumberOfThreads << std::endl;
   os << indent << "Global Default Number Of Threads: " << m_PimplGlobals->m_GlobalDefaultNumberOfThreads << std::endl;
   os << indent << "Global Default Threader Type: " << m_PimplGlobals->m_GlobalDefaultThreader << std::endl;
@@ -605,6 +765,8 @@ operator<<(std::ostream & out, const MultiThreaderBaseEnums::Threader value)
         return "itk::MultiThreaderBaseEnums::Threader::Pool";
       case MultiThreaderBaseEnums::Threader::TBB:
         return "itk::MultiThreaderBaseEnums::Threader::TBB";
+      case MultiThreaderBaseEnums::Threader::WorkStealing:
+        return "itk::MultiThreaderBaseEnums::Threader::WorkStealing";
         //      TODO    case MultiThreaderBaseEnums::Threader::Last:
         //                    return "itk::MultiThreaderBaseEnums::Threader::Last";
       case MultiThreaderBaseEnums::Threader::Unknown:
@@ -35,6 +35,8 @@
 #include "itkVersion.h"
 #include <cstring>
 #include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -117,10 +119,60 @@ struct ObjectFactoryBasePrivate
 
   ObjectFactoryBasePrivate() = default;
 
+  /** Update the registered factories to ask for each class, after the
+   * registered factories, or their overrides, changed. */
+  void
+  UpdateFactoriesByClassName()
+  {
+    m_FactoriesByClassName.clear();
+    m_FactoriesWithoutOverrides.clear();
+    if (m_RegisteredFactories)
+    {
+      for (auto * registeredFactory : *m_RegisteredFactories)
+      {
+        const std::list<std::string> classNames = registeredFactory->GetClassOverrideNames();
+        if (classNames.empty())
+        {
+          m_FactoriesWithoutOverrides.push_back(registeredFactory);
+          for (auto & classNameAndFactories : m_FactoriesByClassName)
+          {
+            classNameAndFactories.second.push_back(registeredFactory);
+          }
+        }
+        for (const auto & className : classNames)
+        {
+          const auto inserted = m_FactoriesByClassName.emplace(className, m_FactoriesWithoutOverrides);
+          auto &     factories = inserted.first->second;
+          if (factories.empty() || factories.back() != registeredFactory)
+          {
+            factories.push_back(registeredFactory);
+          }
+        }
+      }
+    }
+  }
+
+  /** The registered factories to ask for a class, in their order of
+   * registration. Returns a copy, as creating an object may register
+   * factories. */
+  std::vector<::itk::ObjectFactoryBase *>
+  GetFactoriesByClassName(const char * itkclassname) const
+  {
+    const auto it = m_FactoriesByClassName.find(itkclassname);
+    return it != m_FactoriesByClassName.end() ? it->second : m_FactoriesWithoutOverrides;
+  }
+
   std::list<::itk::ObjectFactoryBase *> * m_RegisteredFactories{ nullptr };
   std::list<::itk::ObjectFactoryBase *> * m_InternalFactories{ nullptr };
   bool                                    m_Initialized{ false };
   bool                                    m_StrictVersionChecking{ false };
+
+  /** The registered factories to ask by the names of the classes they
+   * override, so that creating an instance does not ask every registered
+   * factory. The factories which register no override are asked for every
+   * class, as they may create objects in their own CreateObject(). */
+  std::unordered_map<std::string, std::vector<::itk::ObjectFactoryBase *>> m_FactoriesByClassName;
+  std::vector<::itk::ObjectFactoryBase *>                                  m_FactoriesWithoutOverrides;
 };
 
 ObjectFactoryBasePrivate *
@@ -198,7 +250,7 @@ ObjectFactoryBase::CreateInstance(const char * itkclassname)
 {
   ObjectFactoryBase::Initialize();
 
-  for (auto & registeredFactory : *m_PimplGlobals->m_RegisteredFactories)
+  for (auto * registeredFactory : m_PimplGlobals->GetFactoriesByClassName(itkclassname))
   {
     LightObject::Pointer newobject = registeredFactory->CreateObject(itkclassname);
     if (newobject)
@@ -216,7 +268,7 @@ ObjectFactoryBase::CreateAllInstance(const char * itkclassname)
   ObjectFactoryBase::Initialize();
 
   std::list<LightObject::Pointer> created;
-  for (auto & registeredFactory : *m_PimplGlobals->m_RegisteredFactories)
+  for (auto * registeredFactory : m_PimplGlobals->GetFactoriesByClassName(itkclassname))
   {
     std::list<LightObject::Pointer> moreObjects = registeredFactory->CreateAllObject(itkclassname);
     created.splice(created.end(), moreObjects);
@@ -284,6 +336,7 @@ ObjectFactoryBase::RegisterInternal()
   {
     m_PimplGlobals->m_RegisteredFactories->push_back(internalFactory);
   }
+  m_PimplGlobals->UpdateFactoriesByClassName();
 }
 
 /**
@@ -550,6 +603,7 @@ ObjectFactoryBase::RegisterFactoryInternal(ObjectFactoryBase * factory)
   if (m_PimplGlobals->m_Initialized)
   {
     m_PimplGlobals->m_RegisteredFactories->push_back(factory);
+    m_PimplGlobals->UpdateFactoriesByClassName();
   }
 }
 
@@ -645,6 +699,7 @@ ObjectFactoryBase::RegisterFactory(ObjectFactoryBase * factory, InsertionPositio
       }
     }
   }
+  m_PimplGlobals->UpdateFactoriesByClassName();
   factory->Register();
   return true;
 }
@@ -707,6 +762,7 @@ ObjectFactoryBase::UnRegisterFactory(ObjectFactoryBase * factory)
       {
         DeleteNonInternalFactory(factory);
         m_PimplGlobals->m_RegisteredFactories->remove(factory);
+        m_PimplGlobals->UpdateFactoriesByClassName();
         return;
       }
     }
@@ -748,6 +804,7 @@ ObjectFactoryBase::UnRegisterAllFactories()
     delete m_PimplGlobals->m_RegisteredFactories;
     m_PimplGlobals->m_RegisteredFactories = nullptr;
     m_PimplGlobals->m_Initialized = false;
+    m_PimplGlobals->UpdateFactoriesByClassName();
   }
 }
 
@@ -769,6 +826,14 @@ ObjectFactoryBase::RegisterOverride(const char *               classOverride,
   info.m_CreateObject = createFunction;
 
   m_OverrideMap->insert(OverRideMap::value_type(classOverride, info));
+
+  // Overrides are usually registered before their factory.
+  if (m_PimplGlobals && m_PimplGlobals->m_RegisteredFactories &&
+      std::find(m_PimplGlobals->m_RegisteredFactories->begin(), m_PimplGlobals->m_RegisteredFactories->end(), this) !=
+        m_PimplGlobals->m_RegisteredFactories->end())
+  {
+    m_PimplGlobals->UpdateFactoriesByClassName();
+  }
 }
 
 LightObject::Pointer
@@ -876,6 +941,7 @@ ObjectFactoryBase::SynchronizeObjectFactoryBase(void * objectFactoryBasePrivate)
     SynchronizeList(m_PimplGlobals->m_InternalFactories, previousObjectFactoryBasePrivate->m_InternalFactories, true);
     SynchronizeList(
       m_PimplGlobals->m_RegisteredFactories, previousObjectFactoryBasePrivate->m_RegisteredFactories, false);
+    m_PimplGlobals->UpdateFactoriesByClassName();
   }
 }
 
@@ -0,0 +1,274 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPerformanceCounterProbe.h"
+
+#if defined(__linux__)
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <dirent.h>
+#  include <unistd.h>
+#  include <cstdlib>
+#  include <cstring>
+#endif
+
+namespace itk
+{
+namespace
+{
+#if defined(__linux__)
+// The perf_event_open() type and config of each event.
+constexpr std::pair<uint32_t, uint64_t> EventConfigs[] = {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+  { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK }
+};
+
+// The identifiers of the threads of the process.
+std::vector<pid_t>
+GetThreadIds()
+{
+  std::vector<pid_t> threadIds;
+  DIR * const        directory = opendir("/proc/self/task");
+  if (directory == nullptr)
+  {
+    threadIds.push_back(static_cast<pid_t>(syscall(SYS_gettid)));
+    return threadIds;
+  }
+  while (const dirent * const entry = readdir(directory))
+  {
+    if (entry->d_name[0] != '.')
+    {
+      threadIds.push_back(static_cast<pid_t>(std::atoi(entry->d_name)));
+    }
+  }
+  closedir(directory);
+  return threadIds;
+}
+
+int
+OpenCounter(const std::pair<uint32_t, uint64_t> & config, pid_t threadId)
+{
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = config.first;
+  attributes.config = config.second;
+  attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // Count the threads created by the thread, and only in user space, which
+  // the default perf_event_paranoid setting allows.
+  attributes.inherit = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attributes, threadId, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+// The count of a counter, scaled up when the counters of the processor
+// were multiplexed.
+OffsetValueType
+ReadCounter(int fileDescriptor)
+{
+  uint64_t values[3] = { 0, 0, 0 };
+  if (read(fileDescriptor, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0)
+  {
+    return 0;
+  }
+  if (values[2] == values[1])
+  {
+    return static_cast<OffsetValueType>(values[0]);
+  }
+  return static_cast<OffsetValueType>(static_cast<double>(values[0]) * static_cast<double>(values[1]) /
+                                      static_cast<double>(values[2]));
+}
+#endif
+} // end anonymous namespace
+
+PerformanceCounterProbe::PerformanceCounterProbe()
+  : ResourceProbe<CountValueType, double>("Cycles", "cycles")
+{}
+
+PerformanceCounterProbe::~PerformanceCounterProbe()
+{
+  this->CloseCounters();
+}
+
+void
+PerformanceCounterProbe::Start()
+{
+  this->CloseCounters();
+  this->OpenCounters();
+  Superclass::Start();
+  m_StartCounts = m_InstantCounts;
+}
+
+void
+PerformanceCounterProbe::Stop()
+{
+  if (this->GetNumberOfStops() == this->GetNumberOfStarts())
+  {
+    return;
+  }
+  Superclass::Stop();
+  for (unsigned int i = 0; i < NumberOfEvents; ++i)
+  {
+    m_TotalCounts[i] += m_InstantCounts[i] - m_StartCounts[i];
+  }
+  this->CloseCounters();
+}
+
+void
+PerformanceCounterProbe::Reset()
+{
+  Superclass::Reset();
+  m_StartCounts.fill(0);
+  m_TotalCounts.fill(0);
+}
+
+PerformanceCounterProbe::CountValueType
+PerformanceCounterProbe::GetInstantValue() const
+{
+  m_InstantCounts = this->ReadCounters();
+  return m_InstantCounts[static_cast<unsigned int>(EventEnum::Cycles)];
+}
+
+bool
+PerformanceCounterProbe::IsEventAvailable(EventEnum event) const
+{
+  return m_EventAvailable[static_cast<unsigned int>(event)];
+}
+
+PerformanceCounterProbe::CountValueType
+PerformanceCounterProbe::GetEventTotal(EventEnum event) const
+{
+  return m_TotalCounts[static_cast<unsigned int>(event)];
+}
+
+void
+PerformanceCounterProbe::SetNumberOfPixels(SizeValueType numberOfPixels)
+{
+  m_NumberOfPixels = numberOfPixels;
+}
+
+SizeValueType
+PerformanceCounterProbe::GetNumberOfPixels() const
+{
+  return m_NumberOfPixels;
+}
+
+double
+PerformanceCounterProbe::GetInstructionsPerCycle() const
+{
+  const CountValueType cycles = this->GetEventTotal(EventEnum::Cycles);
+  return cycles > 0 ? static_cast<double>(this->GetEventTotal(EventEnum::Instructions)) / static_cast<double>(cycles)
+                    : 0.0;
+}
+
+double
+PerformanceCounterProbe::GetEventsPerPixel(EventEnum event) const
+{
+  const double numberOfPixels =
+    static_cast<double>(m_NumberOfPixels) * static_cast<double>(this->GetNumberOfStops());
+  return numberOfPixels > 0.0 ? static_cast<double>(this->GetEventTotal(event)) / numberOfPixels : 0.0;
+}
+
+auto
+PerformanceCounterProbe::GetDerivedMetrics() const -> DerivedMetricsType
+{
+  return { { "IPC", this->GetInstructionsPerCycle() },
+           { "CacheMisses", static_cast<double>(this->GetEventTotal(EventEnum::CacheMisses)) },
+           { "BranchMisses", static_cast<double>(this->GetEventTotal(EventEnum::BranchMisses)) },
+           { "Cycles/Pixel", this->GetEventsPerPixel(EventEnum::Cycles) },
+           { "CacheMiss/Pixel", this->GetEventsPerPixel(EventEnum::CacheMisses) },
+           { "BranchMiss/Pixel", this->GetEventsPerPixel(EventEnum::BranchMisses) } };
+}
+
+void
+PerformanceCounterProbe::OpenCounters()
+{
+  m_EventAvailable.fill(false);
+#if defined(__linux__)
+  for (const pid_t threadId : GetThreadIds())
+  {
+    for (unsigned int i = 0; i < NumberOfEvents; ++i)
+    {
+      const int fileDescriptor = OpenCounter(EventConfigs[i], threadId);
+      // The thread may have exited since the threads were listed.
+      if (fileDescriptor >= 0)
+      {
+        m_FileDescriptors[i].push_back(fileDescriptor);
+        m_EventAvailable[i] = true;
+      }
+    }
+  }
+#endif
+}
+
+void
+PerformanceCounterProbe::CloseCounters()
+{
+  for (auto & fileDescriptors : m_FileDescriptors)
+  {
+#if defined(__linux__)
+    for (const int fileDescriptor : fileDescriptors)
+    {
+      close(fileDescriptor);
+    }
+#endif
+    fileDescriptors.clear();
+  }
+}
+
+auto
+PerformanceCounterProbe::ReadCounters() const -> CountsType
+{
+  CountsType counts{};
+#if defined(__linux__)
+  for (unsigned int i = 0; i < NumberOfEvents; ++i)
+  {
+    for (const int fileDescriptor : m_FileDescriptors[i])
+    {
+      counts[i] += ReadCounter(fileDescriptor);
+    }
+  }
+#endif
+  return counts;
+}
+
+std::ostream &
+operator<<(std::ostream & out, const PerformanceCounterProbeEnums::Event value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case PerformanceCounterProbeEnums::Event::Cycles:
+        return "itk::PerformanceCounterProbeEnums::Event::Cycles";
+      case PerformanceCounterProbeEnums::Event::Instructions:
+        return "itk::PerformanceCounterProbeEnums::Event::Instructions";
+      case PerformanceCounterProbeEnums::Event::CacheMisses:
+        return "itk::PerformanceCounterProbeEnums::Event::CacheMisses";
+      case PerformanceCounterProbeEnums::Event::BranchMisses:
+        return "itk::PerformanceCounterProbeEnums::Event::BranchMisses";
+      case PerformanceCounterProbeEnums::Event::TaskClock:
+        return "itk::PerformanceCounterProbeEnums::Event::TaskClock";
+      default:
+        return "INVALID VALUE FOR itk::PerformanceCounterProbeEnums::Event";
+    }
+  }();
+}
+} // end namespace itk
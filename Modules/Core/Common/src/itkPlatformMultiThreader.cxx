@@ -107,6 +107,15 @@ PlatformMultiThreader::SetMultipleMethod(ThreadIdType index, ThreadFunctionType
 
 void
 PlatformMultiThreader::SingleMethodExecute()
+{
+  // obey the global maximum number of threads limit
+  m_NumberOfWorkUnits = std::min(MultiThreaderBase::GetGlobalMaximumNumberOfThreads(), m_NumberOfWorkUnits);
+
+  this->SingleMethodExecuteWithWorkUnits(m_NumberOfWorkUnits);
+}
+
+void
+PlatformMultiThreader::SingleMethodExecuteWithWorkUnits(ThreadIdType numberOfWorkUnits)
 {
   ThreadIdType        thread_loop = 0;
   ThreadProcessIdType process_id[ITK_MAX_THREADS];
@@ -117,11 +126,11 @@ PlatformMultiThreader::SingleMethodExecute()
   }
 
   // obey the global maximum number of threads limit
-  m_NumberOfWorkUnits = std::min(MultiThreaderBase::GetGlobalMaximumNumberOfThreads(), m_NumberOfWorkUnits);
+  numberOfWorkUnits = std::min(MultiThreaderBase::GetGlobalMaximumNumberOfThreads(), numberOfWorkUnits);
 
   // Init process_id table because a valid process_id (i.e., non-zero), is
   // checked in the WaitForSingleMethodThread loops
-  for (thread_loop = 1; thread_loop < m_NumberOfWorkUnits; ++thread_loop)
+  for (thread_loop = 1; thread_loop < numberOfWorkUnits; ++thread_loop)
   {
     process_id[thread_loop] = ITK_DEFAULT_THREAD_ID;
   }
@@ -137,10 +146,10 @@ PlatformMultiThreader::SingleMethodExecute()
   std::string exceptionDetails;
   try
   {
-    for (thread_loop = 1; thread_loop < m_NumberOfWorkUnits; ++thread_loop)
+    for (thread_loop = 1; thread_loop < numberOfWorkUnits; ++thread_loop)
     {
       m_ThreadInfoArray[thread_loop].UserData = m_SingleData;
-      m_ThreadInfoArray[thread_loop].NumberOfWorkUnits = m_NumberOfWorkUnits;
+      m_ThreadInfoArray[thread_loop].NumberOfWorkUnits = numberOfWorkUnits;
       m_ThreadInfoArray[thread_loop].ThreadFunction = m_SingleMethod;
 
       process_id[thread_loop] = this->SpawnDispatchSingleMethodThread(&m_ThreadInfoArray[thread_loop]);
@@ -167,14 +176,14 @@ PlatformMultiThreader::SingleMethodExecute()
   try
   {
     m_ThreadInfoArray[0].UserData = m_SingleData;
-    m_ThreadInfoArray[0].NumberOfWorkUnits = m_NumberOfWorkUnits;
+    m_ThreadInfoArray[0].NumberOfWorkUnits = numberOfWorkUnits;
     m_SingleMethod((void *)(&m_ThreadInfoArray[0]));
   }
   catch (ProcessAborted &)
   {
     // Need cleanup and rethrow ProcessAborted
     // close down other threads
-    for (thread_loop = 1; thread_loop < m_NumberOfWorkUnits; ++thread_loop)
+    for (thread_loop = 1; thread_loop < numberOfWorkUnits; ++thread_loop)
     {
       try
       {
@@ -203,7 +212,7 @@ PlatformMultiThreader::SingleMethodExecute()
   }
   // The parent thread has finished this->SingleMethod() - so now it
   // waits for each of the other processes to exit
-  for (thread_loop = 1; thread_loop < m_NumberOfWorkUnits; ++thread_loop)
+  for (thread_loop = 1; thread_loop < numberOfWorkUnits; ++thread_loop)
   {
     try
     {
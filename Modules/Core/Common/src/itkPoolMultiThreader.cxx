@@ -28,10 +28,12 @@
 #include "itkPoolMultiThreader.h"
 #include "itkNumericTraits.h"
 #include "itkProcessObject.h"
+#include "itkExecutionTracer.h"
 #include "itkImageSourceCommon.h"
 #include <algorithm>
 #include <exception>
 #include <iostream>
+#include <numeric>
 #include <string>
 
 namespace itk
@@ -134,7 +136,8 @@ PoolMultiThreader::SingleMethodExecute()
   {
     m_ThreadInfoArray[threadLoop].UserData = m_SingleData;
     m_ThreadInfoArray[threadLoop].NumberOfWorkUnits = m_NumberOfWorkUnits;
-    m_ThreadInfoArray[threadLoop].Future = m_ThreadPool->AddWork(m_SingleMethod, &m_ThreadInfoArray[threadLoop]);
+    m_ThreadInfoArray[threadLoop].Future =
+      m_ThreadPool->AddWorkToThread(threadLoop - 1, m_SingleMethod, &m_ThreadInfoArray[threadLoop]);
   }
 
   // Now, the parent thread calls this->SingleMethod() itself
@@ -159,20 +162,30 @@ PoolMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
                                     ArrayThreadingFunctorType aFunc,
                                     ProcessObject *           filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start(
+      "ParallelRegion", filter ? filter->GetNameOfClass() : this->GetNameOfClass(), lastIndexPlus1 - firstIndex);
+  }
+
   if (!this->GetUpdateProgress())
   {
     filter = nullptr;
   }
 
-  if (firstIndex + 1 < lastIndexPlus1)
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    lastIndexPlus1 > firstIndex ? lastIndexPlus1 - firstIndex : 0, DefaultArrayGrainSize);
+  if (numberOfWorkUnits > 1)
   {
-    SizeValueType chunkSize = (lastIndexPlus1 - firstIndex) / m_NumberOfWorkUnits;
-    if ((lastIndexPlus1 - firstIndex) % m_NumberOfWorkUnits > 0)
+    SizeValueType chunkSize = (lastIndexPlus1 - firstIndex) / numberOfWorkUnits;
+    if ((lastIndexPlus1 - firstIndex) % numberOfWorkUnits > 0)
     {
       chunkSize++; // we want slightly bigger chunks to be processed first
     }
 
     auto lambda = [aFunc](SizeValueType start, SizeValueType end) {
+      const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", end - start);
       for (SizeValueType ii = start; ii < end; ++ii)
       {
         aFunc(ii);
@@ -181,12 +194,13 @@ PoolMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
       return ITK_THREAD_RETURN_DEFAULT_VALUE;
     };
 
-    SizeValueType workUnit = 1;
-    for (SizeValueType i = firstIndex + chunkSize; i < lastIndexPlus1; i += chunkSize)
+    ThreadIdType workUnit = 1;
+    for (SizeValueType i = firstIndex + chunkSize; i < lastIndexPlus1; i += chunkSize, ++workUnit)
     {
-      m_ThreadInfoArray[workUnit++].Future = m_ThreadPool->AddWork(lambda, i, std::min(i + chunkSize, lastIndexPlus1));
+      m_ThreadInfoArray[workUnit].Future =
+        m_ThreadPool->AddWorkToThread(workUnit - 1, lambda, i, std::min(i + chunkSize, lastIndexPlus1));
     }
-    itkAssertOrThrowMacro(workUnit <= m_NumberOfWorkUnits, "Number of work units was somehow miscounted!");
+    itkAssertOrThrowMacro(workUnit <= numberOfWorkUnits, "Number of work units was somehow miscounted!");
 
     ProgressReporter reporter(filter, 0, workUnit);
 
@@ -216,11 +230,15 @@ PoolMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
 
     exceptionHandler.RethrowFirstCaughtException();
   }
-  else if (firstIndex + 1 == lastIndexPlus1)
+  else
   {
-    aFunc(firstIndex);
+    // Not worth waking up other threads.
+    const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", lastIndexPlus1 - firstIndex);
+    for (SizeValueType i = firstIndex; i < lastIndexPlus1; ++i)
+    {
+      aFunc(i);
+    }
   }
-  // else nothing needs to be executed
 }
 
 void
@@ -230,12 +248,23 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
                                           ThreadingFunctorType funcP,
                                           ProcessObject *      filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start("ParallelRegion",
+               filter ? filter->GetNameOfClass() : this->GetNameOfClass(),
+               std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()));
+    funcP = Self::TraceWorkUnits(dimension, std::move(funcP));
+  }
+
   if (!this->GetUpdateProgress())
   {
     filter = nullptr;
   }
 
-  if (m_NumberOfWorkUnits == 1) // no multi-threading wanted
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()), DefaultImageRegionGrainSize);
+  if (numberOfWorkUnits == 1) // no multi-threading wanted, or not worth it
   {
     ProgressReporter reporter(filter, 0, 1);
     funcP(index, size); // process whole region
@@ -256,9 +285,9 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
     else
     {
       const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
-      ThreadIdType                    splitCount = splitter->GetNumberOfSplits(region, m_NumberOfWorkUnits);
+      ThreadIdType                    splitCount = splitter->GetNumberOfSplits(region, numberOfWorkUnits);
       ProgressReporter                reporter(filter, 0, splitCount);
-      itkAssertOrThrowMacro(splitCount <= m_NumberOfWorkUnits, "Split count is greater than number of work units!");
+      itkAssertOrThrowMacro(splitCount <= numberOfWorkUnits, "Split count is greater than number of work units!");
       ImageIORegion iRegion;
       ThreadIdType  total;
       for (ThreadIdType i = 1; i < splitCount; ++i)
@@ -267,7 +296,7 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
         total = splitter->GetSplit(i, splitCount, iRegion);
         if (i < total)
         {
-          m_ThreadInfoArray[i].Future = m_ThreadPool->AddWork([funcP, iRegion]() {
+          m_ThreadInfoArray[i].Future = m_ThreadPool->AddWorkToThread(i - 1, [funcP, iRegion]() {
             funcP(&iRegion.GetIndex()[0], &iRegion.GetSize()[0]);
             // make this lambda have the same signature as m_SingleMethod
             return ITK_THREAD_RETURN_DEFAULT_VALUE;
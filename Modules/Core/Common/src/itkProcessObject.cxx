@@ -32,6 +32,7 @@
 #include <sstream>
 #include <algorithm>
 #include "itkMultiThreaderBase.h"
+#include "itkExecutionTracer.h"
 
 namespace itk
 {
@@ -1648,6 +1649,12 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
   }
 
 
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start("UpdateOutputData", this->GetNameOfClass());
+  }
+
   /**
    * Prepare all the outputs. This may deallocate previous bulk data.
    */
@@ -1705,6 +1712,11 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
 
   try
   {
+    ExecutionTracer::Span generateDataSpan;
+    if (ExecutionTracer::GetEnabled())
+    {
+      generateDataSpan.Start("GenerateData", this->GetNameOfClass());
+    }
     this->GenerateData();
   }
   catch (ProcessAborted &)
@@ -19,8 +19,10 @@
 #include "itkTBBMultiThreader.h"
 #include "itkNumericTraits.h"
 #include "itkProcessObject.h"
+#include "itkExecutionTracer.h"
 #include "itkTotalProgressReporter.h"
 #include <iostream>
+#include <numeric>
 #include <atomic>
 #include <thread>
 #include "tbb/parallel_for.h"
@@ -123,13 +125,21 @@ TBBMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
                                    ArrayThreadingFunctorType aFunc,
                                    ProcessObject *           filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start(
+      "ParallelRegion", filter ? filter->GetNameOfClass() : this->GetNameOfClass(), lastIndexPlus1 - firstIndex);
+  }
+
   if (!this->GetUpdateProgress())
   {
     filter = nullptr;
   }
   ProgressReporter progressStartEnd(filter, 0, 1);
 
-  if (firstIndex + 1 < lastIndexPlus1)
+  if (this->ComputeNumberOfWorkUnits(lastIndexPlus1 > firstIndex ? lastIndexPlus1 - firstIndex : 0,
+                                     DefaultArrayGrainSize) > 1)
   {
     const unsigned      count = lastIndexPlus1 - firstIndex;
     tbb::global_control l_ParallelizeArray_tbb_global_context(
@@ -146,15 +156,22 @@ TBBMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
         TotalProgressReporter progress(filter, count, 100);
         progress.CheckAbortGenerateData();
 
+        // Each work unit is a single index.
+        const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", 1);
         aFunc(r.begin()); // invoke the function
 
         progress.CompletedPixel();
       },
       tbb::simple_partitioner());
   }
-  else if (firstIndex + 1 == lastIndexPlus1)
+  else
   {
-    aFunc(firstIndex);
+    // Not worth waking up other threads.
+    const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", lastIndexPlus1 - firstIndex);
+    for (SizeValueType i = firstIndex; i < lastIndexPlus1; ++i)
+    {
+      aFunc(i);
+    }
   }
 }
 
@@ -246,13 +263,23 @@ TBBMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
                                          ThreadingFunctorType funcP,
                                          ProcessObject *      filter)
 {
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start("ParallelRegion",
+               filter ? filter->GetNameOfClass() : this->GetNameOfClass(),
+               std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()));
+    funcP = Self::TraceWorkUnits(dimension, std::move(funcP));
+  }
+
   if (!this->GetUpdateProgress())
   {
     filter = nullptr;
   }
   ProgressReporter progressStartEnd(filter, 0, 1);
 
-  if (m_NumberOfWorkUnits == 1)
+  if (this->ComputeNumberOfWorkUnits(std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()),
+                                     DefaultImageRegionGrainSize) == 1)
   {
     funcP(index, size);
   }
@@ -25,10 +25,195 @@
 #include "itkSingleton.h"
 
 #include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#elif defined(_WIN32)
+#  include "itkWindows.h"
+#endif
 
 
 namespace itk
 {
+namespace
+{
+// The index of the calling thread in the pool, or AnyThread.
+thread_local ThreadIdType currentThreadIndex = std::numeric_limits<ThreadIdType>::max();
+
+std::string
+TrimWhitespace(const std::string & text)
+{
+  const std::string::size_type first = text.find_first_not_of(" \t\r\n");
+  const std::string::size_type last = text.find_last_not_of(" \t\r\n");
+  return (first == std::string::npos) ? std::string() : text.substr(first, last - first + 1);
+}
+
+// Larger CPU numbers are rejected, as not supported by the pinning APIs.
+constexpr unsigned long MaximumCPU = 1 << 16;
+
+// Parse a list of CPUs, such as "0-3,8,10-11", as written in sysfs.
+bool
+ParseCPUList(const std::string & list, std::vector<unsigned int> & cpus)
+{
+  std::istringstream stream(list);
+  std::string        range;
+  while (std::getline(stream, range, ','))
+  {
+    range = TrimWhitespace(range);
+    if (range.empty())
+    {
+      continue;
+    }
+    const std::string::size_type dash = range.find('-');
+    try
+    {
+      const unsigned long first = std::stoul(range.substr(0, dash));
+      const unsigned long last = (dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1));
+      if (last < first || last >= MaximumCPU)
+      {
+        return false;
+      }
+      for (unsigned long cpu = first; cpu <= last; ++cpu)
+      {
+        cpus.push_back(static_cast<unsigned int>(cpu));
+      }
+    }
+    catch (const std::exception &)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The first line of a sysfs file.
+std::string
+ReadSysFile(const std::string & path)
+{
+  std::ifstream file(path);
+  std::string   line;
+  std::getline(file, line);
+  return line;
+}
+
+struct CPUInfo
+{
+  unsigned int m_CPU;
+  unsigned int m_Package;
+  unsigned int m_Core;
+};
+
+// The CPUs on which the process may run, with their socket and core. The
+// process affinity is read once, before any thread of the pool is pinned.
+const std::vector<CPUInfo> &
+GetProcessCPUs()
+{
+  static const std::vector<CPUInfo> cpus = [] {
+    std::vector<CPUInfo> result;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+      for (unsigned int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      {
+        if (CPU_ISSET(cpu, &set))
+        {
+          const std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+          const std::string package = ReadSysFile(topology + "physical_package_id");
+          const std::string core = ReadSysFile(topology + "core_id");
+          result.push_back({ cpu,
+                             package.empty() ? 0u : static_cast<unsigned int>(std::stoul(package)),
+                             core.empty() ? cpu : static_cast<unsigned int>(std::stoul(core)) });
+        }
+      }
+    }
+#elif defined(_WIN32)
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+    {
+      for (unsigned int cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu)
+      {
+        if (processMask & (DWORD_PTR{ 1 } << cpu))
+        {
+          result.push_back({ cpu, 0u, cpu });
+        }
+      }
+    }
+#endif
+    if (result.empty())
+    {
+      for (unsigned int cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu)
+      {
+        result.push_back({ cpu, 0u, cpu });
+      }
+    }
+    return result;
+  }();
+  return cpus;
+}
+
+bool
+IsProcessCPU(unsigned int cpu)
+{
+  const std::vector<CPUInfo> & processCPUs = GetProcessCPUs();
+  return std::any_of(
+    processCPUs.begin(), processCPUs.end(), [cpu](const CPUInfo & info) { return info.m_CPU == cpu; });
+}
+
+// Pin the thread to the CPUs.
+void
+PinThread(std::thread & thread, const std::vector<unsigned int> & cpus)
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const unsigned int cpu : cpus)
+  {
+    if (cpu < CPU_SETSIZE)
+    {
+      CPU_SET(cpu, &set);
+    }
+  }
+  pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#elif defined(_WIN32)
+  DWORD_PTR mask = 0;
+  for (const unsigned int cpu : cpus)
+  {
+    if (cpu < sizeof(DWORD_PTR) * 8)
+    {
+      mask |= DWORD_PTR{ 1 } << cpu;
+    }
+  }
+  SetThreadAffinityMask(static_cast<HANDLE>(thread.native_handle()), mask);
+#else
+  (void)thread;
+  (void)cpus;
+#endif
+}
+} // end anonymous namespace
+
+/** Idle: waiting to be woken up. Awake: looking for a job, and will run
+ * the jobs of its queue before waiting. Busy: running a job. */
+struct ThreadPool::ThreadState
+{
+  enum class Activity
+  {
+    Idle,
+    Awake,
+    Busy
+  };
+
+  std::deque<std::function<void()>> m_Queue;
+  std::condition_variable           m_Condition;
+  Activity                          m_Activity{ Activity::Awake };
+};
 
 struct ThreadPoolGlobals
 {
@@ -103,11 +288,72 @@ ThreadPool::ThreadPool()
 {
   m_PimplGlobals->m_ThreadPoolInstance = this;        // threads need this
   m_PimplGlobals->m_ThreadPoolInstance->UnRegister(); // Remove extra reference
+
+  // The mutex is locked by GetInstance(), and no thread is started yet.
+  std::string affinity;
+  if (itksys::SystemTools::GetEnv("ITK_THREAD_AFFINITY", affinity))
+  {
+    std::string numaNode;
+    itksys::SystemTools::GetEnv("ITK_THREAD_AFFINITY_NUMA_NODE", numaNode);
+    affinity = itksys::SystemTools::LowerCase(TrimWhitespace(affinity));
+    try
+    {
+      const int                 node = numaNode.empty() ? -1 : std::stoi(numaNode);
+      std::vector<unsigned int> cpus;
+      if (affinity == "compact" || affinity == "spread" || affinity == "unpinned" || affinity.empty())
+      {
+        const auto placement = (affinity == "compact")  ? ThreadPlacementEnum::Compact
+                               : (affinity == "spread") ? ThreadPlacementEnum::Spread
+                                                        : ThreadPlacementEnum::Unpinned;
+        cpus = GetPlacementCPUs(placement, node);
+        if (cpus.empty())
+        {
+          itkWarningMacro("Ignoring ITK_THREAD_AFFINITY_NUMA_NODE=" << numaNode << ", which has no available CPU.");
+        }
+        else if (placement != ThreadPlacementEnum::Unpinned || node >= 0)
+        {
+          this->SetAffinityCPUs(cpus, placement != ThreadPlacementEnum::Unpinned);
+        }
+      }
+      else if (ParseCPUList(affinity, cpus) && std::all_of(cpus.begin(), cpus.end(), IsProcessCPU))
+      {
+        this->SetAffinityCPUs(cpus, true);
+      }
+      else
+      {
+        itkWarningMacro("Ignoring ITK_THREAD_AFFINITY=" << affinity
+                                                        << ", which is neither compact, spread, unpinned, "
+                                                           "nor a list of CPUs available to the process.");
+      }
+    }
+    catch (const std::exception &)
+    {
+      itkWarningMacro("Ignoring ITK_THREAD_AFFINITY_NUMA_NODE=" << numaNode << ", which is not a number.");
+    }
+  }
+
   ThreadIdType threadCount = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
   m_Threads.reserve(threadCount);
   for (unsigned int i = 0; i < threadCount; ++i)
   {
-    m_Threads.emplace_back(&ThreadPool::ThreadExecute);
+    this->StartThread();
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  this->CleanUp();
+}
+
+void
+ThreadPool::StartThread()
+{
+  const auto threadIndex = static_cast<ThreadIdType>(m_Threads.size());
+  m_ThreadStates.emplace_back(new ThreadState());
+  m_Threads.emplace_back(&ThreadPool::ThreadExecute, threadIndex);
+  if (!m_AffinityCPUs.empty())
+  {
+    this->ApplyThreadAffinity(threadIndex);
   }
 }
 
@@ -118,7 +364,7 @@ ThreadPool::AddThreads(ThreadIdType count)
   m_Threads.reserve(m_Threads.size() + count);
   for (unsigned int i = 0; i < count; ++i)
   {
-    m_Threads.emplace_back(&ThreadPool::ThreadExecute);
+    this->StartThread();
   }
 }
 
@@ -128,11 +374,254 @@ ThreadPool::GetMutex()
   return m_PimplGlobals->m_Mutex;
 }
 
+void
+ThreadPool::Submit(std::function<void()> job, ThreadIdType threadIndex)
+{
+  std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+  if (threadIndex == AnyThread || m_ThreadStates.empty())
+  {
+    m_WorkQueue.emplace_back(std::move(job));
+    this->WakeIdleThread();
+    return;
+  }
+
+  ThreadState & state = *m_ThreadStates[threadIndex % m_ThreadStates.size()];
+  state.m_Queue.emplace_back(std::move(job));
+  if (state.m_Activity == ThreadState::Activity::Idle)
+  {
+    state.m_Activity = ThreadState::Activity::Awake;
+    state.m_Condition.notify_one();
+  }
+  else if (state.m_Activity == ThreadState::Activity::Busy || state.m_Queue.size() > 1)
+  {
+    // Let another thread take the job, if one is idle.
+    this->WakeIdleThread();
+  }
+}
+
+void
+ThreadPool::WakeIdleThread()
+{
+  for (const auto & state : m_ThreadStates)
+  {
+    if (state->m_Activity == ThreadState::Activity::Idle)
+    {
+      state->m_Activity = ThreadState::Activity::Awake;
+      state->m_Condition.notify_one();
+      return;
+    }
+  }
+}
+
+std::function<void()>
+ThreadPool::TakeJob(ThreadIdType threadIndex)
+{
+  std::function<void()>               job;
+  std::deque<std::function<void()>> & ownQueue = m_ThreadStates[threadIndex]->m_Queue;
+  if (!ownQueue.empty())
+  {
+    job = std::move(ownQueue.front());
+    ownQueue.pop_front();
+    return job;
+  }
+  if (!m_WorkQueue.empty())
+  {
+    job = std::move(m_WorkQueue.front());
+    m_WorkQueue.pop_front();
+    return job;
+  }
+
+  // Take the jobs queued for a busy thread, or those beyond the first one
+  // of an idle thread, which it will run when it wakes up.
+  const auto numberOfThreads = static_cast<ThreadIdType>(m_ThreadStates.size());
+  for (ThreadIdType i = 1; i < numberOfThreads; ++i)
+  {
+    ThreadState & other = *m_ThreadStates[(threadIndex + i) % numberOfThreads];
+    if (other.m_Activity == ThreadState::Activity::Busy && !other.m_Queue.empty())
+    {
+      job = std::move(other.m_Queue.front());
+      other.m_Queue.pop_front();
+      return job;
+    }
+    if (other.m_Queue.size() > 1)
+    {
+      job = std::move(other.m_Queue.back());
+      other.m_Queue.pop_back();
+      return job;
+    }
+  }
+  return job;
+}
+
+bool
+ThreadPool::IsWorkerThread() const
+{
+  return currentThreadIndex != AnyThread;
+}
+
+void
+ThreadPool::ReleaseCurrentThread()
+{
+  if (currentThreadIndex != AnyThread)
+  {
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    m_PimplGlobals->m_ThreadPoolInstance->m_ThreadStates[currentThreadIndex]->m_Activity =
+      ThreadState::Activity::Awake;
+  }
+}
+
+void
+ThreadPool::SetThreadAffinity(const std::vector<unsigned int> & cpus)
+{
+  for (const unsigned int cpu : cpus)
+  {
+    if (!IsProcessCPU(cpu))
+    {
+      itkExceptionMacro("CPU " << cpu << " is not available to the process.");
+    }
+  }
+
+  std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+  this->SetAffinityCPUs(cpus, true);
+}
+
+void
+ThreadPool::SetThreadPlacement(ThreadPlacementEnum placement, int numaNode)
+{
+  std::vector<unsigned int> cpus = GetPlacementCPUs(placement, numaNode);
+  if (cpus.empty())
+  {
+    itkExceptionMacro("No CPU of NUMA node " << numaNode << " is available to the process.");
+  }
+  if (placement == ThreadPlacementEnum::Unpinned && numaNode < 0)
+  {
+    cpus.clear();
+  }
+
+  std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+  this->SetAffinityCPUs(cpus, placement != ThreadPlacementEnum::Unpinned);
+}
+
+void
+ThreadPool::SetAffinityCPUs(const std::vector<unsigned int> & cpus, bool pinToSingleCPUs)
+{
+  m_AffinityCPUs = cpus;
+  m_PinToSingleCPUs = pinToSingleCPUs;
+  for (ThreadIdType i = 0; i < m_Threads.size(); ++i)
+  {
+    this->ApplyThreadAffinity(i);
+  }
+}
+
+std::vector<unsigned int>
+ThreadPool::GetThreadAffinity(ThreadIdType threadIndex) const
+{
+  std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+  if (m_AffinityCPUs.empty() || !m_PinToSingleCPUs)
+  {
+    return m_AffinityCPUs;
+  }
+  return { m_AffinityCPUs[threadIndex % m_AffinityCPUs.size()] };
+}
+
+void
+ThreadPool::ApplyThreadAffinity(ThreadIdType threadIndex)
+{
+  if (m_AffinityCPUs.empty())
+  {
+    PinThread(m_Threads[threadIndex], GetPlacementCPUs(ThreadPlacementEnum::Unpinned));
+  }
+  else if (!m_PinToSingleCPUs)
+  {
+    PinThread(m_Threads[threadIndex], m_AffinityCPUs);
+  }
+  else
+  {
+    PinThread(m_Threads[threadIndex], { m_AffinityCPUs[threadIndex % m_AffinityCPUs.size()] });
+  }
+}
+
+std::vector<unsigned int>
+ThreadPool::GetPlacementCPUs(ThreadPlacementEnum placement, int numaNode)
+{
+  std::vector<CPUInfo> cpus = GetProcessCPUs();
+  if (numaNode >= 0)
+  {
+    std::vector<unsigned int> nodeCPUs;
+    ParseCPUList(ReadSysFile("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist"), nodeCPUs);
+    cpus.erase(std::remove_if(cpus.begin(),
+                              cpus.end(),
+                              [&nodeCPUs](const CPUInfo & info) {
+                                return std::find(nodeCPUs.begin(), nodeCPUs.end(), info.m_CPU) == nodeCPUs.end();
+                              }),
+               cpus.end());
+  }
+
+  std::vector<unsigned int> result;
+  if (placement == ThreadPlacementEnum::Spread)
+  {
+    // The hardware threads of each core of each socket, in order.
+    std::map<unsigned int, std::map<unsigned int, std::vector<unsigned int>>> packages;
+    for (const CPUInfo & info : cpus)
+    {
+      packages[info.m_Package][info.m_Core].push_back(info.m_CPU);
+    }
+    std::vector<std::vector<std::vector<unsigned int>>> cores;
+    for (const auto & package : packages)
+    {
+      cores.emplace_back();
+      for (const auto & core : package.second)
+      {
+        cores.back().push_back(core.second);
+      }
+    }
+    // Take the n-th hardware thread of the k-th core of each socket in turn.
+    for (size_t hardwareThread = 0; result.size() < cpus.size(); ++hardwareThread)
+    {
+      for (size_t core = 0; result.size() < cpus.size(); ++core)
+      {
+        bool found = false;
+        for (const auto & packageCores : cores)
+        {
+          if (core < packageCores.size())
+          {
+            found = true;
+            if (hardwareThread < packageCores[core].size())
+            {
+              result.push_back(packageCores[core][hardwareThread]);
+            }
+          }
+        }
+        if (!found)
+        {
+          break;
+        }
+      }
+    }
+  }
+  else
+  {
+    if (placement == ThreadPlacementEnum::Compact)
+    {
+      std::sort(cpus.begin(), cpus.end(), [](const CPUInfo & a, const CPUInfo & b) {
+        return std::tie(a.m_Package, a.m_Core, a.m_CPU) < std::tie(b.m_Package, b.m_Core, b.m_CPU);
+      });
+    }
+    for (const CPUInfo & info : cpus)
+    {
+      result.push_back(info.m_CPU);
+    }
+  }
+  return result;
+}
+
 int
 ThreadPool::GetNumberOfCurrentlyIdleThreads() const
 {
   std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
-  return int(m_Threads.size()) - int(m_WorkQueue.size()); // lousy approximation
+  return static_cast<int>(std::count_if(m_ThreadStates.begin(), m_ThreadStates.end(), [](const auto & state) {
+    return state->m_Activity == ThreadState::Activity::Idle;
+  }));
 }
 
 void
@@ -144,9 +633,13 @@ ThreadPool::CleanUp()
     this->m_Stopping = true;
   }
 
-  if (m_PimplGlobals->m_WaitForThreads && !m_Threads.empty())
+  if (m_PimplGlobals->m_WaitForThreads)
   {
-    m_Condition.notify_all();
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    for (const auto & state : m_ThreadStates)
+    {
+      state->m_Condition.notify_one();
+    }
   }
 
   // Even if the threads have already been terminated,
@@ -170,15 +663,17 @@ ThreadPool::ResumeFromFork()
   ThreadPool * instance = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
   ThreadIdType threadCount = instance->m_Threads.size();
   instance->m_Threads.clear();
+  instance->m_ThreadStates.clear();
   instance->m_Stopping = false;
   instance->AddThreads(threadCount);
 }
 
 void
-ThreadPool::ThreadExecute()
+ThreadPool::ThreadExecute(ThreadIdType threadIndex)
 {
   // plain pointer does not increase reference count
   ThreadPool * threadPool = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
+  currentThreadIndex = threadIndex;
 
   while (true)
   {
@@ -186,20 +681,43 @@ ThreadPool::ThreadExecute()
 
     {
       std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
-      threadPool->m_Condition.wait(mutexHolder,
-                                   [threadPool] { return threadPool->m_Stopping || !threadPool->m_WorkQueue.empty(); });
-      if (threadPool->m_Stopping && threadPool->m_WorkQueue.empty())
+      ThreadState &                state = *threadPool->m_ThreadStates[threadIndex];
+      state.m_Activity = ThreadState::Activity::Awake;
+      while (!(task = threadPool->TakeJob(threadIndex)))
       {
-        return;
+        if (threadPool->m_Stopping)
+        {
+          return;
+        }
+        state.m_Activity = ThreadState::Activity::Idle;
+        state.m_Condition.wait(mutexHolder);
+        state.m_Activity = ThreadState::Activity::Awake;
       }
-      task = std::move(threadPool->m_WorkQueue.front());
-      threadPool->m_WorkQueue.pop_front();
+      state.m_Activity = ThreadState::Activity::Busy;
     }
 
     task(); // execute the task
   }
 }
 
+std::ostream &
+operator<<(std::ostream & out, const ThreadPoolEnums::ThreadPlacement value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case ThreadPoolEnums::ThreadPlacement::Unpinned:
+        return "itk::ThreadPoolEnums::ThreadPlacement::Unpinned";
+      case ThreadPoolEnums::ThreadPlacement::Compact:
+        return "itk::ThreadPoolEnums::ThreadPlacement::Compact";
+      case ThreadPoolEnums::ThreadPlacement::Spread:
+        return "itk::ThreadPoolEnums::ThreadPlacement::Spread";
+      default:
+        return "INVALID VALUE FOR itk::ThreadPoolEnums::ThreadPlacement";
+    }
+  }();
+}
+
 ThreadPoolGlobals * ThreadPool::m_PimplGlobals;
 
 } // namespace itk
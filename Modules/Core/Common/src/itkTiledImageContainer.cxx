@@ -0,0 +1,394 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkTiledImageContainer.h"
+#include <cstring>
+#include <limits>
+
+#if defined(_WIN32)
+#  include "itkWindows.h"
+#else
+#  include <sys/mman.h>
+#endif
+
+namespace itk
+{
+
+namespace
+{
+// The count of a run precedes its value in run-length encoded bricks.
+using RunLengthType = uint32_t;
+} // namespace
+
+
+TiledImageContainer::~TiledImageContainer()
+{
+  this->ReserveInternalPixels(0);
+}
+
+void
+TiledImageContainer::ReserveInternalPixels(SizeValueType numberOfElements)
+{
+  static_assert(sizeof(TiledImageInternalPixel) == 1, "An internal pixel is reserved as a byte.");
+  if (m_InternalPixels != nullptr)
+  {
+#if defined(_WIN32)
+    VirtualFree(m_InternalPixels, 0, MEM_RELEASE);
+#else
+    munmap(m_InternalPixels, m_NumberOfInternalPixels);
+#endif
+    m_InternalPixels = nullptr;
+    m_NumberOfInternalPixels = 0;
+  }
+  if (numberOfElements == 0)
+  {
+    return;
+  }
+
+  // The pages are inaccessible, and not backed by memory or swap space.
+#if defined(_WIN32)
+  void * const address = VirtualAlloc(nullptr, numberOfElements, MEM_RESERVE, PAGE_NOACCESS);
+#else
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#  if defined(MAP_NORESERVE)
+  flags |= MAP_NORESERVE;
+#  endif
+  void * address = mmap(nullptr, numberOfElements, PROT_NONE, flags, -1, 0);
+  if (address == MAP_FAILED)
+  {
+    address = nullptr;
+  }
+#endif
+  if (address == nullptr)
+  {
+    throw MemoryAllocationError(
+      __FILE__, __LINE__, "Failed to reserve the address space of a tiled image.", ITK_LOCATION);
+  }
+  m_InternalPixels = static_cast<TiledImageInternalPixel *>(address);
+  m_NumberOfInternalPixels = numberOfElements;
+}
+
+void
+TiledImageContainer::Allocate(SizeValueType numberOfBricks,
+                              SizeValueType numberOfElementsPerBrick,
+                              SizeValueType elementSize,
+                              const void *  value)
+{
+  if (elementSize == 0)
+  {
+    itkExceptionMacro(<< "The element size must be positive.");
+  }
+  if (numberOfElementsPerBrick > std::numeric_limits<RunLengthType>::max())
+  {
+    itkExceptionMacro(<< "The bricks have too many elements: " << numberOfElementsPerBrick);
+  }
+
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  m_NumberOfElementsPerBrick = numberOfElementsPerBrick;
+  m_ElementSize = elementSize;
+  m_CachedBricks.clear();
+  m_Bricks.clear();
+  m_Bricks.resize(numberOfBricks);
+  for (Brick & brick : m_Bricks)
+  {
+    brick.m_Data.assign(static_cast<const char *>(value), static_cast<const char *>(value) + elementSize);
+  }
+  this->ReserveInternalPixels(numberOfBricks * numberOfElementsPerBrick);
+  ++m_Generation;
+  this->Modified();
+}
+
+void
+TiledImageContainer::Initialize()
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  m_CachedBricks.clear();
+  std::vector<Brick>().swap(m_Bricks);
+  this->ReserveInternalPixels(0);
+  ++m_Generation;
+  this->Modified();
+}
+
+void
+TiledImageContainer::Fill(const void * value)
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  m_CachedBricks.clear();
+  for (Brick & brick : m_Bricks)
+  {
+    brick.m_Encoding = BrickEncodingEnum::Uniform;
+    brick.m_Data.assign(static_cast<const char *>(value), static_cast<const char *>(value) + m_ElementSize);
+    brick.m_Data.shrink_to_fit();
+    brick.m_Buffer.reset();
+    brick.m_IsModified = false;
+  }
+  ++m_Generation;
+  this->Modified();
+}
+
+char *
+TiledImageContainer::AcquireBrick(SizeValueType brickIndex, bool forWriting, BrickBuffer & buffer, void * uniformValue)
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  Brick &                           brick = m_Bricks[brickIndex];
+
+  if (brick.m_Buffer)
+  {
+    m_CachedBricks.splice(m_CachedBricks.begin(), m_CachedBricks, brick.m_CachePosition);
+  }
+  else
+  {
+    if (brick.m_Encoding == BrickEncodingEnum::Uniform && !forWriting)
+    {
+      buffer.reset();
+      std::memcpy(uniformValue, brick.m_Data.data(), m_ElementSize);
+      return nullptr;
+    }
+    brick.m_Buffer = std::make_shared<std::vector<char>>(m_NumberOfElementsPerBrick * m_ElementSize);
+    this->Decode(brick, brick.m_Buffer->data());
+    if (brick.m_Encoding == BrickEncodingEnum::Uniform)
+    {
+      // The uniform value of the brick, held by its readers, is outdated.
+      ++m_Generation;
+    }
+    m_CachedBricks.push_front(brickIndex);
+    brick.m_CachePosition = m_CachedBricks.begin();
+  }
+  brick.m_IsModified = brick.m_IsModified || forWriting;
+  buffer = brick.m_Buffer;
+  this->EvictBricks(false);
+  return buffer->data();
+}
+
+void
+TiledImageContainer::Flush()
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  this->EvictBricks(true);
+}
+
+void
+TiledImageContainer::SetCacheCapacity(SizeValueType capacity)
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  if (m_CacheCapacity != capacity)
+  {
+    m_CacheCapacity = capacity;
+    this->EvictBricks(false);
+    this->Modified();
+  }
+}
+
+SizeValueType
+TiledImageContainer::GetCacheCapacity() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CacheCapacity;
+}
+
+SizeValueType
+TiledImageContainer::GetNumberOfBricks() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Bricks.size();
+}
+
+SizeValueType
+TiledImageContainer::GetNumberOfUniformBricks() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  SizeValueType                     numberOfUniformBricks = 0;
+  for (const Brick & brick : m_Bricks)
+  {
+    if (brick.m_Encoding == BrickEncodingEnum::Uniform && !brick.m_IsModified)
+    {
+      ++numberOfUniformBricks;
+    }
+  }
+  return numberOfUniformBricks;
+}
+
+SizeValueType
+TiledImageContainer::GetNumberOfCachedBricks() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CachedBricks.size();
+}
+
+SizeValueType
+TiledImageContainer::GetCompressedSizeInBytes() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  SizeValueType                     numberOfBytes = 0;
+  for (const Brick & brick : m_Bricks)
+  {
+    numberOfBytes += brick.m_Data.size();
+  }
+  return numberOfBytes;
+}
+
+SizeValueType
+TiledImageContainer::GetCacheSizeInBytes() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CachedBricks.size() * m_NumberOfElementsPerBrick * m_ElementSize;
+}
+
+TiledImageContainer::BrickEncodingEnum
+TiledImageContainer::GetBrickEncoding(SizeValueType brickIndex) const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Bricks[brickIndex].m_Encoding;
+}
+
+void
+TiledImageContainer::Encode(Brick & brick) const
+{
+  const char * const  elements = brick.m_Buffer->data();
+  const SizeValueType numberOfBytes = brick.m_Buffer->size();
+
+  // Count the runs, to select the encoding before writing it.
+  SizeValueType numberOfRuns = 1;
+  for (SizeValueType i = m_ElementSize; i < numberOfBytes; i += m_ElementSize)
+  {
+    if (std::memcmp(elements + i, elements + i - m_ElementSize, m_ElementSize) != 0)
+    {
+      ++numberOfRuns;
+    }
+  }
+
+  const SizeValueType runLengthSize = numberOfRuns * (sizeof(RunLengthType) + m_ElementSize);
+  if (numberOfRuns == 1)
+  {
+    brick.m_Encoding = BrickEncodingEnum::Uniform;
+    brick.m_Data.assign(elements, elements + m_ElementSize);
+  }
+  else if (runLengthSize < numberOfBytes)
+  {
+    brick.m_Encoding = BrickEncodingEnum::RunLength;
+    brick.m_Data.resize(runLengthSize);
+    char *        data = brick.m_Data.data();
+    SizeValueType runStart = 0;
+    for (SizeValueType i = m_ElementSize; i <= numberOfBytes; i += m_ElementSize)
+    {
+      if (i == numberOfBytes || std::memcmp(elements + i, elements + runStart, m_ElementSize) != 0)
+      {
+        const auto runLength = static_cast<RunLengthType>((i - runStart) / m_ElementSize);
+        std::memcpy(data, &runLength, sizeof(RunLengthType));
+        std::memcpy(data + sizeof(RunLengthType), elements + runStart, m_ElementSize);
+        data += sizeof(RunLengthType) + m_ElementSize;
+        runStart = i;
+      }
+    }
+  }
+  else
+  {
+    brick.m_Encoding = BrickEncodingEnum::Raw;
+    brick.m_Data.assign(elements, elements + numberOfBytes);
+  }
+  brick.m_Data.shrink_to_fit();
+}
+
+void
+TiledImageContainer::Decode(const Brick & brick, char * elements) const
+{
+  switch (brick.m_Encoding)
+  {
+    case BrickEncodingEnum::Uniform:
+      for (SizeValueType i = 0; i < m_NumberOfElementsPerBrick; ++i)
+      {
+        std::memcpy(elements + i * m_ElementSize, brick.m_Data.data(), m_ElementSize);
+      }
+      break;
+    case BrickEncodingEnum::RunLength:
+    {
+      const char * data = brick.m_Data.data();
+      const char * end = data + brick.m_Data.size();
+      for (; data < end; data += sizeof(RunLengthType) + m_ElementSize)
+      {
+        RunLengthType runLength;
+        std::memcpy(&runLength, data, sizeof(RunLengthType));
+        for (RunLengthType i = 0; i < runLength; ++i, elements += m_ElementSize)
+        {
+          std::memcpy(elements, data + sizeof(RunLengthType), m_ElementSize);
+        }
+      }
+      break;
+    }
+    case BrickEncodingEnum::Raw:
+    default:
+      std::memcpy(elements, brick.m_Data.data(), brick.m_Data.size());
+      break;
+  }
+}
+
+void
+TiledImageContainer::EvictBricks(bool evictAll)
+{
+  auto it = m_CachedBricks.end();
+  while (it != m_CachedBricks.begin() && (evictAll || m_CachedBricks.size() > m_CacheCapacity))
+  {
+    --it;
+    Brick & brick = m_Bricks[*it];
+    // A brick is held by the cache, and by each of its accessors.
+    if (brick.m_Buffer.use_count() > 1)
+    {
+      continue;
+    }
+    if (brick.m_IsModified)
+    {
+      this->Encode(brick);
+      brick.m_IsModified = false;
+    }
+    brick.m_Buffer.reset();
+    it = m_CachedBricks.erase(it);
+  }
+}
+
+void
+TiledImageContainer::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfBricks: " << this->GetNumberOfBricks() << std::endl;
+  os << indent << "NumberOfElementsPerBrick: " << m_NumberOfElementsPerBrick << std::endl;
+  os << indent << "ElementSize: " << m_ElementSize << std::endl;
+  os << indent << "CacheCapacity: " << this->GetCacheCapacity() << std::endl;
+  os << indent << "NumberOfUniformBricks: " << this->GetNumberOfUniformBricks() << std::endl;
+  os << indent << "NumberOfCachedBricks: " << this->GetNumberOfCachedBricks() << std::endl;
+  os << indent << "CompressedSizeInBytes: " << this->GetCompressedSizeInBytes() << std::endl;
+}
+
+std::ostream &
+operator<<(std::ostream & out, const TiledImageContainerEnums::BrickEncoding value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case TiledImageContainerEnums::BrickEncoding::Uniform:
+        return "itk::TiledImageContainerEnums::BrickEncoding::Uniform";
+      case TiledImageContainerEnums::BrickEncoding::RunLength:
+        return "itk::TiledImageContainerEnums::BrickEncoding::RunLength";
+      case TiledImageContainerEnums::BrickEncoding::Raw:
+        return "itk::TiledImageContainerEnums::BrickEncoding::Raw";
+      default:
+        return "INVALID VALUE FOR itk::TiledImageContainerEnums::BrickEncoding";
+    }
+  }();
+}
+
+} // end namespace itk
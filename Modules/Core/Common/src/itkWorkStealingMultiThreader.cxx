@@ -0,0 +1,342 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkWorkStealingMultiThreader.h"
+#include "itkNumericTraits.h"
+#include "itkProcessObject.h"
+#include "itkExecutionTracer.h"
+#include "itkImageSourceCommon.h"
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace itk
+{
+namespace
+{
+std::chrono::milliseconds progressPollingInterval = std::chrono::milliseconds(10);
+
+class ExceptionHandler
+{
+public:
+  // This class follows the rule of zero
+
+  template <typename TFunction>
+  void
+  TryAndCatch(const TFunction & function)
+  {
+    try
+    {
+      function();
+    }
+    catch (...)
+    {
+      if (m_FirstCaughtException == nullptr)
+      {
+        m_FirstCaughtException = std::current_exception();
+      }
+    }
+  }
+
+  void
+  RethrowFirstCaughtException() const
+  {
+    if (m_FirstCaughtException != nullptr)
+    {
+      std::rethrow_exception(m_FirstCaughtException);
+    }
+  }
+
+private:
+  std::exception_ptr m_FirstCaughtException;
+};
+
+/** Wait for the future, helping the pool with pending work in the meantime.
+ * Progress is polled periodically, so that an abort request is noticed. */
+void
+WaitAndHelp(WorkStealingThreadPool * pool, std::future<void> & future, ProcessObject * filter)
+{
+  auto nextPoll = std::chrono::steady_clock::now() + progressPollingInterval;
+  while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+  {
+    if (!pool->ExecutePendingTask())
+    {
+      future.wait_for(std::chrono::microseconds(100));
+    }
+    if (filter && std::chrono::steady_clock::now() >= nextPoll)
+    {
+      filter->IncrementProgress(0);
+      nextPoll += progressPollingInterval;
+    }
+  }
+  future.get(); // rethrows the exception of the task, if any
+}
+} // namespace
+
+
+WorkStealingMultiThreader::WorkStealingMultiThreader()
+  : m_ThreadPool(WorkStealingThreadPool::GetInstance())
+{
+  ThreadIdType defaultThreads = std::max(1u, GetGlobalDefaultNumberOfThreads());
+#if !defined(ITKV4_COMPATIBILITY)
+  if (defaultThreads > 1) // one work unit for only one thread
+  {
+    defaultThreads *= 4;
+  }
+#endif
+  m_NumberOfWorkUnits = std::min<ThreadIdType>(ITK_MAX_THREADS, defaultThreads);
+  m_MaximumNumberOfThreads = m_ThreadPool->GetMaximumNumberOfThreads();
+}
+
+WorkStealingMultiThreader::~WorkStealingMultiThreader() = default;
+
+void
+WorkStealingMultiThreader::SetSingleMethod(ThreadFunctionType f, void * data)
+{
+  m_SingleMethod = f;
+  m_SingleData = data;
+}
+
+void
+WorkStealingMultiThreader::SetMaximumNumberOfThreads(ThreadIdType numberOfThreads)
+{
+  Superclass::SetMaximumNumberOfThreads(numberOfThreads);
+  ThreadIdType threadCount = m_ThreadPool->GetMaximumNumberOfThreads();
+  if (threadCount < m_MaximumNumberOfThreads)
+  {
+    m_ThreadPool->AddThreads(m_MaximumNumberOfThreads - threadCount);
+  }
+  m_MaximumNumberOfThreads = m_ThreadPool->GetMaximumNumberOfThreads();
+}
+
+void
+WorkStealingMultiThreader::SingleMethodExecute()
+{
+  if (!m_SingleMethod)
+  {
+    itkExceptionMacro(<< "No single method set!");
+  }
+
+  // obey the global maximum number of threads limit
+  m_NumberOfWorkUnits = std::min(this->GetGlobalMaximumNumberOfThreads(), m_NumberOfWorkUnits);
+
+  // Local storage keeps this method reentrant, e.g. for nested calls.
+  std::vector<WorkUnitInfo>      workUnitInfo(m_NumberOfWorkUnits);
+  std::vector<std::future<void>> futures(m_NumberOfWorkUnits);
+  const ThreadFunctionType       singleMethod = m_SingleMethod;
+  for (ThreadIdType i = 0; i < m_NumberOfWorkUnits; ++i)
+  {
+    workUnitInfo[i].WorkUnitID = i;
+    workUnitInfo[i].NumberOfWorkUnits = m_NumberOfWorkUnits;
+    workUnitInfo[i].UserData = m_SingleData;
+  }
+  for (ThreadIdType i = 1; i < m_NumberOfWorkUnits; ++i)
+  {
+    WorkUnitInfo * info = &workUnitInfo[i];
+    futures[i] = m_ThreadPool->AddWork([singleMethod, info]() { singleMethod(info); });
+  }
+
+  // Now, the parent thread calls this->SingleMethod() itself
+  ExceptionHandler exceptionHandler;
+  exceptionHandler.TryAndCatch([singleMethod, &workUnitInfo] { singleMethod(&workUnitInfo[0]); });
+
+  // The parent thread has finished SingleMethod()
+  // so now it helps with, and waits for, the other work units
+  for (ThreadIdType i = 1; i < m_NumberOfWorkUnits; ++i)
+  {
+    exceptionHandler.TryAndCatch([this, i, &futures] { WaitAndHelp(m_ThreadPool, futures[i], nullptr); });
+  }
+
+  exceptionHandler.RethrowFirstCaughtException();
+}
+
+void
+WorkStealingMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
+                                            SizeValueType             lastIndexPlus1,
+                                            ArrayThreadingFunctorType aFunc,
+                                            ProcessObject *           filter)
+{
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start(
+      "ParallelRegion", filter ? filter->GetNameOfClass() : this->GetNameOfClass(), lastIndexPlus1 - firstIndex);
+  }
+
+  if (!this->GetUpdateProgress())
+  {
+    filter = nullptr;
+  }
+
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    lastIndexPlus1 > firstIndex ? lastIndexPlus1 - firstIndex : 0, DefaultArrayGrainSize);
+  if (numberOfWorkUnits > 1)
+  {
+    SizeValueType chunkSize = (lastIndexPlus1 - firstIndex) / numberOfWorkUnits;
+    if ((lastIndexPlus1 - firstIndex) % numberOfWorkUnits > 0)
+    {
+      chunkSize++; // we want slightly bigger chunks to be processed first
+    }
+
+    auto lambda = [aFunc](SizeValueType start, SizeValueType end) {
+      const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", end - start);
+      for (SizeValueType ii = start; ii < end; ++ii)
+      {
+        aFunc(ii);
+      }
+    };
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(numberOfWorkUnits);
+    for (SizeValueType i = firstIndex + chunkSize; i < lastIndexPlus1; i += chunkSize)
+    {
+      futures.push_back(m_ThreadPool->AddWork(lambda, i, std::min(i + chunkSize, lastIndexPlus1)));
+    }
+    itkAssertOrThrowMacro(futures.size() < numberOfWorkUnits, "Number of work units was somehow miscounted!");
+
+    ProgressReporter reporter(filter, 0, futures.size() + 1);
+
+    // execute this thread's share
+    ExceptionHandler exceptionHandler;
+    exceptionHandler.TryAndCatch([lambda, firstIndex, chunkSize, &reporter] {
+      lambda(firstIndex, firstIndex + chunkSize);
+      reporter.CompletedPixel();
+    });
+
+    // now help with, and wait for, the other computations
+    for (auto & future : futures)
+    {
+      exceptionHandler.TryAndCatch([this, &future, &reporter, filter] {
+        WaitAndHelp(m_ThreadPool, future, filter);
+        reporter.CompletedPixel();
+      });
+    }
+
+    exceptionHandler.RethrowFirstCaughtException();
+  }
+  else
+  {
+    // Not worth waking up other threads.
+    const ExecutionTracer::Span workUnitSpan("WorkUnit", "WorkUnit", lastIndexPlus1 - firstIndex);
+    for (SizeValueType i = firstIndex; i < lastIndexPlus1; ++i)
+    {
+      aFunc(i);
+    }
+  }
+}
+
+void
+WorkStealingMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
+                                                  const IndexValueType index[],
+                                                  const SizeValueType  size[],
+                                                  ThreadingFunctorType funcP,
+                                                  ProcessObject *      filter)
+{
+  ExecutionTracer::Span span;
+  if (ExecutionTracer::GetEnabled())
+  {
+    span.Start("ParallelRegion",
+               filter ? filter->GetNameOfClass() : this->GetNameOfClass(),
+               std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()));
+    funcP = Self::TraceWorkUnits(dimension, std::move(funcP));
+  }
+
+  if (!this->GetUpdateProgress())
+  {
+    filter = nullptr;
+  }
+
+  const ThreadIdType numberOfWorkUnits = this->ComputeNumberOfWorkUnits(
+    std::accumulate(size, size + dimension, SizeValueType{ 1 }, std::multiplies<>()), DefaultImageRegionGrainSize);
+  if (numberOfWorkUnits == 1) // no multi-threading wanted, or not worth it
+  {
+    ProgressReporter reporter(filter, 0, 1);
+    funcP(index, size); // process whole region
+    reporter.CompletedPixel();
+  }
+  else
+  {
+    ImageIORegion region(dimension);
+    for (unsigned d = 0; d < dimension; ++d)
+    {
+      region.SetIndex(d, index[d]);
+      region.SetSize(d, size[d]);
+    }
+    if (region.GetNumberOfPixels() <= 1)
+    {
+      funcP(index, size); // process whole region
+    }
+    else
+    {
+      const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+      ThreadIdType                    splitCount = splitter->GetNumberOfSplits(region, numberOfWorkUnits);
+      ProgressReporter                reporter(filter, 0, splitCount);
+      itkAssertOrThrowMacro(splitCount <= numberOfWorkUnits, "Split count is greater than number of work units!");
+      std::vector<std::future<void>> futures;
+      futures.reserve(splitCount);
+      ImageIORegion iRegion;
+      ThreadIdType  total;
+      for (ThreadIdType i = 1; i < splitCount; ++i)
+      {
+        iRegion = region;
+        total = splitter->GetSplit(i, splitCount, iRegion);
+        if (i < total)
+        {
+          futures.push_back(
+            m_ThreadPool->AddWork([funcP, iRegion]() { funcP(&iRegion.GetIndex()[0], &iRegion.GetSize()[0]); }));
+        }
+        else
+        {
+          itkExceptionMacro("Could not get work unit "
+                            << i << " even though we checked possible number of splits beforehand!");
+        }
+      }
+      iRegion = region;
+      total = splitter->GetSplit(0, splitCount, iRegion);
+
+      // execute this thread's share
+      ExceptionHandler exceptionHandler;
+      exceptionHandler.TryAndCatch([funcP, iRegion, &reporter] {
+        funcP(&iRegion.GetIndex()[0], &iRegion.GetSize()[0]);
+        reporter.CompletedPixel();
+      });
+
+      // now help with, and wait for, the other computations
+      for (auto & future : futures)
+      {
+        exceptionHandler.TryAndCatch([this, &future, &reporter, filter] {
+          WaitAndHelp(m_ThreadPool, future, filter);
+          reporter.CompletedPixel();
+        });
+      }
+
+      exceptionHandler.RethrowFirstCaughtException();
+    }
+  }
+}
+
+void
+WorkStealingMultiThreader::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Number of Idle Pool Threads: " << m_ThreadPool->GetNumberOfCurrentlyIdleThreads() << std::endl;
+}
+
+} // namespace itk
@@ -0,0 +1,441 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+
+#include "itkWorkStealingThreadPool.h"
+#include "itkThreadPool.h"
+#include "itkThreadSupport.h"
+#include "itkMultiThreaderBase.h"
+#include "itkSingleton.h"
+
+#include <algorithm>
+
+
+namespace itk
+{
+namespace
+{
+// The pool which the calling thread is a worker of, if any, and its index
+// within that pool.
+thread_local const WorkStealingThreadPool * currentThreadPool = nullptr;
+thread_local ThreadIdType                   currentWorkerIndex = 0;
+} // namespace
+
+
+class WorkStealingDeque::RingBuffer
+{
+public:
+  explicit RingBuffer(int64_t capacity)
+    : m_Capacity(capacity)
+    , m_Mask(capacity - 1)
+    , m_Slots(new std::atomic<TaskType *>[static_cast<size_t>(capacity)])
+  {}
+
+  int64_t
+  GetCapacity() const
+  {
+    return m_Capacity;
+  }
+
+  TaskType *
+  Get(int64_t i) const
+  {
+    return m_Slots[i & m_Mask].load(std::memory_order_relaxed);
+  }
+
+  void
+  Put(int64_t i, TaskType * task)
+  {
+    m_Slots[i & m_Mask].store(task, std::memory_order_relaxed);
+  }
+
+  /** Returns a buffer of twice the capacity, holding elements [top, bottom). */
+  RingBuffer *
+  Grow(int64_t bottom, int64_t top) const
+  {
+    auto * buffer = new RingBuffer(2 * m_Capacity);
+    for (int64_t i = top; i < bottom; ++i)
+    {
+      buffer->Put(i, this->Get(i));
+    }
+    return buffer;
+  }
+
+private:
+  const int64_t                              m_Capacity;
+  const int64_t                              m_Mask;
+  std::unique_ptr<std::atomic<TaskType *>[]> m_Slots;
+};
+
+
+WorkStealingDeque::WorkStealingDeque(int64_t initialCapacity)
+{
+  // The capacity must be a power of two, for the index mask to work.
+  int64_t capacity = 1;
+  while (capacity < initialCapacity)
+  {
+    capacity *= 2;
+  }
+  m_Buffer.store(new RingBuffer(capacity), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque()
+{
+  delete m_Buffer.load(std::memory_order_relaxed);
+}
+
+void
+WorkStealingDeque::Push(TaskType * task)
+{
+  const int64_t b = m_Bottom.load(std::memory_order_relaxed);
+  const int64_t t = m_Top.load(std::memory_order_acquire);
+  RingBuffer *  buffer = m_Buffer.load(std::memory_order_relaxed);
+  if (b - t > buffer->GetCapacity() - 1)
+  {
+    RingBuffer * grown = buffer->Grow(b, t);
+    m_RetiredBuffers.emplace_back(buffer);
+    m_Buffer.store(grown, std::memory_order_release);
+    buffer = grown;
+  }
+  buffer->Put(b, task);
+  std::atomic_thread_fence(std::memory_order_release);
+  m_Bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::TaskType *
+WorkStealingDeque::Pop()
+{
+  const int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+  RingBuffer *  buffer = m_Buffer.load(std::memory_order_relaxed);
+  m_Bottom.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t t = m_Top.load(std::memory_order_relaxed);
+
+  TaskType * task = nullptr;
+  if (t <= b)
+  {
+    task = buffer->Get(b);
+    if (t == b)
+    {
+      // Last element: race against thieves for it.
+      if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+        task = nullptr;
+      }
+      m_Bottom.store(b + 1, std::memory_order_relaxed);
+    }
+  }
+  else
+  {
+    m_Bottom.store(b + 1, std::memory_order_relaxed);
+  }
+  return task;
+}
+
+WorkStealingDeque::TaskType *
+WorkStealingDeque::Steal()
+{
+  int64_t t = m_Top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t b = m_Bottom.load(std::memory_order_acquire);
+
+  TaskType * task = nullptr;
+  if (t < b)
+  {
+    RingBuffer * buffer = m_Buffer.load(std::memory_order_acquire);
+    task = buffer->Get(t);
+    if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+  }
+  return task;
+}
+
+int64_t
+WorkStealingDeque::GetApproximateSize() const
+{
+  const int64_t b = m_Bottom.load(std::memory_order_relaxed);
+  const int64_t t = m_Top.load(std::memory_order_relaxed);
+  return std::max<int64_t>(b - t, 0);
+}
+
+
+struct WorkStealingThreadPoolGlobals
+{
+  WorkStealingThreadPoolGlobals() = default;
+  // To lock on the internal variables.
+  std::mutex                      m_Mutex;
+  WorkStealingThreadPool::Pointer m_ThreadPoolInstance;
+};
+
+itkGetGlobalSimpleMacro(WorkStealingThreadPool, WorkStealingThreadPoolGlobals, PimplGlobals);
+
+WorkStealingThreadPool::Pointer
+WorkStealingThreadPool::New()
+{
+  return Self::GetInstance();
+}
+
+
+WorkStealingThreadPool::Pointer
+WorkStealingThreadPool::GetInstance()
+{
+  // This is called once, on-demand to ensure that m_PimplGlobals is
+  // initialized.
+  itkInitGlobalsMacro(PimplGlobals);
+
+  if (m_PimplGlobals->m_ThreadPoolInstance.IsNull())
+  {
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    // After we have the lock, double check the initialization
+    // flag to ensure it hasn't been changed by another thread.
+    if (m_PimplGlobals->m_ThreadPoolInstance.IsNull())
+    {
+      m_PimplGlobals->m_ThreadPoolInstance = ObjectFactory<Self>::Create();
+      if (m_PimplGlobals->m_ThreadPoolInstance.IsNull())
+      {
+        new WorkStealingThreadPool(); // constructor sets m_PimplGlobals->m_ThreadPoolInstance
+      }
+#if defined(ITK_USE_PTHREADS)
+      pthread_atfork(WorkStealingThreadPool::PrepareForFork,
+                     WorkStealingThreadPool::ResumeFromFork,
+                     WorkStealingThreadPool::ResumeFromFork);
+#endif
+    }
+  }
+  return m_PimplGlobals->m_ThreadPoolInstance;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool()
+{
+  m_PimplGlobals->m_ThreadPoolInstance = this;        // threads need this
+  m_PimplGlobals->m_ThreadPoolInstance->UnRegister(); // Remove extra reference
+  m_Deques.reserve(ITK_MAX_THREADS);
+  m_Threads.reserve(ITK_MAX_THREADS);
+  ThreadIdType threadCount = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  for (unsigned int i = 0; i < threadCount; ++i)
+  {
+    this->StartWorker();
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+  this->CleanUp();
+
+  // Workers drain the queues before exiting, unless they were not waited for.
+  for (TaskType * task : m_InjectionQueue)
+  {
+    delete task;
+  }
+  for (auto & deque : m_Deques)
+  {
+    while (TaskType * task = deque->Steal())
+    {
+      delete task;
+    }
+  }
+}
+
+void
+WorkStealingThreadPool::StartWorker()
+{
+  const ThreadIdType workerIndex = static_cast<ThreadIdType>(m_Deques.size());
+  m_Deques.emplace_back(new WorkStealingDeque());
+  m_NumberOfWorkers.store(workerIndex + 1, std::memory_order_release);
+  m_Threads.emplace_back(&WorkStealingThreadPool::ThreadExecute, workerIndex);
+}
+
+void
+WorkStealingThreadPool::AddThreads(ThreadIdType count)
+{
+  std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+  // m_Deques must never reallocate, as thieves access it without locking.
+  count = std::min<ThreadIdType>(count, ITK_MAX_THREADS - static_cast<ThreadIdType>(m_Deques.size()));
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    this->StartWorker();
+  }
+}
+
+int
+WorkStealingThreadPool::GetNumberOfCurrentlyIdleThreads() const
+{
+  return m_NumberOfSleepingWorkers.load();
+}
+
+bool
+WorkStealingThreadPool::IsWorkerThread() const
+{
+  return currentThreadPool == this;
+}
+
+void
+WorkStealingThreadPool::Submit(TaskType * task)
+{
+  if (currentThreadPool == this)
+  {
+    m_Deques[currentWorkerIndex]->Push(task);
+  }
+  else
+  {
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    m_InjectionQueue.push_back(task);
+  }
+
+  // A worker about to sleep increments m_NumberOfSleepingWorkers before it
+  // checks m_NumberOfQueuedTasks, so one of the two always sees the other.
+  m_NumberOfQueuedTasks.fetch_add(1);
+  if (m_NumberOfSleepingWorkers.load() > 0)
+  {
+    {
+      std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    }
+    m_Condition.notify_one();
+  }
+}
+
+WorkStealingThreadPool::TaskType *
+WorkStealingThreadPool::FindTask(ThreadIdType workerIndex)
+{
+  const ThreadIdType numberOfWorkers = m_NumberOfWorkers.load(std::memory_order_acquire);
+  TaskType *         task = nullptr;
+
+  if (workerIndex < numberOfWorkers)
+  {
+    task = m_Deques[workerIndex]->Pop();
+  }
+
+  if (task == nullptr && m_NumberOfQueuedTasks.load(std::memory_order_relaxed) > 0)
+  {
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    if (!m_InjectionQueue.empty())
+    {
+      task = m_InjectionQueue.front();
+      m_InjectionQueue.pop_front();
+    }
+  }
+
+  // Visit the other workers round-robin, starting with the next one,
+  // so that thieves do not all converge on the same victim.
+  for (ThreadIdType i = 1; task == nullptr && i <= numberOfWorkers; ++i)
+  {
+    const ThreadIdType victim = (workerIndex + i) % numberOfWorkers;
+    if (victim != workerIndex)
+    {
+      task = m_Deques[victim]->Steal();
+    }
+  }
+
+  if (task != nullptr)
+  {
+    m_NumberOfQueuedTasks.fetch_sub(1);
+  }
+  return task;
+}
+
+bool
+WorkStealingThreadPool::ExecutePendingTask()
+{
+  const ThreadIdType workerIndex = (currentThreadPool == this) ? currentWorkerIndex : ITK_MAX_THREADS;
+
+  std::unique_ptr<TaskType> task(this->FindTask(workerIndex));
+  if (task == nullptr)
+  {
+    return false;
+  }
+  (*task)(); // execute the task
+  return true;
+}
+
+void
+WorkStealingThreadPool::CleanUp()
+{
+  {
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+
+    this->m_Stopping = true;
+  }
+
+  if (!ThreadPool::GetDoNotWaitForThreads() && !m_Threads.empty())
+  {
+    m_Condition.notify_all();
+  }
+
+  // Even if the threads have already been terminated,
+  // we should join() the std::thread variables.
+  // Otherwise some sanity check in debug mode complains.
+  for (auto & thread : m_Threads)
+  {
+    if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+}
+
+void
+WorkStealingThreadPool::PrepareForFork()
+{
+  m_PimplGlobals->m_ThreadPoolInstance->CleanUp();
+}
+
+void
+WorkStealingThreadPool::ResumeFromFork()
+{
+  WorkStealingThreadPool * instance = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
+  instance->m_Threads.clear();
+  instance->m_Stopping = false;
+  // Restart one thread per existing deque.
+  for (ThreadIdType i = 0; i < instance->m_Deques.size(); ++i)
+  {
+    instance->m_Threads.emplace_back(&WorkStealingThreadPool::ThreadExecute, i);
+  }
+}
+
+void
+WorkStealingThreadPool::ThreadExecute(ThreadIdType workerIndex)
+{
+  // plain pointer does not increase reference count
+  WorkStealingThreadPool * threadPool = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
+  currentThreadPool = threadPool;
+  currentWorkerIndex = workerIndex;
+
+  while (true)
+  {
+    if (threadPool->ExecutePendingTask())
+    {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    ++threadPool->m_NumberOfSleepingWorkers;
+    threadPool->m_Condition.wait(
+      mutexHolder, [threadPool] { return threadPool->m_Stopping || threadPool->m_NumberOfQueuedTasks.load() > 0; });
+    --threadPool->m_NumberOfSleepingWorkers;
+    if (threadPool->m_Stopping && threadPool->m_NumberOfQueuedTasks.load() == 0)
+    {
+      return;
+    }
+  }
+}
+
+WorkStealingThreadPoolGlobals * WorkStealingThreadPool::m_PimplGlobals;
+
+} // namespace itk
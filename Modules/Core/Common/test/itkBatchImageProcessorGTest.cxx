@@ -0,0 +1,222 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkBatchImageProcessor.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageToImageFilter.h"
+#include <atomic>
+#include <stdexcept>
+
+
+namespace
+{
+using ImageType = itk::Image<short, 2>;
+
+// Adds an offset to the pixels, and throws for the images whose first pixel
+// is negative. Checks that no other thread runs it at the same time.
+class AddOffsetImageFilter : public itk::ImageToImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOffsetImageFilter);
+
+  using Self = AddOffsetImageFilter;
+  using Superclass = itk::ImageToImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(AddOffsetImageFilter, ImageToImageFilter);
+
+  itkSetMacro(Offset, short);
+
+  bool
+  RanConcurrently() const
+  {
+    return m_RanConcurrently;
+  }
+
+protected:
+  AddOffsetImageFilter() = default;
+
+  void
+  GenerateData() override
+  {
+    if (++m_NumberOfRuns > 1)
+    {
+      m_RanConcurrently = true;
+    }
+    const ImageType * input = this->GetInput();
+    if (input->GetBufferPointer()[0] < 0)
+    {
+      --m_NumberOfRuns;
+      itkExceptionMacro("Negative first pixel.");
+    }
+    this->AllocateOutputs();
+    itk::ImageRegionIterator<ImageType> it(this->GetOutput(), this->GetOutput()->GetRequestedRegion());
+    for (const short * pixel = input->GetBufferPointer(); !it.IsAtEnd(); ++it, ++pixel)
+    {
+      it.Set(static_cast<short>(*pixel + m_Offset));
+    }
+    --m_NumberOfRuns;
+  }
+
+private:
+  short             m_Offset{ 0 };
+  std::atomic<int>  m_NumberOfRuns{ 0 };
+  std::atomic<bool> m_RanConcurrently{ false };
+};
+
+using ProcessorType = itk::BatchImageProcessor<ImageType, ImageType>;
+
+std::vector<ImageType::ConstPointer>
+MakeImages(unsigned int numberOfImages)
+{
+  std::vector<ImageType::ConstPointer> images;
+  for (unsigned int i = 0; i < numberOfImages; ++i)
+  {
+    auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType{ { 5 + i % 3, 7 } });
+    image->Allocate();
+    image->FillBuffer(static_cast<short>(i));
+    images.push_back(image);
+  }
+  return images;
+}
+} // namespace
+
+
+TEST(BatchImageProcessor, ProcessesImagesInOrder)
+{
+  const auto                                 processor = ProcessorType::New();
+  std::vector<AddOffsetImageFilter::Pointer> lastFilters;
+  processor->SetPipelineFactory([&lastFilters] {
+    auto first = AddOffsetImageFilter::New();
+    first->SetOffset(10);
+    // The pipeline holds the filter in the middle.
+    auto middle = AddOffsetImageFilter::New();
+    middle->SetOffset(100);
+    middle->SetInput(first->GetOutput());
+    auto last = AddOffsetImageFilter::New();
+    last->SetOffset(1000);
+    last->SetInput(middle->GetOutput());
+    lastFilters.push_back(last);
+    return ProcessorType::MakePipeline(first.GetPointer(), last.GetPointer());
+  });
+  processor->SetNumberOfWorkers(4);
+  EXPECT_EQ(processor->GetNumberOfWorkers(), 4u);
+
+  const auto images = MakeImages(50);
+  for (unsigned int batch = 0; batch < 2; ++batch)
+  {
+    const std::vector<ImageType::Pointer> outputs = processor->Process(images);
+    ASSERT_EQ(outputs.size(), images.size());
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+      EXPECT_EQ(outputs[i]->GetBufferedRegion(), images[i]->GetBufferedRegion());
+      EXPECT_EQ(outputs[i]->GetPixel({ { 4, 6 } }), static_cast<short>(i + 1110));
+      EXPECT_EQ(outputs[i]->GetSource(), nullptr);
+    }
+  }
+
+  // The pipelines are made once per worker, and run single-threaded.
+  ASSERT_EQ(lastFilters.size(), 4u);
+  for (const auto & filter : lastFilters)
+  {
+    EXPECT_EQ(filter->GetNumberOfWorkUnits(), 1u);
+    EXPECT_FALSE(filter->RanConcurrently());
+  }
+
+  // Fewer images than workers.
+  EXPECT_EQ(processor->Process(MakeImages(2)).size(), 2u);
+  EXPECT_TRUE(processor->Process({}).empty());
+  EXPECT_EQ(lastFilters.size(), 4u);
+}
+
+
+TEST(BatchImageProcessor, ProcessesTheSameImageSeveralTimes)
+{
+  const auto processor = ProcessorType::New();
+  processor->SetPipelineFactory([] {
+    auto filter = AddOffsetImageFilter::New();
+    filter->SetOffset(10);
+    return ProcessorType::MakePipeline(filter.GetPointer(), filter.GetPointer());
+  });
+  processor->SetNumberOfWorkers(4);
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 6, 7 } });
+  image->Allocate();
+  image->FillBuffer(3);
+  const ImageType::RegionType requestedRegion({ { 1, 2 } }, ImageType::SizeType{ { 2, 2 } });
+  image->SetRequestedRegion(requestedRegion);
+
+  // The pipelines do not share the requested region of the image.
+  const std::vector<ImageType::ConstPointer> images(20, image.GetPointer());
+  const std::vector<ImageType::Pointer>      outputs = processor->Process(images);
+  for (const auto & output : outputs)
+  {
+    EXPECT_EQ(output->GetBufferedRegion(), image->GetBufferedRegion());
+    EXPECT_EQ(output->GetPixel({ { 5, 6 } }), 13);
+  }
+  EXPECT_EQ(image->GetRequestedRegion(), requestedRegion);
+  EXPECT_EQ(image->GetPixel({ { 5, 6 } }), 3);
+}
+
+TEST(BatchImageProcessor, RethrowsExceptionOfFirstFailingImage)
+{
+  const auto processor = ProcessorType::New();
+  EXPECT_THROW(processor->Process(MakeImages(1)), itk::ExceptionObject);
+
+  processor->SetPipelineFactory([] {
+    auto filter = AddOffsetImageFilter::New();
+    return ProcessorType::MakePipeline(filter.GetPointer(), filter.GetPointer());
+  });
+  auto images = MakeImages(20);
+  for (const unsigned int failing : { 7u, 13u })
+  {
+    auto image = ImageType::New();
+    image->SetRegions(images[failing]->GetBufferedRegion());
+    image->Allocate();
+    image->FillBuffer(static_cast<short>(-failing));
+    images[failing] = image;
+  }
+  try
+  {
+    processor->Process(images);
+    ADD_FAILURE() << "No exception thrown.";
+  }
+  catch (const itk::ExceptionObject & exception)
+  {
+    EXPECT_NE(std::string(exception.GetDescription()).find("Negative first pixel"), std::string::npos);
+  }
+
+  // A custom pipeline, whose exception is not an ExceptionObject.
+  processor->SetPipelineFactory([] {
+    return [](const ImageType * input) -> ImageType::Pointer {
+      if (input->GetBufferPointer()[0] == 3)
+      {
+        throw std::runtime_error("3");
+      }
+      return ImageType::New();
+    };
+  });
+  EXPECT_THROW(processor->Process(MakeImages(5)), std::runtime_error);
+  EXPECT_EQ(processor->Process(MakeImages(3)).size(), 3u);
+}
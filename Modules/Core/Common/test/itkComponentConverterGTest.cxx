@@ -0,0 +1,217 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkComponentConverter.h"
+#include "itkImage.h"
+#include "itkImageAlgorithm.h"
+#include "itkRGBPixel.h"
+#include "itkVectorImage.h"
+#include <tuple>
+#include <vector>
+
+
+namespace
+{
+using InstructionSetEnum = itk::ComponentConverterEnums::InstructionSet;
+
+std::vector<InstructionSetEnum>
+GetAvailableInstructionSets()
+{
+  std::vector<InstructionSetEnum> instructionSets;
+  for (const auto instructionSet :
+       { InstructionSetEnum::Baseline, InstructionSetEnum::AVX2, InstructionSetEnum::AVX512 })
+  {
+    if (itk::ComponentConverter::IsInstructionSetAvailable(instructionSet))
+    {
+      instructionSets.push_back(instructionSet);
+    }
+  }
+  return instructionSets;
+}
+
+// Restores the default maximum instruction set.
+class ComponentConverterTest : public ::testing::Test
+{
+protected:
+  void
+  TearDown() override
+  {
+    itk::ComponentConverter::SetMaximumInstructionSet(InstructionSetEnum::AVX512);
+  }
+};
+
+// Converts values which all types represent, from misaligned arrays whose
+// length is not a multiple of the vector length.
+template <typename TInput, typename TOutput>
+void
+ExpectConversionLikeStaticCast()
+{
+  constexpr size_t     numberOfValues = 1000;
+  std::vector<TInput>  input(numberOfValues + 1);
+  std::vector<TOutput> output(numberOfValues + 1);
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    input[i] = static_cast<TInput>(i % 128);
+  }
+  const TOutput * const end = itk::ComponentConverter::Convert(&input[1], &input[1] + numberOfValues, &output[1]);
+  EXPECT_EQ(end, &output[1] + numberOfValues);
+
+  size_t numberOfMismatches = 0;
+  for (size_t i = 1; i < input.size(); ++i)
+  {
+    numberOfMismatches += (output[i] != static_cast<TOutput>(input[i]));
+  }
+  EXPECT_EQ(numberOfMismatches, 0u) << typeid(TInput).name() << " to " << typeid(TOutput).name();
+}
+
+template <typename TInput, typename... TOutput>
+void
+ExpectConversionsFrom(std::tuple<TOutput...>)
+{
+  (void)std::initializer_list<int>{ (ExpectConversionLikeStaticCast<TInput, TOutput>(), 0)... };
+}
+
+template <typename... TInput>
+void
+ExpectConversionsBetween(std::tuple<TInput...> types)
+{
+  (void)std::initializer_list<int>{ (ExpectConversionsFrom<TInput>(types), 0)... };
+}
+} // namespace
+
+
+TEST_F(ComponentConverterTest, ConvertsLikeStaticCast)
+{
+  using ScalarTypes = std::tuple<char,
+                                 signed char,
+                                 unsigned char,
+                                 short,
+                                 unsigned short,
+                                 int,
+                                 unsigned int,
+                                 long,
+                                 unsigned long,
+                                 long long,
+                                 unsigned long long,
+                                 float,
+                                 double>;
+
+  for (const auto instructionSet : GetAvailableInstructionSets())
+  {
+    itk::ComponentConverter::SetMaximumInstructionSet(instructionSet);
+    EXPECT_EQ(itk::ComponentConverter::GetInstructionSet(), instructionSet);
+    ExpectConversionsBetween(ScalarTypes());
+  }
+}
+
+
+TEST_F(ComponentConverterTest, TruncatesFloatingPointValues)
+{
+  const std::vector<float> input{ -2.75f, -0.5f, 0.5f, 2.75f, 126.99f, 127.5f, 254.5f, 255.99f };
+  for (const auto instructionSet : GetAvailableInstructionSets())
+  {
+    itk::ComponentConverter::SetMaximumInstructionSet(instructionSet);
+
+    std::vector<float> values;
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      values.insert(values.end(), input.begin(), input.end());
+    }
+    std::vector<short> shorts(values.size());
+    itk::ComponentConverter::Convert(values.data(), values.data() + values.size(), shorts.data());
+    std::vector<unsigned char> bytes(values.size());
+    itk::ComponentConverter::Convert(values.data() + 2, values.data() + values.size(), bytes.data() + 2);
+    std::vector<double> doubles(values.size());
+    itk::ComponentConverter::Convert(values.data(), values.data() + values.size(), doubles.data());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      EXPECT_EQ(shorts[i], static_cast<short>(values[i])) << instructionSet;
+      EXPECT_EQ(doubles[i], static_cast<double>(values[i])) << instructionSet;
+      if (values[i] >= 0)
+      {
+        EXPECT_EQ(bytes[i], static_cast<unsigned char>(values[i])) << instructionSet;
+      }
+    }
+  }
+}
+
+
+TEST_F(ComponentConverterTest, ConvertsImagePixelsAndComponents)
+{
+  const itk::Size<2> size{ { 37, 11 } };
+
+  // Scalar pixels.
+  auto scalarInput = itk::Image<unsigned short, 2>::New();
+  scalarInput->SetRegions(size);
+  scalarInput->Allocate();
+  for (itk::SizeValueType i = 0; i < scalarInput->GetBufferedRegion().GetNumberOfPixels(); ++i)
+  {
+    scalarInput->GetBufferPointer()[i] = static_cast<unsigned short>(i * 97);
+  }
+  auto scalarOutput = itk::Image<float, 2>::New();
+  scalarOutput->SetRegions(size);
+  scalarOutput->Allocate();
+  itk::ImageAlgorithm::Copy(scalarInput.GetPointer(),
+                            scalarOutput.GetPointer(),
+                            scalarInput->GetBufferedRegion(),
+                            scalarInput->GetBufferedRegion());
+  EXPECT_EQ(scalarOutput->GetPixel({ { 36, 10 } }), static_cast<float>(scalarInput->GetPixel({ { 36, 10 } })));
+
+  // The components of fixed size pixels.
+  using RGBPixelType = itk::RGBPixel<unsigned char>;
+  auto rgbInput = itk::Image<RGBPixelType, 2>::New();
+  rgbInput->SetRegions(size);
+  rgbInput->Allocate();
+  RGBPixelType rgb;
+  rgb.Set(1, 128, 255);
+  rgbInput->FillBuffer(rgb);
+  auto rgbOutput = itk::Image<itk::RGBPixel<float>, 2>::New();
+  rgbOutput->SetRegions(size);
+  rgbOutput->Allocate();
+  const itk::ImageRegion<2> region({ { 3, 2 } }, { { 30, 8 } });
+  itk::ImageAlgorithm::Copy(rgbInput.GetPointer(), rgbOutput.GetPointer(), region, region);
+  EXPECT_EQ(rgbOutput->GetPixel({ { 32, 9 } }), itk::RGBPixel<float>(rgb));
+
+  // The components of variable length pixels.
+  auto vectorInput = itk::VectorImage<double, 2>::New();
+  vectorInput->SetRegions(size);
+  vectorInput->SetNumberOfComponentsPerPixel(4);
+  vectorInput->Allocate();
+  itk::VariableLengthVector<double> vector(4);
+  vector[0] = -1.5;
+  vector[1] = 0.25;
+  vector[2] = 1e10;
+  vector[3] = 3.0;
+  vectorInput->FillBuffer(vector);
+  auto vectorOutput = itk::VectorImage<float, 2>::New();
+  vectorOutput->SetRegions(size);
+  vectorOutput->SetNumberOfComponentsPerPixel(4);
+  vectorOutput->Allocate();
+  itk::ImageAlgorithm::Copy(vectorInput.GetPointer(),
+                            vectorOutput.GetPointer(),
+                            vectorInput->GetBufferedRegion(),
+                            vectorInput->GetBufferedRegion());
+  const auto outputVector = vectorOutput->GetPixel({ { 20, 5 } });
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(outputVector[i], static_cast<float>(vector[i]));
+  }
+}
+
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkExecutionTracer.h"
+#include "itkExtractImageFilter.h"
+#include "itkImage.h"
+#include "itkMultiThreaderBase.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// The output directory is passed unquoted by CMake.
+#define STRING_HELPER(s) #s
+#define STRING(s) STRING_HELPER(s)
+
+
+TEST(ExecutionTracer, RecordsNothingWhenNotStarted)
+{
+  ASSERT_FALSE(itk::ExecutionTracer::GetEnabled());
+
+  {
+    const itk::ExecutionTracer::Span span("Test", "Span");
+  }
+  EXPECT_EQ(itk::ExecutionTracer::GetNumberOfEvents(), 0u);
+}
+
+
+TEST(ExecutionTracer, WritesChromeTrace)
+{
+  using ImageType = itk::Image<short, 2>;
+
+  const std::string fileName = std::string(STRING(ITK_TEST_OUTPUT_DIR)) + "/itkExecutionTracerGTest.json";
+  itk::ExecutionTracer::Start(fileName);
+  EXPECT_TRUE(itk::ExecutionTracer::GetEnabled());
+
+  const auto image = ImageType::New();
+  image->SetRegions(itk::Size<2>{ { 64, 32 } });
+  image->Allocate(true);
+
+  const auto filter = itk::ExtractImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(image);
+  filter->SetExtractionRegion(ImageType::RegionType({ { 8, 8 } }, { { 16, 16 } }));
+  filter->SetDirectionCollapseToIdentity();
+  filter->Update();
+
+  const auto multiThreader = itk::MultiThreaderBase::New();
+  multiThreader->SetNumberOfWorkUnits(2);
+  multiThreader->ParallelizeImageRegion<2>(
+    image->GetBufferedRegion(), [](const ImageType::RegionType &) {}, nullptr);
+
+  // An array is recorded as a single work unit when processed serially.
+  const itk::SizeValueType numberOfEvents = itk::ExecutionTracer::GetNumberOfEvents();
+  multiThreader->SetNumberOfWorkUnits(1);
+  multiThreader->ParallelizeArray(
+    0, 100, [](itk::SizeValueType) {}, nullptr);
+  EXPECT_EQ(itk::ExecutionTracer::GetNumberOfEvents(), numberOfEvents + 2);
+
+  {
+    const itk::ExecutionTracer::Span span("Test", "Span \"quoted\"", 7);
+  }
+  EXPECT_GE(itk::ExecutionTracer::GetNumberOfEvents(), 5u);
+
+  std::ostringstream trace;
+  itk::ExecutionTracer::WriteTrace(trace);
+  const std::string traceString = trace.str();
+
+  EXPECT_EQ(traceString.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(traceString.find("\"name\":\"ExtractImageFilter\",\"cat\":\"UpdateOutputData\",\"ph\":\"X\""),
+            std::string::npos);
+  EXPECT_NE(traceString.find("\"name\":\"ExtractImageFilter\",\"cat\":\"GenerateData\""), std::string::npos);
+  EXPECT_NE(traceString.find("\"cat\":\"Allocation\",\"ph\":\"i\""), std::string::npos);
+  EXPECT_NE(traceString.find("\"args\":{\"bytes\":" + std::to_string(64 * 32 * sizeof(short)) + "}"),
+            std::string::npos);
+  EXPECT_NE(traceString.find("\"name\":\"Span \\\"quoted\\\"\",\"cat\":\"Test\""), std::string::npos);
+  EXPECT_NE(traceString.find("\"args\":{\"size\":7}"), std::string::npos);
+  EXPECT_NE(traceString.find("\"cat\":\"ParallelRegion\""), std::string::npos);
+  EXPECT_NE(traceString.find("\"args\":{\"size\":" + std::to_string(64 * 32) + "}"), std::string::npos);
+  EXPECT_NE(traceString.find("\"cat\":\"WorkUnit\""), std::string::npos);
+
+  itk::ExecutionTracer::Stop();
+  EXPECT_FALSE(itk::ExecutionTracer::GetEnabled());
+  EXPECT_EQ(itk::ExecutionTracer::GetNumberOfEvents(), 0u);
+
+  std::ifstream     file(fileName.c_str());
+  std::stringstream fileContent;
+  fileContent << file.rdbuf();
+  EXPECT_EQ(fileContent.str(), traceString);
+}
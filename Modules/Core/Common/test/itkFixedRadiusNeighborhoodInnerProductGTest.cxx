@@ -0,0 +1,144 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFixedRadiusNeighborhoodInnerProduct.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImage.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkNeighborhoodAlgorithm.h"
+#include "itkNeighborhoodInnerProduct.h"
+#include "itkVectorImage.h"
+#include <gtest/gtest.h>
+
+
+namespace
+{
+template <typename TImage>
+typename TImage::Pointer
+CreateImage(const typename TImage::SizeType & size)
+{
+  const auto image = TImage::New();
+  image->SetRegions(size);
+  image->Allocate();
+  auto * const             buffer = image->GetBufferPointer();
+  const itk::SizeValueType numberOfPixels = image->GetBufferedRegion().GetNumberOfPixels();
+  for (itk::SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    buffer[i] = static_cast<typename TImage::PixelType>((i * 7919) % 251) / 8;
+  }
+  return image;
+}
+
+template <unsigned int VDimension>
+itk::Neighborhood<float, VDimension>
+CreateOperator(const itk::Size<VDimension> & radius)
+{
+  itk::Neighborhood<float, VDimension> op;
+  op.SetRadius(radius);
+  for (unsigned int i = 0; i < op.Size(); ++i)
+  {
+    op[i] = static_cast<float>(i % 5) - 1.5f;
+  }
+  return op;
+}
+
+// Checks that the inner products of the non-boundary region are those of
+// NeighborhoodInnerProduct, and that the other output pixels are untouched.
+template <unsigned int VDimension>
+void
+ExpectSameInnerProducts(const itk::Size<VDimension> & radius)
+{
+  using ImageType = itk::Image<short, VDimension>;
+  using OutputImageType = itk::Image<float, VDimension>;
+  using InnerProductType = itk::FixedRadiusNeighborhoodInnerProduct<ImageType, float, double>;
+
+  typename ImageType::SizeType size;
+  size.Fill(9);
+  size[0] = 21;
+  const auto input = CreateImage<ImageType>(size);
+  const auto output = OutputImageType::New();
+  output->SetRegions(size);
+  output->Allocate();
+  output->FillBuffer(-1000.0f);
+
+  const auto op = CreateOperator(radius);
+  ASSERT_TRUE(InnerProductType::IsSupported(op)) << radius;
+
+  // A region which does not start at the origin, and is smaller than the
+  // buffered region.
+  typename ImageType::RegionType region = input->GetBufferedRegion();
+  region.ShrinkByRadius(1);
+  const auto nonBoundaryRegion =
+    itk::NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<ImageType>::Compute(*input, region, radius)
+      .GetNonBoundaryRegion();
+  ASSERT_GT(nonBoundaryRegion.GetNumberOfPixels(), 0u);
+
+  InnerProductType::Evaluate(*input, op, *output, nonBoundaryRegion);
+
+  itk::ConstNeighborhoodIterator<ImageType>               nit(radius, input, input->GetBufferedRegion());
+  itk::NeighborhoodInnerProduct<ImageType, float, double> innerProduct;
+  itk::ImageRegionConstIterator<OutputImageType>          oit(output, output->GetBufferedRegion());
+  unsigned int                                            numberOfMismatches = 0;
+  for (; !oit.IsAtEnd(); ++oit)
+  {
+    const auto index = oit.GetIndex();
+    nit.SetLocation(index);
+    const float expected = nonBoundaryRegion.IsInside(index) ? static_cast<float>(innerProduct(nit, op)) : -1000.0f;
+    numberOfMismatches += (oit.Get() != expected);
+  }
+  EXPECT_EQ(numberOfMismatches, 0u) << radius;
+}
+} // namespace
+
+
+TEST(FixedRadiusNeighborhoodInnerProduct, MatchesNeighborhoodInnerProduct)
+{
+  ExpectSameInnerProducts(itk::Size<2>{ { 1, 1 } });
+  ExpectSameInnerProducts(itk::Size<2>{ { 2, 2 } });
+  ExpectSameInnerProducts(itk::Size<3>{ { 1, 1, 1 } });
+  ExpectSameInnerProducts(itk::Size<3>{ { 2, 2, 2 } });
+
+  // One-dimensional operators, as those of DerivativeImageFilter.
+  ExpectSameInnerProducts(itk::Size<2>{ { 0, 2 } });
+  ExpectSameInnerProducts(itk::Size<3>{ { 1, 0, 0 } });
+  ExpectSameInnerProducts(itk::Size<3>{ { 0, 0, 2 } });
+  ExpectSameInnerProducts(itk::Size<1>{ { 1 } });
+}
+
+
+TEST(FixedRadiusNeighborhoodInnerProduct, SupportsSmallOperatorsAndScalarImages)
+{
+  using InnerProductType = itk::FixedRadiusNeighborhoodInnerProduct<itk::Image<float, 3>, float, float>;
+
+  EXPECT_TRUE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 2, 2, 2 } })));
+  EXPECT_TRUE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 0, 2, 0 } })));
+  EXPECT_FALSE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 3, 3, 3 } })));
+  EXPECT_FALSE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 1, 2, 1 } })));
+  EXPECT_FALSE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 1, 1, 0 } })));
+  EXPECT_FALSE(InnerProductType::IsSupported(CreateOperator(itk::Size<3>{ { 0, 0, 0 } })));
+
+  // Full stencils are only unrolled in 2D and 3D.
+  EXPECT_FALSE((itk::FixedRadiusNeighborhoodInnerProduct<itk::Image<float, 4>, float, float>::IsSupported(
+    CreateOperator(itk::Size<4>{ { 1, 1, 1, 1 } }))));
+
+  EXPECT_TRUE((InnerProductType::SupportsImageTypes<itk::Image<short, 3>>()));
+  EXPECT_FALSE((InnerProductType::SupportsImageTypes<itk::VectorImage<float, 3>>()));
+  EXPECT_FALSE(
+    (itk::FixedRadiusNeighborhoodInnerProduct<itk::VectorImage<float, 3>, float, float>::SupportsImageTypes<
+      itk::Image<float, 3>>()));
+}
@@ -0,0 +1,258 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkAlignedImageBufferAllocator.h"
+#include "itkHugePageImageBufferAllocator.h"
+#include "itkImage.h"
+#include "itkImportImageContainer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+// A user-provided allocator, serving the buffers from a fixed arena.
+class ArenaAllocator : public itk::ImageBufferAllocator
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ArenaAllocator);
+
+  using Self = ArenaAllocator;
+  using Superclass = itk::ImageBufferAllocator;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(ArenaAllocator, ImageBufferAllocator);
+
+  void *
+  Allocate(itk::SizeValueType numberOfBytes) override
+  {
+    const itk::SizeValueType alignedOffset = (m_Offset + Alignment - 1) / Alignment * Alignment;
+    if (alignedOffset + numberOfBytes > m_Arena.size() * sizeof(Block))
+    {
+      return nullptr;
+    }
+    m_Offset = alignedOffset + numberOfBytes;
+    m_AllocatedBytes += numberOfBytes;
+    return reinterpret_cast<char *>(m_Arena.data()) + alignedOffset;
+  }
+
+  void
+  Deallocate(void *, itk::SizeValueType numberOfBytes) override
+  {
+    m_AllocatedBytes -= numberOfBytes;
+  }
+
+  itk::SizeValueType
+  GetAlignment() const override
+  {
+    return Alignment;
+  }
+
+  itk::SizeValueType
+  GetAllocatedBytes() const
+  {
+    return m_AllocatedBytes;
+  }
+
+protected:
+  ArenaAllocator() = default;
+  ~ArenaAllocator() override = default;
+
+private:
+  // Not more than the alignment guaranteed by std::allocator.
+  static constexpr itk::SizeValueType Alignment = 16;
+  struct alignas(Alignment) Block
+  {
+    char m_Bytes[Alignment];
+  };
+
+  std::vector<Block> m_Arena{ 1024 };
+  itk::SizeValueType m_Offset{ 0 };
+  itk::SizeValueType m_AllocatedBytes{ 0 };
+};
+
+
+// An element whose constructor throws once a given number of elements is
+// alive, counting the live elements.
+struct ThrowingElement
+{
+  static int liveElements;
+  static int maximumLiveElements;
+
+  ThrowingElement()
+  {
+    if (liveElements == maximumLiveElements)
+    {
+      throw std::runtime_error("ThrowingElement");
+    }
+    ++liveElements;
+  }
+  ThrowingElement(const ThrowingElement &)
+    : ThrowingElement()
+  {}
+  ~ThrowingElement() { --liveElements; }
+  ThrowingElement &
+  operator=(const ThrowingElement &) = default;
+};
+
+int ThrowingElement::liveElements = 0;
+int ThrowingElement::maximumLiveElements = 0;
+} // namespace
+
+
+TEST(ImageBufferAllocator, CreateAllocatorFromString)
+{
+  using itk::ImageBufferAllocator;
+
+  EXPECT_STREQ(ImageBufferAllocator::CreateAllocatorFromString("Aligned")->GetNameOfClass(),
+               "AlignedImageBufferAllocator");
+  EXPECT_STREQ(ImageBufferAllocator::CreateAllocatorFromString("hugepage")->GetNameOfClass(),
+               "HugePageImageBufferAllocator");
+  EXPECT_EQ(ImageBufferAllocator::CreateAllocatorFromString("New"), nullptr);
+}
+
+
+TEST(ImageBufferAllocator, AlignedAllocatorAlignsBuffers)
+{
+  const auto allocator = itk::AlignedImageBufferAllocator::New();
+  EXPECT_EQ(allocator->GetAlignment(), 64u);
+
+  allocator->SetAlignment(100);
+  EXPECT_EQ(allocator->GetAlignment(), 128u);
+
+  for (const itk::SizeValueType numberOfBytes : { 0, 1, 1000, 123457 })
+  {
+    void * const buffer = allocator->Allocate(numberOfBytes);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_TRUE(itk::ImageBufferAllocator::IsAligned(buffer, 128));
+    allocator->Deallocate(buffer, numberOfBytes);
+  }
+}
+
+
+TEST(ImageBufferAllocator, HugePageAllocatorAlignsLargeBuffers)
+{
+  const auto               allocator = itk::HugePageImageBufferAllocator::New();
+  const itk::SizeValueType numberOfBytes = 3 * itk::HugePageImageBufferAllocator::HugePageSize + 1;
+
+  void * const buffer = allocator->Allocate(numberOfBytes);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_TRUE(itk::ImageBufferAllocator::IsAligned(buffer, itk::HugePageImageBufferAllocator::HugePageSize));
+  static_cast<char *>(buffer)[numberOfBytes - 1] = 1;
+  allocator->Deallocate(buffer, numberOfBytes);
+}
+
+
+TEST(ImageBufferAllocator, ContainerUsesAlignedAllocator)
+{
+  const auto container = itk::ImportImageContainer<itk::SizeValueType, float>::New();
+  container->SetAllocator(itk::AlignedImageBufferAllocator::New());
+
+  const itk::SizeValueType size = 1001;
+  container->Reserve(size, true);
+  EXPECT_EQ(container->GetBufferAlignment(), 64u);
+  EXPECT_TRUE(container->IsBufferAligned(64));
+
+  const float * const buffer = container->GetBufferPointer();
+  EXPECT_TRUE(std::all_of(buffer, buffer + size, [](float value) { return value == 0.0f; }));
+
+  // Growing the buffer keeps its content.
+  container->GetBufferPointer()[size - 1] = 1.0f;
+  container->Reserve(2 * size, false);
+  EXPECT_EQ((*container)[size - 1], 1.0f);
+  EXPECT_TRUE(container->IsBufferAligned(64));
+}
+
+
+TEST(ImageBufferAllocator, ContainerReleasesBufferToItsAllocator)
+{
+  const auto arena = ArenaAllocator::New();
+  {
+    const auto container = itk::ImportImageContainer<itk::SizeValueType, std::string>::New();
+    container->SetAllocator(arena);
+    container->Reserve(10, true);
+    EXPECT_EQ(arena->GetAllocatedBytes(), 10 * sizeof(std::string));
+    EXPECT_EQ(container->GetBufferAlignment(), 16u);
+    (*container)[9] = "The elements are constructed and destroyed by the container";
+
+    // Buffers allocated afterwards come from operator new[], while the
+    // current buffer is still released to the arena.
+    container->SetAllocator(nullptr);
+    container->Reserve(20, true);
+    EXPECT_EQ(arena->GetAllocatedBytes(), 0u);
+    EXPECT_EQ(container->GetBufferAlignment(), alignof(std::string));
+    EXPECT_EQ((*container)[9], "The elements are constructed and destroyed by the container");
+
+    container->SetAllocator(arena);
+    container->Reserve(40, false);
+    EXPECT_EQ(arena->GetAllocatedBytes(), 40 * sizeof(std::string));
+  }
+  EXPECT_EQ(arena->GetAllocatedBytes(), 0u);
+}
+
+
+TEST(ImageBufferAllocator, ContainerPassesOnConstructorExceptions)
+{
+  const auto arena = ArenaAllocator::New();
+  ThrowingElement::maximumLiveElements = 5;
+  for (const bool useArena : { true, false })
+  {
+    const auto container = itk::ImportImageContainer<itk::SizeValueType, ThrowingElement>::New();
+    container->SetAllocator(useArena ? arena.GetPointer() : nullptr);
+    EXPECT_THROW(container->Reserve(10, true), std::runtime_error);
+    EXPECT_EQ(ThrowingElement::liveElements, 0);
+    EXPECT_EQ(arena->GetAllocatedBytes(), 0u);
+    EXPECT_EQ(container->Size(), 0u);
+  }
+  ThrowingElement::maximumLiveElements = 0;
+}
+
+
+TEST(ImageBufferAllocator, ImageKeepsAllocatorWhenInitialized)
+{
+  const auto allocator = itk::AlignedImageBufferAllocator::New();
+  allocator->SetAlignment(256);
+
+  const auto image = itk::Image<unsigned char, 2>::New();
+  image->GetPixelContainer()->SetAllocator(allocator);
+  image->Initialize();
+  image->SetRegions(itk::Size<2>{ { 17, 19 } });
+  image->Allocate();
+
+  EXPECT_EQ(image->GetPixelContainer()->GetAllocator(), allocator.GetPointer());
+  EXPECT_TRUE(image->GetPixelContainer()->IsBufferAligned(256));
+}
+
+
+TEST(ImageBufferAllocator, GlobalDefaultAllocator)
+{
+  const itk::ImageBufferAllocator::Pointer previousAllocator = itk::ImageBufferAllocator::GetGlobalDefaultAllocator();
+
+  const auto allocator = itk::AlignedImageBufferAllocator::New();
+  itk::ImageBufferAllocator::SetGlobalDefaultAllocator(allocator);
+  using ContainerType = itk::ImportImageContainer<itk::SizeValueType, short>;
+  EXPECT_EQ(ContainerType::New()->GetAllocator(), allocator.GetPointer());
+
+  itk::ImageBufferAllocator::SetGlobalDefaultAllocator(previousAllocator);
+}
@@ -0,0 +1,223 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkAlignedImageBufferAllocator.h"
+#include "itkImage.h"
+#include "itkImageBufferPool.h"
+
+
+namespace
+{
+// An upstream allocator counting the bytes it has allocated and not yet
+// released.
+class CountingAllocator : public itk::AlignedImageBufferAllocator
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CountingAllocator);
+
+  using Self = CountingAllocator;
+  using Superclass = itk::AlignedImageBufferAllocator;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(CountingAllocator, AlignedImageBufferAllocator);
+
+  void *
+  Allocate(itk::SizeValueType numberOfBytes) override
+  {
+    m_AllocatedBytes += numberOfBytes;
+    return Superclass::Allocate(numberOfBytes);
+  }
+
+  void
+  Deallocate(void * buffer, itk::SizeValueType numberOfBytes) override
+  {
+    m_AllocatedBytes -= numberOfBytes;
+    Superclass::Deallocate(buffer, numberOfBytes);
+  }
+
+  itk::SizeValueType
+  GetAllocatedBytes() const
+  {
+    return m_AllocatedBytes;
+  }
+
+protected:
+  CountingAllocator() = default;
+  ~CountingAllocator() override = default;
+
+private:
+  itk::SizeValueType m_AllocatedBytes{ 0 };
+};
+} // namespace
+
+
+TEST(ImageBufferPool, ReusesBuffersOfSameSize)
+{
+  const auto pool = itk::ImageBufferPool::New();
+
+  void * const first = pool->Allocate(1000);
+  ASSERT_NE(first, nullptr);
+  EXPECT_TRUE(itk::ImageBufferAllocator::IsAligned(first, pool->GetAlignment()));
+  pool->Deallocate(first, 1000);
+  EXPECT_EQ(pool->GetCachedBytes(), 1000u);
+  EXPECT_EQ(pool->GetBytesInUse(), 0u);
+
+  // A different size is not served from the pool.
+  void * const second = pool->Allocate(2000);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(pool->Allocate(1000), first);
+
+  EXPECT_EQ(pool->GetNumberOfHits(), 1u);
+  EXPECT_EQ(pool->GetNumberOfMisses(), 2u);
+  EXPECT_EQ(pool->GetBytesInUse(), 3000u);
+  EXPECT_EQ(pool->GetCachedBytes(), 0u);
+  EXPECT_EQ(pool->GetPeakBytes(), 3000u);
+
+  pool->Deallocate(first, 1000);
+  pool->Deallocate(second, 2000);
+  EXPECT_EQ(pool->GetCachedBytes(), 3000u);
+
+  // Releases the least recently released buffer.
+  pool->Trim(2000);
+  EXPECT_EQ(pool->GetCachedBytes(), 2000u);
+  pool->Trim();
+  EXPECT_EQ(pool->GetCachedBytes(), 0u);
+
+  pool->ResetStatistics();
+  EXPECT_EQ(pool->GetNumberOfHits(), 0u);
+  EXPECT_EQ(pool->GetNumberOfMisses(), 0u);
+  EXPECT_EQ(pool->GetPeakBytes(), 0u);
+}
+
+
+TEST(ImageBufferPool, KeepsCachedBytesBelowMaximum)
+{
+  const auto pool = itk::ImageBufferPool::New();
+  pool->SetMaximumCachedBytes(2500);
+
+  void * const buffers[] = { pool->Allocate(1000), pool->Allocate(1000), pool->Allocate(1000), pool->Allocate(3000) };
+  pool->Deallocate(buffers[0], 1000);
+  pool->Deallocate(buffers[1], 1000);
+  pool->Deallocate(buffers[2], 1000);
+  EXPECT_EQ(pool->GetCachedBytes(), 2000u);
+
+  // Larger than the maximum, so directly released upstream.
+  pool->Deallocate(buffers[3], 3000);
+  EXPECT_EQ(pool->GetCachedBytes(), 2000u);
+
+  pool->SetMaximumCachedBytes(1000);
+  EXPECT_EQ(pool->GetCachedBytes(), 1000u);
+
+  // The least recently released buffers were released upstream.
+  EXPECT_EQ(pool->Allocate(1000), buffers[2]);
+  EXPECT_EQ(pool->GetNumberOfHits(), 1u);
+  pool->Deallocate(buffers[2], 1000);
+}
+
+
+TEST(ImageBufferPool, KeepsCachedBuffersOnMiss)
+{
+  const auto upstream = CountingAllocator::New();
+  const auto pool = itk::ImageBufferPool::New();
+  pool->SetUpstreamAllocator(upstream);
+  pool->SetMaximumCachedBytes(2500);
+
+  void * const buffer = pool->Allocate(1000);
+  pool->Deallocate(buffer, 1000);
+
+  // A buffer of another size, which does not fit in the maximum along with
+  // the cached one, does not evict it, as only cached bytes are bounded.
+  void * const largerBuffer = pool->Allocate(2000);
+  EXPECT_EQ(pool->GetCachedBytes(), 1000u);
+  EXPECT_EQ(upstream->GetAllocatedBytes(), 3000u);
+  EXPECT_EQ(pool->Allocate(1000), buffer);
+
+  // Trimmed when the cached bytes would exceed the maximum.
+  pool->Deallocate(buffer, 1000);
+  pool->Deallocate(largerBuffer, 2000);
+  EXPECT_EQ(pool->GetCachedBytes(), 2000u);
+  EXPECT_EQ(upstream->GetAllocatedBytes(), 2000u);
+}
+
+TEST(ImageBufferPool, ReleasesBuffersToTheirUpstreamAllocator)
+{
+  const auto pool = itk::ImageBufferPool::New();
+
+  void * const buffer = pool->Allocate(1000);
+
+  const auto upstream = itk::AlignedImageBufferAllocator::New();
+  upstream->SetAlignment(4096);
+  pool->SetUpstreamAllocator(upstream);
+  EXPECT_EQ(pool->GetAlignment(), 4096u);
+
+  // Allocated by the previous upstream allocator, so not reused.
+  pool->Deallocate(buffer, 1000);
+  EXPECT_EQ(pool->GetCachedBytes(), 0u);
+
+  void * const alignedBuffer = pool->Allocate(1000);
+  EXPECT_TRUE(itk::ImageBufferAllocator::IsAligned(alignedBuffer, 4096));
+  pool->Deallocate(alignedBuffer, 1000);
+  EXPECT_EQ(pool->GetCachedBytes(), 1000u);
+}
+
+
+TEST(ImageBufferPool, ReleasesForeignBuffersUpstream)
+{
+  const auto upstream = CountingAllocator::New();
+  const auto pool = itk::ImageBufferPool::New();
+  pool->SetUpstreamAllocator(upstream);
+
+  // Allocated before the pool was used, like the buffer of an image whose
+  // allocator was replaced by the pool.
+  void * const buffer = upstream->Allocate(1000);
+  EXPECT_EQ(upstream->GetAllocatedBytes(), 1000u);
+
+  pool->Deallocate(buffer, 1000);
+  EXPECT_EQ(upstream->GetAllocatedBytes(), 0u);
+  EXPECT_EQ(pool->GetCachedBytes(), 0u);
+  EXPECT_EQ(pool->GetBytesInUse(), 0u);
+
+  pool->Deallocate(nullptr, 0);
+}
+
+
+TEST(ImageBufferPool, RecyclesReleasedImageBuffers)
+{
+  using ImageType = itk::Image<float, 3>;
+
+  const auto pool = itk::ImageBufferPool::New();
+  const auto image = ImageType::New();
+  image->GetPixelContainer()->SetAllocator(pool);
+
+  for (int i = 0; i < 5; ++i)
+  {
+    // Like the output of a filter, with its data released after use.
+    image->SetRegions(ImageType::SizeType{ { 16, 8, 4 } });
+    image->Allocate(true);
+    EXPECT_EQ(image->GetPixel({ { 15, 7, 3 } }), 0.0f);
+    image->SetPixel({ { 15, 7, 3 } }, 1.0f);
+    image->ReleaseData();
+  }
+
+  EXPECT_EQ(pool->GetNumberOfMisses(), 1u);
+  EXPECT_EQ(pool->GetNumberOfHits(), 4u);
+  EXPECT_EQ(pool->GetPeakBytes(), 16 * 8 * 4 * sizeof(float));
+}
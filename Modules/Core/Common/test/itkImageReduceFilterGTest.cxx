@@ -0,0 +1,209 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkImageReduceFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkPlatformMultiThreader.h"
+#include "itkPoolMultiThreader.h"
+#include <atomic>
+
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// The accumulator of SumImageFilter: a plain sum, whose rounding depends on
+// the order of the additions.
+struct SumAccumulator
+{
+  double             m_Sum{ 0.0 };
+  itk::SizeValueType m_Count{ 0 };
+};
+
+class SumImageFilter : public itk::ImageReduceFilter<ImageType, SumAccumulator>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SumImageFilter);
+
+  using Self = SumImageFilter;
+  using Superclass = itk::ImageReduceFilter<ImageType, SumAccumulator>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(SumImageFilter, ImageReduceFilter);
+
+  using Superclass::SetNumberOfStreamDivisions;
+
+  double
+  GetSum() const
+  {
+    return m_Sum;
+  }
+
+  itk::SizeValueType
+  GetCount() const
+  {
+    return m_Count;
+  }
+
+  unsigned int
+  GetNumberOfMerges() const
+  {
+    return m_NumberOfMerges;
+  }
+
+protected:
+  SumImageFilter() = default;
+
+  void
+  BeforeStreamedGenerateData() override
+  {
+    Superclass::BeforeStreamedGenerateData();
+    m_NumberOfMerges = 0;
+  }
+
+  void
+  AfterStreamedGenerateData() override
+  {
+    Superclass::AfterStreamedGenerateData();
+    m_Sum = this->GetAccumulator().m_Sum;
+    m_Count = this->GetAccumulator().m_Count;
+  }
+
+  void
+  AccumulateRegion(const InputImageRegionType & region, SumAccumulator & accumulator) override
+  {
+    for (itk::ImageRegionConstIterator<ImageType> it(this->GetInput(), region); !it.IsAtEnd(); ++it)
+    {
+      accumulator.m_Sum += it.Get();
+      ++accumulator.m_Count;
+    }
+  }
+
+  void
+  MergeAccumulators(SumAccumulator & accumulator, SumAccumulator & other) override
+  {
+    accumulator.m_Sum += other.m_Sum;
+    accumulator.m_Count += other.m_Count;
+    ++m_NumberOfMerges;
+  }
+
+private:
+  double                    m_Sum{ 0.0 };
+  itk::SizeValueType        m_Count{ 0 };
+  std::atomic<unsigned int> m_NumberOfMerges{ 0 };
+};
+
+// Values of very different magnitudes, whose sum is rounded.
+ImageType::Pointer
+MakeImage()
+{
+  const auto size = ImageType::SizeType::Filled(40);
+  auto       image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+  float * const buffer = image->GetBufferPointer();
+  for (itk::SizeValueType i = 0; i < image->GetBufferedRegion().GetNumberOfPixels(); ++i)
+  {
+    buffer[i] = (i % 7 == 0) ? 1.0e7f + static_cast<float>(i) : 0.1f * static_cast<float>(i % 13);
+  }
+  return image;
+}
+} // namespace
+
+
+TEST(ImageReduceFilter, SumDoesNotDependOnNumberOfWorkUnits)
+{
+  const auto image = MakeImage();
+
+  const auto reference = SumImageFilter::New();
+  reference->SetInput(image);
+  reference->SetNumberOfWorkUnits(1);
+  reference->SetMinimumNumberOfPixelsPerBlock(1000);
+  reference->Update();
+  EXPECT_EQ(reference->GetCount(), image->GetBufferedRegion().GetNumberOfPixels());
+  EXPECT_EQ(reference->GetNumberOfMerges(), 40u - 1u);
+
+  const itk::MultiThreaderBase::Pointer multiThreaders[] = { itk::PlatformMultiThreader::New(),
+                                                             itk::PoolMultiThreader::New() };
+  for (const auto & multiThreader : multiThreaders)
+  {
+    for (const unsigned int numberOfWorkUnits : { 2, 3, 8, 17 })
+    {
+      const auto filter = SumImageFilter::New();
+      filter->SetMultiThreader(multiThreader);
+      filter->SetInput(image);
+      filter->SetNumberOfWorkUnits(numberOfWorkUnits);
+      filter->SetMinimumNumberOfPixelsPerBlock(1000);
+      filter->Update();
+      EXPECT_EQ(filter->GetSum(), reference->GetSum())
+        << multiThreader->GetNameOfClass() << " with " << numberOfWorkUnits << " work units";
+      EXPECT_EQ(filter->GetCount(), reference->GetCount());
+    }
+  }
+}
+
+
+TEST(ImageReduceFilter, BoundsNumberOfBlocks)
+{
+  const auto image = MakeImage();
+
+  const auto filter = SumImageFilter::New();
+  filter->SetInput(image);
+  EXPECT_EQ(filter->GetMaximumNumberOfBlocks(), 256u);
+  EXPECT_EQ(filter->GetMinimumNumberOfPixelsPerBlock(), 4096u);
+
+  // 64000 pixels, in 15 blocks of at least 4096 pixels, which are slabs of
+  // whole slices.
+  filter->Update();
+  EXPECT_LE(filter->GetNumberOfMerges() + 1, 15u);
+
+  filter->SetMaximumNumberOfBlocks(4);
+  filter->Update();
+  EXPECT_EQ(filter->GetNumberOfMerges() + 1, 4u);
+
+  // A single block sums the pixels in order.
+  filter->SetMaximumNumberOfBlocks(1);
+  filter->Update();
+  EXPECT_EQ(filter->GetNumberOfMerges(), 0u);
+  double sum = 0.0;
+  for (itk::SizeValueType i = 0; i < image->GetBufferedRegion().GetNumberOfPixels(); ++i)
+  {
+    sum += image->GetBufferPointer()[i];
+  }
+  EXPECT_EQ(filter->GetSum(), sum);
+}
+
+
+TEST(ImageReduceFilter, MergesStreamedChunks)
+{
+  const auto image = MakeImage();
+
+  const auto filter = SumImageFilter::New();
+  filter->SetInput(image);
+  filter->SetNumberOfStreamDivisions(4);
+  filter->SetMinimumNumberOfPixelsPerBlock(1000);
+  filter->Update();
+
+  // 4 chunks of 10 slices, in blocks of one slice each.
+  EXPECT_EQ(filter->GetCount(), image->GetBufferedRegion().GetNumberOfPixels());
+  EXPECT_EQ(filter->GetNumberOfMerges(), 4u * 9u + 3u);
+}
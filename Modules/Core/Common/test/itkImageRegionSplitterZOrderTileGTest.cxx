@@ -0,0 +1,102 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImageRegionSplitterZOrderTile.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+
+
+TEST(ImageRegionSplitterZOrderTile, TilesCoverRegionOnce)
+{
+  using ImageType = itk::Image<unsigned char, 3>;
+  using RegionType = ImageType::RegionType;
+
+  const RegionType region({ { 3, -2, 5 } }, { { 101, 67, 43 } });
+
+  const auto image = ImageType::New();
+  image->SetRegions(region);
+  image->Allocate(true);
+
+  const auto splitter = itk::ImageRegionSplitterZOrderTile::New();
+  splitter->SetTileSizeInBytes(4096);
+  splitter->SetBytesPerPixel(2);
+
+  const unsigned int numberOfSplits = splitter->GetNumberOfSplits(region, 10000);
+  EXPECT_GT(numberOfSplits, 1u);
+  EXPECT_LE(numberOfSplits, 10000u);
+
+  for (unsigned int i = 0; i < numberOfSplits; ++i)
+  {
+    RegionType tile = region;
+    splitter->GetSplit(i, numberOfSplits, tile);
+    EXPECT_TRUE(region.IsInside(tile));
+    EXPECT_LE(tile.GetNumberOfPixels() * 2, 4096u);
+
+    for (itk::ImageRegionIterator<ImageType> it(image, tile); !it.IsAtEnd(); ++it)
+    {
+      it.Set(it.Get() + 1);
+    }
+  }
+
+  for (itk::ImageRegionIterator<ImageType> it(image, region); !it.IsAtEnd(); ++it)
+  {
+    EXPECT_EQ(it.Get(), 1);
+  }
+}
+
+
+TEST(ImageRegionSplitterZOrderTile, RespectsRequestedNumberOfSplits)
+{
+  const itk::ImageRegion<2> region(itk::Size<2>{ { 1000, 1000 } });
+
+  const auto splitter = itk::ImageRegionSplitterZOrderTile::New();
+  splitter->SetTileSizeInBytes(64);
+  splitter->SetBytesPerPixel(1);
+
+  // The tiles are made larger instead.
+  EXPECT_EQ(splitter->GetNumberOfSplits(region, 5), 4u);
+  EXPECT_EQ(splitter->GetNumberOfSplits(region, 1), 1u);
+
+  // A small region is not split.
+  EXPECT_EQ(splitter->GetNumberOfSplits(itk::ImageRegion<2>(itk::Size<2>{ { 8, 8 } }), 100), 1u);
+}
+
+
+TEST(ImageRegionSplitterZOrderTile, ConsecutiveTilesFormBlocks)
+{
+  using RegionType = itk::ImageRegion<3>;
+  const RegionType region(itk::Size<3>{ { 64, 64, 64 } });
+
+  const auto splitter = itk::ImageRegionSplitterZOrderTile::New();
+  splitter->SetTileSizeInBytes(8 * 8 * 8);
+  splitter->SetBytesPerPixel(1);
+
+  const unsigned int numberOfSplits = splitter->GetNumberOfSplits(region, 100000);
+  ASSERT_EQ(numberOfSplits, 512u);
+
+  // The first eight tiles form the first 16x16x16 block.
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    RegionType tile = region;
+    splitter->GetSplit(i, numberOfSplits, tile);
+    EXPECT_EQ(tile.GetSize(), RegionType::SizeType::Filled(8));
+    EXPECT_TRUE(RegionType(RegionType::SizeType::Filled(16)).IsInside(tile));
+  }
+}
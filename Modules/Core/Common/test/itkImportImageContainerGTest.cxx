@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkImportImageContainer.h"
+#include "itkMultiThreaderBase.h"
+#include "itkVectorImage.h"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace
+{
+using MemoryPlacementEnum = itk::ImportImageContainerEnums::MemoryPlacement;
+
+// Restores the global memory placement settings when going out of scope.
+class GlobalMemoryPlacementGuard
+{
+public:
+  GlobalMemoryPlacementGuard()
+    : m_Placement(itk::ImportImageContainerCommon::GetGlobalDefaultMemoryPlacement())
+    , m_MinimumBufferSize(itk::ImportImageContainerCommon::GetGlobalMemoryPlacementMinimumBufferSize())
+  {}
+
+  ~GlobalMemoryPlacementGuard()
+  {
+    itk::ImportImageContainerCommon::SetGlobalDefaultMemoryPlacement(m_Placement);
+    itk::ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(m_MinimumBufferSize);
+  }
+
+private:
+  const MemoryPlacementEnum m_Placement;
+  const itk::SizeValueType  m_MinimumBufferSize;
+};
+} // namespace
+
+
+TEST(ImportImageContainer, MemoryPlacementFromString)
+{
+  using itk::ImportImageContainerCommon;
+
+  EXPECT_EQ(ImportImageContainerCommon::MemoryPlacementFromString("ParallelFirstTouch"),
+            MemoryPlacementEnum::ParallelFirstTouch);
+  EXPECT_EQ(ImportImageContainerCommon::MemoryPlacementFromString("interleaved"), MemoryPlacementEnum::Interleaved);
+  EXPECT_EQ(ImportImageContainerCommon::MemoryPlacementFromString("Default"), MemoryPlacementEnum::Default);
+  EXPECT_EQ(ImportImageContainerCommon::MemoryPlacementFromString("unknown"), MemoryPlacementEnum::Default);
+}
+
+
+TEST(ImportImageContainer, UsesGlobalDefaultMemoryPlacement)
+{
+  const GlobalMemoryPlacementGuard guard;
+
+  itk::ImportImageContainerCommon::SetGlobalDefaultMemoryPlacement(MemoryPlacementEnum::Interleaved);
+  const auto container = itk::ImportImageContainer<itk::SizeValueType, float>::New();
+  EXPECT_EQ(container->GetMemoryPlacement(), MemoryPlacementEnum::Interleaved);
+
+  itk::ImportImageContainerCommon::SetGlobalDefaultMemoryPlacement(MemoryPlacementEnum::Default);
+  EXPECT_EQ(container->GetMemoryPlacement(), MemoryPlacementEnum::Interleaved);
+}
+
+
+TEST(ImportImageContainer, PlacedBufferIsZeroInitialized)
+{
+  const GlobalMemoryPlacementGuard guard;
+
+  // Also place small buffers, so that the test runs fast.
+  itk::ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(0);
+
+  for (const auto placement : { MemoryPlacementEnum::ParallelFirstTouch, MemoryPlacementEnum::Interleaved })
+  {
+    const auto container = itk::ImportImageContainer<itk::SizeValueType, double>::New();
+    container->SetMemoryPlacement(placement);
+
+    // Not a multiple of the page size.
+    const itk::SizeValueType size = 123457;
+    container->Reserve(size, true);
+    ASSERT_EQ(container->Size(), size);
+
+    const double * const buffer = container->GetBufferPointer();
+    EXPECT_TRUE(std::all_of(buffer, buffer + size, [](double value) { return value == 0.0; }));
+  }
+}
+
+
+TEST(ImportImageContainer, PlacesBufferInsideParallelRegion)
+{
+  const GlobalMemoryPlacementGuard guard;
+  itk::ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(0);
+
+  const auto               threader = itk::MultiThreaderBase::New();
+  const itk::SizeValueType numberOfBuffers = 8;
+  std::vector<char>        zeroed(numberOfBuffers, 0);
+  threader->ParallelizeArray(
+    0,
+    numberOfBuffers,
+    [&zeroed](itk::SizeValueType i) {
+      const auto container = itk::ImportImageContainer<itk::SizeValueType, float>::New();
+      container->SetMemoryPlacement(MemoryPlacementEnum::ParallelFirstTouch);
+      const itk::SizeValueType size = 54321;
+      container->Reserve(size, true);
+      const float * const buffer = container->GetBufferPointer();
+      zeroed[i] = std::all_of(buffer, buffer + size, [](float value) { return value == 0.0f; });
+    },
+    nullptr);
+  EXPECT_TRUE(std::all_of(zeroed.begin(), zeroed.end(), [](char value) { return value != 0; }));
+}
+
+
+TEST(ImportImageContainer, ImageKeepsMemoryPlacementWhenInitialized)
+{
+  const auto image = itk::Image<short, 3>::New();
+  image->GetPixelContainer()->SetMemoryPlacement(MemoryPlacementEnum::ParallelFirstTouch);
+  image->Initialize();
+  EXPECT_EQ(image->GetPixelContainer()->GetMemoryPlacement(), MemoryPlacementEnum::ParallelFirstTouch);
+
+  const auto vectorImage = itk::VectorImage<short, 3>::New();
+  vectorImage->GetPixelContainer()->SetMemoryPlacement(MemoryPlacementEnum::Interleaved);
+  vectorImage->Initialize();
+  EXPECT_EQ(vectorImage->GetPixelContainer()->GetMemoryPlacement(), MemoryPlacementEnum::Interleaved);
+}
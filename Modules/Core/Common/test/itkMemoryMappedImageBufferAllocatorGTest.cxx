@@ -0,0 +1,188 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkMemoryMappedImageBufferAllocator.h"
+
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Memory mapping is only implemented on POSIX systems.
+#if defined(__unix__) || defined(__APPLE__)
+
+namespace
+{
+using ImageType = itk::Image<unsigned short, 2>;
+
+constexpr itk::SizeValueType HeaderSize = 100;
+
+// Writes a header of HeaderSize bytes, followed by the pixels 0, 1, 2, ...
+std::string
+WriteTestFile(const std::string & fileName, itk::SizeValueType numberOfPixels)
+{
+  std::ofstream file(fileName, std::ios::binary);
+  file << std::string(HeaderSize, 'h');
+  std::vector<unsigned short> pixels(numberOfPixels);
+  std::iota(pixels.begin(), pixels.end(), static_cast<unsigned short>(0));
+  file.write(reinterpret_cast<const char *>(pixels.data()), pixels.size() * sizeof(unsigned short));
+  return fileName;
+}
+
+std::vector<unsigned short>
+ReadTestFilePixels(const std::string & fileName, itk::SizeValueType numberOfPixels)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  file.seekg(HeaderSize);
+  std::vector<unsigned short> pixels(numberOfPixels);
+  file.read(reinterpret_cast<char *>(pixels.data()), pixels.size() * sizeof(unsigned short));
+  return pixels;
+}
+
+ImageType::Pointer
+MakeImage(itk::MemoryMappedImageBufferAllocator * allocator)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->GetPixelContainer()->SetAllocator(allocator);
+  image->Allocate();
+  return image;
+}
+} // namespace
+
+
+TEST(MemoryMappedImageBufferAllocator, ScratchBuffersArePageAlignedAndWritable)
+{
+  auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+  EXPECT_EQ(allocator->GetMode(), itk::MemoryMappedImageBufferAllocator::ModeEnum::Scratch);
+
+  {
+    auto image = MakeImage(allocator);
+    EXPECT_EQ(allocator->GetNumberOfMappedBuffers(), 1u);
+    EXPECT_TRUE(itk::ImageBufferAllocator::IsAligned(image->GetBufferPointer(), allocator->GetAlignment()));
+    EXPECT_EQ(image->GetPixelContainer()->GetBufferAlignment(), allocator->GetAlignment());
+
+    image->FillBuffer(7);
+    EXPECT_EQ(image->GetPixel({ { 63, 31 } }), 7);
+  }
+  EXPECT_EQ(allocator->GetNumberOfMappedBuffers(), 0u);
+}
+
+
+TEST(MemoryMappedImageBufferAllocator, ReadOnlyBuffersShowTheFileAndDoNotModifyIt)
+{
+  const itk::SizeValueType numberOfPixels = 64 * 32;
+  const std::string        fileName =
+    WriteTestFile("itkMemoryMappedImageBufferAllocatorReadOnly.raw", numberOfPixels);
+
+  auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+  allocator->SetFileName(fileName);
+  allocator->SetOffset(HeaderSize);
+  allocator->SetMode(itk::MemoryMappedImageBufferAllocator::ModeEnum::ReadOnly);
+  allocator->SetAdvice(itk::MemoryMappedImageBufferAllocator::AdviceEnum::Sequential);
+  EXPECT_EQ(allocator->GetAlignment(), 4u);
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->GetPixelContainer()->SetAllocator(allocator);
+  image->Allocate(false);
+
+  EXPECT_EQ(image->GetPixel({ { 0, 0 } }), 0);
+  EXPECT_EQ(image->GetPixel({ { 5, 1 } }), 69);
+  EXPECT_EQ(image->GetPixel({ { 63, 31 } }), numberOfPixels - 1);
+
+  image->FillBuffer(3);
+  EXPECT_EQ(image->GetPixel({ { 5, 1 } }), 3);
+  image = nullptr;
+  EXPECT_EQ(allocator->GetNumberOfMappedBuffers(), 0u);
+
+  const std::vector<unsigned short> pixels = ReadTestFilePixels(fileName, numberOfPixels);
+  EXPECT_EQ(pixels[69], 69);
+  EXPECT_EQ(pixels.back(), numberOfPixels - 1);
+  std::remove(fileName.c_str());
+}
+
+
+TEST(MemoryMappedImageBufferAllocator, ReadWriteBuffersWriteThrough)
+{
+  const itk::SizeValueType numberOfPixels = 64 * 32;
+  const std::string        fileName =
+    WriteTestFile("itkMemoryMappedImageBufferAllocatorReadWrite.raw", numberOfPixels);
+
+  auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+  allocator->SetFileName(fileName);
+  allocator->SetOffset(HeaderSize);
+  allocator->SetMode(itk::MemoryMappedImageBufferAllocator::ModeEnum::ReadWrite);
+  {
+    auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+    image->GetPixelContainer()->SetAllocator(allocator);
+    image->Allocate(false);
+    EXPECT_EQ(image->GetPixel({ { 5, 1 } }), 69);
+    image->SetPixel({ { 5, 1 } }, 1000);
+  }
+  EXPECT_EQ(allocator->GetNumberOfMappedBuffers(), 0u);
+
+  const std::vector<unsigned short> pixels = ReadTestFilePixels(fileName, numberOfPixels);
+  EXPECT_EQ(pixels[68], 68);
+  EXPECT_EQ(pixels[69], 1000);
+  std::remove(fileName.c_str());
+}
+
+
+TEST(MemoryMappedImageBufferAllocator, ReadOnlyAllocationFailsWhenTheFileIsTooShort)
+{
+  auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+  allocator->SetFileName("itkMemoryMappedImageBufferAllocatorMissing.raw");
+  allocator->SetMode(itk::MemoryMappedImageBufferAllocator::ModeEnum::ReadOnly);
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 32 } });
+  image->GetPixelContainer()->SetAllocator(allocator);
+  EXPECT_THROW(image->Allocate(false), itk::MemoryAllocationError);
+  EXPECT_EQ(allocator->GetNumberOfMappedBuffers(), 0u);
+}
+
+
+TEST(MemoryMappedImageBufferAllocator, Advise)
+{
+  using AdviceEnum = itk::MemoryMappedImageBufferAllocator::AdviceEnum;
+
+  auto allocator = itk::MemoryMappedImageBufferAllocator::New();
+  auto image = MakeImage(allocator);
+
+  // A few rows in the middle of the buffer, not starting on a page.
+  const unsigned short * const slab = image->GetBufferPointer() + image->ComputeOffset({ { 0, 8 } });
+  const itk::SizeValueType     slabSize = 64 * 4 * sizeof(unsigned short);
+  EXPECT_TRUE(itk::MemoryMappedImageBufferAllocator::Advise(slab, slabSize, AdviceEnum::WillNeed));
+  EXPECT_TRUE(itk::MemoryMappedImageBufferAllocator::Advise(slab, slabSize, AdviceEnum::DontNeed));
+}
+
+
+TEST(MemoryMappedImageBufferAllocator, CreateAllocatorFromString)
+{
+  const auto allocator = itk::ImageBufferAllocator::CreateAllocatorFromString("MEMORYMAPPED");
+  ASSERT_NE(allocator, nullptr);
+  EXPECT_STREQ(allocator->GetNameOfClass(), "MemoryMappedImageBufferAllocator");
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include "itkMetaDataObject.h"
 
 #include <iterator>
+#include <utility>
 
 namespace
 {
@@ -42,6 +43,14 @@ createMetaDataDictionary()
   return metaDataDictionary;
 }
 
+// The address of the first entry, which identifies the map of a dictionary
+// without making it unique.
+const void *
+getFirstEntryAddress(const itk::MetaDataDictionary & metaDataDictionary)
+{
+  return &*metaDataDictionary.Begin();
+}
+
 template <typename T>
 itk::MetaDataObjectBase::Pointer
 createMetaDataObject(const T & invalue)
@@ -254,6 +263,63 @@ TEST(MetaDataDictionary, CopyOnWrite)
 }
 
 
+TEST(MetaDataDictionary, SharesEntriesUntilModified)
+{
+  const itk::MetaDataDictionary original = createMetaDataDictionary();
+  const void * const            originalAddress = getFirstEntryAddress(original);
+
+  // Copies, and the reading of their entries, do not copy the map.
+  itk::MetaDataDictionary copy = original;
+  itk::MetaDataDictionary assigned;
+  assigned = copy;
+  EXPECT_EQ(getFirstEntryAddress(copy), originalAddress);
+  EXPECT_EQ(getFirstEntryAddress(assigned), originalAddress);
+
+  float f = -99;
+  EXPECT_TRUE(itk::ExposeMetaData<float>(copy, "one", f));
+  EXPECT_EQ(f, 1.0f);
+  EXPECT_NE(copy.Get("two"), nullptr);
+  EXPECT_TRUE(copy.HasKey("object"));
+  EXPECT_EQ(copy.GetKeys().size(), 3u);
+  EXPECT_FALSE(copy.Erase("three"));
+  EXPECT_EQ(getFirstEntryAddress(copy), originalAddress);
+
+  // The non-constant iterators may replace entries, so they copy the map.
+  EXPECT_NE(&*copy.Begin(), originalAddress);
+  EXPECT_EQ(copy, original);
+
+  // Modifying a copy leaves the other copies unchanged.
+  itk::EncapsulateMetaData<float>(assigned, "one", 11.0f);
+  EXPECT_NE(getFirstEntryAddress(assigned), originalAddress);
+  EXPECT_TRUE(itk::ExposeMetaData<float>(original, "one", f));
+  EXPECT_EQ(f, 1.0f);
+  EXPECT_EQ(original.Get("two"), assigned.Get("two"));
+
+  // A moved from dictionary is empty, and usable.
+  const itk::MetaDataDictionary moved = std::move(copy);
+  EXPECT_EQ(moved, original);
+  EXPECT_EQ(copy.GetKeys().size(), 0u);
+  EXPECT_FALSE(copy.HasKey("one"));
+  itk::EncapsulateMetaData<float>(copy, "one", 1.0f);
+  EXPECT_TRUE(copy.HasKey("one"));
+}
+
+TEST(MetaDataDictionary, EmptyDictionariesAreIndependent)
+{
+  itk::MetaDataDictionary dic1;
+  itk::MetaDataDictionary dic2;
+  itk::EncapsulateMetaData<int>(dic1, "key", 1);
+  EXPECT_TRUE(dic1.HasKey("key"));
+  EXPECT_FALSE(dic2.HasKey("key"));
+
+  dic1.Clear();
+  itk::EncapsulateMetaData<int>(dic2, "key", 2);
+  EXPECT_FALSE(dic1.HasKey("key"));
+  EXPECT_FALSE(itk::MetaDataDictionary().HasKey("key"));
+  EXPECT_EQ(dic1, itk::MetaDataDictionary());
+}
+
+
 TEST(MetaDataDictionary, Equal)
 {
   const auto expectEqual = [](const itk::MetaDataDictionary & object1, const itk::MetaDataDictionary & object2) {
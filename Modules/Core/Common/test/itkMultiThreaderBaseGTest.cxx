@@ -0,0 +1,188 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkPlatformMultiThreader.h"
+#include "itkPoolMultiThreader.h"
+#include "itkWorkStealingMultiThreader.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::vector<itk::MultiThreaderBase::Pointer>
+CreateMultiThreaders()
+{
+  return { itk::PlatformMultiThreader::New().GetPointer(),
+           itk::PoolMultiThreader::New().GetPointer(),
+           itk::WorkStealingMultiThreader::New().GetPointer() };
+}
+} // namespace
+
+
+TEST(MultiThreaderBase, ExecutesSmallWorkOnCallingThread)
+{
+  for (const auto & threader : CreateMultiThreaders())
+  {
+    threader->SetNumberOfWorkUnits(4);
+    threader->SetGrainSize(100);
+    EXPECT_EQ(threader->GetGrainSize(), 100u);
+
+    const std::thread::id callingThread = std::this_thread::get_id();
+    std::atomic<int>      numberOfOtherThreadCalls{ 0 };
+
+    // Less than twice the grain size.
+    std::vector<int> visits(199, 0);
+    threader->ParallelizeArray(
+      0,
+      visits.size(),
+      [&](itk::SizeValueType i) {
+        ++visits[i];
+        numberOfOtherThreadCalls += (std::this_thread::get_id() != callingThread);
+      },
+      nullptr);
+
+    const itk::IndexValueType index[2] = { 0, 0 };
+    const itk::SizeValueType  size[2] = { 10, 10 };
+    itk::SizeValueType        numberOfPixels = 0;
+    threader->ParallelizeImageRegion(
+      2,
+      index,
+      size,
+      [&](const itk::IndexValueType *, const itk::SizeValueType * regionSize) {
+        numberOfPixels += regionSize[0] * regionSize[1];
+        numberOfOtherThreadCalls += (std::this_thread::get_id() != callingThread);
+      },
+      nullptr);
+
+    EXPECT_EQ(numberOfOtherThreadCalls, 0) << threader->GetNameOfClass();
+    EXPECT_EQ(numberOfPixels, 100u);
+    for (auto count : visits)
+    {
+      EXPECT_EQ(count, 1);
+    }
+    EXPECT_EQ(threader->GetNumberOfSerialExecutions(), 2u);
+    EXPECT_EQ(threader->GetNumberOfParallelExecutions(), 0u);
+  }
+}
+
+
+TEST(MultiThreaderBase, SplitsWorkOfAtLeastTwiceTheGrainSize)
+{
+  for (const auto & threader : CreateMultiThreaders())
+  {
+    threader->SetNumberOfWorkUnits(4);
+    threader->SetGrainSize(100);
+
+    std::vector<std::atomic<int>> visits(200);
+    threader->ParallelizeArray(
+      0, visits.size(), [&visits](itk::SizeValueType i) { ++visits[i]; }, nullptr);
+    for (const auto & count : visits)
+    {
+      EXPECT_EQ(count, 1);
+    }
+
+    const itk::IndexValueType index[2] = { 0, 0 };
+    const itk::SizeValueType  size[2] = { 100, 100 };
+    std::atomic<int>          numberOfCalls{ 0 };
+    threader->ParallelizeImageRegion(
+      2, index, size, [&](const itk::IndexValueType *, const itk::SizeValueType *) { ++numberOfCalls; }, nullptr);
+
+    EXPECT_GT(numberOfCalls, 1) << threader->GetNameOfClass();
+    EXPECT_LE(numberOfCalls, 4) << threader->GetNameOfClass();
+    EXPECT_EQ(threader->GetNumberOfSerialExecutions(), 0u);
+    EXPECT_EQ(threader->GetNumberOfParallelExecutions(), 2u);
+
+    threader->ResetExecutionCounters();
+    EXPECT_EQ(threader->GetNumberOfParallelExecutions(), 0u);
+  }
+}
+
+
+TEST(MultiThreaderBase, CountsExecutionsOfAllMultiThreaders)
+{
+  itk::MultiThreaderBase::ResetGlobalExecutionCounters();
+
+  const auto threader = itk::PoolMultiThreader::New();
+  threader->SetNumberOfWorkUnits(2);
+  threader->ParallelizeArray(
+    0, 1, [](itk::SizeValueType) {}, nullptr);
+  threader->ParallelizeArray(
+    0, 2, [](itk::SizeValueType) {}, nullptr);
+
+  EXPECT_EQ(itk::MultiThreaderBase::GetGlobalNumberOfSerialExecutions(), 1u);
+  EXPECT_EQ(itk::MultiThreaderBase::GetGlobalNumberOfParallelExecutions(), 1u);
+
+  itk::MultiThreaderBase::ResetGlobalExecutionCounters();
+  EXPECT_EQ(itk::MultiThreaderBase::GetGlobalNumberOfSerialExecutions(), 0u);
+}
+
+
+TEST(MultiThreaderBase, ExecutesSmallImageRegionsOnCallingThreadByDefault)
+{
+  for (const auto & threader : CreateMultiThreaders())
+  {
+    threader->SetNumberOfWorkUnits(4);
+    threader->SetGrainSize(0);
+
+    const std::thread::id callingThread = std::this_thread::get_id();
+    std::atomic<int>      numberOfCalls{ 0 };
+    std::atomic<int>      numberOfOtherThreadCalls{ 0 };
+    const auto            countCalls = [&](const itk::IndexValueType *, const itk::SizeValueType *) {
+      ++numberOfCalls;
+      numberOfOtherThreadCalls += (std::this_thread::get_id() != callingThread);
+    };
+
+    // A 64x64 slice is less than twice the default grain size of regions.
+    const itk::IndexValueType index[2] = { 0, 0 };
+    const itk::SizeValueType  smallSize[2] = { 64, 64 };
+    threader->ParallelizeImageRegion(2, index, smallSize, countCalls, nullptr);
+    EXPECT_EQ(numberOfCalls, 1) << threader->GetNameOfClass();
+    EXPECT_EQ(numberOfOtherThreadCalls, 0) << threader->GetNameOfClass();
+    EXPECT_EQ(threader->GetNumberOfSerialExecutions(), 1u);
+
+    numberOfCalls = 0;
+    const itk::SizeValueType largeSize[2] = { 256, 256 };
+    threader->ParallelizeImageRegion(2, index, largeSize, countCalls, nullptr);
+    EXPECT_GT(numberOfCalls, 1) << threader->GetNameOfClass();
+
+    // Each index of an array is worth a work unit by default.
+    std::vector<std::atomic<int>> visits(4);
+    threader->ParallelizeArray(
+      0, visits.size(), [&visits](itk::SizeValueType i) { ++visits[i]; }, nullptr);
+    EXPECT_EQ(threader->GetNumberOfParallelExecutions(), 2u);
+  }
+}
+
+
+TEST(MultiThreaderBase, GlobalDefaultGrainSizeInitializesNewMultiThreaders)
+{
+  const itk::SizeValueType defaultGrainSize = itk::MultiThreaderBase::GetGlobalDefaultGrainSize();
+
+  itk::MultiThreaderBase::SetGlobalDefaultGrainSize(64);
+  EXPECT_EQ(itk::PoolMultiThreader::New()->GetGrainSize(), 64u);
+
+  // Zero selects the grain size from the kind of call.
+  itk::MultiThreaderBase::SetGlobalDefaultGrainSize(0);
+  EXPECT_EQ(itk::PoolMultiThreader::New()->GetGrainSize(), 0u);
+
+  itk::MultiThreaderBase::SetGlobalDefaultGrainSize(defaultGrainSize);
+}
@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkMultiThreaderBase.h"
+#include "itkPerformanceCounterProbesCollectorBase.h"
+
+#include <ctime>
+#include <future>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+using EventEnum = itk::PerformanceCounterProbeEnums::Event;
+
+// The CPU time of the calling thread, on Linux, or of the process.
+double
+GetCPUTime()
+{
+#if defined(__linux__)
+  timespec time;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return static_cast<double>(time.tv_sec) + 1e-9 * static_cast<double>(time.tv_nsec);
+#else
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+// Keeps the calling thread busy for the given CPU time.
+void
+SpinFor(double seconds)
+{
+  const double    start = GetCPUTime();
+  volatile double sum = 0.0;
+  while (GetCPUTime() - start < seconds)
+  {
+    for (int i = 0; i < 1000; ++i)
+    {
+      sum = sum + i;
+    }
+  }
+}
+} // namespace
+
+
+TEST(PerformanceCounterProbe, CountsTheEventsOfAllThreads)
+{
+  itk::PerformanceCounterProbe probe;
+  probe.SetNumberOfPixels(1000);
+  EXPECT_EQ(probe.GetNumberOfPixels(), 1000u);
+
+  const auto threader = itk::MultiThreaderBase::New();
+  threader->SetNumberOfWorkUnits(4);
+  threader->SetGrainSize(1);
+
+  // The work units run for 0.2 s of CPU time altogether, on the threads of
+  // the pool.
+  probe.Start();
+  threader->ParallelizeArray(0, 4, [](itk::SizeValueType) { SpinFor(0.05); }, nullptr);
+  probe.Stop();
+
+  EXPECT_EQ(probe.GetNumberOfStops(), 1u);
+  EXPECT_EQ(probe.GetTotal(), probe.GetEventTotal(EventEnum::Cycles));
+  if (!probe.IsEventAvailable(EventEnum::TaskClock))
+  {
+    GTEST_SKIP() << "perf_event_open() is not available.";
+  }
+  EXPECT_GE(probe.GetEventTotal(EventEnum::TaskClock), 150000000);
+  EXPECT_DOUBLE_EQ(probe.GetEventsPerPixel(EventEnum::TaskClock),
+                   static_cast<double>(probe.GetEventTotal(EventEnum::TaskClock)) / 1000.0);
+  if (probe.IsEventAvailable(EventEnum::Cycles) && probe.IsEventAvailable(EventEnum::Instructions))
+  {
+    EXPECT_GT(probe.GetTotal(), 0);
+    EXPECT_GT(probe.GetInstructionsPerCycle(), 0.0);
+  }
+
+  // Stop() without a matching Start() has no effect.
+  probe.Stop();
+  EXPECT_EQ(probe.GetNumberOfStops(), 1u);
+
+  probe.Reset();
+  EXPECT_EQ(probe.GetEventTotal(EventEnum::TaskClock), 0);
+  EXPECT_EQ(probe.GetNumberOfStops(), 0u);
+}
+
+
+TEST(PerformanceCounterProbe, CountsThreadsCreatedBeforeAndAfterStart)
+{
+  std::promise<void> startPromise;
+  std::future<void>  started = startPromise.get_future();
+  std::thread        existingThread([&started] {
+    started.wait();
+    SpinFor(0.05);
+  });
+
+  itk::PerformanceCounterProbe probe;
+  probe.Start();
+  startPromise.set_value();
+  std::thread newThread([] { SpinFor(0.05); });
+  existingThread.join();
+  newThread.join();
+  probe.Stop();
+
+  if (!probe.IsEventAvailable(EventEnum::TaskClock))
+  {
+    GTEST_SKIP() << "perf_event_open() is not available.";
+  }
+  // The calling thread only waits.
+  EXPECT_GE(probe.GetEventTotal(EventEnum::TaskClock), 80000000);
+}
+
+
+TEST(PerformanceCounterProbe, ReportsDerivedMetrics)
+{
+  itk::PerformanceCounterProbesCollectorBase collector;
+  collector.SetNumberOfPixels("Spin", 100);
+  for (int i = 0; i < 2; ++i)
+  {
+    collector.Start("Spin");
+    SpinFor(0.01);
+    collector.Stop("Spin");
+  }
+  EXPECT_EQ(collector.GetProbe("Spin").GetNumberOfPixels(), 100u);
+  EXPECT_EQ(collector.GetProbe("Spin").GetNumberOfStops(), 2u);
+
+  std::ostringstream report;
+  collector.Report(report, false);
+  EXPECT_NE(report.str().find("IPC"), std::string::npos);
+  EXPECT_NE(report.str().find("CacheMiss/Pixel"), std::string::npos);
+
+  std::ostringstream jsonReport;
+  collector.JSONReport(jsonReport, false);
+  EXPECT_NE(jsonReport.str().find("\"IPC\": "), std::string::npos);
+  EXPECT_NE(jsonReport.str().find("\"BranchMiss/Pixel\": "), std::string::npos);
+  std::cout << report.str() << jsonReport.str();
+}
+
+
+TEST(PerformanceCounterProbe, PrintsEvents)
+{
+  std::ostringstream stream;
+  stream << EventEnum::CacheMisses;
+  EXPECT_EQ(stream.str(), "itk::PerformanceCounterProbeEnums::Event::CacheMisses");
+}
@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImageAlgorithm.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkPlanarVectorImage.h"
+#include "itkVectorImage.h"
+
+
+namespace
+{
+constexpr unsigned int NumberOfComponents = 3;
+
+template <typename TImage>
+typename TImage::Pointer
+MakeImage(const itk::Size<2> & size)
+{
+  auto image = TImage::New();
+  image->SetRegions(size);
+  image->SetNumberOfComponentsPerPixel(NumberOfComponents);
+  image->Allocate();
+  return image;
+}
+
+// The value of the component k of the pixel at an index.
+double
+ComponentValue(const itk::Index<2> & index, unsigned int k)
+{
+  return static_cast<double>(100 * k + 10 * index[1] + index[0]);
+}
+
+template <typename TImage>
+void
+FillWithComponentValues(TImage * image)
+{
+  typename TImage::PixelType pixel(NumberOfComponents);
+  for (itk::ImageRegionIterator<TImage> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    for (unsigned int k = 0; k < NumberOfComponents; ++k)
+    {
+      pixel[k] = static_cast<typename TImage::InternalPixelType>(ComponentValue(it.GetIndex(), k));
+    }
+    it.Set(pixel);
+  }
+}
+
+template <typename TImage>
+void
+ExpectComponentValues(const TImage * image, const itk::ImageRegion<2> & region, const itk::Offset<2> & shift = {})
+{
+  for (itk::ImageRegionConstIteratorWithIndex<TImage> it(image, region); !it.IsAtEnd(); ++it)
+  {
+    const typename TImage::PixelType pixel = it.Get();
+    for (unsigned int k = 0; k < NumberOfComponents; ++k)
+    {
+      EXPECT_EQ(pixel[k],
+                static_cast<typename TImage::InternalPixelType>(ComponentValue(it.GetIndex() + shift, k)))
+        << it.GetIndex() << " " << k;
+    }
+  }
+}
+} // namespace
+
+
+TEST(PlanarVectorImage, StoresComponentsInPlanes)
+{
+  using ImageType = itk::PlanarVectorImage<float, 2>;
+  const itk::Size<2> size{ { 5, 4 } };
+  const auto         image = MakeImage<ImageType>(size);
+  EXPECT_EQ(image->GetNumberOfComponentsPerPixel(), NumberOfComponents);
+  EXPECT_EQ(image->GetComponentStride(), 20u);
+
+  FillWithComponentValues(image.GetPointer());
+  ExpectComponentValues(image.GetPointer(), image->GetBufferedRegion());
+
+  const itk::Index<2> index{ { 3, 2 } };
+  const auto          offset = image->ComputeOffset(index);
+  for (unsigned int k = 0; k < NumberOfComponents; ++k)
+  {
+    EXPECT_EQ(image->GetBufferPointer()[k * 20 + offset], ComponentValue(index, k));
+    EXPECT_EQ(image->GetComponentBufferPointer(k)[offset], ComponentValue(index, k));
+    EXPECT_EQ(image->GetPixel(index)[k], ComponentValue(index, k));
+  }
+
+  ImageType::PixelType pixel(NumberOfComponents);
+  pixel.Fill(-1.0f);
+  image->SetPixel(index, pixel);
+  EXPECT_EQ((*image)[index], pixel);
+  EXPECT_EQ(image->GetComponentBufferPointer(2)[offset], -1.0f);
+
+  pixel[1] = 7.0f;
+  image->FillBuffer(pixel);
+  EXPECT_EQ(image->GetPixel({ { 0, 0 } }), pixel);
+  EXPECT_EQ(image->GetPixel({ { 4, 3 } }), pixel);
+}
+
+
+TEST(PlanarVectorImage, SupportsNeighborhoodIterators)
+{
+  using ImageType = itk::PlanarVectorImage<short, 2>;
+  const auto image = MakeImage<ImageType>({ { 6, 5 } });
+  FillWithComponentValues(image.GetPointer());
+
+  itk::ConstNeighborhoodIterator<ImageType> it({ { 1, 1 } }, image, image->GetBufferedRegion());
+  it.SetLocation({ { 2, 3 } });
+  const itk::Offset<2> offset{ { 1, -1 } };
+  const auto           pixel = it.GetPixel(offset);
+  for (unsigned int k = 0; k < NumberOfComponents; ++k)
+  {
+    EXPECT_EQ(pixel[k], ComponentValue({ { 3, 2 } }, k));
+  }
+
+  // Outside of the image, the default boundary condition clamps the index.
+  it.SetLocation({ { 0, 0 } });
+  const auto boundaryPixel = it.GetPixel({ { -1, -1 } });
+  for (unsigned int k = 0; k < NumberOfComponents; ++k)
+  {
+    EXPECT_EQ(boundaryPixel[k], ComponentValue({ { 0, 0 } }, k));
+  }
+}
+
+
+TEST(PlanarVectorImage, GetsComponentImagesWithoutCopy)
+{
+  using ImageType = itk::PlanarVectorImage<float, 2>;
+  auto image = MakeImage<ImageType>({ { 7, 3 } });
+  image->SetSpacing(2.5);
+  FillWithComponentValues(image.GetPointer());
+
+  auto component = image->GetComponentImage(1);
+  EXPECT_EQ(component->GetBufferPointer(), image->GetComponentBufferPointer(1));
+  EXPECT_EQ(component->GetBufferedRegion(), image->GetBufferedRegion());
+  EXPECT_EQ(component->GetSpacing(), image->GetSpacing());
+  EXPECT_EQ(component->GetPixel({ { 6, 2 } }), ComponentValue({ { 6, 2 } }, 1));
+
+  component->SetPixel({ { 1, 1 } }, 42.0f);
+  EXPECT_EQ(image->GetPixel({ { 1, 1 } })[1], 42.0f);
+
+  EXPECT_THROW(image->GetComponentImage(NumberOfComponents), itk::ExceptionObject);
+
+  // The component image keeps the buffer alive.
+  image = nullptr;
+  EXPECT_EQ(component->GetPixel({ { 1, 1 } }), 42.0f);
+  EXPECT_EQ(component->GetPixel({ { 5, 0 } }), ComponentValue({ { 5, 0 } }, 1));
+}
+
+
+TEST(PlanarVectorImage, CopiesToAndFromVectorImages)
+{
+  using PlanarImageType = itk::PlanarVectorImage<float, 2>;
+  using VectorImageType = itk::VectorImage<unsigned short, 2>;
+  const itk::Size<2> size{ { 41, 9 } };
+
+  const auto vectorImage = MakeImage<VectorImageType>(size);
+  FillWithComponentValues(vectorImage.GetPointer());
+
+  // Interleaved to planar, with a conversion of the components.
+  const auto planarImage = MakeImage<PlanarImageType>(size);
+  itk::ImageAlgorithm::Copy(vectorImage.GetPointer(),
+                            planarImage.GetPointer(),
+                            vectorImage->GetBufferedRegion(),
+                            planarImage->GetBufferedRegion());
+  ExpectComponentValues(planarImage.GetPointer(), planarImage->GetBufferedRegion());
+
+  // Planar to planar, between regions at different places.
+  const auto                planarCopy = MakeImage<PlanarImageType>(size);
+  const itk::ImageRegion<2> inputRegion({ { 5, 2 } }, { { 30, 6 } });
+  const itk::ImageRegion<2> outputRegion({ { 0, 1 } }, { { 30, 6 } });
+  itk::ImageAlgorithm::Copy(planarImage.GetPointer(), planarCopy.GetPointer(), inputRegion, outputRegion);
+  ExpectComponentValues(planarCopy.GetPointer(), outputRegion, inputRegion.GetIndex() - outputRegion.GetIndex());
+
+  // Planar to interleaved.
+  const auto vectorCopy = MakeImage<VectorImageType>(size);
+  itk::ImageAlgorithm::Copy(planarImage.GetPointer(),
+                            vectorCopy.GetPointer(),
+                            planarImage->GetBufferedRegion(),
+                            vectorCopy->GetBufferedRegion());
+  ExpectComponentValues(vectorCopy.GetPointer(), vectorCopy->GetBufferedRegion());
+}
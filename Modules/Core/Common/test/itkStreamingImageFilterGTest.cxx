@@ -0,0 +1,77 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkStreamingImageFilter.h"
+#include "itkUnaryGeneratorImageFilter.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+using InputImageType = itk::Image<short, 3>;
+using OutputImageType = itk::Image<float, 3>;
+} // namespace
+
+
+TEST(StreamingImageFilter, ChoosesNumberOfPiecesFromMemoryBudget)
+{
+  const auto image = InputImageType::New();
+  image->SetRegions(InputImageType::SizeType{ { 30, 20, 16 } });
+  image->Allocate();
+  const itk::ImageBufferRange<InputImageType> imageRange(*image);
+  std::iota(imageRange.begin(), imageRange.end(), short{ 0 });
+
+  using FilterType = itk::UnaryGeneratorImageFilter<InputImageType, OutputImageType>;
+  const auto filter = FilterType::New();
+  filter->SetInput(image);
+  filter->SetFunctor([](short value) { return static_cast<float>(value); });
+
+  // The input image is already buffered, so only the output of the filter
+  // is allocated by an update.
+  const itk::SizeValueType imageBytes = 30 * 20 * 16 * sizeof(float);
+  filter->GetOutput()->UpdateOutputInformation();
+  EXPECT_EQ(filter->GetOutput()->EstimateMemoryForRequestedRegion(), imageBytes);
+
+  const auto streamer = itk::StreamingImageFilter<OutputImageType, OutputImageType>::New();
+  streamer->SetInput(filter->GetOutput());
+  streamer->GetOutput()->UpdateOutputInformation();
+  EXPECT_EQ(streamer->EstimatePeakMemory(1), 2 * imageBytes);
+  EXPECT_EQ(streamer->EstimatePeakMemory(4), imageBytes + imageBytes / 4);
+
+  // Three pieces would have 6 slices, four pieces have 4 slices.
+  streamer->SetMemoryBudget(imageBytes + imageBytes / 4);
+  streamer->Update();
+  EXPECT_EQ(filter->GetOutput()->GetBufferedRegion().GetSize(2), 4u);
+
+  const itk::ImageBufferRange<const OutputImageType> outputRange(*streamer->GetOutput());
+  EXPECT_TRUE(std::equal(outputRange.begin(), outputRange.end(), imageRange.begin(), imageRange.end()));
+
+  // The last piece is buffered already.
+  EXPECT_EQ(filter->GetOutput()->EstimateMemoryForRequestedRegion(), 0u);
+
+  // Computing the number of pieces does not modify the pipeline, so that
+  // it is not executed again.
+  const itk::ModifiedTimeType updateTime = streamer->GetOutput()->GetUpdateMTime();
+  streamer->Update();
+  EXPECT_EQ(streamer->GetOutput()->GetUpdateMTime(), updateTime);
+}
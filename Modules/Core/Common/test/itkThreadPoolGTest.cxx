@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkPoolMultiThreader.h"
+#include "itkThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+
+namespace
+{
+constexpr itk::ThreadIdType NumberOfThreads = 4;
+
+// Gets the pool, with enough threads, and unpins its threads at the end.
+class ThreadPoolTest : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    m_ThreadPool = itk::ThreadPool::GetInstance();
+    if (m_ThreadPool->GetMaximumNumberOfThreads() < NumberOfThreads)
+    {
+      m_ThreadPool->AddThreads(NumberOfThreads - m_ThreadPool->GetMaximumNumberOfThreads());
+    }
+  }
+
+  void
+  TearDown() override
+  {
+    m_ThreadPool->SetThreadPlacement(itk::ThreadPoolEnums::ThreadPlacement::Unpinned);
+  }
+
+  std::vector<std::thread::id>
+  GetThreadOfEachJob(itk::ThreadIdType numberOfJobs)
+  {
+    std::vector<std::future<std::thread::id>> futures;
+    for (itk::ThreadIdType i = 0; i < numberOfJobs; ++i)
+    {
+      futures.push_back(m_ThreadPool->AddWorkToThread(i, [] { return std::this_thread::get_id(); }));
+    }
+    std::vector<std::thread::id> threads;
+    for (auto & future : futures)
+    {
+      threads.push_back(future.get());
+    }
+    return threads;
+  }
+
+  itk::ThreadPool::Pointer m_ThreadPool;
+};
+
+bool
+IsSortedPermutation(std::vector<unsigned int> cpus, const std::vector<unsigned int> & sortedCPUs)
+{
+  std::sort(cpus.begin(), cpus.end());
+  return cpus == sortedCPUs;
+}
+} // namespace
+
+
+TEST_F(ThreadPoolTest, HandsJobsToThreadsInStableOrder)
+{
+  const itk::ThreadIdType numberOfThreads = m_ThreadPool->GetMaximumNumberOfThreads();
+
+  const std::vector<std::thread::id> threads = GetThreadOfEachJob(numberOfThreads);
+  EXPECT_EQ(std::set<std::thread::id>(threads.begin(), threads.end()).size(), numberOfThreads);
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(GetThreadOfEachJob(numberOfThreads), threads);
+  }
+
+  // Through PoolMultiThreader, whose first work unit runs on the calling
+  // thread.
+  const auto multiThreader = itk::PoolMultiThreader::New();
+  multiThreader->SetMaximumNumberOfThreads(NumberOfThreads);
+  multiThreader->SetNumberOfWorkUnits(NumberOfThreads);
+  const auto getThreadOfEachIndex = [&multiThreader] {
+    std::vector<std::thread::id> indexThreads(NumberOfThreads);
+    multiThreader->ParallelizeArray(
+      0,
+      NumberOfThreads,
+      [&indexThreads](itk::SizeValueType i) { indexThreads[i] = std::this_thread::get_id(); },
+      nullptr);
+    return indexThreads;
+  };
+  const std::vector<std::thread::id> indexThreads = getThreadOfEachIndex();
+  EXPECT_EQ(indexThreads[0], std::this_thread::get_id());
+  for (unsigned int i = 1; i < NumberOfThreads; ++i)
+  {
+    EXPECT_EQ(indexThreads[i], threads[i - 1]);
+  }
+  EXPECT_EQ(getThreadOfEachIndex(), indexThreads);
+}
+
+
+TEST_F(ThreadPoolTest, OtherThreadsRunTheJobsOfBusyThreads)
+{
+  std::promise<void> start;
+  std::promise<void> release;
+  auto               released = release.get_future().share();
+  auto               busy = m_ThreadPool->AddWorkToThread(0, [&start, released] {
+    start.set_value();
+    released.wait();
+  });
+  start.get_future().wait();
+
+  auto job = m_ThreadPool->AddWorkToThread(0, [] { return std::this_thread::get_id(); });
+  EXPECT_EQ(job.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+
+  release.set_value();
+  busy.get();
+}
+
+
+TEST_F(ThreadPoolTest, ComputesPlacementCPUs)
+{
+  using PlacementEnum = itk::ThreadPoolEnums::ThreadPlacement;
+
+  const std::vector<unsigned int> cpus = itk::ThreadPool::GetPlacementCPUs(PlacementEnum::Unpinned);
+  ASSERT_FALSE(cpus.empty());
+  EXPECT_TRUE(std::is_sorted(cpus.begin(), cpus.end()));
+  EXPECT_TRUE(IsSortedPermutation(itk::ThreadPool::GetPlacementCPUs(PlacementEnum::Compact), cpus));
+  EXPECT_TRUE(IsSortedPermutation(itk::ThreadPool::GetPlacementCPUs(PlacementEnum::Spread), cpus));
+
+  for (const PlacementEnum placement : { PlacementEnum::Unpinned, PlacementEnum::Compact, PlacementEnum::Spread })
+  {
+    const std::vector<unsigned int> nodeCPUs = itk::ThreadPool::GetPlacementCPUs(placement, 0);
+    EXPECT_TRUE(std::all_of(nodeCPUs.begin(), nodeCPUs.end(), [&cpus](unsigned int cpu) {
+      return std::find(cpus.begin(), cpus.end(), cpu) != cpus.end();
+    })) << placement;
+  }
+  EXPECT_TRUE(itk::ThreadPool::GetPlacementCPUs(PlacementEnum::Spread, 1 << 20).empty());
+  EXPECT_THROW(m_ThreadPool->SetThreadPlacement(PlacementEnum::Compact, 1 << 20), itk::ExceptionObject);
+}
+
+
+TEST_F(ThreadPoolTest, PinsThreads)
+{
+  const std::vector<unsigned int> cpus =
+    itk::ThreadPool::GetPlacementCPUs(itk::ThreadPoolEnums::ThreadPlacement::Spread);
+  m_ThreadPool->SetThreadPlacement(itk::ThreadPoolEnums::ThreadPlacement::Spread);
+  for (itk::ThreadIdType i = 0; i < NumberOfThreads; ++i)
+  {
+    EXPECT_EQ(m_ThreadPool->GetThreadAffinity(i), std::vector<unsigned int>{ cpus[i % cpus.size()] });
+  }
+
+  m_ThreadPool->SetThreadAffinity({ cpus.back() });
+  EXPECT_EQ(m_ThreadPool->GetThreadAffinity(1), std::vector<unsigned int>{ cpus.back() });
+#if defined(__linux__)
+  for (itk::ThreadIdType i = 0; i < NumberOfThreads; ++i)
+  {
+    auto cpuCount = m_ThreadPool->AddWorkToThread(i, [] {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+      return CPU_COUNT(&set);
+    });
+    EXPECT_EQ(cpuCount.get(), 1);
+  }
+#endif
+  EXPECT_THROW(m_ThreadPool->SetThreadAffinity({ 1u << 20 }), itk::ExceptionObject);
+
+  m_ThreadPool->SetThreadPlacement(itk::ThreadPoolEnums::ThreadPlacement::Unpinned);
+  EXPECT_TRUE(m_ThreadPool->GetThreadAffinity(0).empty());
+}
@@ -0,0 +1,284 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImage.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageScanlineConstIterator.h"
+#include "itkImageScanlineIterator.h"
+#include "itkLabelStatisticsImageFilter.h"
+#include "itkTiledImage.h"
+#include "itkUnaryFunctorImageFilter.h"
+
+
+namespace
+{
+using TiledImageType = itk::TiledImage<unsigned short, 3>;
+using DenseImageType = itk::Image<unsigned short, 3>;
+
+constexpr itk::SizeValueType BrickSize = 16;
+
+// A label map: two balls in a background of zeros.
+unsigned short
+Label(const itk::Index<3> & index)
+{
+  const auto distance2 = [&index](int x, int y, int z) {
+    return (index[0] - x) * (index[0] - x) + (index[1] - y) * (index[1] - y) + (index[2] - z) * (index[2] - z);
+  };
+  if (distance2(30, 30, 20) < 15 * 15)
+  {
+    return 1;
+  }
+  if (distance2(75, 50, 20) < 10 * 10)
+  {
+    return static_cast<unsigned short>(2 + index[0] % 3);
+  }
+  return 0;
+}
+
+template <typename TImage>
+typename TImage::Pointer
+MakeImage()
+{
+  auto image = TImage::New();
+  image->SetRegions(typename TImage::SizeType{ { 100, 80, 40 } });
+  return image;
+}
+
+TiledImageType::Pointer
+MakeTiledImage()
+{
+  auto image = MakeImage<TiledImageType>();
+  image->SetBrickSize(TiledImageType::SizeType{ { BrickSize, BrickSize, BrickSize } });
+  image->Allocate();
+  return image;
+}
+
+template <typename TImage>
+void
+WriteLabels(TImage * image)
+{
+  for (itk::ImageRegionIterator<TImage> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    it.Set(Label(it.GetIndex()));
+  }
+}
+
+template <typename TPixel>
+struct ThresholdFunctor
+{
+  TPixel
+  operator()(const TPixel & value) const
+  {
+    return value >= 2 ? 1 : 0;
+  }
+  bool
+  operator==(const ThresholdFunctor &) const
+  {
+    return true;
+  }
+  bool
+  operator!=(const ThresholdFunctor &) const
+  {
+    return false;
+  }
+};
+} // namespace
+
+
+TEST(TiledImage, AllocatesUniformBricks)
+{
+  const auto image = MakeTiledImage();
+  const auto container = image->GetPixelContainer();
+
+  // 100 x 80 x 40 pixels are split in 7 x 5 x 3 bricks.
+  EXPECT_EQ(container->GetNumberOfBricks(), 105u);
+  EXPECT_EQ(container->GetNumberOfUniformBricks(), 105u);
+  EXPECT_EQ(container->GetCompressedSizeInBytes(), 105u * sizeof(unsigned short));
+  EXPECT_NE(image->GetBufferPointer(), nullptr);
+  EXPECT_EQ(image->GetPixel({ { 99, 79, 39 } }), 0);
+
+  image->FillBuffer(7);
+  EXPECT_EQ(image->GetPixel({ { 50, 40, 20 } }), 7);
+  EXPECT_EQ(container->GetNumberOfUniformBricks(), 105u);
+  EXPECT_EQ(container->GetNumberOfCachedBricks(), 0u);
+
+  image->Initialize();
+  EXPECT_EQ(image->GetBufferPointer(), nullptr);
+}
+
+
+TEST(TiledImage, IteratorsReadWhatTheyWrite)
+{
+  const auto tiledImage = MakeTiledImage();
+  tiledImage->GetPixelContainer()->SetCacheCapacity(4);
+  WriteLabels(tiledImage.GetPointer());
+
+  const auto denseImage = MakeImage<DenseImageType>();
+  denseImage->Allocate();
+  WriteLabels(denseImage.GetPointer());
+
+  itk::ImageScanlineConstIterator<TiledImageType> tiledIt(tiledImage, tiledImage->GetBufferedRegion());
+  itk::ImageScanlineConstIterator<DenseImageType> denseIt(denseImage, denseImage->GetBufferedRegion());
+  itk::SizeValueType                              numberOfMismatches = 0;
+  while (!tiledIt.IsAtEnd())
+  {
+    while (!tiledIt.IsAtEndOfLine())
+    {
+      numberOfMismatches += (tiledIt.Get() != denseIt.Get());
+      ++tiledIt;
+      ++denseIt;
+    }
+    tiledIt.NextLine();
+    denseIt.NextLine();
+  }
+  EXPECT_EQ(numberOfMismatches, 0u);
+  EXPECT_EQ(tiledImage->GetPixel({ { 30, 30, 20 } }), 1);
+  EXPECT_EQ(tiledImage->GetPixel({ { 75, 50, 20 } }), 2);
+
+  // Writing a pixel is seen by iterators reading its brick as uniform.
+  const itk::Index<3> corner{ { 99, 79, 39 } };
+  tiledImage->GetPixelContainer()->Flush();
+  itk::ImageRegionConstIteratorWithIndex<TiledImageType> readIt(tiledImage, tiledImage->GetBufferedRegion());
+  readIt.SetIndex(corner);
+  EXPECT_EQ(readIt.Get(), 0);
+  tiledImage->SetPixel(corner, 9);
+  EXPECT_EQ(readIt.Get(), 9);
+}
+
+
+TEST(TiledImage, CompressesBricks)
+{
+  const auto image = MakeTiledImage();
+  WriteLabels(image.GetPointer());
+  const auto container = image->GetPixelContainer();
+  container->Flush();
+
+  EXPECT_EQ(container->GetNumberOfCachedBricks(), 0u);
+  EXPECT_GT(container->GetNumberOfUniformBricks(), 80u);
+  EXPECT_LT(container->GetCompressedSizeInBytes(), 100u * 80u * 40u * sizeof(unsigned short) / 10);
+
+  const itk::SizeValueType firstBrick = 0;
+  const itk::SizeValueType ballBrick = 1 + 7 * (1 + 5 * 1); // The brick containing (30, 30, 20).
+  EXPECT_EQ(container->GetBrickEncoding(firstBrick), itk::TiledImageContainerEnums::BrickEncoding::Uniform);
+  // The surface of the ball crosses its brick.
+  EXPECT_EQ(container->GetBrickEncoding(ballBrick), itk::TiledImageContainerEnums::BrickEncoding::RunLength);
+
+  // Bricks whose pixels all differ are not run-length encoded.
+  itk::ImageRegionIterator<TiledImageType> it(image, TiledImageType::RegionType({ { 0, 0, 0 } }, { { 16, 16, 16 } }));
+  for (unsigned short value = 0; !it.IsAtEnd(); ++it, ++value)
+  {
+    it.Set(value);
+  }
+  it = itk::ImageRegionIterator<TiledImageType>();
+  container->Flush();
+  EXPECT_EQ(container->GetBrickEncoding(firstBrick), itk::TiledImageContainerEnums::BrickEncoding::Raw);
+  EXPECT_EQ(image->GetPixel({ { 15, 15, 15 } }), 16 * 16 * 16 - 1);
+}
+
+
+TEST(TiledImage, NeighborhoodIterators)
+{
+  const auto tiledImage = MakeTiledImage();
+  WriteLabels(tiledImage.GetPointer());
+  const auto denseImage = MakeImage<DenseImageType>();
+  denseImage->Allocate();
+  WriteLabels(denseImage.GetPointer());
+
+  const itk::Size<3>                             radius{ { 1, 1, 1 } };
+  const TiledImageType::RegionType               region({ { 0, 20, 10 } }, { { 100, 30, 20 } });
+  itk::ConstNeighborhoodIterator<TiledImageType> tiledIt(radius, tiledImage, region);
+  itk::ConstNeighborhoodIterator<DenseImageType> denseIt(radius, denseImage, region);
+  itk::SizeValueType                             numberOfMismatches = 0;
+  for (; !tiledIt.IsAtEnd(); ++tiledIt, ++denseIt)
+  {
+    for (unsigned int i = 0; i < tiledIt.Size(); ++i)
+    {
+      numberOfMismatches += (tiledIt.GetPixel(i) != denseIt.GetPixel(i));
+    }
+  }
+  EXPECT_EQ(numberOfMismatches, 0u);
+}
+
+
+TEST(TiledImage, FilterReadsAndWritesTiledImages)
+{
+  const auto input = MakeTiledImage();
+  WriteLabels(input.GetPointer());
+
+  using FilterType = itk::UnaryFunctorImageFilter<TiledImageType, TiledImageType, ThresholdFunctor<unsigned short>>;
+  auto filter = FilterType::New();
+  filter->SetInput(input);
+  filter->Update();
+  const TiledImageType * output = filter->GetOutput();
+
+  itk::SizeValueType numberOfMismatches = 0;
+  for (itk::ImageRegionConstIteratorWithIndex<TiledImageType> it(output, output->GetBufferedRegion()); !it.IsAtEnd();
+       ++it)
+  {
+    numberOfMismatches += (it.Get() != (Label(it.GetIndex()) >= 2 ? 1 : 0));
+  }
+  EXPECT_EQ(numberOfMismatches, 0u);
+
+  // Grafting shares the bricks.
+  auto graft = TiledImageType::New();
+  graft->Graft(output);
+  EXPECT_EQ(graft->GetPixelContainer(), output->GetPixelContainer());
+  EXPECT_EQ(graft->GetPixel({ { 75, 50, 20 } }), 1);
+}
+
+
+TEST(TiledImage, LabelStatisticsOfTiledLabelMap)
+{
+  const auto tiledLabels = MakeTiledImage();
+  WriteLabels(tiledLabels.GetPointer());
+  const auto denseLabels = MakeImage<DenseImageType>();
+  denseLabels->Allocate();
+  WriteLabels(denseLabels.GetPointer());
+
+  const auto intensities = MakeImage<DenseImageType>();
+  intensities->Allocate();
+  for (itk::ImageRegionIterator<DenseImageType> it(intensities, intensities->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    const itk::Index<3> index = it.GetIndex();
+    it.Set(static_cast<unsigned short>(index[0] * 7 + index[1] * 3 + index[2]));
+  }
+
+  const auto tiledFilter = itk::LabelStatisticsImageFilter<DenseImageType, TiledImageType>::New();
+  tiledFilter->SetInput(intensities);
+  tiledFilter->SetLabelInput(tiledLabels);
+  tiledFilter->Update();
+  const auto denseFilter = itk::LabelStatisticsImageFilter<DenseImageType, DenseImageType>::New();
+  denseFilter->SetInput(intensities);
+  denseFilter->SetLabelInput(denseLabels);
+  denseFilter->Update();
+
+  ASSERT_EQ(tiledFilter->GetNumberOfLabels(), 5u);
+  ASSERT_EQ(tiledFilter->GetNumberOfLabels(), denseFilter->GetNumberOfLabels());
+  for (const unsigned short label : denseFilter->GetValidLabelValues())
+  {
+    EXPECT_EQ(tiledFilter->GetCount(label), denseFilter->GetCount(label));
+    EXPECT_EQ(tiledFilter->GetSum(label), denseFilter->GetSum(label));
+    EXPECT_EQ(tiledFilter->GetMinimum(label), denseFilter->GetMinimum(label));
+    EXPECT_EQ(tiledFilter->GetMaximum(label), denseFilter->GetMaximum(label));
+    EXPECT_EQ(tiledFilter->GetBoundingBox(label), denseFilter->GetBoundingBox(label));
+  }
+}
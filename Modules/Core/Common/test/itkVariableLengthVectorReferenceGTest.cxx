@@ -0,0 +1,180 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkVariableLengthVectorReference.h"
+#include "itkImageBufferRange.h"
+#include "itkImageRegionRange.h"
+#include "itkVectorImage.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+
+namespace
+{
+using ImageType = itk::VectorImage<float, 2>;
+using PixelType = ImageType::PixelType;
+
+// Creates an image whose pixel i has the components (i, 2 * i, 3 * i).
+ImageType::Pointer
+CreateImage()
+{
+  const auto image = ImageType::New();
+  image->SetRegions(itk::Size<2>{ { 4, 3 } });
+  image->SetVectorLength(3);
+  image->Allocate();
+  float * const buffer = image->GetBufferPointer();
+  for (unsigned int i = 0; i < 12; ++i)
+  {
+    for (unsigned int c = 0; c < 3; ++c)
+    {
+      buffer[3 * i + c] = static_cast<float>((c + 1) * i);
+    }
+  }
+  return image;
+}
+} // namespace
+
+
+TEST(VariableLengthVectorReference, IsTheReferenceTypeOfVectorImageRanges)
+{
+  using BufferRangeType = itk::ImageBufferRange<ImageType>;
+  using ConstBufferRangeType = itk::ImageBufferRange<const ImageType>;
+  using RegionRangeType = itk::ImageRegionRange<ImageType>;
+
+  static_assert(std::is_same<std::iterator_traits<BufferRangeType::iterator>::reference,
+                             itk::VariableLengthVectorReference<float>>::value,
+                "ImageBufferRange iterator must return a reference to the components");
+  static_assert(std::is_same<std::iterator_traits<ConstBufferRangeType::iterator>::reference,
+                             itk::VariableLengthVectorReference<const float>>::value,
+                "ImageBufferRange const iterator must return a const reference to the components");
+  static_assert(std::is_same<std::iterator_traits<RegionRangeType::iterator>::reference,
+                             itk::VariableLengthVectorReference<float>>::value,
+                "ImageRegionRange iterator must return a reference to the components");
+
+  const auto      image = CreateImage();
+  BufferRangeType range{ *image };
+  auto &&         pixel = range[5];
+  EXPECT_EQ(pixel.GetDataPointer(), image->GetBufferPointer() + 15);
+  EXPECT_EQ(pixel.Size(), 3u);
+  EXPECT_EQ(pixel[2], 15.0f);
+}
+
+
+TEST(VariableLengthVectorReference, ModifiesPixelsInPlace)
+{
+  const auto image = CreateImage();
+  PixelType  offset(3);
+  offset.Fill(1.0f);
+
+  for (auto && pixel : itk::ImageBufferRange<ImageType>{ *image })
+  {
+    pixel *= 2;
+    pixel += offset;
+    pixel -= 0.5f;
+  }
+  EXPECT_EQ(image->GetPixel({ { 1, 1 } })[1], 2.0f * 10.0f + 0.5f);
+
+  // Expression templates are evaluated element by element.
+  itk::ImageBufferRange<ImageType> range{ *image };
+  range[0] = range[1] + range[2] * 2.0;
+  EXPECT_EQ(range[0], range[1] + range[2] * 2.0);
+  EXPECT_EQ(range[0][0], (2.0f * 1.0f + 0.5f) + (2.0f * 2.0f + 0.5f) * 2.0f);
+
+  range[1] = 7.0f;
+  PixelType sevens(3);
+  sevens.Fill(7.0f);
+  EXPECT_EQ(image->GetPixel({ { 1, 0 } }), sevens);
+
+  range[2] /= 2;
+  EXPECT_EQ(range[2][2], (2.0f * 6.0f + 0.5f) / 2.0f);
+
+  // Assignment copies the elements, and does not rebind the reference.
+  auto && pixel3 = range[3];
+  pixel3 = range[4];
+  EXPECT_EQ(range[3], range[4]);
+  EXPECT_NE(pixel3.GetDataPointer(), range[4].GetDataPointer());
+}
+
+
+TEST(VariableLengthVectorReference, ConvertsToOwningVector)
+{
+  const auto                       image = CreateImage();
+  itk::ImageBufferRange<ImageType> range{ *image };
+
+  const PixelType copy = range[3];
+  range[3].Fill(0.0f);
+  EXPECT_EQ(copy[1], 6.0f);
+  EXPECT_EQ(range[3][1], 0.0f);
+
+  PixelType vector;
+  vector = range[4];
+  vector += range[4];
+  EXPECT_EQ(vector[2], 24.0f);
+  EXPECT_EQ(itk::GetNorm(range[4]), range[4].GetNorm());
+  EXPECT_EQ(range[4].GetSquaredNorm(), 16.0 + 64.0 + 144.0);
+
+  std::ostringstream stream;
+  stream << range[4];
+  EXPECT_EQ(stream.str(), "[4, 8, 12]");
+}
+
+
+TEST(VariableLengthVectorReference, HasNumericTraits)
+{
+  using ReferenceType = itk::VariableLengthVectorReference<const float>;
+  using TraitsType = itk::NumericTraits<ReferenceType>;
+
+  static_assert(std::is_same<TraitsType::RealType, itk::VariableLengthVector<double>>::value,
+                "The real type must be a vector of double");
+
+  PixelType pixel(4);
+  pixel.Fill(1.0f);
+  const ReferenceType reference(pixel);
+  EXPECT_EQ(TraitsType::GetLength(reference), 4u);
+  EXPECT_EQ(TraitsType::ZeroValue(reference), reference * 0.0f);
+  EXPECT_EQ(TraitsType::OneValue(reference).GetSize(), 4u);
+  EXPECT_EQ(TraitsType::max(reference)[3], itk::NumericTraits<float>::max());
+}
+
+
+TEST(VariableLengthVectorReference, SupportsStdSortAndSwap)
+{
+  const auto                       image = CreateImage();
+  itk::ImageBufferRange<ImageType> range{ *image };
+
+  using std::swap;
+  swap(range[0], range[11]);
+  EXPECT_EQ(range[0][0], 11.0f);
+  EXPECT_EQ(range[11][2], 0.0f);
+
+  // Sort by descending first component.
+  std::sort(range.begin(), range.end(), [](const PixelType & lhs, const PixelType & rhs) { return rhs[0] < lhs[0]; });
+  for (unsigned int i = 0; i < 12; ++i)
+  {
+    const auto expected = static_cast<float>(11 - i);
+    EXPECT_EQ(range[i][0], expected);
+    EXPECT_EQ(range[i][2], 3.0f * expected);
+  }
+
+  const std::vector<PixelType> pixels(range.cbegin(), range.cend());
+  range[0].Fill(-1.0f);
+  EXPECT_EQ(pixels[0][1], 22.0f);
+}
@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkWorkStealingMultiThreader.h"
+#include "itkMacro.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+
+TEST(WorkStealingDeque, PopIsLastInFirstOutAndStealIsFirstInFirstOut)
+{
+  using TaskType = itk::WorkStealingDeque::TaskType;
+
+  // A small initial capacity, to exercise growing the ring buffer.
+  itk::WorkStealingDeque deque(2);
+  std::vector<TaskType>  tasks(10);
+
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_EQ(deque.Steal(), nullptr);
+
+  for (auto & task : tasks)
+  {
+    deque.Push(&task);
+  }
+  EXPECT_EQ(deque.GetApproximateSize(), 10);
+
+  EXPECT_EQ(deque.Pop(), &tasks[9]);
+  EXPECT_EQ(deque.Steal(), &tasks[0]);
+  EXPECT_EQ(deque.Steal(), &tasks[1]);
+  EXPECT_EQ(deque.Pop(), &tasks[8]);
+  EXPECT_EQ(deque.GetApproximateSize(), 6);
+
+  for (size_t i = 7; i >= 2; --i)
+  {
+    EXPECT_EQ(deque.Pop(), &tasks[i]);
+  }
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+
+TEST(WorkStealingMultiThreader, ParallelizeArrayVisitsEachIndexOnce)
+{
+  auto threader = itk::WorkStealingMultiThreader::New();
+  threader->SetNumberOfWorkUnits(16);
+
+  std::vector<int> visits(1000, 0);
+  threader->ParallelizeArray(
+    0, visits.size(), [&visits](itk::SizeValueType i) { ++visits[i]; }, nullptr);
+
+  for (auto count : visits)
+  {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+
+TEST(WorkStealingMultiThreader, NestedParallelRegionsComplete)
+{
+  auto outer = itk::WorkStealingMultiThreader::New();
+  outer->SetNumberOfWorkUnits(8);
+  auto inner = itk::WorkStealingMultiThreader::New();
+  inner->SetNumberOfWorkUnits(8);
+
+  constexpr itk::SizeValueType outerSize = 32;
+  constexpr itk::SizeValueType innerSize = 64;
+
+  std::atomic<itk::SizeValueType> sum{ 0 };
+  outer->ParallelizeArray(
+    0,
+    outerSize,
+    [&](itk::SizeValueType) {
+      // The inner threader shares the same pool as the outer one.
+      inner->ParallelizeArray(
+        0, innerSize, [&sum](itk::SizeValueType j) { sum += j; }, nullptr);
+    },
+    nullptr);
+
+  EXPECT_EQ(sum.load(), outerSize * (innerSize * (innerSize - 1) / 2));
+}
+
+
+TEST(WorkStealingMultiThreader, ParallelizeImageRegionCoversRegion)
+{
+  // The templated overload is only visible through the base class.
+  itk::MultiThreaderBase::Pointer threader = itk::WorkStealingMultiThreader::New();
+
+  using RegionType = itk::ImageRegion<3>;
+  const RegionType region({ { 1, 2, 3 } }, { { 17, 13, 11 } });
+
+  std::atomic<itk::SizeValueType> numberOfPixels{ 0 };
+  threader->ParallelizeImageRegion<3>(
+    region,
+    [&numberOfPixels, &region](const RegionType & subregion) {
+      EXPECT_TRUE(region.IsInside(subregion));
+      numberOfPixels += subregion.GetNumberOfPixels();
+    },
+    nullptr);
+
+  EXPECT_EQ(numberOfPixels.load(), region.GetNumberOfPixels());
+}
+
+
+TEST(WorkStealingMultiThreader, RethrowsExceptionOfWorkUnit)
+{
+  auto threader = itk::WorkStealingMultiThreader::New();
+  threader->SetNumberOfWorkUnits(4);
+
+  EXPECT_THROW(threader->ParallelizeArray(
+                 0,
+                 100,
+                 [](itk::SizeValueType i) {
+                   if (i == 99)
+                   {
+                     throw std::runtime_error("Exception from the last work unit");
+                   }
+                 },
+                 nullptr),
+               std::runtime_error);
+}
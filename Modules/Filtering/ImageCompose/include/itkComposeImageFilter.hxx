@@ -19,7 +19,7 @@
 #define itkComposeImageFilter_hxx
 
 #include "itkComposeImageFilter.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageRegionRange.h"
 #include "itkTotalProgressReporter.h"
 
 namespace itk
@@ -115,9 +115,6 @@ ComposeImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const
 
   TotalProgressReporter progress(this, outputImage->GetRequestedRegion().GetNumberOfPixels());
 
-  ImageRegionIterator<OutputImageType> oit(outputImage, outputRegionForThread);
-  oit.GoToBegin();
-
   InputIteratorContainerType inputItContainer;
 
   for (unsigned int i = 0; i < this->GetNumberOfIndexedInputs(); ++i)
@@ -129,13 +126,11 @@ ComposeImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const
     inputItContainer.push_back(iit);
   }
 
-  OutputPixelType pix;
-  NumericTraits<OutputPixelType>::SetLength(pix, static_cast<unsigned int>(this->GetNumberOfIndexedInputs()));
-  while (!oit.IsAtEnd())
+  // The components are written directly into the output pixels, which are
+  // VariableLengthVectorReference objects for a VectorImage.
+  for (auto && pixel : ImageRegionRange<OutputImageType>(*outputImage, outputRegionForThread))
   {
-    ComputeOutputPixel(pix, inputItContainer);
-    oit.Set(pix);
-    ++oit;
+    ComputeOutputPixel(pixel, inputItContainer);
     progress.CompletedPixel();
   }
 }
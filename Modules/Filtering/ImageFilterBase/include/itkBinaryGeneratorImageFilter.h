@@ -20,6 +20,8 @@
 
 #include "itkInPlaceImageFilter.h"
 #include "itkSimpleDataObjectDecorator.h"
+#include "itkGeneratorImageFilterDetail.h"
+#include "itkTotalProgressReporter.h"
 
 
 #include <functional>
@@ -45,6 +47,12 @@ namespace itk
  * the pipeline. The SetConstant() and GetConstant() methods are provided as shortcuts
  * to set or get the constant value without manipulating the decorator.
  *
+ * When the input and output images store their pixels contiguously, as
+ * Image does, the functor is evaluated with a loop over the pixel
+ * buffers, which the compiler may vectorize, and a functor providing an
+ * EvaluateBatch() method evaluates whole runs of pixels of two input
+ * images at once. See GeneratorImageFilterDetail.
+ *
  * \sa UnaryGeneratorImageFilter
  * \sa BinaryFunctorImageFilter
  *
@@ -251,6 +259,39 @@ protected:
   GenerateOutputInformation() override;
 
 private:
+  /** Whether the pixels of the input and output images are stored
+   * contiguously in their buffers. */
+  using HasContiguousPixelsType =
+    std::integral_constant<bool,
+                           TInputImage1::ImageDimension == TOutputImage::ImageDimension &&
+                             TInputImage2::ImageDimension == TOutputImage::ImageDimension &&
+                             GeneratorImageFilterDetail::HasContiguousPixels<TInputImage1>::value &&
+                             GeneratorImageFilterDetail::HasContiguousPixels<TInputImage2>::value &&
+                             GeneratorImageFilterDetail::HasContiguousPixels<TOutputImage>::value>;
+
+  /** Evaluate the functor with loops over the pixel buffers, and return
+   * true, unless both inputs are missing.
+   * \sa GeneratorImageFilterDetail */
+  template <typename TFunctor>
+  bool
+  EvaluateContiguousPixels(const TFunctor &              functor,
+                           const TInputImage1 *          inputPtr1,
+                           const TInputImage2 *          inputPtr2,
+                           const OutputImageRegionType & outputRegionForThread,
+                           TotalProgressReporter &       progress,
+                           std::true_type);
+  template <typename TFunctor>
+  bool
+  EvaluateContiguousPixels(const TFunctor &,
+                           const TInputImage1 *,
+                           const TInputImage2 *,
+                           const OutputImageRegionType &,
+                           TotalProgressReporter &,
+                           std::false_type)
+  {
+    return false;
+  }
+
   std::function<void(const OutputImageRegionType &)> m_DynamicThreadedGenerateDataFunction;
 };
 } // end namespace itk
@@ -185,6 +185,12 @@ BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::DynamicThr
 
   TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
+  if (this->EvaluateContiguousPixels(
+        functor, inputPtr1, inputPtr2, outputRegionForThread, progress, HasContiguousPixelsType()))
+  {
+    return;
+  }
+
   if (inputPtr1 && inputPtr2)
   {
     ImageScanlineConstIterator<TInputImage1> inputIt1(inputPtr1, outputRegionForThread);
@@ -252,6 +258,88 @@ BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::DynamicThr
     itkGenericExceptionMacro(<< "At most one of the inputs can be a constant.");
   }
 }
+
+
+template <typename TInputImage1, typename TInputImage2, typename TOutputImage>
+template <typename TFunctor>
+bool
+BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::EvaluateContiguousPixels(
+  const TFunctor &              functor,
+  const TInputImage1 *          inputPtr1,
+  const TInputImage2 *          inputPtr2,
+  const OutputImageRegionType & outputRegionForThread,
+  TotalProgressReporter &       progress,
+  std::true_type)
+{
+  constexpr unsigned int Dimension = TOutputImage::ImageDimension;
+  using RunOffsetsType = std::array<OffsetValueType, 3>;
+
+  TOutputImage *               outputPtr = this->GetOutput(0);
+  OutputImagePixelType * const output = outputPtr->GetBufferPointer();
+
+  if (inputPtr1 && inputPtr2)
+  {
+    const Input1ImagePixelType * const input1 = inputPtr1->GetBufferPointer();
+    const Input2ImagePixelType * const input2 = inputPtr2->GetBufferPointer();
+
+    using HasEvaluateBatch = typename GeneratorImageFilterDetail::
+      HasBinaryEvaluateBatch<TFunctor, Input1ImagePixelType, Input2ImagePixelType, OutputImagePixelType>;
+
+    GeneratorImageFilterDetail::ForEachContiguousRun<Dimension, 3>(
+      { { inputPtr1, inputPtr2, outputPtr } },
+      { { outputRegionForThread, outputRegionForThread, outputRegionForThread } },
+      [&](const RunOffsetsType & offsets, SizeValueType numberOfPixels) {
+        GeneratorImageFilterDetail::EvaluateRun(functor,
+                                                input1 + offsets[0],
+                                                input2 + offsets[1],
+                                                output + offsets[2],
+                                                numberOfPixels,
+                                                HasEvaluateBatch());
+        progress.Completed(numberOfPixels);
+      });
+  }
+  else if (inputPtr1)
+  {
+    const Input1ImagePixelType * const input1 = inputPtr1->GetBufferPointer();
+    const Input2ImagePixelType &       input2Value = this->GetConstant2();
+
+    GeneratorImageFilterDetail::ForEachContiguousRun<Dimension, 2>(
+      { { inputPtr1, outputPtr } },
+      { { outputRegionForThread, outputRegionForThread } },
+      [&](const std::array<OffsetValueType, 2> & offsets, SizeValueType numberOfPixels) {
+        const Input1ImagePixelType * const runInput1 = input1 + offsets[0];
+        OutputImagePixelType * const       runOutput = output + offsets[1];
+        for (SizeValueType i = 0; i < numberOfPixels; ++i)
+        {
+          runOutput[i] = functor(runInput1[i], input2Value);
+        }
+        progress.Completed(numberOfPixels);
+      });
+  }
+  else if (inputPtr2)
+  {
+    const Input1ImagePixelType &       input1Value = this->GetConstant1();
+    const Input2ImagePixelType * const input2 = inputPtr2->GetBufferPointer();
+
+    GeneratorImageFilterDetail::ForEachContiguousRun<Dimension, 2>(
+      { { inputPtr2, outputPtr } },
+      { { outputRegionForThread, outputRegionForThread } },
+      [&](const std::array<OffsetValueType, 2> & offsets, SizeValueType numberOfPixels) {
+        const Input2ImagePixelType * const runInput2 = input2 + offsets[0];
+        OutputImagePixelType * const       runOutput = output + offsets[1];
+        for (SizeValueType i = 0; i < numberOfPixels; ++i)
+        {
+          runOutput[i] = functor(input1Value, runInput2[i]);
+        }
+        progress.Completed(numberOfPixels);
+      });
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
 } // end namespace itk
 
 #endif
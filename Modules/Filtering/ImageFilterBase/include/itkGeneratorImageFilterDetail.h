@@ -0,0 +1,222 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGeneratorImageFilterDetail_h
+#define itkGeneratorImageFilterDetail_h
+
+#include "itkDefaultPixelAccessor.h"
+#include "itkImageBase.h"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace itk
+{
+/** GeneratorImageFilterDetail namespace to house the implementation of the
+ * loops of the generator filters over raw pixel buffers.
+ *
+ * When the pixels of all the images of a generator filter are stored
+ * contiguously, as those of Image, the filter evaluates its functor with
+ * a tight loop over the pixel pointers of each run of pixels which are
+ * contiguous in all the buffers, instead of iterating with scanline
+ * iterators. Such loops are vectorized by the compiler when the functor
+ * is inlined.
+ *
+ * A functor may also evaluate a whole run at once, e.g. with SIMD
+ * instructions, by providing an EvaluateBatch() method, which the filter
+ * calls instead of operator():
+   \code
+   // UnaryGeneratorImageFilter
+   void EvaluateBatch(const TInput * input, TOutput * output, SizeValueType numberOfPixels) const;
+   // BinaryGeneratorImageFilter, when neither input is a constant
+   void EvaluateBatch(const TInput1 * input1, const TInput2 * input2, TOutput * output,
+                      SizeValueType numberOfPixels) const;
+   \endcode
+ * EvaluateBatch() must produce the same pixels as operator(). The input
+ * and output arrays are the same when the filter runs in place.
+ */
+namespace GeneratorImageFilterDetail
+{
+/** Whether the pixels of an image type are stored contiguously, without
+ * conversion, so that its buffer pointer points to its pixels. */
+template <typename TImage, typename = void>
+struct HasContiguousPixels : std::false_type
+{};
+
+/// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+template <typename TImage>
+struct HasContiguousPixels<TImage, decltype(std::declval<typename TImage::AccessorType>(), void())>
+  : std::integral_constant<
+      bool,
+      std::is_same<typename TImage::AccessorType, DefaultPixelAccessor<typename TImage::PixelType>>::value &&
+        std::is_same<typename TImage::InternalPixelType, typename TImage::PixelType>::value>
+{};
+/// \endcond
+
+/** Whether a functor has a unary EvaluateBatch() method. */
+template <typename TFunctor, typename TInput, typename TOutput, typename = void>
+struct HasUnaryEvaluateBatch : std::false_type
+{};
+
+/// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+template <typename TFunctor, typename TInput, typename TOutput>
+struct HasUnaryEvaluateBatch<TFunctor,
+                             TInput,
+                             TOutput,
+                             decltype(std::declval<const TFunctor &>().EvaluateBatch(
+                                        std::declval<const TInput *>(), std::declval<TOutput *>(), SizeValueType{}),
+                                      void())> : std::true_type
+{};
+/// \endcond
+
+/** Whether a functor has a binary EvaluateBatch() method. */
+template <typename TFunctor, typename TInput1, typename TInput2, typename TOutput, typename = void>
+struct HasBinaryEvaluateBatch : std::false_type
+{};
+
+/// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+template <typename TFunctor, typename TInput1, typename TInput2, typename TOutput>
+struct HasBinaryEvaluateBatch<TFunctor,
+                              TInput1,
+                              TInput2,
+                              TOutput,
+                              decltype(std::declval<const TFunctor &>().EvaluateBatch(std::declval<const TInput1 *>(),
+                                                                                      std::declval<const TInput2 *>(),
+                                                                                      std::declval<TOutput *>(),
+                                                                                      SizeValueType{}),
+                                       void())> : std::true_type
+{};
+/// \endcond
+
+/** Evaluate a unary functor over a run of pixels. */
+template <typename TFunctor, typename TInput, typename TOutput>
+inline void
+EvaluateRun(const TFunctor & functor,
+            const TInput *   input,
+            TOutput *        output,
+            SizeValueType    numberOfPixels,
+            std::true_type)
+{
+  functor.EvaluateBatch(input, output, numberOfPixels);
+}
+
+template <typename TFunctor, typename TInput, typename TOutput>
+inline void
+EvaluateRun(const TFunctor & functor,
+            const TInput *   input,
+            TOutput *        output,
+            SizeValueType    numberOfPixels,
+            std::false_type)
+{
+  for (SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    output[i] = functor(input[i]);
+  }
+}
+
+/** Evaluate a binary functor over a run of pixels. */
+template <typename TFunctor, typename TInput1, typename TInput2, typename TOutput>
+inline void
+EvaluateRun(const TFunctor & functor,
+            const TInput1 *  input1,
+            const TInput2 *  input2,
+            TOutput *        output,
+            SizeValueType    numberOfPixels,
+            std::true_type)
+{
+  functor.EvaluateBatch(input1, input2, output, numberOfPixels);
+}
+
+template <typename TFunctor, typename TInput1, typename TInput2, typename TOutput>
+inline void
+EvaluateRun(const TFunctor & functor,
+            const TInput1 *  input1,
+            const TInput2 *  input2,
+            TOutput *        output,
+            SizeValueType    numberOfPixels,
+            std::false_type)
+{
+  for (SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    output[i] = functor(input1[i], input2[i]);
+  }
+}
+
+/** Call runFunction(offsets, numberOfPixels) for each run of pixels which
+ * are contiguous in the buffers of all the images, where the offsets are
+ * those of the first pixel of the run in each buffer. The regions, one per
+ * image, must have the same size, and be inside the buffered regions.
+ * The runs are visited in the order of the pixels. */
+template <unsigned int VDimension, size_t VNumberOfImages, typename TRunFunction>
+void
+ForEachContiguousRun(const std::array<const ImageBase<VDimension> *, VNumberOfImages> & images,
+                     const std::array<ImageRegion<VDimension>, VNumberOfImages> &      regions,
+                     TRunFunction &&                                                   runFunction)
+{
+  const Size<VDimension> & size = regions[0].GetSize();
+  if (regions[0].GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  // A run goes along the next dimension while it covers whole lines of the
+  // buffered region of every image.
+  unsigned int  runDimension = 1;
+  SizeValueType numberOfPixelsPerRun = size[0];
+  while (runDimension < VDimension)
+  {
+    bool coversBufferedRegions = true;
+    for (size_t i = 0; i < VNumberOfImages; ++i)
+    {
+      coversBufferedRegions &= (size[runDimension - 1] == images[i]->GetBufferedRegion().GetSize(runDimension - 1));
+    }
+    if (!coversBufferedRegions)
+    {
+      break;
+    }
+    numberOfPixelsPerRun *= size[runDimension];
+    ++runDimension;
+  }
+
+  Offset<VDimension>                          position{};
+  std::array<OffsetValueType, VNumberOfImages> offsets;
+  while (true)
+  {
+    for (size_t i = 0; i < VNumberOfImages; ++i)
+    {
+      offsets[i] = images[i]->ComputeOffset(regions[i].GetIndex() + position);
+    }
+    runFunction(offsets, numberOfPixelsPerRun);
+
+    // Move to the next run, carrying to the higher dimensions.
+    unsigned int dimension = runDimension;
+    while (dimension < VDimension && static_cast<SizeValueType>(++position[dimension]) == size[dimension])
+    {
+      position[dimension] = 0;
+      ++dimension;
+    }
+    if (dimension >= VDimension)
+    {
+      return;
+    }
+  }
+}
+} // end namespace GeneratorImageFilterDetail
+} // end namespace itk
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkNeighborhoodOperator.h"
+#include "itkFixedRadiusNeighborhoodInnerProduct.h"
 #include "itkImage.h"
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 
@@ -159,6 +160,7 @@ protected:
     m_BoundsCondition = static_cast<ImageBoundaryConditionPointerType>(&m_DefaultBoundaryCondition);
     this->DynamicMultiThreadingOn();
     this->ThreaderUpdateProgressOff();
+    this->CacheBlockingOn();
   }
   ~NeighborhoodOperatorImageFilter() override = default;
 
@@ -184,6 +186,26 @@ protected:
   }
 
 private:
+  using InputImageRegionType = typename InputImageType::RegionType;
+
+  /** Whether the image types are supported by
+   * FixedRadiusNeighborhoodInnerProduct. */
+  using SupportsFixedRadiusInnerProductType = std::integral_constant<
+    bool,
+    FixedRadiusNeighborhoodInnerProduct<InputImageType, OperatorValueType, ComputingPixelType>::
+      template SupportsImageTypes<OutputImageType>()>;
+
+  /** Computes the output pixels of a region whose neighborhoods are inside
+   * the input buffer with FixedRadiusNeighborhoodInnerProduct, and returns
+   * true, unless the operator is not supported. */
+  bool
+  EvaluateFixedRadiusInnerProducts(const InputImageRegionType & region, std::true_type);
+  bool
+  EvaluateFixedRadiusInnerProducts(const InputImageRegionType &, std::false_type)
+  {
+    return false;
+  }
+
   /** Internal operator used to filter the image. */
   OutputNeighborhoodType m_Operator;
 
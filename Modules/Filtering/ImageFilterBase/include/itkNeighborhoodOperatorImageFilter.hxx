@@ -84,8 +84,6 @@ NeighborhoodOperatorImageFilter<TInputImage, TOutputImage, TOperatorValueType>::
   using FaceListType = typename BFC::FaceListType;
 
   NeighborhoodInnerProduct<InputImageType, OperatorValueType, ComputingPixelType> smartInnerProduct;
-  BFC                                                                             faceCalculator;
-  FaceListType                                                                    faceList;
 
   OutputImageType *      output = this->GetOutput();
   const InputImageType * input = this->GetInput();
@@ -95,13 +93,30 @@ NeighborhoodOperatorImageFilter<TInputImage, TOutputImage, TOperatorValueType>::
   // we pass in the input image and the OUTPUT requested region. We are
   // only concerned with centering the neighborhood operator at the
   // pixels that correspond to output pixels.
-  faceList = faceCalculator(input, outputRegionForThread, m_Operator.GetRadius());
+  const auto result = BFC::Compute(*input, outputRegionForThread, m_Operator.GetRadius());
+  if (result == typename BFC::Result{})
+  {
+    return;
+  }
+
+  TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
+
+  // The pixels of the non-boundary region are computed with the unrolled
+  // loops of FixedRadiusNeighborhoodInnerProduct when the operator is small.
+  FaceListType faceList = result.GetBoundaryFaces();
+  const auto   nonBoundaryRegion = result.GetNonBoundaryRegion();
+  if (this->EvaluateFixedRadiusInnerProducts(nonBoundaryRegion, SupportsFixedRadiusInnerProductType()))
+  {
+    progress.Completed(nonBoundaryRegion.GetNumberOfPixels());
+  }
+  else
+  {
+    faceList.push_front(nonBoundaryRegion);
+  }
 
   typename FaceListType::iterator      fit;
   ImageRegionIterator<OutputImageType> it;
 
-  TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
-
   // Process non-boundary region and each of the boundary faces.
   // These are N-d regions which border the edge of the buffer.
   ConstNeighborhoodIterator<InputImageType> bit;
@@ -120,6 +135,22 @@ NeighborhoodOperatorImageFilter<TInputImage, TOutputImage, TOperatorValueType>::
     }
   }
 }
+
+template <typename TInputImage, typename TOutputImage, typename TOperatorValueType>
+bool
+NeighborhoodOperatorImageFilter<TInputImage, TOutputImage, TOperatorValueType>::EvaluateFixedRadiusInnerProducts(
+  const InputImageRegionType & region,
+  std::true_type)
+{
+  using InnerProductType = FixedRadiusNeighborhoodInnerProduct<InputImageType, OperatorValueType, ComputingPixelType>;
+
+  if (!InnerProductType::IsSupported(m_Operator))
+  {
+    return false;
+  }
+  InnerProductType::Evaluate(*this->GetInput(), m_Operator, *this->GetOutput(), region);
+  return true;
+}
 } // end namespace itk
 
 #endif
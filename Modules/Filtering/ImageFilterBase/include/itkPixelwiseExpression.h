@@ -0,0 +1,210 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPixelwiseExpression_h
+#define itkPixelwiseExpression_h
+
+#include "itkUnaryGeneratorImageFilter.h"
+#include "itkBinaryGeneratorImageFilter.h"
+#include "itkTernaryGeneratorImageFilter.h"
+
+#include <tuple>
+#include <utility>
+
+namespace itk
+{
+namespace Functor
+{
+/** \class Composition
+ * \brief Applies a functor to the result of another functor.
+ *
+ * The inner functor takes the first VInnerArity arguments. The outer
+ * functor takes the result of the inner functor, followed by the
+ * remaining arguments:
+ * \code
+ * composition(a, b, c) == outer(inner(a), b, c) // VInnerArity == 1
+ * \endcode
+ *
+ * \ingroup ITKImageFilterBase
+ */
+template <typename TOuter, typename TInner, unsigned int VInnerArity>
+class Composition
+{
+public:
+  Composition() = default;
+
+  Composition(const TOuter & outer, const TInner & inner)
+    : m_Outer(outer)
+    , m_Inner(inner)
+  {}
+
+  template <typename... TArguments>
+  auto
+  operator()(const TArguments &... arguments) const
+  {
+    static_assert(sizeof...(TArguments) >= VInnerArity, "The inner functor takes more arguments than provided.");
+    return this->Apply(std::make_index_sequence<VInnerArity>(),
+                       std::make_index_sequence<sizeof...(TArguments) - VInnerArity>(),
+                       std::forward_as_tuple(arguments...));
+  }
+
+  const TOuter &
+  GetOuter() const
+  {
+    return m_Outer;
+  }
+
+  const TInner &
+  GetInner() const
+  {
+    return m_Inner;
+  }
+
+private:
+  template <size_t... VInnerIndices, size_t... VOuterIndices, typename TTuple>
+  auto
+  Apply(std::index_sequence<VInnerIndices...>, std::index_sequence<VOuterIndices...>, const TTuple & arguments) const
+  {
+    return m_Outer(m_Inner(std::get<VInnerIndices>(arguments)...), std::get<VInnerArity + VOuterIndices>(arguments)...);
+  }
+
+  TOuter m_Outer{};
+  TInner m_Inner{};
+};
+} // end namespace Functor
+
+
+/** \class PixelwiseExpression
+ * \brief Builds a chain of pixel-wise operations evaluated in one pass.
+ *
+ * A pipeline of pixel-wise filters, such as a rescaling followed by a
+ * clamping, a sigmoid and a multiplication by a mask, writes a full-size
+ * intermediate image at every stage and reads it back at the next one.
+ * PixelwiseExpression composes the functors of the stages instead, and
+ * creates a single UnaryGeneratorImageFilter, BinaryGeneratorImageFilter
+ * or TernaryGeneratorImageFilter which evaluates the whole chain for
+ * each pixel, writing only its output image:
+ * \code
+ * itk::Functor::Clamp<float, float> clamp;
+ * clamp.SetBounds(-10.0f, 10.0f);
+ * auto filter = itk::MakePixelwiseExpression(clamp)
+ *                 .Then(itk::Functor::Sigmoid<float, float>())
+ *                 .Then<1>(itk::Functor::Mult<float, unsigned char, float>())
+ *                 .CreateBinaryFilter<FloatImageType, MaskImageType, FloatImageType>();
+ * filter->SetInput1(image);
+ * filter->SetInput2(mask);
+ * \endcode
+ *
+ * The arity of an expression is the number of pixel values it takes.
+ * Then<N>(functor) applies a functor to the result of the expression and
+ * to N more pixel values, which are taken from the next inputs of the
+ * filter, or from the constants set on them. The composed functor is a
+ * concrete type, so that the stages are inlined into the loop of the
+ * generator filter.
+ *
+ * The result of each stage is passed to the next one as the type returned
+ * by its functor, whereas the unfused pipeline converts it to the pixel
+ * type of the intermediate image. With functors returning the pixel types
+ * of the intermediate images, as the functors of the ITK pixel-wise
+ * filters do, the fused filter produces the same output.
+ *
+ * \sa Functor::Composition
+ * \ingroup ITKImageFilterBase
+ */
+template <typename TFunctor, unsigned int VArity = 1>
+class PixelwiseExpression
+{
+public:
+  using FunctorType = TFunctor;
+
+  /** The number of pixel values taken by the expression. */
+  static constexpr unsigned int Arity = VArity;
+
+  explicit PixelwiseExpression(const TFunctor & functor = TFunctor())
+    : m_Functor(functor)
+  {}
+
+  const TFunctor &
+  GetFunctor() const
+  {
+    return m_Functor;
+  }
+
+  /** Apply a functor to the result of this expression, followed by
+   * VAdditionalArity more pixel values. Functions are stored as function
+   * pointers. */
+  template <unsigned int VAdditionalArity = 0, typename TOuter>
+  PixelwiseExpression<Functor::Composition<TOuter, TFunctor, VArity>, VArity + VAdditionalArity>
+  Then(TOuter outer) const
+  {
+    return PixelwiseExpression<Functor::Composition<TOuter, TFunctor, VArity>, VArity + VAdditionalArity>(
+      Functor::Composition<TOuter, TFunctor, VArity>(outer, m_Functor));
+  }
+
+  /** Create a filter evaluating this expression of one pixel value. */
+  template <typename TInputImage, typename TOutputImage = TInputImage>
+  typename UnaryGeneratorImageFilter<TInputImage, TOutputImage>::Pointer
+  CreateUnaryFilter() const
+  {
+    static_assert(VArity == 1, "The expression does not take one pixel value.");
+    const auto filter = UnaryGeneratorImageFilter<TInputImage, TOutputImage>::New();
+    filter->SetFunctor(m_Functor);
+    return filter;
+  }
+
+  /** Create a filter evaluating this expression of two pixel values. */
+  template <typename TInputImage1, typename TInputImage2, typename TOutputImage = TInputImage1>
+  typename BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::Pointer
+  CreateBinaryFilter() const
+  {
+    static_assert(VArity == 2, "The expression does not take two pixel values.");
+    const auto filter = BinaryGeneratorImageFilter<TInputImage1, TInputImage2, TOutputImage>::New();
+    filter->SetFunctor(m_Functor);
+    return filter;
+  }
+
+  /** Create a filter evaluating this expression of three pixel values. */
+  template <typename TInputImage1,
+            typename TInputImage2,
+            typename TInputImage3,
+            typename TOutputImage = TInputImage1>
+  typename TernaryGeneratorImageFilter<TInputImage1, TInputImage2, TInputImage3, TOutputImage>::Pointer
+  CreateTernaryFilter() const
+  {
+    static_assert(VArity == 3, "The expression does not take three pixel values.");
+    const auto filter = TernaryGeneratorImageFilter<TInputImage1, TInputImage2, TInputImage3, TOutputImage>::New();
+    filter->SetFunctor(m_Functor);
+    return filter;
+  }
+
+private:
+  TFunctor m_Functor;
+};
+
+
+/** Make an expression from the functor of its first stage, taking VArity
+ * pixel values. Functions are stored as function pointers. */
+template <unsigned int VArity = 1, typename TFunctor>
+PixelwiseExpression<TFunctor, VArity>
+MakePixelwiseExpression(TFunctor functor)
+{
+  return PixelwiseExpression<TFunctor, VArity>(functor);
+}
+
+} // end namespace itk
+
+#endif
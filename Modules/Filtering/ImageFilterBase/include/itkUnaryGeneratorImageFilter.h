@@ -21,6 +21,8 @@
 #include "itkMath.h"
 #include "itkInPlaceImageFilter.h"
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkGeneratorImageFilterDetail.h"
+#include "itkTotalProgressReporter.h"
 
 #include <functional>
 
@@ -45,6 +47,12 @@ namespace itk
  * UnaryGeneratorImageFilter can be used to promote a 2D image to a 3D
  * image, etc.
  *
+ * When the input and output images store their pixels contiguously, as
+ * Image does, the functor is evaluated with a loop over the pixel
+ * buffers, which the compiler may vectorize, and a functor providing an
+ * EvaluateBatch() method evaluates whole runs of pixels at once. See
+ * GeneratorImageFilterDetail.
+ *
  * \sa UnaryFunctorImageFilter
  * \sa BinaryGeneratorImageFilter TernaryGeneratormageFilter
  *
@@ -183,6 +191,35 @@ protected:
   DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
+  /** Whether the pixels of the input and output images are stored
+   * contiguously in their buffers. */
+  using HasContiguousPixelsType =
+    std::integral_constant<bool,
+                           TInputImage::ImageDimension == TOutputImage::ImageDimension &&
+                             GeneratorImageFilterDetail::HasContiguousPixels<TInputImage>::value &&
+                             GeneratorImageFilterDetail::HasContiguousPixels<TOutputImage>::value>;
+
+  /** Evaluate the functor with loops over the pixel buffers, and return
+   * true, unless the input and output regions have different sizes.
+   * \sa GeneratorImageFilterDetail */
+  template <typename TFunctor>
+  bool
+  EvaluateContiguousPixels(const TFunctor &              functor,
+                           const InputImageRegionType &  inputRegionForThread,
+                           const OutputImageRegionType & outputRegionForThread,
+                           TotalProgressReporter &       progress,
+                           std::true_type);
+  template <typename TFunctor>
+  bool
+  EvaluateContiguousPixels(const TFunctor &,
+                           const InputImageRegionType &,
+                           const OutputImageRegionType &,
+                           TotalProgressReporter &,
+                           std::false_type)
+  {
+    return false;
+  }
+
   std::function<void(const OutputImageRegionType &)> m_DynamicThreadedGenerateDataFunction;
 };
 } // end namespace itk
@@ -104,6 +104,12 @@ UnaryGeneratorImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDat
 
   this->CallCopyOutputRegionToInputRegion(inputRegionForThread, outputRegionForThread);
 
+  if (this->EvaluateContiguousPixels(
+        functor, inputRegionForThread, outputRegionForThread, progress, HasContiguousPixelsType()))
+  {
+    return;
+  }
+
   // Define the iterators
   ImageScanlineConstIterator<TInputImage> inputIt(inputPtr, inputRegionForThread);
   ImageScanlineIterator<TOutputImage>     outputIt(outputPtr, outputRegionForThread);
@@ -123,6 +129,42 @@ UnaryGeneratorImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDat
     outputIt.NextLine();
   }
 }
+
+
+template <typename TInputImage, typename TOutputImage>
+template <typename TFunctor>
+bool
+UnaryGeneratorImageFilter<TInputImage, TOutputImage>::EvaluateContiguousPixels(
+  const TFunctor &              functor,
+  const InputImageRegionType &  inputRegionForThread,
+  const OutputImageRegionType & outputRegionForThread,
+  TotalProgressReporter &       progress,
+  std::true_type)
+{
+  if (inputRegionForThread.GetSize() != outputRegionForThread.GetSize())
+  {
+    return false;
+  }
+
+  const TInputImage * inputPtr = this->GetInput();
+  TOutputImage *      outputPtr = this->GetOutput(0);
+
+  const InputImagePixelType * const input = inputPtr->GetBufferPointer();
+  OutputImagePixelType * const      output = outputPtr->GetBufferPointer();
+
+  using HasEvaluateBatch =
+    typename GeneratorImageFilterDetail::HasUnaryEvaluateBatch<TFunctor, InputImagePixelType, OutputImagePixelType>;
+
+  GeneratorImageFilterDetail::ForEachContiguousRun<TOutputImage::ImageDimension, 2>(
+    { { inputPtr, outputPtr } },
+    { { inputRegionForThread, outputRegionForThread } },
+    [&](const std::array<OffsetValueType, 2> & offsets, SizeValueType numberOfPixels) {
+      GeneratorImageFilterDetail::EvaluateRun(
+        functor, input + offsets[0], output + offsets[1], numberOfPixels, HasEvaluateBatch());
+      progress.Completed(numberOfPixels);
+    });
+  return true;
+}
 } // end namespace itk
 
 #endif
@@ -19,11 +19,19 @@
 #include "itkUnaryGeneratorImageFilter.h"
 #include "itkBinaryGeneratorImageFilter.h"
 #include "itkTernaryGeneratorImageFilter.h"
+#include "itkPixelwiseExpression.h"
+#include "itkArithmeticOpsFunctors.h"
+#include "itkMultiplyImageFilter.h"
+#include "itkSqrtImageFilter.h"
 #include "itkImage.h"
 #include "itkImageRegionIterator.h"
 
 #include "itkGTest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
 
 namespace
 {
@@ -92,6 +100,38 @@ struct Utilities
 };
 
 
+// Evaluates runs of pixels, counting the pixels it evaluates in batches.
+struct BatchFunctor
+{
+  float
+  operator()(float p) const
+  {
+    return 2 * p + 1;
+  }
+
+  float
+  operator()(float p1, float p2) const
+  {
+    return p1 - p2;
+  }
+
+  void
+  EvaluateBatch(const float * input, float * output, itk::SizeValueType numberOfPixels) const
+  {
+    std::transform(input, input + numberOfPixels, output, *this);
+    *m_NumberOfBatchPixels += numberOfPixels;
+  }
+
+  void
+  EvaluateBatch(const float * input1, const float * input2, float * output, itk::SizeValueType numberOfPixels) const
+  {
+    std::transform(input1, input1 + numberOfPixels, input2, output, *this);
+    *m_NumberOfBatchPixels += numberOfPixels;
+  }
+
+  std::atomic<itk::SizeValueType> * m_NumberOfBatchPixels;
+};
+
 } // namespace
 
 
@@ -444,3 +484,206 @@ TEST(TernaryGeneratorImageFilter, Constants)
 
   EXPECT_NEAR(103.0, outputImage->GetPixel(idx), 1e-8);
 }
+
+
+TEST(PixelwiseExpression, MatchesPipelineOfGeneratorFilters)
+{
+  using Utils = Utilities<3, float>;
+  using MaskImageType = itk::Image<unsigned char, 3>;
+
+  auto image = Utils::CreateImage();
+  itk::ImageRegionIterator<Utils::ImageType> it(image, image->GetBufferedRegion());
+  for (float value = -3.0f; !it.IsAtEnd(); ++it, value += 0.125f)
+  {
+    it.Set(value);
+  }
+
+  auto mask = MaskImageType::New();
+  mask->SetRegions(image->GetBufferedRegion());
+  mask->Allocate();
+  itk::ImageRegionIterator<MaskImageType> maskIt(mask, mask->GetBufferedRegion());
+  for (unsigned char value = 0; !maskIt.IsAtEnd(); ++maskIt, ++value)
+  {
+    maskIt.Set(value % 2);
+  }
+
+  const auto shiftScale = [](float v) -> float { return 2.0f * (v + 0.5f); };
+  const auto clamp = [](float v) -> float { return std::max(-1.0f, std::min(v, 1.0f)); };
+  const auto sigmoid = [](float v) -> float { return static_cast<float>(1.0 / (1.0 + std::exp(-v))); };
+
+  // The pipeline materializing every intermediate image.
+  using UnaryFilterType = itk::UnaryGeneratorImageFilter<Utils::ImageType, Utils::ImageType>;
+  auto shiftScaleFilter = UnaryFilterType::New();
+  shiftScaleFilter->SetFunctor(shiftScale);
+  shiftScaleFilter->SetInput(image);
+  auto clampFilter = UnaryFilterType::New();
+  clampFilter->SetFunctor(clamp);
+  clampFilter->SetInput(shiftScaleFilter->GetOutput());
+  auto sigmoidFilter = UnaryFilterType::New();
+  sigmoidFilter->SetFunctor(sigmoid);
+  sigmoidFilter->SetInput(clampFilter->GetOutput());
+  auto multiplyFilter = itk::MultiplyImageFilter<Utils::ImageType, MaskImageType, Utils::ImageType>::New();
+  multiplyFilter->SetInput1(sigmoidFilter->GetOutput());
+  multiplyFilter->SetInput2(mask);
+  multiplyFilter->Update();
+
+  // The same chain, evaluated in one pass.
+  auto fusedFilter = itk::MakePixelwiseExpression(shiftScale)
+                       .Then(clamp)
+                       .Then(sigmoid)
+                       .Then<1>(itk::Functor::Mult<float, unsigned char, float>())
+                       .CreateBinaryFilter<Utils::ImageType, MaskImageType, Utils::ImageType>();
+  fusedFilter->SetInput1(image);
+  fusedFilter->SetInput2(mask);
+  fusedFilter->Update();
+
+  itk::ImageRegionIterator<Utils::ImageType> expectedIt(multiplyFilter->GetOutput(), image->GetBufferedRegion());
+  itk::ImageRegionIterator<Utils::ImageType> fusedIt(fusedFilter->GetOutput(), image->GetBufferedRegion());
+  for (; !expectedIt.IsAtEnd(); ++expectedIt, ++fusedIt)
+  {
+    EXPECT_EQ(fusedIt.Get(), expectedIt.Get());
+  }
+}
+
+
+TEST(PixelwiseExpression, TakesAdditionalPixelValuesAtEachStage)
+{
+  using Utils = Utilities<2, float>;
+
+  auto image = Utils::CreateImage();
+  image->FillBuffer(1.0);
+
+  const auto expression = itk::MakePixelwiseExpression(Utils::MyUnaryFunction)
+                            .Then<1>(Utils::MyBinaryFunction1)
+                            .Then<1>([](float v, float w) { return v * w; });
+  static_assert(decltype(expression)::Arity == 3, "Unexpected arity");
+
+  // ((1 + 10) + 3 * 2) * 4
+  auto filter = expression.CreateTernaryFilter<Utils::ImageType, Utils::ImageType, Utils::ImageType>();
+  filter->SetInput1(image);
+  filter->SetConstant2(2.0);
+  filter->SetConstant3(4.0);
+  EXPECT_NO_THROW(filter->Update());
+
+  Utils::IndexType idx;
+  idx.Fill(0);
+  EXPECT_EQ(filter->GetOutput()->GetPixel(idx), 68.0f);
+
+  // A binary first stage.
+  auto binaryFilter = itk::MakePixelwiseExpression<2>(Utils::MyBinaryFunction2)
+                        .Then(Utils::MyUnaryFunction)
+                        .CreateBinaryFilter<Utils::ImageType, Utils::ImageType>();
+  binaryFilter->SetInput1(image);
+  binaryFilter->SetConstant2(3.0);
+  EXPECT_NO_THROW(binaryFilter->Update());
+  EXPECT_EQ(binaryFilter->GetOutput()->GetPixel(idx), 15.0f);
+}
+
+
+TEST(UnaryGeneratorImageFilter, EvaluatesContiguousRuns)
+{
+  using Utils = Utilities<3, float>;
+  using FilterType = itk::UnaryGeneratorImageFilter<Utils::ImageType, Utils::ImageType>;
+
+  const auto                      image = Utils::CreateImage();
+  std::atomic<itk::SizeValueType> numberOfBatchPixels{ 0 };
+
+  auto filter = FilterType::New();
+  filter->SetInput(image);
+  filter->SetFunctor(BatchFunctor{ &numberOfBatchPixels });
+  filter->Update();
+  EXPECT_EQ(numberOfBatchPixels, image->GetBufferedRegion().GetNumberOfPixels());
+
+  // The runs of a requested region which does not cover whole lines.
+  const Utils::ImageType::RegionType region({ { 1, 0, 2 } }, { { 3, 5, 2 } });
+  numberOfBatchPixels = 0;
+  filter->GetOutput()->SetRequestedRegion(region);
+  filter->Modified();
+  filter->Update();
+  EXPECT_EQ(numberOfBatchPixels, region.GetNumberOfPixels());
+
+  itk::ImageRegionConstIterator<Utils::ImageType> inputIt(image, region);
+  itk::ImageRegionConstIterator<Utils::ImageType> outputIt(filter->GetOutput(), region);
+  for (; !inputIt.IsAtEnd(); ++inputIt, ++outputIt)
+  {
+    EXPECT_EQ(outputIt.Get(), 2 * inputIt.Get() + 1);
+  }
+}
+
+
+TEST(BinaryGeneratorImageFilter, EvaluatesContiguousRuns)
+{
+  using Utils = Utilities<2, float>;
+  using FilterType = itk::BinaryGeneratorImageFilter<Utils::ImageType, Utils::ImageType, Utils::ImageType>;
+
+  const auto                      image1 = Utils::CreateImage();
+  const auto                      image2 = Utils::CreateImage();
+  std::atomic<itk::SizeValueType> numberOfBatchPixels{ 0 };
+  image2->FillBuffer(3.0);
+
+  auto filter = FilterType::New();
+  filter->SetInput1(image1);
+  filter->SetInput2(image2);
+  filter->SetFunctor(BatchFunctor{ &numberOfBatchPixels });
+  filter->GetOutput()->SetRequestedRegion(Utils::ImageType::RegionType({ { 1, 1 } }, { { 4, 3 } }));
+  filter->Update();
+  EXPECT_EQ(numberOfBatchPixels, 12u);
+
+  Utils::IndexType idx{ { 2, 3 } };
+  EXPECT_EQ(filter->GetOutput()->GetPixel(idx), image1->GetPixel(idx) - 3.0f);
+
+  // Constants are not evaluated in batches.
+  numberOfBatchPixels = 0;
+  filter->SetConstant1(10.0);
+  filter->GetOutput()->SetRequestedRegion(image1->GetBufferedRegion());
+  filter->Update();
+  EXPECT_EQ(numberOfBatchPixels, 0u);
+  EXPECT_EQ(filter->GetOutput()->GetPixel(idx), 7.0f);
+}
+
+
+TEST(SqrtImageFilter, EvaluateBatchMatchesOperator)
+{
+  itk::Functor::Sqrt<float, float> sqrtFunctor;
+
+  std::vector<float> input(1001);
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    input[i] = 0.37f * static_cast<float>(i * i);
+  }
+  std::vector<float> output(input.size());
+  sqrtFunctor.EvaluateBatch(input.data() + 1, output.data() + 1, input.size() - 1);
+  for (size_t i = 1; i < input.size(); ++i)
+  {
+    EXPECT_EQ(output[i], sqrtFunctor(input[i]));
+  }
+
+  // Every unsigned short, computed in single precision.
+  itk::Functor::Sqrt<unsigned short, float> shortSqrtFunctor;
+  std::vector<unsigned short>               shorts(65536);
+  for (size_t i = 0; i < shorts.size(); ++i)
+  {
+    shorts[i] = static_cast<unsigned short>(i);
+  }
+  std::vector<float> shortOutput(shorts.size());
+  shortSqrtFunctor.EvaluateBatch(shorts.data(), shortOutput.data(), shorts.size());
+  size_t numberOfMismatches = 0;
+  for (size_t i = 0; i < shorts.size(); ++i)
+  {
+    numberOfMismatches += (shortOutput[i] != shortSqrtFunctor(shorts[i]));
+  }
+  EXPECT_EQ(numberOfMismatches, 0u);
+
+  // In place, as the filter does when running in place.
+  itk::Functor::Sqrt<unsigned short, unsigned short> integerSqrtFunctor;
+  std::vector<unsigned short>                        values(256);
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = static_cast<unsigned short>(i * i);
+  }
+  integerSqrtFunctor.EvaluateBatch(values.data(), values.data(), values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(values[i], i);
+  }
+}
@@ -35,6 +35,7 @@ GradientMagnitudeImageFilter<TInputImage, TOutputImage>::GradientMagnitudeImageF
 {
   this->DynamicMultiThreadingOn();
   this->ThreaderUpdateProgressOff();
+  this->CacheBlockingOn();
 }
 
 template <typename TInputImage, typename TOutputImage>
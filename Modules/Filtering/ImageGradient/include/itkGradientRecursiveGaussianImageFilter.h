@@ -25,7 +25,9 @@
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkProgressAccumulator.h"
 #include "itkImageRegionIterator.h"
+#include "itkImageRegionRange.h"
 #include "itkVectorImage.h"
+#include <algorithm>
 #include <vector>
 
 namespace itk
@@ -197,22 +199,27 @@ protected:
 private:
   template <typename TValue>
   void
-  TransformOutputPixel(ImageRegionIterator<VectorImage<TValue, ImageDimension>> & it)
+  TransformOutputPixel(const VectorImage<TValue, ImageDimension> & image, VariableLengthVectorReference<TValue> pixel)
   {
-    // To transform Variable length vector we need to convert to and
-    // fro the CovariantVectorType
-    const CovariantVectorType gradient(it.Get().GetDataPointer());
-    CovariantVectorType       physicalGradient;
-    it.GetImage()->TransformLocalVectorToPhysicalVector(gradient, physicalGradient);
-    it.Set(OutputPixelType(physicalGradient.GetDataPointer(), ImageDimension, false));
+    // Transform each component gradient in place, through the reference to
+    // the components of the pixel, which does not copy them.
+    const unsigned int nComponents = pixel.Size() / ImageDimension;
+
+    for (unsigned int nc = 0; nc < nComponents; ++nc)
+    {
+      TValue * const            componentGradient = pixel.GetDataPointer() + nc * ImageDimension;
+      const CovariantVectorType gradient(componentGradient);
+      CovariantVectorType       physicalGradient;
+      image.TransformLocalVectorToPhysicalVector(gradient, physicalGradient);
+      std::copy_n(physicalGradient.GetDataPointer(), ImageDimension, componentGradient);
+    }
   }
 
   template <typename T>
   void
-  TransformOutputPixel(ImageRegionIterator<T> & it)
+  TransformOutputPixel(const T & image, OutputPixelType & pixel)
   {
-    OutputPixelType         correctedGradient;
-    const OutputPixelType & gradient = it.Get();
+    const OutputPixelType gradient = pixel;
 
     const unsigned int nComponents = NumericTraits<OutputPixelType>::GetLength(gradient) / ImageDimension;
 
@@ -225,23 +232,22 @@ private:
         componentGradient[dim] =
           DefaultConvertPixelTraits<OutputPixelType>::GetNthComponent(nc * ImageDimension + dim, gradient);
       }
-      it.GetImage()->TransformLocalVectorToPhysicalVector(componentGradient, correctedComponentGradient);
+      image.TransformLocalVectorToPhysicalVector(componentGradient, correctedComponentGradient);
       for (unsigned int dim = 0; dim < ImageDimension; ++dim)
       {
         DefaultConvertPixelTraits<OutputPixelType>::SetNthComponent(
-          nc * ImageDimension + dim, correctedGradient, correctedComponentGradient[dim]);
+          nc * ImageDimension + dim, pixel, correctedComponentGradient[dim]);
       }
     }
-    it.Set(correctedGradient);
   }
 
   template <template <typename, unsigned int> class P, class T, unsigned int N>
   void
-  TransformOutputPixel(ImageRegionIterator<Image<P<T, N>, N>> & it)
+  TransformOutputPixel(const Image<P<T, N>, N> & image, OutputPixelType & pixel)
   {
-    const OutputPixelType gradient = it.Get();
+    const OutputPixelType gradient = pixel;
     // This uses the more efficient set by reference method
-    it.GetImage()->TransformLocalVectorToPhysicalVector(gradient, it.Value());
+    image.TransformLocalVectorToPhysicalVector(gradient, pixel);
   }
 
 
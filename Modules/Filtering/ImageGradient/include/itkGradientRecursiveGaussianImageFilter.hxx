@@ -293,8 +293,10 @@ GradientRecursiveGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
       ot.GoToBegin();
       while (!it.IsAtEnd())
       {
+        // Divide the component, rather than the whole pixel, to not allocate
+        // a variable length vector per pixel.
         auto outValue = static_cast<OutputComponentType>(
-          DefaultConvertPixelTraits<InternalRealType>::GetNthComponent(nc, it.Get() / spacing));
+          DefaultConvertPixelTraits<InternalRealType>::GetNthComponent(nc, it.Get()) / spacing);
         ot.Set(outValue);
         ++it;
         ++ot;
@@ -318,15 +320,11 @@ GradientRecursiveGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
   // of the output gradient image.
   if (this->m_UseImageDirection)
   {
+    const OutputImageType & gradientImage = *outputImage;
 
-    OutputImageType *                    gradientImage = outputImage;
-    ImageRegionIterator<OutputImageType> itr(gradientImage, gradientImage->GetRequestedRegion());
-
-    while (!itr.IsAtEnd())
+    for (auto && pixel : ImageRegionRange<OutputImageType>(*outputImage, outputImage->GetRequestedRegion()))
     {
-
-      TransformOutputPixel(itr);
-      ++itr;
+      TransformOutputPixel(gradientImage, pixel);
     }
   }
 }
@@ -18,16 +18,151 @@
 #ifndef itkLabelStatisticsImageFilter_h
 #define itkLabelStatisticsImageFilter_h
 
-#include "itkImageSink.h"
+#include "itkImageReduceFilter.h"
 #include "itkNumericTraits.h"
 #include "itkSimpleDataObjectDecorator.h"
 #include "itkHistogram.h"
-#include <mutex>
 #include <unordered_map>
 #include <vector>
 
 namespace itk
 {
+namespace LabelStatisticsImageFilterDetail
+{
+/** \class LabelStatistics
+ * \brief Statistics stored per label
+ * \ingroup ITKImageStatistics
+ */
+template <typename TRealType, unsigned int VImageDimension>
+class LabelStatistics
+{
+public:
+  using RealType = TRealType;
+  using BoundingBoxType = std::vector<IndexValueType>;
+  using HistogramType = itk::Statistics::Histogram<RealType>;
+
+  // default constructor
+  LabelStatistics()
+  {
+    // initialized to the default values
+    m_Count = NumericTraits<IdentifierType>::ZeroValue();
+    m_Sum = NumericTraits<RealType>::ZeroValue();
+    m_SumOfSquares = NumericTraits<RealType>::ZeroValue();
+
+    // Set such that the first pixel encountered can be compared
+    m_Minimum = NumericTraits<RealType>::max();
+    m_Maximum = NumericTraits<RealType>::NonpositiveMin();
+
+    // Default these to zero
+    m_Mean = NumericTraits<RealType>::ZeroValue();
+    m_Sigma = NumericTraits<RealType>::ZeroValue();
+    m_Variance = NumericTraits<RealType>::ZeroValue();
+
+    const unsigned int imageDimension = VImageDimension;
+    m_BoundingBox.resize(imageDimension * 2);
+    for (unsigned int i = 0; i < imageDimension * 2; i += 2)
+    {
+      m_BoundingBox[i] = NumericTraits<IndexValueType>::max();
+      m_BoundingBox[i + 1] = NumericTraits<IndexValueType>::NonpositiveMin();
+    }
+    m_Histogram = nullptr;
+  }
+
+  // constructor with histogram enabled
+  LabelStatistics(int size, RealType lowerBound, RealType upperBound)
+  {
+    // initialized to the default values
+    m_Count = NumericTraits<IdentifierType>::ZeroValue();
+    m_Sum = NumericTraits<RealType>::ZeroValue();
+    m_SumOfSquares = NumericTraits<RealType>::ZeroValue();
+
+    // Set such that the first pixel encountered can be compared
+    m_Minimum = NumericTraits<RealType>::max();
+    m_Maximum = NumericTraits<RealType>::NonpositiveMin();
+
+    // Default these to zero
+    m_Mean = NumericTraits<RealType>::ZeroValue();
+    m_Sigma = NumericTraits<RealType>::ZeroValue();
+    m_Variance = NumericTraits<RealType>::ZeroValue();
+
+    const unsigned int imageDimension = VImageDimension;
+    m_BoundingBox.resize(imageDimension * 2);
+    for (unsigned int i = 0; i < imageDimension * 2; i += 2)
+    {
+      m_BoundingBox[i] = NumericTraits<IndexValueType>::max();
+      m_BoundingBox[i + 1] = NumericTraits<IndexValueType>::NonpositiveMin();
+    }
+
+    // Histogram
+    m_Histogram = HistogramType::New();
+    typename HistogramType::SizeType              hsize;
+    typename HistogramType::MeasurementVectorType lb;
+    typename HistogramType::MeasurementVectorType ub;
+    hsize.SetSize(1);
+    lb.SetSize(1);
+    ub.SetSize(1);
+    m_Histogram->SetMeasurementVectorSize(1);
+    hsize[0] = size;
+    lb[0] = lowerBound;
+    ub[0] = upperBound;
+    m_Histogram->Initialize(hsize, lb, ub);
+  }
+
+  // need copy constructor because of smart pointer to histogram
+  LabelStatistics(const LabelStatistics & l)
+  {
+    m_Count = l.m_Count;
+    m_Minimum = l.m_Minimum;
+    m_Maximum = l.m_Maximum;
+    m_Mean = l.m_Mean;
+    m_Sum = l.m_Sum;
+    m_SumOfSquares = l.m_SumOfSquares;
+    m_Sigma = l.m_Sigma;
+    m_Variance = l.m_Variance;
+    m_BoundingBox = l.m_BoundingBox;
+    m_Histogram = l.m_Histogram;
+  }
+
+  LabelStatistics(LabelStatistics &&) = default;
+
+  // added for completeness
+  LabelStatistics &
+  operator=(const LabelStatistics & l)
+  {
+    if (this != &l)
+    {
+      m_Count = l.m_Count;
+      m_Minimum = l.m_Minimum;
+      m_Maximum = l.m_Maximum;
+      m_Mean = l.m_Mean;
+      m_Sum = l.m_Sum;
+      m_SumOfSquares = l.m_SumOfSquares;
+      m_Sigma = l.m_Sigma;
+      m_Variance = l.m_Variance;
+      m_BoundingBox = l.m_BoundingBox;
+      m_Histogram = l.m_Histogram;
+    }
+    return *this;
+  }
+
+  IdentifierType                  m_Count;
+  RealType                        m_Minimum;
+  RealType                        m_Maximum;
+  RealType                        m_Mean;
+  RealType                        m_Sum;
+  RealType                        m_SumOfSquares;
+  RealType                        m_Sigma;
+  RealType                        m_Variance;
+  BoundingBoxType                 m_BoundingBox;
+  typename HistogramType::Pointer m_Histogram;
+};
+
+/** The statistics of the labels of a block of pixels, accumulated by
+ * LabelStatisticsImageFilter. */
+template <typename TLabelPixel, typename TRealType, unsigned int VImageDimension>
+using Accumulator = std::unordered_map<TLabelPixel, LabelStatistics<TRealType, VImageDimension>>;
+} // end namespace LabelStatisticsImageFilterDetail
+
 /** \class LabelStatisticsImageFilter
  * \brief Given an intensity image and a label map, compute min, max, variance and mean of the pixels associated with
  * each label or segment
@@ -48,8 +183,11 @@ namespace itk
  *
  * This filter is automatically multi-threaded and can stream its
  * input when NumberOfStreamDivisions is set to more than
- * 1. Statistics are independently computed for each streamed and
- * threaded region then merged.
+ * 1. Statistics are independently computed for blocks of each
+ * streamed region then merged, see ImageReduceFilter. A region is split
+ * into at most 16 blocks by default, which bounds the memory of the
+ * statistics and histograms of the blocks. As the blocks do not depend on
+ * the number of work units, neither do the statistics.
  *
  * \ingroup MathematicalStatisticsImageFilters
  * \ingroup ITKImageStatistics
@@ -59,14 +197,23 @@ namespace itk
  * \endsphinx
  */
 template <typename TInputImage, typename TLabelImage>
-class ITK_TEMPLATE_EXPORT LabelStatisticsImageFilter : public ImageSink<TInputImage>
+class ITK_TEMPLATE_EXPORT LabelStatisticsImageFilter
+  : public ImageReduceFilter<
+      TInputImage,
+      LabelStatisticsImageFilterDetail::Accumulator<typename TLabelImage::PixelType,
+                                                    typename NumericTraits<typename TInputImage::PixelType>::RealType,
+                                                    TInputImage::ImageDimension>>
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(LabelStatisticsImageFilter);
 
   /** Standard Self type alias */
   using Self = LabelStatisticsImageFilter;
-  using Superclass = ImageSink<TInputImage>;
+  using Superclass = ImageReduceFilter<
+    TInputImage,
+    LabelStatisticsImageFilterDetail::Accumulator<typename TLabelImage::PixelType,
+                                                  typename NumericTraits<typename TInputImage::PixelType>::RealType,
+                                                  TInputImage::ImageDimension>>;
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
@@ -110,128 +257,8 @@ public:
   using HistogramType = itk::Statistics::Histogram<RealType>;
   using HistogramPointer = typename HistogramType::Pointer;
 
-  /** \class LabelStatistics
-   * \brief Statistics stored per label
-   * \ingroup ITKImageStatistics
-   */
-  class LabelStatistics
-  {
-  public:
-    // default constructor
-    LabelStatistics()
-    {
-      // initialized to the default values
-      m_Count = NumericTraits<IdentifierType>::ZeroValue();
-      m_Sum = NumericTraits<RealType>::ZeroValue();
-      m_SumOfSquares = NumericTraits<RealType>::ZeroValue();
-
-      // Set such that the first pixel encountered can be compared
-      m_Minimum = NumericTraits<RealType>::max();
-      m_Maximum = NumericTraits<RealType>::NonpositiveMin();
-
-      // Default these to zero
-      m_Mean = NumericTraits<RealType>::ZeroValue();
-      m_Sigma = NumericTraits<RealType>::ZeroValue();
-      m_Variance = NumericTraits<RealType>::ZeroValue();
-
-      const unsigned int imageDimension = Self::ImageDimension;
-      m_BoundingBox.resize(imageDimension * 2);
-      for (unsigned int i = 0; i < imageDimension * 2; i += 2)
-      {
-        m_BoundingBox[i] = NumericTraits<IndexValueType>::max();
-        m_BoundingBox[i + 1] = NumericTraits<IndexValueType>::NonpositiveMin();
-      }
-      m_Histogram = nullptr;
-    }
-
-    // constructor with histogram enabled
-    LabelStatistics(int size, RealType lowerBound, RealType upperBound)
-    {
-      // initialized to the default values
-      m_Count = NumericTraits<IdentifierType>::ZeroValue();
-      m_Sum = NumericTraits<RealType>::ZeroValue();
-      m_SumOfSquares = NumericTraits<RealType>::ZeroValue();
-
-      // Set such that the first pixel encountered can be compared
-      m_Minimum = NumericTraits<RealType>::max();
-      m_Maximum = NumericTraits<RealType>::NonpositiveMin();
-
-      // Default these to zero
-      m_Mean = NumericTraits<RealType>::ZeroValue();
-      m_Sigma = NumericTraits<RealType>::ZeroValue();
-      m_Variance = NumericTraits<RealType>::ZeroValue();
-
-      const unsigned int imageDimension = Self::ImageDimension;
-      m_BoundingBox.resize(imageDimension * 2);
-      for (unsigned int i = 0; i < imageDimension * 2; i += 2)
-      {
-        m_BoundingBox[i] = NumericTraits<IndexValueType>::max();
-        m_BoundingBox[i + 1] = NumericTraits<IndexValueType>::NonpositiveMin();
-      }
-
-      // Histogram
-      m_Histogram = HistogramType::New();
-      typename HistogramType::SizeType              hsize;
-      typename HistogramType::MeasurementVectorType lb;
-      typename HistogramType::MeasurementVectorType ub;
-      hsize.SetSize(1);
-      lb.SetSize(1);
-      ub.SetSize(1);
-      m_Histogram->SetMeasurementVectorSize(1);
-      hsize[0] = size;
-      lb[0] = lowerBound;
-      ub[0] = upperBound;
-      m_Histogram->Initialize(hsize, lb, ub);
-    }
-
-    // need copy constructor because of smart pointer to histogram
-    LabelStatistics(const LabelStatistics & l)
-    {
-      m_Count = l.m_Count;
-      m_Minimum = l.m_Minimum;
-      m_Maximum = l.m_Maximum;
-      m_Mean = l.m_Mean;
-      m_Sum = l.m_Sum;
-      m_SumOfSquares = l.m_SumOfSquares;
-      m_Sigma = l.m_Sigma;
-      m_Variance = l.m_Variance;
-      m_BoundingBox = l.m_BoundingBox;
-      m_Histogram = l.m_Histogram;
-    }
-
-    LabelStatistics(LabelStatistics &&) = default;
-
-    // added for completeness
-    LabelStatistics &
-    operator=(const LabelStatistics & l)
-    {
-      if (this != &l)
-      {
-        m_Count = l.m_Count;
-        m_Minimum = l.m_Minimum;
-        m_Maximum = l.m_Maximum;
-        m_Mean = l.m_Mean;
-        m_Sum = l.m_Sum;
-        m_SumOfSquares = l.m_SumOfSquares;
-        m_Sigma = l.m_Sigma;
-        m_Variance = l.m_Variance;
-        m_BoundingBox = l.m_BoundingBox;
-        m_Histogram = l.m_Histogram;
-      }
-      return *this;
-    }
-
-    IdentifierType                  m_Count;
-    RealType                        m_Minimum;
-    RealType                        m_Maximum;
-    RealType                        m_Mean;
-    RealType                        m_Sum;
-    RealType                        m_SumOfSquares;
-    RealType                        m_Sigma;
-    RealType                        m_Variance;
-    BoundingBoxType                 m_BoundingBox;
-    typename HistogramType::Pointer m_Histogram;
-  };
+  /** Statistics stored per label */
+  using LabelStatistics = LabelStatisticsImageFilterDetail::LabelStatistics<RealType, ImageDimension>;
 
   /** Type of the map used to store data per label */
   using MapType = std::unordered_map<LabelPixelType, LabelStatistics>;
@@ -369,11 +396,17 @@ protected:
   AfterStreamedGenerateData() override;
 
   void
-  ThreadedStreamedGenerateData(const RegionType &) override;
+  AccumulateRegion(const RegionType & region, MapType & accumulator) override;
+
+  void
+  MergeAccumulators(MapType & accumulator, MapType & other) override;
 
 private:
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
+  /** \deprecated Use MergeAccumulators() instead. */
   void
-  MergeMap(MapType &, MapType &) const;
+  MergeMap(MapType & m1, MapType & m2) const;
+#endif
 
   MapType                       m_LabelStatistics;
   ValidLabelValuesContainerType m_ValidLabelValues;
@@ -385,8 +418,6 @@ private:
   RealType m_LowerBound;
   RealType m_UpperBound;
 
-  std::mutex m_Mutex;
-
 }; // end of class
 } // end namespace itk
 
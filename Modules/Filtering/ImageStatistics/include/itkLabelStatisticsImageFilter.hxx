@@ -36,6 +36,9 @@ LabelStatisticsImageFilter<TInputImage, TLabelImage>::LabelStatisticsImageFilter
   m_LowerBound = static_cast<RealType>(NumericTraits<PixelType>::NonpositiveMin());
   m_UpperBound = static_cast<RealType>(NumericTraits<PixelType>::max());
   m_ValidLabelValues.clear();
+
+  // Each block holds the statistics, and the histograms, of its labels.
+  this->SetMaximumNumberOfBlocks(16);
 }
 
 template <typename TInputImage, typename TLabelImage>
@@ -51,9 +54,19 @@ LabelStatisticsImageFilter<TInputImage, TLabelImage>::SetHistogramParameters(con
 }
 
 
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
 template <typename TInputImage, typename TLabelImage>
 void
 LabelStatisticsImageFilter<TInputImage, TLabelImage>::MergeMap(MapType & m1, MapType & m2) const
+{
+  // MergeAccumulators() does not modify the filter.
+  const_cast<Self *>(this)->MergeAccumulators(m1, m2);
+}
+#endif
+
+template <typename TInputImage, typename TLabelImage>
+void
+LabelStatisticsImageFilter<TInputImage, TLabelImage>::MergeAccumulators(MapType & m1, MapType & m2)
 {
 
   for (auto & m2_value : m2)
@@ -119,6 +132,9 @@ LabelStatisticsImageFilter<TInputImage, TLabelImage>::AfterStreamedGenerateData(
 {
   Superclass::AfterStreamedGenerateData();
 
+  m_LabelStatistics = std::move(this->GetAccumulator());
+  this->GetAccumulator().clear();
+
   // compute the remainder of the statistics
   for (auto & mapValue : m_LabelStatistics)
   {
@@ -162,24 +178,21 @@ LabelStatisticsImageFilter<TInputImage, TLabelImage>::AfterStreamedGenerateData(
 
 template <typename TInputImage, typename TLabelImage>
 void
-LabelStatisticsImageFilter<TInputImage, TLabelImage>::ThreadedStreamedGenerateData(
-  const RegionType & outputRegionForThread)
+LabelStatisticsImageFilter<TInputImage, TLabelImage>::AccumulateRegion(const RegionType & region,
+                                                                       MapType &          localStatistics)
 {
-
-  MapType localStatistics;
-
   typename HistogramType::IndexType             histogramIndex(1);
   typename HistogramType::MeasurementVectorType histogramMeasurement(1);
 
-  const SizeValueType size0 = outputRegionForThread.GetSize(0);
+  const SizeValueType size0 = region.GetSize(0);
   if (size0 == 0)
   {
     return;
   }
 
-  ImageLinearConstIteratorWithIndex<TInputImage> it(this->GetInput(), outputRegionForThread);
+  ImageLinearConstIteratorWithIndex<TInputImage> it(this->GetInput(), region);
 
-  ImageScanlineConstIterator<TLabelImage> labelIt(this->GetLabelInput(), outputRegionForThread);
+  ImageScanlineConstIterator<TLabelImage> labelIt(this->GetLabelInput(), region);
 
   auto mapIt = localStatistics.end();
 
@@ -252,35 +265,6 @@ LabelStatisticsImageFilter<TInputImage, TLabelImage>::ThreadedStreamedGenerateDa
     labelIt.NextLine();
     it.NextLine();
   }
-
-
-  // Merge localStatistics and m_LabelStatistics concurrently safe in a
-  // local copy, this thread may do multiple merges.
-  while (true)
-  {
-
-    {
-      std::unique_lock<std::mutex> lock(m_Mutex);
-
-      if (m_LabelStatistics.empty())
-      {
-        swap(m_LabelStatistics, localStatistics);
-        break;
-      }
-      else
-      {
-        // copy the output map to thread local storage
-        MapType tomerge;
-        swap(m_LabelStatistics, tomerge);
-
-        // allow other threads to merge data
-        lock.unlock();
-
-        // Merge tomerge into localStatistics, locally
-        MergeMap(localStatistics, tomerge);
-      }
-    } // release lock
-  }
 }
 
 template <typename TInputImage, typename TLabelImage>
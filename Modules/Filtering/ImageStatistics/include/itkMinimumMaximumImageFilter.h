@@ -18,11 +18,10 @@
 #ifndef itkMinimumMaximumImageFilter_h
 #define itkMinimumMaximumImageFilter_h
 
-#include "itkImageSink.h"
+#include "itkImageReduceFilter.h"
 #include "itkSimpleDataObjectDecorator.h"
-#include <mutex>
 
-#include <vector>
+#include <utility>
 
 #include "itkNumericTraits.h"
 
@@ -36,8 +35,8 @@ namespace itk
  *
  * This filter is automatically multi-threaded and can stream its
  * input when NumberOfStreamDivisions is set to more than
- * 1. The extrema are independently computed for each streamed and
- * threaded region then merged.
+ * 1. The extrema are independently computed for blocks of each
+ * streamed region then merged, see ImageReduceFilter.
  *
  *
  * \ingroup Operators
@@ -45,7 +44,8 @@ namespace itk
  * \ingroup ITKImageStatistics
  */
 template <typename TInputImage>
-class ITK_TEMPLATE_EXPORT MinimumMaximumImageFilter : public ImageSink<TInputImage>
+class ITK_TEMPLATE_EXPORT MinimumMaximumImageFilter
+  : public ImageReduceFilter<TInputImage, std::pair<typename TInputImage::PixelType, typename TInputImage::PixelType>>
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(MinimumMaximumImageFilter);
@@ -55,7 +55,8 @@ public:
 
   /** Standard class type aliases. */
   using Self = MinimumMaximumImageFilter;
-  using Superclass = ImageSink<TInputImage>;
+  using Superclass =
+    ImageReduceFilter<TInputImage, std::pair<typename TInputImage::PixelType, typename TInputImage::PixelType>>;
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
@@ -67,6 +68,9 @@ public:
   using IndexType = typename TInputImage::IndexType;
   using PixelType = typename TInputImage::PixelType;
 
+  /** The minimum and the maximum of a block of pixels. */
+  using AccumulatorType = typename Superclass::AccumulatorType;
+
   /** Smart Pointer type to a DataObject. */
   using DataObjectPointer = typename DataObject::Pointer;
 
@@ -123,27 +127,22 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
-  /** Initialize some accumulators before any chunks are processes */
+  /** Set the outputs to the extrema accumulated from the blocks. */
   void
-  BeforeStreamedGenerateData() override;
+  AfterStreamedGenerateData() override;
+
+  AccumulatorType
+  MakeAccumulator() override;
 
-  /** Do final mean and variance computation from data accumulated in threads.
-   */
   void
-  AfterStreamedGenerateData() override;
+  AccumulateRegion(const RegionType & region, AccumulatorType & accumulator) override;
 
   void
-  ThreadedStreamedGenerateData(const RegionType &) override;
+  MergeAccumulators(AccumulatorType & accumulator, AccumulatorType & other) override;
 
 
   itkSetDecoratedOutputMacro(Minimum, PixelType);
   itkSetDecoratedOutputMacro(Maximum, PixelType);
-
-private:
-  PixelType m_ThreadMin;
-  PixelType m_ThreadMax;
-
-  std::mutex m_Mutex;
 };
 } // end namespace itk
 
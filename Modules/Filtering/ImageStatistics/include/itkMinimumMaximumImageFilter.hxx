@@ -21,9 +21,6 @@
 
 
 #include "itkImageScanlineIterator.h"
-#include <mutex>
-
-#include <vector>
 
 namespace itk
 {
@@ -47,44 +44,41 @@ MinimumMaximumImageFilter<TInputImage>::MakeOutput(const DataObjectIdentifierTyp
 
 template <typename TInputImage>
 void
-MinimumMaximumImageFilter<TInputImage>::BeforeStreamedGenerateData()
+MinimumMaximumImageFilter<TInputImage>::AfterStreamedGenerateData()
 {
-  Superclass::BeforeStreamedGenerateData();
+  Superclass::AfterStreamedGenerateData();
 
-  m_ThreadMin = NumericTraits<PixelType>::max();
-  m_ThreadMax = NumericTraits<PixelType>::NonpositiveMin();
+  this->SetMinimum(this->GetAccumulator().first);
+  this->SetMaximum(this->GetAccumulator().second);
 }
 
 template <typename TInputImage>
-void
-MinimumMaximumImageFilter<TInputImage>::AfterStreamedGenerateData()
+auto
+MinimumMaximumImageFilter<TInputImage>::MakeAccumulator() -> AccumulatorType
 {
-  Superclass::AfterStreamedGenerateData();
-
-  this->SetMinimum(m_ThreadMin);
-  this->SetMaximum(m_ThreadMax);
+  return AccumulatorType(NumericTraits<PixelType>::max(), NumericTraits<PixelType>::NonpositiveMin());
 }
 
 template <typename TInputImage>
 void
-MinimumMaximumImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionType & regionForThread)
+MinimumMaximumImageFilter<TInputImage>::AccumulateRegion(const RegionType & region, AccumulatorType & accumulator)
 {
-  if (regionForThread.GetNumberOfPixels() == 0)
+  if (region.GetNumberOfPixels() == 0)
   {
     return;
   }
 
-  PixelType localMin = NumericTraits<PixelType>::max();
-  PixelType localMax = NumericTraits<PixelType>::NonpositiveMin();
+  PixelType localMin = accumulator.first;
+  PixelType localMax = accumulator.second;
 
-  ImageScanlineConstIterator<TInputImage> it(this->GetInput(), regionForThread);
+  ImageScanlineConstIterator<TInputImage> it(this->GetInput(), region);
 
 
   // do the work
   while (!it.IsAtEnd())
   {
     // Handle the odd pixel separately
-    if (regionForThread.GetSize(0) % 2 == 1)
+    if (region.GetSize(0) % 2 == 1)
     {
       const PixelType value = it.Get();
       localMin = std::min(value, localMin);
@@ -113,9 +107,16 @@ MinimumMaximumImageFilter<TInputImage>::ThreadedStreamedGenerateData(const Regio
     it.NextLine();
   }
 
-  std::lock_guard<std::mutex> mutexHolder(m_Mutex);
-  m_ThreadMin = std::min(localMin, m_ThreadMin);
-  m_ThreadMax = std::max(localMax, m_ThreadMax);
+  accumulator.first = localMin;
+  accumulator.second = localMax;
+}
+
+template <typename TInputImage>
+void
+MinimumMaximumImageFilter<TInputImage>::MergeAccumulators(AccumulatorType & accumulator, AccumulatorType & other)
+{
+  accumulator.first = std::min(accumulator.first, other.first);
+  accumulator.second = std::max(accumulator.second, other.second);
 }
 
 template <typename TImage>
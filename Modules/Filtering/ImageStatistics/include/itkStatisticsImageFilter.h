@@ -18,15 +18,31 @@
 #ifndef itkStatisticsImageFilter_h
 #define itkStatisticsImageFilter_h
 
-#include "itkImageSink.h"
+#include "itkImageReduceFilter.h"
 #include "itkNumericTraits.h"
 #include "itkArray.h"
 #include "itkSimpleDataObjectDecorator.h"
-#include <mutex>
 #include "itkCompensatedSummation.h"
 
 namespace itk
 {
+namespace StatisticsImageFilterDetail
+{
+/** The statistics of a block of pixels, accumulated by
+ * StatisticsImageFilter. */
+template <typename TPixel>
+struct Accumulator
+{
+  using RealType = typename NumericTraits<TPixel>::RealType;
+
+  CompensatedSummation<RealType> m_Sum;
+  CompensatedSummation<RealType> m_SumOfSquares;
+  SizeValueType                  m_Count{ 0 };
+  TPixel                         m_Minimum{ NumericTraits<TPixel>::max() };
+  TPixel                         m_Maximum{ NumericTraits<TPixel>::NonpositiveMin() };
+};
+} // end namespace StatisticsImageFilterDetail
+
 /** \class StatisticsImageFilter
  * \brief Compute min, max, variance and mean of an Image.
  *
@@ -38,11 +54,12 @@ namespace itk
  *
  * This filter is automatically multi-threaded and can stream its
  * input when NumberOfStreamDivisions is set to more than
- * one. Statistics are independently computed for each streamed and
- * threaded region then merged.
+ * one. Statistics are independently computed for blocks of each
+ * streamed region then merged, see ImageReduceFilter.
  *
  * Internally a compensated summation algorithm is used for the
  * accumulation of intensities to improve accuracy for large images.
+ * The sums do not depend on the number of threads.
  *
  * \ingroup MathematicalStatisticsImageFilters
  * \ingroup ITKImageStatistics
@@ -52,14 +69,16 @@ namespace itk
  * Image} \endsphinx
  */
 template <typename TInputImage>
-class ITK_TEMPLATE_EXPORT StatisticsImageFilter : public ImageSink<TInputImage>
+class ITK_TEMPLATE_EXPORT StatisticsImageFilter
+  : public ImageReduceFilter<TInputImage, StatisticsImageFilterDetail::Accumulator<typename TInputImage::PixelType>>
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(StatisticsImageFilter);
 
   /** Standard Self type alias */
   using Self = StatisticsImageFilter;
-  using Superclass = ImageSink<TInputImage>;
+  using Superclass =
+    ImageReduceFilter<TInputImage, StatisticsImageFilterDetail::Accumulator<typename TInputImage::PixelType>>;
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
@@ -83,6 +102,9 @@ public:
   /** Type to use for computations. */
   using RealType = typename NumericTraits<PixelType>::RealType;
 
+  /** The statistics of a block of pixels. */
+  using AccumulatorType = typename Superclass::AccumulatorType;
+
   /** Smart Pointer type to a DataObject. */
   using DataObjectPointer = typename DataObject::Pointer;
 
@@ -143,17 +165,16 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
-  /** Initialize some accumulators before the threads run. */
-  void
-  BeforeStreamedGenerateData() override;
-
   /** Set outputs to computed values from all regions
    */
   void
   AfterStreamedGenerateData() override;
 
   void
-  ThreadedStreamedGenerateData(const RegionType &) override;
+  AccumulateRegion(const RegionType & region, AccumulatorType & accumulator) override;
+
+  void
+  MergeAccumulators(AccumulatorType & accumulator, AccumulatorType & other) override;
 
   itkSetDecoratedOutputMacro(Minimum, PixelType);
   itkSetDecoratedOutputMacro(Maximum, PixelType);
@@ -162,16 +183,6 @@ protected:
   itkSetDecoratedOutputMacro(Variance, RealType);
   itkSetDecoratedOutputMacro(Sum, RealType);
   itkSetDecoratedOutputMacro(SumOfSquares, RealType);
-
-private:
-  CompensatedSummation<RealType> m_ThreadSum{ 1 };
-  CompensatedSummation<RealType> m_SumOfSquares{ 1 };
-
-  SizeValueType m_Count{ 1 };
-  PixelType     m_ThreadMin{ 1 };
-  PixelType     m_ThreadMax{ 1 };
-
-  std::mutex m_Mutex;
 }; // end of class
 } // end namespace itk
 
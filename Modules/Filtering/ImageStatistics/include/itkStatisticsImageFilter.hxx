@@ -21,7 +21,6 @@
 
 
 #include "itkImageScanlineIterator.h"
-#include <mutex>
 
 namespace itk
 {
@@ -54,31 +53,18 @@ StatisticsImageFilter<TInputImage>::MakeOutput(const DataObjectIdentifierType &
   return Superclass::MakeOutput(name);
 }
 
-template <typename TInputImage>
-void
-StatisticsImageFilter<TInputImage>::BeforeStreamedGenerateData()
-{
-  Superclass::BeforeStreamedGenerateData();
-
-  // Resize the thread temporaries
-  m_Count = NumericTraits<SizeValueType>::ZeroValue();
-  m_SumOfSquares = NumericTraits<RealType>::ZeroValue();
-  m_ThreadSum = NumericTraits<RealType>::ZeroValue();
-  m_ThreadMin = NumericTraits<PixelType>::max();
-  m_ThreadMax = NumericTraits<PixelType>::NonpositiveMin();
-}
-
 template <typename TInputImage>
 void
 StatisticsImageFilter<TInputImage>::AfterStreamedGenerateData()
 {
   Superclass::AfterStreamedGenerateData();
 
-  const SizeValueType count = m_Count;
-  const RealType      sumOfSquares(m_SumOfSquares);
-  const PixelType     minimum = m_ThreadMin;
-  const PixelType     maximum = m_ThreadMax;
-  const RealType      sum(m_ThreadSum);
+  const AccumulatorType & accumulator = this->GetAccumulator();
+  const SizeValueType     count = accumulator.m_Count;
+  const RealType          sumOfSquares(accumulator.m_SumOfSquares);
+  const PixelType         minimum = accumulator.m_Minimum;
+  const PixelType         maximum = accumulator.m_Maximum;
+  const RealType          sum(accumulator.m_Sum);
 
   const RealType mean = sum / static_cast<RealType>(count);
   const RealType variance =
@@ -97,16 +83,15 @@ StatisticsImageFilter<TInputImage>::AfterStreamedGenerateData()
 
 template <typename TInputImage>
 void
-StatisticsImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionType & regionForThread)
+StatisticsImageFilter<TInputImage>::AccumulateRegion(const RegionType & region, AccumulatorType & accumulator)
 {
+  CompensatedSummation<RealType> sum = accumulator.m_Sum;
+  CompensatedSummation<RealType> sumOfSquares = accumulator.m_SumOfSquares;
+  SizeValueType                  count = accumulator.m_Count;
+  PixelType                      min = accumulator.m_Minimum;
+  PixelType                      max = accumulator.m_Maximum;
 
-  CompensatedSummation<RealType> sum = NumericTraits<RealType>::ZeroValue();
-  CompensatedSummation<RealType> sumOfSquares = NumericTraits<RealType>::ZeroValue();
-  SizeValueType                  count = NumericTraits<SizeValueType>::ZeroValue();
-  PixelType                      min = NumericTraits<PixelType>::max();
-  PixelType                      max = NumericTraits<PixelType>::NonpositiveMin();
-
-  ImageScanlineConstIterator<TInputImage> it(this->GetInput(), regionForThread);
+  ImageScanlineConstIterator<TInputImage> it(this->GetInput(), region);
 
   // do the work
   while (!it.IsAtEnd())
@@ -126,12 +111,22 @@ StatisticsImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionTyp
     it.NextLine();
   }
 
-  std::lock_guard<std::mutex> mutexHolder(m_Mutex);
-  m_ThreadSum += sum;
-  m_SumOfSquares += sumOfSquares;
-  m_Count += count;
-  m_ThreadMin = std::min(min, m_ThreadMin);
-  m_ThreadMax = std::max(max, m_ThreadMax);
+  accumulator.m_Sum = sum;
+  accumulator.m_SumOfSquares = sumOfSquares;
+  accumulator.m_Count = count;
+  accumulator.m_Minimum = min;
+  accumulator.m_Maximum = max;
+}
+
+template <typename TInputImage>
+void
+StatisticsImageFilter<TInputImage>::MergeAccumulators(AccumulatorType & accumulator, AccumulatorType & other)
+{
+  accumulator.m_Sum += other.m_Sum;
+  accumulator.m_SumOfSquares += other.m_SumOfSquares;
+  accumulator.m_Count += other.m_Count;
+  accumulator.m_Minimum = std::min(accumulator.m_Minimum, other.m_Minimum);
+  accumulator.m_Maximum = std::max(accumulator.m_Maximum, other.m_Maximum);
 }
 
 template <typename TImage>
@@ -140,8 +135,7 @@ StatisticsImageFilter<TImage>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
 
-  os << indent << "Count: " << static_cast<typename NumericTraits<SizeValueType>::PrintType>(this->m_Count)
-     << std::endl;
+  os << indent << "Count: " << this->GetAccumulator().m_Count << std::endl;
   os << indent << "Minimum: " << static_cast<typename NumericTraits<PixelType>::PrintType>(this->GetMinimum())
      << std::endl;
   os << indent << "Maximum: " << static_cast<typename NumericTraits<PixelType>::PrintType>(this->GetMaximum())
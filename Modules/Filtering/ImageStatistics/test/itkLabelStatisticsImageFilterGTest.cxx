@@ -0,0 +1,75 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkLabelStatisticsImageFilter.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+
+TEST(LabelStatisticsImageFilter, StatisticsDoNotDependOnNumberOfWorkUnits)
+{
+  using ImageType = itk::Image<float, 2>;
+  using LabelImageType = itk::Image<unsigned char, 2>;
+  using FilterType = itk::LabelStatisticsImageFilter<ImageType, LabelImageType>;
+
+  const ImageType::RegionType region(ImageType::SizeType{ { 256, 256 } });
+  auto                        image = ImageType::New();
+  image->SetRegions(region);
+  image->Allocate();
+  auto labelImage = LabelImageType::New();
+  labelImage->SetRegions(region);
+  labelImage->Allocate();
+
+  // Values of different magnitudes, so that the rounding of the sums
+  // depends on the order in which they are added.
+  auto randomGenerator = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  randomGenerator->SetSeed(42);
+  itk::ImageRegionIterator<ImageType>      it(image, region);
+  itk::ImageRegionIterator<LabelImageType> labelIt(labelImage, region);
+  for (; !it.IsAtEnd(); ++it, ++labelIt)
+  {
+    it.Set(static_cast<float>(randomGenerator->GetNormalVariate(0.0, 1e8)));
+    labelIt.Set(static_cast<unsigned char>(randomGenerator->GetIntegerVariate(4)));
+  }
+
+  const auto computeStatistics = [&image, &labelImage](itk::ThreadIdType numberOfWorkUnits) {
+    auto filter = FilterType::New();
+    filter->SetInput(image);
+    filter->SetLabelInput(labelImage);
+    filter->SetNumberOfWorkUnits(numberOfWorkUnits);
+    filter->Update();
+    return filter;
+  };
+  const FilterType::Pointer serial = computeStatistics(1);
+  const FilterType::Pointer parallel = computeStatistics(7);
+
+  ASSERT_EQ(serial->GetNumberOfLabels(), 5u);
+  ASSERT_EQ(parallel->GetNumberOfLabels(), 5u);
+  for (const auto label : serial->GetValidLabelValues())
+  {
+    EXPECT_EQ(serial->GetCount(label), parallel->GetCount(label));
+    EXPECT_EQ(serial->GetSum(label), parallel->GetSum(label));
+    EXPECT_EQ(serial->GetMean(label), parallel->GetMean(label));
+    EXPECT_EQ(serial->GetVariance(label), parallel->GetVariance(label));
+    EXPECT_EQ(serial->GetMinimum(label), parallel->GetMinimum(label));
+    EXPECT_EQ(serial->GetMaximum(label), parallel->GetMaximum(label));
+  }
+}
@@ -34,6 +34,7 @@ template <typename TInputImage, typename TOutputImage>
 MeanImageFilter<TInputImage, TOutputImage>::MeanImageFilter()
 {
   this->DynamicMultiThreadingOn();
+  this->CacheBlockingOn();
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -129,3 +129,30 @@ TEST(MeanImageFilter, ExpectedOutputPixelValuesForSequenceOfNaturalNumbers)
   Expect_output_has_specified_pixel_values_when_input_has_sequence_of_natural_numbers<itk::Image<int, 3>>(
     itk::Size<3>{ { 2, 2, 2 } }, { 3, 3, 4, 4, 4, 5, 5, 5 });
 }
+
+
+// Tests that processing the output by cache-sized tiles yields the same output as processing it by slabs.
+TEST(MeanImageFilter, CacheBlockingDoesNotChangeOutput)
+{
+  using ImageType = itk::Image<float, 3>;
+
+  const auto inputImage = CreateImageFilledWithSequenceOfNaturalNumbers<ImageType>(itk::Size<3>{ { 37, 29, 23 } });
+
+  const auto filter = itk::MeanImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(inputImage);
+  filter->SetRadius(2);
+  EXPECT_TRUE(filter->GetCacheBlocking());
+
+  // Small enough to have many tiles.
+  filter->SetCacheBlockSize(4096);
+  filter->Update();
+  const auto               tiledOutputRange = itk::MakeImageBufferRange(filter->GetOutput());
+  const std::vector<float> tiledOutputPixelValues(tiledOutputRange.cbegin(), tiledOutputRange.cend());
+
+  filter->CacheBlockingOff();
+  filter->Update();
+  const auto               outputRange = itk::MakeImageBufferRange(filter->GetOutput());
+  const std::vector<float> outputPixelValues(outputRange.cbegin(), outputRange.cend());
+
+  EXPECT_EQ(tiledOutputPixelValues, outputPixelValues);
+}
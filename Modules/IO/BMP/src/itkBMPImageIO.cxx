@@ -48,6 +48,8 @@ BMPImageIO::BMPImageIO()
     this->AddSupportedWriteExtension(ext);
     this->AddSupportedReadExtension(ext);
   }
+
+  this->AddSupportedReadSignature(0, "BM");
 }
 
 /** Destructor */
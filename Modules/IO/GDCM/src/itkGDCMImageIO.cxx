@@ -842,7 +842,7 @@ GDCMImageIO::Write(const void * buffer)
   const gdcm::Dicts &         dicts = g.GetDicts();
   const gdcm::Dict &          pubdict = dicts.GetPublicDict();
 
-  MetaDataDictionary & dict = this->GetMetaDataDictionary();
+  const MetaDataDictionary & dict = this->GetMetaDataDictionary();
 
   gdcm::Tag tag;
 
@@ -1092,8 +1092,8 @@ HDF5ImageIO ::WriteImageInformation()
     this->m_H5File->createGroup(MetaDataGroupName);
     //
     // MetaData.
-    MetaDataDictionary & metaDict = this->GetMetaDataDictionary();
-    auto                 it = metaDict.Begin(), end = metaDict.End();
+    const MetaDataDictionary & metaDict = this->GetMetaDataDictionary();
+    auto                       it = metaDict.Begin(), end = metaDict.End();
     for (; it != end; ++it)
     {
       MetaDataObjectBase * metaObj = it->second.GetPointer();
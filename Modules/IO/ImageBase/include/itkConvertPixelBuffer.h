@@ -69,6 +69,15 @@ public:
                      OutputPixelType * outputData,
                      size_t            size);
 
+  /** Converts interleaved components to the planes of the components of a
+   * PlanarVectorImage: the component k of the pixel i is written at
+   * k * size + i. */
+  static void
+  ConvertVectorImageToPlanar(InputPixelType *  inputData,
+                             int               inputNumberOfComponents,
+                             OutputPixelType * outputData,
+                             size_t            size);
+
 protected:
   /** Convert to Gray output. */
   /** Input values are cast to output values. */
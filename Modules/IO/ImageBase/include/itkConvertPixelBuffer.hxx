@@ -598,6 +598,28 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
     ++inputData;
   }
 }
+
+template <typename InputPixelType, typename OutputPixelType, typename OutputConvertTraits>
+void
+ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::ConvertVectorImageToPlanar(
+  InputPixelType *  inputData,
+  int               inputNumberOfComponents,
+  OutputPixelType * outputData,
+  size_t            size)
+{
+  const auto numberOfComponents = static_cast<size_t>(inputNumberOfComponents);
+
+  for (size_t k = 0; k < numberOfComponents; ++k)
+  {
+    const InputPixelType * input = inputData + k;
+    OutputPixelType *      output = outputData + k * size;
+    for (size_t i = 0; i < size; ++i)
+    {
+      OutputConvertTraits::SetNthComponent(0, output[i], static_cast<OutputComponentType>(*input));
+      input += numberOfComponents;
+    }
+  }
+}
 } // end namespace itk
 
 #endif
@@ -118,6 +118,18 @@ public:
   itkGetConstReferenceMacro(UseStreaming, bool);
   itkBooleanMacro(UseStreaming);
 
+  /** Set/Get whether the pixel buffer of the output maps the pixel data of
+   * the file rather than holding a copy of them, when the ImageIO reports
+   * that they are stored raw (see ImageIOBase::GetPixelDataFileLocation())
+   * and no conversion is needed, and their offset in the file is aligned
+   * for the pixel components. The pages of the file are then read ahead of
+   * the accesses to the requested region. Pixels written to the buffer do not modify the
+   * file. Defaults to false.
+   * \sa MemoryMappedImageBufferAllocator */
+  itkSetMacro(UseMemoryMapping, bool);
+  itkGetConstMacro(UseMemoryMapping, bool);
+  itkBooleanMacro(UseMemoryMapping);
+
 protected:
   ImageFileReader();
   ~ImageFileReader() override = default;
@@ -153,6 +165,11 @@ protected:
   void
   GenerateData() override;
 
+  /** Allocate the output as a mapping of the pixel data of the file, when
+   * they can be mapped. Returns false otherwise. */
+  bool
+  MapOutput();
+
   ImageIOBase::Pointer m_ImageIO;
 
   bool m_UserSpecifiedImageIO; // keep track whether the
@@ -160,6 +177,8 @@ protected:
 
   bool m_UseStreaming;
 
+  bool m_UseMemoryMapping{ false };
+
 private:
   std::string m_ExceptionMessage;
 
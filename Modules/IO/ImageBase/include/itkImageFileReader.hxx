@@ -25,6 +25,7 @@
 #include "itkPixelTraits.h"
 #include "itkVectorImage.h"
 #include "itkMetaDataObject.h"
+#include "itkMemoryMappedImageBufferAllocator.h"
 
 #include "itksys/SystemTools.hxx"
 #include <memory> // For unique_ptr
@@ -51,6 +52,7 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::PrintSelf(std::ostream & os,
 
   os << indent << "UserSpecifiedImageIO flag: " << m_UserSpecifiedImageIO << "\n";
   os << indent << "m_UseStreaming: " << m_UseStreaming << "\n";
+  os << indent << "m_UseMemoryMapping: " << m_UseMemoryMapping << "\n";
 }
 
 template <typename TOutputImage, typename ConvertPixelTraits>
@@ -247,9 +249,10 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateOutputInformation()
   region.SetSize(dimSize);
   region.SetIndex(start);
 
-  // If a VectorImage, this requires us to set the
+  // If a VectorImage or a PlanarVectorImage, this requires us to set the
   // VectorLength before allocate
-  if (strcmp(output->GetNameOfClass(), "VectorImage") == 0)
+  if (strcmp(output->GetNameOfClass(), "VectorImage") == 0 ||
+      strcmp(output->GetNameOfClass(), "PlanarVectorImage") == 0)
   {
     using AccessorFunctorType = typename TOutputImage::AccessorFunctorType;
     AccessorFunctorType::SetVectorLength(output, m_ImageIO->GetNumberOfComponents());
@@ -360,6 +363,13 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
                 << "Allocating the buffer with the EnlargedRequestedRegion \n"
                 << output->GetRequestedRegion() << "\n");
 
+  if (m_UseMemoryMapping && this->MapOutput())
+  {
+    itkDebugMacro(<< "Mapped the pixel data of the file.");
+    this->UpdateProgress(1.0f);
+    return;
+  }
+
   // allocated the output image to the size of the enlarge requested region
   this->AllocateOutputs();
 
@@ -385,6 +395,13 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
   itkDebugMacro(<< "Setting imageIO IORegion to: " << m_ActualIORegion);
   m_ImageIO->SetIORegion(m_ActualIORegion);
 
+  // A PlanarVectorImage is read with its components in planes when the
+  // ImageIO can do it, and when the planes of the buffers match.
+  m_ImageIO->SetUsePlanarComponents(strcmp(output->GetNameOfClass(), "PlanarVectorImage") == 0 &&
+                                    m_ImageIO->CanUsePlanarComponents() &&
+                                    m_ActualIORegion.GetNumberOfPixels() ==
+                                      output->GetBufferedRegion().GetNumberOfPixels());
+
   // the size of the buffer is computed based on the actual number of
   // pixels to be read and the actual size of the pixels to be read
   // (as opposed to the sizes of the output)
@@ -441,6 +458,96 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
   this->UpdateProgress(1.0f);
 }
 
+template <typename TOutputImage, typename ConvertPixelTraits>
+bool
+ImageFileReader<TOutputImage, ConvertPixelTraits>::MapOutput()
+{
+  typename TOutputImage::Pointer output = this->GetOutput();
+
+  const IOComponentEnum ioType = ImageIOBase::MapPixelType<typename ConvertPixelTraits::ComponentType>::CType;
+  if (m_ImageIO->GetComponentType() != ioType ||
+      m_ImageIO->GetNumberOfComponents() != ConvertPixelTraits::GetNumberOfComponents() ||
+      m_ActualIORegion.GetNumberOfPixels() != output->GetRequestedRegion().GetNumberOfPixels() ||
+      m_ActualIORegion.GetNumberOfPixels() == 0)
+  {
+    return false;
+  }
+
+  // The pixels of the region must be contiguous in the file: only its last
+  // dimension may be smaller than the image.
+  const unsigned int numberOfDimensions = m_ActualIORegion.GetImageDimension();
+  SizeValueType      firstPixel = 0;
+  SizeValueType      stride = 1;
+  unsigned int       lastDimension = 0;
+  for (unsigned int i = 0; i < numberOfDimensions; ++i)
+  {
+    if (m_ActualIORegion.GetSize(i) > 1)
+    {
+      lastDimension = i;
+    }
+  }
+  for (unsigned int i = 0; i < numberOfDimensions; ++i)
+  {
+    if (i < lastDimension &&
+        (m_ActualIORegion.GetIndex(i) != 0 || m_ActualIORegion.GetSize(i) != m_ImageIO->GetDimensions(i)))
+    {
+      return false;
+    }
+    firstPixel += static_cast<SizeValueType>(m_ActualIORegion.GetIndex(i)) * stride;
+    stride *= m_ImageIO->GetDimensions(i);
+  }
+
+  std::string   fileName;
+  SizeValueType offset = 0;
+  m_ImageIO->SetFileName(this->GetFileName().c_str());
+  m_ImageIO->SetIORegion(m_ActualIORegion);
+  if (!m_ImageIO->GetPixelDataFileLocation(fileName, offset))
+  {
+    return false;
+  }
+  const SizeValueType bytesPerPixel = m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents();
+  const SizeValueType dataOffset = offset + firstPixel * bytesPerPixel;
+
+  // The mapped buffer starts at the same offset from a page boundary as the
+  // pixel data in the file, e.g. after a header of any length, so that the
+  // components would be misaligned unless the offset is a multiple of their
+  // alignment.
+  if (dataOffset % alignof(typename ConvertPixelTraits::ComponentType) != 0)
+  {
+    return false;
+  }
+
+  auto allocator = MemoryMappedImageBufferAllocator::New();
+  allocator->SetMode(MemoryMappedImageBufferAllocator::ModeEnum::ReadOnly);
+  allocator->SetFileName(fileName);
+  allocator->SetOffset(dataOffset);
+
+  // The container keeps the allocator of its buffer, to unmap it, so that
+  // its allocator for later buffers is restored once the output is mapped.
+  auto *                              pixelContainer = output->GetPixelContainer();
+  const ImageBufferAllocator::Pointer previousAllocator = pixelContainer->GetModifiableAllocator();
+  pixelContainer->Initialize();
+  pixelContainer->SetAllocator(allocator);
+  try
+  {
+    output->SetBufferedRegion(output->GetRequestedRegion());
+    output->Allocate(false);
+  }
+  catch (const MemoryAllocationError &)
+  {
+    pixelContainer->SetAllocator(previousAllocator);
+    return false;
+  }
+  pixelContainer->SetAllocator(previousAllocator);
+
+  // The whole requested region is about to be accessed: start reading its
+  // pages ahead of the first accesses.
+  MemoryMappedImageBufferAllocator::Advise(output->GetBufferPointer(),
+                                           m_ActualIORegion.GetNumberOfPixels() * bytesPerPixel,
+                                           MemoryMappedImageBufferAllocator::AdviceEnum::WillNeed);
+  return true;
+}
+
 template <typename TOutputImage, typename ConvertPixelTraits>
 void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::DoConvertBuffer(void * inputData, size_t numberOfPixels)
@@ -448,6 +555,11 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::DoConvertBuffer(void * inputD
   // get the pointer to the destination buffer
   OutputImagePixelType * outputData = this->GetOutput()->GetPixelContainer()->GetBufferPointer();
   bool                   isVectorImage(strcmp(this->GetOutput()->GetNameOfClass(), "VectorImage") == 0);
+  // The components of a PlanarVectorImage are converted to planes, unless
+  // the ImageIO has read them so.
+  const bool isPlanarVectorImage(strcmp(this->GetOutput()->GetNameOfClass(), "PlanarVectorImage") == 0);
+  const bool convertToPlanes = isPlanarVectorImage && !m_ImageIO->GetUsePlanarComponents();
+  isVectorImage = isVectorImage || isPlanarVectorImage;
   // TODO:
   // Pass down the PixelType (RGB, VECTOR, etc.) so that any vector to
   // scalar conversion be type specific. i.e. RGB to scalar would use
@@ -466,7 +578,12 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::DoConvertBuffer(void * inputD
 #define ITK_CONVERT_BUFFER_IF_BLOCK(_CType, type)                                                                      \
   else if (m_ImageIO->GetComponentType() == _CType)                                                                    \
   {                                                                                                                    \
-    if (isVectorImage)                                                                                                 \
+    if (convertToPlanes)                                                                                               \
+    {                                                                                                                  \
+      ConvertPixelBuffer<type, OutputImagePixelType, ConvertPixelTraits>::ConvertVectorImageToPlanar(                  \
+        static_cast<type *>(inputData), m_ImageIO->GetNumberOfComponents(), outputData, numberOfPixels);               \
+    }                                                                                                                  \
+    else if (isVectorImage)                                                                                            \
     {                                                                                                                  \
       ConvertPixelBuffer<type, OutputImagePixelType, ConvertPixelTraits>::ConvertVectorImage(                          \
         static_cast<type *>(inputData), m_ImageIO->GetNumberOfComponents(), outputData, numberOfPixels);               \
@@ -170,6 +170,16 @@ public:
   itkSetMacro(NumberOfStreamDivisions, unsigned int);
   itkGetConstReferenceMacro(NumberOfStreamDivisions, unsigned int);
 
+  /** Set/Get the number of bytes of bulk data the upstream pipeline may
+   * allocate for a piece. When not zero, and the ImageIO can stream, the
+   * number of pieces is doubled until the memory estimated by
+   * DataObject::EstimateMemoryForRequestedRegion() for the largest piece
+   * meets the budget, instead of being NumberOfStreamDivisions. The pieces
+   * are then written as with NumberOfStreamDivisions. Zero, the default,
+   * means no budget. */
+  itkSetMacro(MemoryBudget, SizeValueType);
+  itkGetConstMacro(MemoryBudget, SizeValueType);
+
   /** Aliased to the Write() method to be consistent with the rest of the
    * pipeline. */
   void
@@ -229,6 +239,8 @@ private:
 
   ImageIORegion m_PasteIORegion{ TInputImage::ImageDimension };
   unsigned int  m_NumberOfStreamDivisions{ 1 };
+  SizeValueType m_MemoryBudget{ 0 };
+  unsigned int  m_NumberOfPieces{ 1 };
   bool          m_UserSpecifiedIORegion{ false };
 
   bool m_FactorySpecifiedImageIO{ false }; // did factory mechanism set the ImageIO?
@@ -33,6 +33,7 @@
 #include "itkMatrix.h"
 #include "itkImageAlgorithm.h"
 #include <complex>
+#include <memory>
 
 namespace itk
 {
@@ -207,7 +208,8 @@ ImageFileWriter<TInputImage>::Write()
 
   // Set the pixel and component type; the number of components.
   m_ImageIO->SetPixelTypeInfo(static_cast<const InputImagePixelType *>(nullptr));
-  if (strcmp(input->GetNameOfClass(), "VectorImage") == 0)
+  if (strcmp(input->GetNameOfClass(), "VectorImage") == 0 ||
+      strcmp(input->GetNameOfClass(), "PlanarVectorImage") == 0)
   {
     using AccessorFunctorType = typename InputImageType::AccessorFunctorType;
     m_ImageIO->SetNumberOfComponents(AccessorFunctorType::GetVectorLength(input));
@@ -220,11 +222,6 @@ ImageFileWriter<TInputImage>::Write()
   // Notify start event observers
   this->InvokeEvent(StartEvent());
 
-  if (m_NumberOfStreamDivisions > 1 || m_UserSpecifiedIORegion)
-  {
-    m_ImageIO->SetUseStreamedWriting(true);
-  }
-
   ImageIORegion largestIORegion(TInputImage::ImageDimension);
   ImageIORegionAdaptor<TInputImage::ImageDimension>::Convert(largestRegion, largestIORegion, largestRegion.GetIndex());
 
@@ -252,8 +249,55 @@ ImageFileWriter<TInputImage>::Write()
   unsigned int numDivisions;
 
   // this may fail and throw an exception if the configuration is not supported
-  numDivisions =
-    m_ImageIO->GetActualNumberOfSplitsForWriting(m_NumberOfStreamDivisions, pasteIORegion, largestIORegion);
+  if (m_MemoryBudget > 0)
+  {
+    // The pieces may differ in size, e.g. by a slice, so that the largest
+    // one is estimated.
+    const auto estimateMemoryOfLargestPiece = [&](unsigned int numberOfPieces) {
+      InputImageRegionType largestStreamRegion;
+      for (unsigned int i = 0; i < numberOfPieces; ++i)
+      {
+        const ImageIORegion streamIORegion =
+          m_ImageIO->GetSplitRegionForWriting(i, numberOfPieces, pasteIORegion, largestIORegion);
+        InputImageRegionType streamRegion;
+        ImageIORegionAdaptor<TInputImage::ImageDimension>::Convert(
+          streamIORegion, streamRegion, largestRegion.GetIndex());
+        if (streamRegion.GetNumberOfPixels() > largestStreamRegion.GetNumberOfPixels())
+        {
+          largestStreamRegion = streamRegion;
+        }
+      }
+      nonConstInput->SetRequestedRegion(largestStreamRegion);
+      return nonConstInput->EstimateMemoryForRequestedRegion();
+    };
+
+    // Double the number of pieces until the budget is met, or the ImageIO
+    // cannot make more pieces.
+    numDivisions = m_ImageIO->GetActualNumberOfSplitsForWriting(1, pasteIORegion, largestIORegion);
+    while (estimateMemoryOfLargestPiece(numDivisions) > m_MemoryBudget)
+    {
+      const unsigned int moreDivisions =
+        m_ImageIO->GetActualNumberOfSplitsForWriting(2 * numDivisions, pasteIORegion, largestIORegion);
+      if (moreDivisions <= numDivisions)
+      {
+        itkWarningMacro(<< "The memory budget of " << m_MemoryBudget << " bytes cannot be met with " << numDivisions
+                        << " pieces.");
+        break;
+      }
+      numDivisions = moreDivisions;
+    }
+  }
+  else
+  {
+    numDivisions =
+      m_ImageIO->GetActualNumberOfSplitsForWriting(m_NumberOfStreamDivisions, pasteIORegion, largestIORegion);
+  }
+
+  if (numDivisions > 1 || m_UserSpecifiedIORegion)
+  {
+    m_ImageIO->SetUseStreamedWriting(true);
+  }
+  m_NumberOfPieces = numDivisions;
 
   /**
    * Loop over the number of pieces, execute the upstream pipeline on each
@@ -302,6 +346,7 @@ ImageFileWriter<TInputImage>::Write()
         itkDebugMacro("Requested stream region  matches largest region input filter may not support streaming well.");
         itkDebugMacro("Writer is not streaming now!");
         numDivisions = 1;
+        m_NumberOfPieces = 1;
         streamRegion = largestRegion;
         ImageIORegionAdaptor<TInputImage::ImageDimension>::Convert(
           streamRegion, streamIORegion, largestRegion.GetIndex());
@@ -347,7 +392,7 @@ ImageFileWriter<TInputImage>::GenerateData()
   // before this test, bad stuff would happened when they don't match
   if (bufferedRegion != ioRegion)
   {
-    if (m_NumberOfStreamDivisions > 1 || m_UserSpecifiedIORegion)
+    if (m_NumberOfPieces > 1 || m_UserSpecifiedIORegion)
     {
       itkDebugMacro("Requested stream region does not match generated output");
       itkDebugMacro("input filter may not support streaming well");
@@ -376,6 +421,31 @@ ImageFileWriter<TInputImage>::GenerateData()
     }
   }
 
+  // The components of a PlanarVectorImage are written in planes when the
+  // ImageIO can do it, and are interleaved otherwise.
+  using InternalPixelType = typename InputImageType::InternalPixelType;
+  std::unique_ptr<InternalPixelType[]> interleavedBuffer;
+  const bool isPlanarVectorImage = strcmp(input->GetNameOfClass(), "PlanarVectorImage") == 0;
+  m_ImageIO->SetUsePlanarComponents(isPlanarVectorImage && m_ImageIO->CanUsePlanarComponents());
+  if (isPlanarVectorImage && !m_ImageIO->GetUsePlanarComponents() && m_ImageIO->GetNumberOfComponents() > 1)
+  {
+    itkDebugMacro("Interleaving the components of the planes");
+
+    const SizeValueType numberOfPixels = ioRegion.GetNumberOfPixels();
+    const SizeValueType numberOfComponents = m_ImageIO->GetNumberOfComponents();
+    const auto *        planes = static_cast<const InternalPixelType *>(dataPtr);
+    interleavedBuffer.reset(new InternalPixelType[numberOfPixels * numberOfComponents]);
+    for (SizeValueType k = 0; k < numberOfComponents; ++k)
+    {
+      const InternalPixelType * plane = planes + k * numberOfPixels;
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        interleavedBuffer[i * numberOfComponents + k] = plane[i];
+      }
+    }
+    dataPtr = interleavedBuffer.get();
+  }
+
   m_ImageIO->Write(dataPtr);
 }
 
@@ -400,6 +470,7 @@ ImageFileWriter<TInputImage>::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "IO Region: " << m_PasteIORegion << "\n";
   os << indent << "Number of Stream Divisions: " << m_NumberOfStreamDivisions << "\n";
+  os << indent << "Memory Budget: " << m_MemoryBudget << "\n";
   os << indent << "CompressionLevel: " << m_CompressionLevel << "\n";
 
   if (m_UseCompression)
@@ -293,6 +293,16 @@ public:
   itkGetConstMacro(UseStreamedWriting, bool);
   itkBooleanMacro(UseStreamedWriting);
 
+  /** Set/Get a boolean to read or write the pixels of multi-component
+   * images with their components in planes: all the first components,
+   * then all the second components, and so on, as they are stored by
+   * PlanarVectorImage, instead of interleaved. It is set by ImageFileReader
+   * and ImageFileWriter when CanUsePlanarComponents() is true, and is
+   * ignored otherwise. Defaults to false. */
+  itkSetMacro(UsePlanarComponents, bool);
+  itkGetConstMacro(UsePlanarComponents, bool);
+  itkBooleanMacro(UsePlanarComponents);
+
   /** Set/Get a boolean to perform RGB palette expansion.
    * If true, palette image is read as RGB,
    * if false, palette image is read as Scalar+Palette.
@@ -431,6 +441,16 @@ public:
     return false;
   }
 
+  /** Determine if the ImageIO can read and write the pixels with their
+      components in planes, see SetUsePlanarComponents(). Default is
+      false. If this is queried after the header of the file has been
+      read then it will indicate if that file can be read so. */
+  virtual bool
+  CanUsePlanarComponents()
+  {
+    return false;
+  }
+
   /** Read the spacing and dimensions of the image.
    * Assumes SetFileName has been called with a valid file name. */
   virtual void
@@ -440,6 +460,18 @@ public:
   virtual void
   Read(void * buffer) = 0;
 
+  /** Get the location of the pixel data of the file, when they are stored
+   * uncompressed, contiguously, and in the byte order of this machine, so
+   * that they can be memory-mapped rather than read: the name of the file
+   * which holds them and the offset (in bytes) of the first pixel.
+   * Assumes ReadImageInformation() has been called. Returns false when the
+   * pixel data cannot be mapped, which is the default. */
+  virtual bool
+  GetPixelDataFileLocation(std::string & itkNotUsed(fileName), SizeValueType & itkNotUsed(offset)) const
+  {
+    return false;
+  }
+
   /*-------- This part of the interfaces deals with writing data ----- */
 
   /** Determine the file type. Returns true if this ImageIO can read the
@@ -545,6 +577,34 @@ public:
   const ArrayOfExtensionsType &
   GetSupportedWriteExtensions() const;
 
+  /** \brief A signature of a file format: bytes found at a given offset of
+   * every file of the format, e.g. its magic number. */
+  struct FileSignature
+  {
+    SizeValueType Offset;
+    std::string   Bytes;
+  };
+
+  /** Type for the list of signatures of the files supported for reading. */
+  using ArrayOfFileSignaturesType = std::vector<FileSignature>;
+
+  /** This method returns an array with the list of file signatures
+   * supported for reading by this ImageIO class. When the array is not
+   * empty, CanReadFile() returns false for the files which match none of
+   * them, which lets ImageIOFactory skip this ImageIO after reading the
+   * header of a file once. An empty array means that any file may be
+   * readable.
+   */
+  const ArrayOfFileSignaturesType &
+  GetSupportedReadSignatures() const;
+
+  /** Whether the header of a file, that is its first bytes, matches one of
+   * the signatures supported for reading, or no signature is declared.
+   * The header must be long enough to hold the signatures, unless the file
+   * is shorter. */
+  bool
+  MatchesSupportedReadSignatures(const std::string & header) const;
+
   template <typename TPixel>
   void
   SetTypeInfo(const TPixel *);
@@ -745,6 +805,9 @@ protected:
   /** Should we use streaming for writing */
   bool m_UseStreamedWriting;
 
+  /** Should we read or write the components in planes */
+  bool m_UsePlanarComponents{ false };
+
   /** Should we expand RGB palette or stay scalar */
   bool m_ExpandRGBPalette;
 
@@ -868,6 +931,12 @@ protected:
   void
   AddSupportedWriteExtension(const char * extension);
 
+  /** Insert a signature to the list of supported signatures for reading.
+   * Only the ImageIO classes whose CanReadFile() rejects every file which
+   * matches none of their signatures may declare them. */
+  void
+  AddSupportedReadSignature(SizeValueType offset, const std::string & bytes);
+
 
   void
   SetSupportedReadExtensions(const ArrayOfExtensionsType &);
@@ -891,8 +960,9 @@ private:
   bool
   HasSupportedExtension(const char *, const ArrayOfExtensionsType &, bool ignoreCase = true);
 
-  ArrayOfExtensionsType m_SupportedReadExtensions;
-  ArrayOfExtensionsType m_SupportedWriteExtensions;
+  ArrayOfExtensionsType     m_SupportedReadExtensions;
+  ArrayOfExtensionsType     m_SupportedWriteExtensions;
+  ArrayOfFileSignaturesType m_SupportedReadSignatures;
 };
 
 /** Utility function for writing RAW bytes */
@@ -58,6 +58,12 @@ public:
   static constexpr IOFileModeEnum WriteMode = IOFileModeEnum::WriteMode;
 #endif
   /** Create the appropriate ImageIO depending on the particulars of the file.
+   *
+   * The first registered ImageIO whose CanReadFile(), or CanWriteFile(),
+   * returns true is selected. For reading, the header of the file is read
+   * once, and the ImageIO classes whose supported read signatures it does
+   * not match are skipped without calling CanReadFile().
+   * \sa ImageIOBase::GetSupportedReadSignatures()
    */
   static ImageIOBasePointer
   CreateImageIO(const char * path, IOFileModeEnum mode);
@@ -458,11 +458,11 @@ ImageSeriesReader<TOutputImage>::GenerateData()
       progress.CompletedPixel();
     } // end !insidedRequestedRegion
 
-    // Deep copy the MetaDataDictionary into the array
+    // Copy the MetaDataDictionary into the array. The copy shares the
+    // entries of the dictionary of the ImageIO, until either is modified.
     if (reader->GetImageIO() && needToUpdateMetaDataDictionaryArray)
     {
-      auto newDictionary = new DictionaryType;
-      *newDictionary = reader->GetImageIO()->GetMetaDataDictionary();
+      auto newDictionary = new DictionaryType(reader->GetImageIO()->GetMetaDataDictionary());
       if (nonUniformSampling)
       {
         // slice-specific information
@@ -77,6 +77,36 @@ ImageIOBase::AddSupportedWriteExtension(const char * extension)
   this->m_SupportedWriteExtensions.push_back(extension);
 }
 
+const ImageIOBase::ArrayOfFileSignaturesType &
+ImageIOBase::GetSupportedReadSignatures() const
+{
+  return this->m_SupportedReadSignatures;
+}
+
+void
+ImageIOBase::AddSupportedReadSignature(SizeValueType offset, const std::string & bytes)
+{
+  this->m_SupportedReadSignatures.push_back({ offset, bytes });
+}
+
+bool
+ImageIOBase::MatchesSupportedReadSignatures(const std::string & header) const
+{
+  if (this->m_SupportedReadSignatures.empty())
+  {
+    return true;
+  }
+  for (const auto & signature : this->m_SupportedReadSignatures)
+  {
+    if (signature.Offset + signature.Bytes.size() <= header.size() &&
+        header.compare(signature.Offset, signature.Bytes.size(), signature.Bytes) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 void
 ImageIOBase::SetSupportedReadExtensions(const ArrayOfExtensionsType & extensions)
 {
@@ -1202,6 +1232,14 @@ ImageIOBase::PrintSelf(std::ostream & os, Indent indent) const
   {
     os << indent << "UseStreamedWriting: Off" << std::endl;
   }
+  if (m_UsePlanarComponents)
+  {
+    os << indent << "UsePlanarComponents: On" << std::endl;
+  }
+  else
+  {
+    os << indent << "UsePlanarComponents: Off" << std::endl;
+  }
   if (m_ExpandRGBPalette)
   {
     os << indent << "ExpandRGBPalette: On" << std::endl;
@@ -18,6 +18,8 @@
 
 #include "itkImageIOFactory.h"
 
+#include <algorithm>
+#include <fstream>
 #include <mutex>
 
 
@@ -27,7 +29,32 @@ namespace itk
 namespace
 {
 std::mutex createImageIOLock;
+
+// Read the first bytes of a file, enough to hold the read signatures of the
+// ImageIO classes. Returns an empty header when the file cannot be read.
+std::string
+ReadFileHeader(const char * path, const std::list<ImageIOBase::Pointer> & imageIOs)
+{
+  SizeValueType headerSize = 0;
+  for (const auto & io : imageIOs)
+  {
+    for (const auto & signature : io->GetSupportedReadSignatures())
+    {
+      headerSize = std::max<SizeValueType>(headerSize, signature.Offset + signature.Bytes.size());
+    }
+  }
+
+  std::string header;
+  if (headerSize > 0 && path != nullptr)
+  {
+    header.resize(headerSize);
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    file.read(&header[0], static_cast<std::streamsize>(headerSize));
+    header.resize(static_cast<size_t>(file.gcount()));
+  }
+  return header;
 }
+} // namespace
 
 ImageIOBase::Pointer
 ImageIOFactory::CreateImageIO(const char * path, IOFileModeEnum mode)
@@ -48,11 +75,12 @@ ImageIOFactory::CreateImageIO(const char * path, IOFileModeEnum mode)
       std::cerr << "Error ImageIO factory did not return an ImageIOBase: " << allobject->GetNameOfClass() << std::endl;
     }
   }
+  const std::string header = mode == IOFileModeEnum::ReadMode ? ReadFileHeader(path, possibleImageIO) : std::string();
   for (auto & k : possibleImageIO)
   {
     if (mode == IOFileModeEnum::ReadMode)
     {
-      if (k->CanReadFile(path))
+      if (k->MatchesSupportedReadSignatures(header) && k->CanReadFile(path))
       {
         return k;
       }
@@ -0,0 +1,202 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImage.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMemoryMappedImageBufferAllocator.h"
+
+#include "itkGTest.h"
+#include "itksys/SystemTools.hxx"
+#include "itkTestDriverIncludeRequiredIOFactories.h"
+
+#include <complex>
+#include <fstream>
+
+#define STRING(s) #s
+
+namespace
+{
+
+struct ITKImageFileReaderTest : public ::testing::Test
+{
+  void
+  SetUp() override
+  {
+    RegisterRequiredFactories();
+    itksys::SystemTools::ChangeDirectory(STRING(ITK_TEST_OUTPUT_DIR_STR));
+  }
+  using ImageType = itk::Image<short, 3>;
+
+  static ImageType::Pointer
+  MakeImage()
+  {
+    auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType{ { 16, 8, 6 } });
+    image->Allocate();
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      const ImageType::IndexType index = it.GetIndex();
+      it.Set(static_cast<short>(index[0] + 16 * index[1] + 128 * index[2] - 300));
+    }
+    return image;
+  }
+
+  template <typename TImage>
+  static bool
+  IsMapped(const TImage * image)
+  {
+    return dynamic_cast<const itk::MemoryMappedImageBufferAllocator *>(
+             image->GetPixelContainer()->GetBufferAllocator()) != nullptr;
+  }
+};
+
+} // namespace
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_F(ITKImageFileReaderTest, MapsRawPixelData)
+{
+  // The pixel data are written to a separate raw file, at an aligned offset.
+  const std::string fileName = "itkImageFileReaderGTestMapped.mhd";
+  const auto        image = MakeImage();
+  itk::WriteImage(image, fileName);
+
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  EXPECT_FALSE(reader->GetUseMemoryMapping());
+  reader->UseMemoryMappingOn();
+  reader->Update();
+
+  const ImageType * output = reader->GetOutput();
+  EXPECT_TRUE(IsMapped(output));
+  EXPECT_EQ(*output, *image);
+
+  // A requested slab is mapped from its first pixel.
+  const ImageType::RegionType slab({ { 0, 0, 2 } }, { { 16, 8, 3 } });
+  reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->UseMemoryMappingOn();
+  reader->GetOutput()->SetRequestedRegion(slab);
+  reader->Update();
+  EXPECT_TRUE(IsMapped(reader->GetOutput()));
+  EXPECT_EQ(reader->GetOutput()->GetBufferedRegion(), slab);
+  EXPECT_EQ(reader->GetOutput()->GetPixel({ { 3, 4, 2 } }), image->GetPixel({ { 3, 4, 2 } }));
+  EXPECT_EQ(reader->GetOutput()->GetPixel({ { 15, 7, 4 } }), image->GetPixel({ { 15, 7, 4 } }));
+}
+
+
+TEST_F(ITKImageFileReaderTest, MapsPixelDataWithoutOverwritingThem)
+{
+  const std::string fileName = "itkImageFileReaderGTestMappedPlaced.mhd";
+  const auto        image = MakeImage();
+  itk::WriteImage(image, fileName);
+
+  // The pages of a mapped buffer are not touched to place them.
+  const itk::SizeValueType minimumBufferSize =
+    itk::ImportImageContainerCommon::GetGlobalMemoryPlacementMinimumBufferSize();
+  itk::ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(0);
+  for (const auto placement : { itk::ImportImageContainerCommon::MemoryPlacementEnum::ParallelFirstTouch,
+                                itk::ImportImageContainerCommon::MemoryPlacementEnum::Interleaved })
+  {
+    auto reader = itk::ImageFileReader<ImageType>::New();
+    reader->SetFileName(fileName);
+    reader->UseMemoryMappingOn();
+    reader->GetOutput()->GetPixelContainer()->SetMemoryPlacement(placement);
+    reader->Update();
+    EXPECT_TRUE(IsMapped(reader->GetOutput()));
+    EXPECT_EQ(*reader->GetOutput(), *image) << "MemoryPlacement: " << placement;
+  }
+  itk::ImportImageContainerCommon::SetGlobalMemoryPlacementMinimumBufferSize(minimumBufferSize);
+
+  // The elements of a mapped buffer are not default constructed.
+  using ComplexImageType = itk::Image<std::complex<float>, 3>;
+  const std::string complexFileName = "itkImageFileReaderGTestMappedComplex.mhd";
+  auto              complexImage = ComplexImageType::New();
+  complexImage->SetRegions(image->GetBufferedRegion());
+  complexImage->Allocate();
+  for (itk::ImageRegionIteratorWithIndex<ComplexImageType> it(complexImage, complexImage->GetBufferedRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const float value = image->GetPixel(it.GetIndex());
+    it.Set({ value, -2.0f * value });
+  }
+  itk::WriteImage(complexImage, complexFileName);
+
+  auto complexReader = itk::ImageFileReader<ComplexImageType>::New();
+  complexReader->SetFileName(complexFileName);
+  complexReader->UseMemoryMappingOn();
+  complexReader->Update();
+  EXPECT_TRUE(IsMapped(complexReader->GetOutput()));
+  EXPECT_EQ(*complexReader->GetOutput(), *complexImage);
+}
+
+
+TEST_F(ITKImageFileReaderTest, ReadsMisalignedPixelData)
+{
+  // The pixel data follow a header of odd length, so that they cannot be
+  // mapped with the alignment of short.
+  const std::string fileName = "itkImageFileReaderGTestMisaligned.mha";
+  std::string       header = "ObjectType = Image\nNDims = 3\nDimSize = 16 8 6\nElementType = MET_SHORT\n"
+                       "ElementByteOrderMSB = False\nElementDataFile = LOCAL\n";
+  if (header.size() % 2 == 0)
+  {
+    header.insert(0, "Comment = header\n");
+  }
+  ASSERT_EQ(header.size() % 2, 1u);
+
+  const auto image = MakeImage();
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    file << header;
+    file.write(reinterpret_cast<const char *>(image->GetBufferPointer()),
+               image->GetPixelContainer()->Size() * sizeof(ImageType::PixelType));
+  }
+
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->UseMemoryMappingOn();
+  reader->Update();
+
+  const ImageType * output = reader->GetOutput();
+  EXPECT_FALSE(IsMapped(output));
+  EXPECT_EQ(*output, *image);
+}
+#endif
+
+TEST_F(ITKImageFileReaderTest, ReadsCompressedOrConvertedPixelData)
+{
+  const std::string fileName = "itkImageFileReaderGTestCompressed.mha";
+  const auto        image = MakeImage();
+  itk::WriteImage(image, fileName, true);
+
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->UseMemoryMappingOn();
+  reader->Update();
+  EXPECT_FALSE(IsMapped(reader->GetOutput()));
+  EXPECT_EQ(*reader->GetOutput(), *image);
+
+  using FloatImageType = itk::Image<float, 3>;
+  auto floatReader = itk::ImageFileReader<FloatImageType>::New();
+  floatReader->SetFileName(fileName);
+  floatReader->UseMemoryMappingOn();
+  floatReader->Update();
+  EXPECT_EQ(floatReader->GetOutput()->GetPixel({ { 3, 4, 2 } }), image->GetPixel({ { 3, 4, 2 } }));
+}
@@ -0,0 +1,121 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileWriter.h"
+#include "itkImageFileReader.h"
+#include "itkImage.h"
+#include "itkImageAlgorithm.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageToImageFilter.h"
+
+#include "itkGTest.h"
+#include "itksys/SystemTools.hxx"
+#include "itkTestDriverIncludeRequiredIOFactories.h"
+
+#define STRING(s) #s
+
+namespace
+{
+
+/** Copies its input, and generates one more slice than requested, like
+ * filters which can only produce whole blocks. */
+template <typename TImage>
+class SlicePaddingImageFilter : public itk::ImageToImageFilter<TImage, TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SlicePaddingImageFilter);
+
+  using Self = SlicePaddingImageFilter;
+  using Superclass = itk::ImageToImageFilter<TImage, TImage>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(SlicePaddingImageFilter, ImageToImageFilter);
+
+protected:
+  SlicePaddingImageFilter() = default;
+
+  void
+  EnlargeOutputRequestedRegion(itk::DataObject * output) override
+  {
+    auto *                       image = static_cast<TImage *>(output);
+    typename TImage::RegionType region = image->GetRequestedRegion();
+    region.PadByRadius(1);
+    region.Crop(image->GetLargestPossibleRegion());
+    image->SetRequestedRegion(region);
+  }
+
+  void
+  GenerateData() override
+  {
+    this->AllocateOutputs();
+    const typename TImage::RegionType region = this->GetOutput()->GetRequestedRegion();
+    itk::ImageAlgorithm::Copy(this->GetInput(), this->GetOutput(), region, region);
+  }
+};
+
+struct ITKImageFileWriterTest : public ::testing::Test
+{
+  void
+  SetUp() override
+  {
+    RegisterRequiredFactories();
+    itksys::SystemTools::ChangeDirectory(STRING(ITK_TEST_OUTPUT_DIR_STR));
+  }
+  using ImageType = itk::Image<short, 3>;
+
+  static ImageType::Pointer
+  MakeImage()
+  {
+    auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType{ { 16, 8, 12 } });
+    image->Allocate();
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      const ImageType::IndexType index = it.GetIndex();
+      it.Set(static_cast<short>(index[0] + 16 * index[1] + 128 * index[2] - 300));
+    }
+    return image;
+  }
+};
+
+} // namespace
+
+
+TEST_F(ITKImageFileWriterTest, StreamsPiecesWithinMemoryBudget)
+{
+  const std::string fileName = "itkImageFileWriterGTestMemoryBudget.mha";
+  const auto        image = MakeImage();
+
+  // The pieces are buffered with a slice around them, so that the writer
+  // copies the requested piece out of each one.
+  const auto filter = SlicePaddingImageFilter<ImageType>::New();
+  filter->SetInput(image);
+
+  const itk::SizeValueType sliceBytes = 16 * 8 * sizeof(short);
+  auto                     writer = itk::ImageFileWriter<ImageType>::New();
+  writer->SetInput(filter->GetOutput());
+  writer->SetFileName(fileName);
+  writer->SetMemoryBudget(5 * sliceBytes);
+  ASSERT_NO_THROW(writer->Update());
+  EXPECT_TRUE(writer->GetImageIO()->GetUseStreamedWriting());
+
+  // The last piece, padded by one slice, fits in the budget.
+  EXPECT_LE(filter->GetOutput()->GetBufferedRegion().GetNumberOfPixels() * sizeof(short), 5 * sliceBytes);
+  EXPECT_EQ(*itk::ReadImage<ImageType>(fileName), *image);
+}
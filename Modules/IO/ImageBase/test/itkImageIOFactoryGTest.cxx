@@ -0,0 +1,198 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageIOFactory.h"
+#include "itkCreateObjectFunction.h"
+#include "itkMetaImageIO.h"
+#include "itkVersion.h"
+
+#include "itkGTest.h"
+#include "itksys/SystemTools.hxx"
+#include "itkTestDriverIncludeRequiredIOFactories.h"
+#include <fstream>
+
+#define STRING(s) #s
+
+namespace
+{
+
+// Reads the files which start with "SIGNED", and counts the calls of
+// CanReadFile().
+class SignedImageIO : public itk::ImageIOBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SignedImageIO);
+
+  using Self = SignedImageIO;
+  using Superclass = itk::ImageIOBase;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(SignedImageIO, ImageIOBase);
+
+  static unsigned int &
+  GetNumberOfCanReadFileCalls()
+  {
+    static unsigned int numberOfCalls = 0;
+    return numberOfCalls;
+  }
+
+  bool
+  CanReadFile(const char * fileName) override
+  {
+    ++GetNumberOfCanReadFileCalls();
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    char          header[6];
+    file.read(header, sizeof(header));
+    return file && std::string(header, sizeof(header)) == "SIGNED";
+  }
+
+  void
+  ReadImageInformation() override
+  {}
+
+  void
+  Read(void *) override
+  {}
+
+  bool
+  CanWriteFile(const char *) override
+  {
+    return false;
+  }
+
+  void
+  WriteImageInformation() override
+  {}
+
+  void
+  Write(const void *) override
+  {}
+
+protected:
+  SignedImageIO() { this->AddSupportedReadSignature(0, "SIGNED"); }
+};
+
+class SignedImageIOFactory : public itk::ObjectFactoryBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SignedImageIOFactory);
+
+  using Self = SignedImageIOFactory;
+  using Superclass = itk::ObjectFactoryBase;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkFactorylessNewMacro(Self);
+  itkTypeMacro(SignedImageIOFactory, ObjectFactoryBase);
+
+  const char *
+  GetITKSourceVersion() const override
+  {
+    return ITK_SOURCE_VERSION;
+  }
+
+  const char *
+  GetDescription() const override
+  {
+    return "SignedImageIO factory";
+  }
+
+  void
+  RegisterSignedImageIO()
+  {
+    this->RegisterOverride(
+      "itkImageIOBase", "SignedImageIO", "SignedImageIO", true, itk::CreateObjectFunction<SignedImageIO>::New());
+  }
+
+protected:
+  SignedImageIOFactory() = default;
+};
+
+bool
+HasSignedImageIO(const std::list<itk::LightObject::Pointer> & imageIOs)
+{
+  for (const auto & imageIO : imageIOs)
+  {
+    if (dynamic_cast<const SignedImageIO *>(imageIO.GetPointer()) != nullptr)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+WriteFile(const std::string & fileName, const std::string & contents)
+{
+  std::ofstream file(fileName, std::ios::out | std::ios::binary);
+  file << contents;
+}
+
+} // namespace
+
+
+TEST(ImageIOFactory, MatchesSupportedReadSignatures)
+{
+  const auto signedImageIO = SignedImageIO::New();
+  ASSERT_EQ(signedImageIO->GetSupportedReadSignatures().size(), 1u);
+  EXPECT_TRUE(signedImageIO->MatchesSupportedReadSignatures("SIGNED"));
+  EXPECT_TRUE(signedImageIO->MatchesSupportedReadSignatures("SIGNED data"));
+  EXPECT_FALSE(signedImageIO->MatchesSupportedReadSignatures("SIGNE"));
+  EXPECT_FALSE(signedImageIO->MatchesSupportedReadSignatures("UNSIGNED"));
+  EXPECT_FALSE(signedImageIO->MatchesSupportedReadSignatures(""));
+
+  // Without signatures, any file may be readable.
+  const auto metaImageIO = itk::MetaImageIO::New();
+  EXPECT_TRUE(metaImageIO->GetSupportedReadSignatures().empty());
+  EXPECT_TRUE(metaImageIO->MatchesSupportedReadSignatures(""));
+}
+
+
+TEST(ImageIOFactory, SkipsImageIOsWhoseSignaturesDoNotMatch)
+{
+  RegisterRequiredFactories();
+  itksys::SystemTools::ChangeDirectory(STRING(ITK_TEST_OUTPUT_DIR_STR));
+  const std::string signedFileName = "itkImageIOFactoryGTestSigned.dat";
+  const std::string unsignedFileName = "itkImageIOFactoryGTestUnsigned.dat";
+  WriteFile(signedFileName, "SIGNED data");
+  WriteFile(unsignedFileName, "UNSIGNED data");
+
+  // The override is registered after the factory, so that the factories
+  // asked for a class are updated.
+  const auto factory = SignedImageIOFactory::New();
+  itk::ObjectFactoryBase::RegisterFactory(factory, itk::ObjectFactoryEnums::InsertionPosition::INSERT_AT_FRONT);
+  EXPECT_FALSE(HasSignedImageIO(itk::ObjectFactoryBase::CreateAllInstance("itkImageIOBase")));
+  factory->RegisterSignedImageIO();
+  EXPECT_TRUE(HasSignedImageIO(itk::ObjectFactoryBase::CreateAllInstance("itkImageIOBase")));
+
+  SignedImageIO::GetNumberOfCanReadFileCalls() = 0;
+  const auto imageIO = itk::ImageIOFactory::CreateImageIO(signedFileName.c_str(), itk::IOFileModeEnum::ReadMode);
+  EXPECT_NE(dynamic_cast<SignedImageIO *>(imageIO.GetPointer()), nullptr);
+  EXPECT_EQ(SignedImageIO::GetNumberOfCanReadFileCalls(), 1u);
+
+  const auto otherImageIO = itk::ImageIOFactory::CreateImageIO(unsignedFileName.c_str(), itk::IOFileModeEnum::ReadMode);
+  EXPECT_EQ(dynamic_cast<SignedImageIO *>(otherImageIO.GetPointer()), nullptr);
+  const auto missingImageIO = itk::ImageIOFactory::CreateImageIO("itkImageIOFactoryGTestMissing.dat",
+                                                                 itk::IOFileModeEnum::ReadMode);
+  EXPECT_EQ(missingImageIO, nullptr);
+  EXPECT_EQ(SignedImageIO::GetNumberOfCanReadFileCalls(), 1u);
+
+  itk::ObjectFactoryBase::UnRegisterFactory(factory);
+  EXPECT_FALSE(HasSignedImageIO(itk::ObjectFactoryBase::CreateAllInstance("itkImageIOBase")));
+  EXPECT_EQ(itk::ImageIOFactory::CreateImageIO(signedFileName.c_str(), itk::IOFileModeEnum::ReadMode), nullptr);
+}
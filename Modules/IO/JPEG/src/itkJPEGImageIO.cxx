@@ -264,6 +264,8 @@ JPEGImageIO::JPEGImageIO()
     this->AddSupportedWriteExtension(ext);
     this->AddSupportedReadExtension(ext);
   }
+
+  this->AddSupportedReadSignature(0, "\xff\xd8");
 }
 
 JPEGImageIO::~JPEGImageIO() = default;
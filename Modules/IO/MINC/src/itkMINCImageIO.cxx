@@ -884,7 +884,7 @@ MINCImageIO::WriteImageInformation()
   this->CloseVolume();
   this->AllocateDimensions(nDims + (nComp > 1 ? 1 : 0));
 
-  MetaDataDictionary & thisDic = GetMetaDataDictionary();
+  const MetaDataDictionary & thisDic = GetMetaDataDictionary();
 
   unsigned int minc_dimensions = 0;
   double       tstart = 0.0;
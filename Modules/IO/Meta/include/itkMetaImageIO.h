@@ -82,6 +82,12 @@ public:
   void
   Read(void * buffer) override;
 
+  /** Get the location of the pixel data, when they are not compressed,
+   * not split in several files (LIST or file name patterns), and in the
+   * byte order of this machine. */
+  bool
+  GetPixelDataFileLocation(std::string & fileName, SizeValueType & offset) const override;
+
   MetaImage *
   GetMetaImagePointer();
 
@@ -134,12 +140,13 @@ public:
                            const ImageIORegion & largestPossibleRegion) override;
 
   /** Determine if the ImageIO can stream reading from this
-   *  file. Only time cannot stream read/write is if compression is used.
+   *  file. Compressed files can only be stream read if they were
+   *  written in chunks, see SetCompressionChunkSize().
    *  CanRead must be called prior to this function. */
   bool
   CanStreamRead() override
   {
-    if (m_MetaImage.CompressedData())
+    if (m_MetaImage.CompressedData() && m_MetaImage.CompressedDataChunks() < 2)
     {
       return false;
     }
@@ -167,6 +174,15 @@ public:
   itkSetMacro(SubSamplingFactor, unsigned int);
   itkGetConstMacro(SubSamplingFactor, unsigned int);
 
+  /** Number of uncompressed bytes deflated independently of each other
+   *  when compression is used. The chunks are compressed in parallel and
+   *  their offsets are recorded in the header, so that they can also be
+   *  inflated in parallel and stream read by region. The data remains a
+   *  single zlib stream that readers unaware of the chunks decode as before.
+   *  Zero compresses the data as one stream. Defaults to 1 MiB. */
+  itkSetMacro(CompressionChunkSize, SizeValueType);
+  itkGetConstMacro(CompressionChunkSize, SizeValueType);
+
   /**
    * Set the default precision when writing out the MetaImage header.
    * MetaImage header contains values stored in memory as double,
@@ -199,6 +215,8 @@ private:
 
   unsigned int m_SubSamplingFactor;
 
+  SizeValueType m_CompressionChunkSize{ 1024 * 1024 };
+
   static unsigned int * m_DefaultDoublePrecision;
 };
 
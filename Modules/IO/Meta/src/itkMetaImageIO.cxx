@@ -21,6 +21,7 @@
 #include "itkIOCommon.h"
 #include "itksys/SystemTools.hxx"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
 #include "itkSingleton.h"
 
 namespace itk
@@ -56,6 +57,12 @@ MetaImageIO::MetaImageIO()
   this->Self::SetCompressor("");
   this->Self::SetMaximumCompressionLevel(9);
   this->Self::SetCompressionLevel(2);
+
+  // Let MetaIO compress and uncompress chunks on the ITK threads
+  m_MetaImage.ParallelForFunction([](int n, const std::function<void(int)> & function) {
+    MultiThreaderBase::New()->ParallelizeArray(
+      0, static_cast<SizeValueType>(n), [&function](SizeValueType i) { function(static_cast<int>(i)); }, nullptr);
+  });
 }
 
 MetaImageIO::~MetaImageIO() = default;
@@ -66,6 +73,7 @@ MetaImageIO::PrintSelf(std::ostream & os, Indent indent) const
   Superclass::PrintSelf(os, indent);
   m_MetaImage.PrintInfo();
   os << indent << "SubSamplingFactor: " << m_SubSamplingFactor << "\n";
+  os << indent << "CompressionChunkSize: " << m_CompressionChunkSize << "\n";
 }
 
 void
@@ -493,6 +501,58 @@ MetaImageIO::Read(void * buffer)
   }
 }
 
+bool
+MetaImageIO::GetPixelDataFileLocation(std::string & fileName, SizeValueType & offset) const
+{
+  if (!m_MetaImage.BinaryData() || m_MetaImage.CompressedData() ||
+      m_MetaImage.BinaryDataByteOrderMSB() != MET_SystemByteOrderMSB() || m_SubSamplingFactor != 1)
+  {
+    return false;
+  }
+
+  const std::string elementDataFileName = m_MetaImage.ElementDataFileName();
+  const bool        isLocal =
+    elementDataFileName == "LOCAL" || elementDataFileName == "Local" || elementDataFileName == "local";
+  if (isLocal)
+  {
+    fileName = m_FileName;
+  }
+  else if (elementDataFileName.empty() || elementDataFileName.compare(0, 4, "LIST") == 0 ||
+           elementDataFileName.find('%') != std::string::npos)
+  {
+    return false;
+  }
+  else if (itksys::SystemTools::FileIsFullPath(elementDataFileName))
+  {
+    fileName = elementDataFileName;
+  }
+  else
+  {
+    const std::string path = itksys::SystemTools::GetFilenamePath(m_FileName);
+    fileName = path.empty() ? elementDataFileName : path + '/' + elementDataFileName;
+  }
+
+  const SizeValueType dataSize = this->GetImageSizeInBytes();
+  const SizeValueType fileSize = itksys::SystemTools::FileLength(fileName);
+  if (fileSize < dataSize)
+  {
+    return false;
+  }
+
+  // The data of a local file follow its header, and a header size of -1
+  // means that the data are at the end of the file.
+  const int headerSize = m_MetaImage.HeaderSize();
+  if (isLocal || headerSize == -1)
+  {
+    offset = fileSize - dataSize;
+  }
+  else
+  {
+    offset = (headerSize > 0) ? static_cast<SizeValueType>(headerSize) : 0;
+  }
+  return offset + dataSize <= fileSize;
+}
+
 MetaImage *
 MetaImageIO::GetMetaImagePointer()
 {
@@ -1077,6 +1137,7 @@ MetaImageIO ::Write(const void * buffer)
 
   m_MetaImage.CompressedData(m_UseCompression);
   m_MetaImage.CompressionLevel(this->GetCompressionLevel());
+  m_MetaImage.CompressionChunkSize(static_cast<std::streamoff>(m_CompressionChunkSize));
 
   // this is a check to see if we are actually streaming
   // we initialize with m_IORegion to match dimensions
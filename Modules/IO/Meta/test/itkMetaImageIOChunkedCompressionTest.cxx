@@ -0,0 +1,194 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMetaImageIO.h"
+#include "itkTestingMacros.h"
+#include "itk_zlib.h"
+
+// Write compressed MetaImages in chunks and read them back whole, by
+// region, with a plain zlib inflate and with a stale chunk index.
+
+namespace
+{
+
+using PixelType = unsigned short;
+using ImageType = itk::Image<PixelType, 3>;
+
+std::string
+ReadFile(const std::string & fileName)
+{
+  std::ifstream file(fileName.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::streamoff
+GetHeaderValue(const std::string & contents, const std::string & field)
+{
+  const std::string::size_type pos = contents.find(field + " = ");
+  if (pos == std::string::npos)
+  {
+    return -1;
+  }
+  return std::stoll(contents.substr(pos + field.size() + 3));
+}
+
+bool
+SameImages(const ImageType * expected, const ImageType * actual, const ImageType::RegionType & region)
+{
+  itk::ImageRegionConstIterator<ImageType> expectedIt(expected, region);
+  itk::ImageRegionConstIterator<ImageType> actualIt(actual, region);
+  for (; !expectedIt.IsAtEnd(); ++expectedIt, ++actualIt)
+  {
+    if (expectedIt.Get() != actualIt.Get())
+    {
+      std::cerr << "Pixel mismatch at " << expectedIt.GetIndex() << ": expected " << expectedIt.Get() << ", got "
+                << actualIt.Get() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+ImageType::Pointer
+ReadImage(const std::string & fileName, const ImageType::RegionType & region)
+{
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->SetImageIO(itk::MetaImageIO::New());
+  reader->UpdateOutputInformation();
+  reader->GetOutput()->SetRequestedRegion(region);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+} // namespace
+
+int
+itkMetaImageIOChunkedCompressionTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputDirectory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string chunkedFileName = std::string(argv[1]) + "/MetaImageChunkedCompression.mha";
+  const std::string staleFileName = std::string(argv[1]) + "/MetaImageChunkedCompressionStale.mha";
+  const std::string singleFileName = std::string(argv[1]) + "/MetaImageChunkedCompressionSingle.mha";
+
+  ImageType::SizeType   size = { { 64, 48, 40 } };
+  ImageType::RegionType largestRegion(size);
+  auto                  image = ImageType::New();
+  image->SetRegions(largestRegion);
+  image->Allocate();
+  PixelType * buffer = image->GetBufferPointer();
+  for (itk::SizeValueType i = 0; i < largestRegion.GetNumberOfPixels(); ++i)
+  {
+    buffer[i] = static_cast<PixelType>((i * 7) % 1001 + (i / 4096));
+  }
+  const std::streamoff dataSize = largestRegion.GetNumberOfPixels() * sizeof(PixelType);
+
+  // Chunked write
+  auto io = itk::MetaImageIO::New();
+  ITK_TEST_SET_GET_VALUE(1024 * 1024, io->GetCompressionChunkSize());
+  io->SetCompressionChunkSize(16384);
+  ITK_TEST_SET_GET_VALUE(16384, io->GetCompressionChunkSize());
+
+  auto writer = itk::ImageFileWriter<ImageType>::New();
+  writer->SetInput(image);
+  writer->SetImageIO(io);
+  writer->SetFileName(chunkedFileName);
+  writer->UseCompressionOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  const std::string contents = ReadFile(chunkedFileName);
+  ITK_TEST_EXPECT_EQUAL(GetHeaderValue(contents, "CompressedDataChunkSize"), 16384);
+  ITK_TEST_EXPECT_EQUAL(GetHeaderValue(contents, "CompressedDataChunks"), (dataSize + 16383) / 16384);
+
+  // Readers unaware of the chunks see a single zlib stream
+  const std::streamoff compressedDataSize = GetHeaderValue(contents, "CompressedDataSize");
+  ITK_TEST_EXPECT_TRUE(compressedDataSize > 0 && compressedDataSize < static_cast<std::streamoff>(contents.size()));
+  const auto * compressedData = reinterpret_cast<const Bytef *>(contents.data() + contents.size() - compressedDataSize);
+  std::vector<PixelType> inflated(largestRegion.GetNumberOfPixels());
+  auto                   inflatedSize = static_cast<uLongf>(dataSize);
+  const int              err =
+    uncompress(reinterpret_cast<Bytef *>(inflated.data()), &inflatedSize, compressedData, compressedDataSize);
+  ITK_TEST_EXPECT_EQUAL(err, Z_OK);
+  ITK_TEST_EXPECT_EQUAL(static_cast<std::streamoff>(inflatedSize), dataSize);
+  ITK_TEST_EXPECT_TRUE(std::equal(inflated.begin(), inflated.end(), buffer));
+
+  // Whole image, inflated chunk by chunk
+  ImageType::Pointer readImage;
+  ITK_TRY_EXPECT_NO_EXCEPTION(readImage = ReadImage(chunkedFileName, largestRegion));
+  ITK_TEST_EXPECT_TRUE(SameImages(image, readImage, largestRegion));
+
+  // A region, inflating only the chunks that cover it
+  auto readerIO = itk::MetaImageIO::New();
+  readerIO->SetFileName(chunkedFileName);
+  readerIO->ReadImageInformation();
+  ITK_TEST_EXPECT_TRUE(readerIO->CanStreamRead());
+
+  ImageType::IndexType  regionIndex = { { 5, 7, 21 } };
+  ImageType::SizeType   regionSize = { { 30, 20, 3 } };
+  ImageType::RegionType region(regionIndex, regionSize);
+  ITK_TRY_EXPECT_NO_EXCEPTION(readImage = ReadImage(chunkedFileName, region));
+  ITK_TEST_EXPECT_EQUAL(readImage->GetBufferedRegion(), region);
+  ITK_TEST_EXPECT_TRUE(SameImages(image, readImage, region));
+
+  // A stale index that passes validation is caught by the checksum, and the
+  // data is then inflated as a single stream
+  std::string                  stale = contents;
+  const std::string            offsetsField = "CompressedDataChunkOffsets = ";
+  const std::string::size_type offsetsBegin = stale.find(offsetsField) + offsetsField.size();
+  const std::string::size_type offsetsEnd = stale.find('\n', offsetsBegin);
+  std::istringstream           offsets(stale.substr(offsetsBegin, offsetsEnd - offsetsBegin));
+  std::ostringstream           staleOffsets;
+  std::streamoff               offset;
+  offsets >> offset;
+  staleOffsets << offset;
+  while (offsets >> offset)
+  {
+    staleOffsets << ' ' << offset + 1;
+  }
+  stale.replace(offsetsBegin, offsetsEnd - offsetsBegin, staleOffsets.str());
+  std::ofstream(staleFileName.c_str(), std::ios::binary) << stale;
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(readImage = ReadImage(staleFileName, largestRegion));
+  ITK_TEST_EXPECT_TRUE(SameImages(image, readImage, largestRegion));
+
+  // Without chunks no index is written
+  io->SetCompressionChunkSize(0);
+  writer->SetFileName(singleFileName);
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+  ITK_TEST_EXPECT_EQUAL(GetHeaderValue(ReadFile(singleFileName), "CompressedDataChunks"), -1);
+
+  readerIO->SetFileName(singleFileName);
+  readerIO->ReadImageInformation();
+  ITK_TEST_EXPECT_TRUE(!readerIO->CanStreamRead());
+  ITK_TRY_EXPECT_NO_EXCEPTION(readImage = ReadImage(singleFileName, largestRegion));
+  ITK_TEST_EXPECT_TRUE(SameImages(image, readImage, largestRegion));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -78,6 +78,12 @@ public:
   void
   Read(void * buffer) override;
 
+  /** The components of all the pixel types but the symmetric second rank
+   * tensors, which may be stored with a mask, can be read and written in
+   * planes. */
+  bool
+  CanUsePlanarComponents() override;
+
   /** Determine the file type. Returns true if this ImageIO can write the
    * file specified. */
   bool
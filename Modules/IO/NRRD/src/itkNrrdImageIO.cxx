@@ -39,6 +39,9 @@ NrrdImageIO::NrrdImageIO()
     this->AddSupportedReadExtension(ext);
   }
 
+  // The magic of every format version, "NRRD000X".
+  this->AddSupportedReadSignature(0, "NRRD");
+
   this->Self::SetCompressor("");
   this->Self::SetMaximumCompressionLevel(9);
   this->Self::SetCompressionLevel(2);
@@ -711,6 +714,12 @@ NrrdImageIO::ReadImageInformation()
   }
 }
 
+bool
+NrrdImageIO::CanUsePlanarComponents()
+{
+  return IOPixelEnum::SYMMETRICSECONDRANKTENSOR != this->GetPixelType();
+}
+
 void
 NrrdImageIO::Read(void * buffer)
 {
@@ -782,7 +791,30 @@ NrrdImageIO::Read(void * buffer)
     itkExceptionMacro("Read: handling more than one non-scalar axis "
                       "not currently handled");
   }
-  if (1 == rangeAxisNum && 0 != rangeAxisIdx[0])
+  // When the components are read in planes, the range axis goes to the
+  // slowest axis rather than to the fastest one.
+  const bool usePlanarComponents = this->GetUsePlanarComponents() && !nrrdAllocated;
+  if (1 == rangeAxisNum && usePlanarComponents && nrrd->dim - 1 != rangeAxisIdx[0])
+  {
+    // the range (dependent variable) is not on the slowest axis,
+    // so we have to permute axes to put it there
+    Nrrd *       ntmp = nrrdNew();
+    unsigned int axmap[NRRD_DIM_MAX];
+    for (unsigned int axi = 0; axi + 1 < nrrd->dim; ++axi)
+    {
+      axmap[axi] = axi + (axi >= rangeAxisIdx[0]);
+    }
+    axmap[nrrd->dim - 1] = rangeAxisIdx[0];
+    // The memory size of the input and output of nrrdAxesPermute is
+    // the same; the existing nrrd->data is re-used.
+    if (nrrdCopy(ntmp, nrrd) || nrrdAxesPermute(nrrd, ntmp, axmap))
+    {
+      char * err = biffGetDone(NRRD); // would be nice to free(err)
+      itkExceptionMacro("Read: Error permuting independent axis in " << this->GetFileName() << ":\n" << err);
+    }
+    nrrdNuke(ntmp);
+  }
+  else if (1 == rangeAxisNum && !usePlanarComponents && 0 != rangeAxisIdx[0])
   {
     // the range (dependent variable) is not on the fastest axis,
     // so we have to permute axes to put it there, since that is
@@ -882,47 +914,50 @@ NrrdImageIO::Write(const void * buffer)
   spaceDim = this->GetNumberOfDimensions();
   if (this->GetNumberOfComponents() > 1)
   {
-    size[0] = this->GetNumberOfComponents();
+    // The range axis is the fastest axis, or the slowest one when the
+    // components are in planes.
+    const unsigned int rangeAxis = this->GetUsePlanarComponents() ? spaceDim : 0;
+    size[rangeAxis] = this->GetNumberOfComponents();
     switch (this->GetPixelType())
     {
       case IOPixelEnum::RGB:
-        kind[0] = nrrdKindRGBColor;
+        kind[rangeAxis] = nrrdKindRGBColor;
         break;
       case IOPixelEnum::RGBA:
-        kind[0] = nrrdKindRGBAColor;
+        kind[rangeAxis] = nrrdKindRGBAColor;
         break;
       case IOPixelEnum::POINT:
-        kind[0] = nrrdKindPoint;
+        kind[rangeAxis] = nrrdKindPoint;
         break;
       case IOPixelEnum::COVARIANTVECTOR:
-        kind[0] = nrrdKindCovariantVector;
+        kind[rangeAxis] = nrrdKindCovariantVector;
         break;
       case IOPixelEnum::SYMMETRICSECONDRANKTENSOR:
       case IOPixelEnum::DIFFUSIONTENSOR3D:
-        kind[0] = nrrdKind3DSymMatrix;
+        kind[rangeAxis] = nrrdKind3DSymMatrix;
         break;
       case IOPixelEnum::COMPLEX:
-        kind[0] = nrrdKindComplex;
+        kind[rangeAxis] = nrrdKindComplex;
         break;
       case IOPixelEnum::VECTOR:
       case IOPixelEnum::OFFSET:     // HEY is this right?
       case IOPixelEnum::FIXEDARRAY: // HEY is this right?
       default:
-        kind[0] = nrrdKindVector;
+        kind[rangeAxis] = nrrdKindVector;
         break;
     }
     // the range axis has no space direction
     for (unsigned int saxi = 0; saxi < spaceDim; ++saxi)
     {
-      spaceDir[0][saxi] = AIR_NAN;
+      spaceDir[rangeAxis][saxi] = AIR_NAN;
     }
-    baseDim = 1;
+    baseDim = (rangeAxis == 0) ? 1 : 0;
   }
   else
   {
     baseDim = 0;
   }
-  nrrdDim = baseDim + spaceDim;
+  nrrdDim = spaceDim + (this->GetNumberOfComponents() > 1 ? 1 : 0);
   std::vector<double> spaceDirStd(spaceDim);
   unsigned int        axi;
   for (axi = 0; axi < spaceDim; ++axi)
@@ -0,0 +1,152 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkNrrdImageIO.h"
+#include "itkPlanarVectorImage.h"
+#include "itkVectorImage.h"
+#include "itkTestingMacros.h"
+
+// Writes and reads PlanarVectorImage, whose components are stored along the
+// slowest axis of the NRRD files, and VectorImage, whose components are
+// stored along the fastest axis.
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+constexpr unsigned int NumberOfComponents = 4;
+
+using PlanarImageType = itk::PlanarVectorImage<float, Dimension>;
+using VectorImageType = itk::VectorImage<float, Dimension>;
+
+float
+ComponentValue(const itk::Index<Dimension> & index, unsigned int k)
+{
+  return static_cast<float>(1000 * k + 100 * index[2] + 10 * index[1] + index[0]);
+}
+
+template <typename TImage>
+typename TImage::Pointer
+MakeImage()
+{
+  auto                       image = TImage::New();
+  const itk::Size<Dimension> size{ { 7, 5, 3 } };
+  image->SetRegions(size);
+  image->SetNumberOfComponentsPerPixel(NumberOfComponents);
+  image->Allocate();
+
+  typename TImage::PixelType pixel(NumberOfComponents);
+  for (itk::ImageRegionConstIteratorWithIndex<TImage> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    for (unsigned int k = 0; k < NumberOfComponents; ++k)
+    {
+      pixel[k] = ComponentValue(it.GetIndex(), k);
+    }
+    image->SetPixel(it.GetIndex(), pixel);
+  }
+  return image;
+}
+
+template <typename TImage>
+bool
+HasComponentValues(const TImage * image)
+{
+  if (image->GetNumberOfComponentsPerPixel() != NumberOfComponents)
+  {
+    std::cerr << "Expected " << NumberOfComponents << " components, got " << image->GetNumberOfComponentsPerPixel()
+              << std::endl;
+    return false;
+  }
+  for (itk::ImageRegionConstIteratorWithIndex<TImage> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    const typename TImage::PixelType pixel = it.Get();
+    for (unsigned int k = 0; k < NumberOfComponents; ++k)
+    {
+      if (pixel[k] != ComponentValue(it.GetIndex(), k))
+      {
+        std::cerr << "Wrong component " << k << " at " << it.GetIndex() << ": " << pixel[k] << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename TImage>
+void
+Write(const TImage * image, const std::string & fileName)
+{
+  auto writer = itk::ImageFileWriter<TImage>::New();
+  writer->SetImageIO(itk::NrrdImageIO::New());
+  writer->SetInput(image);
+  writer->SetFileName(fileName);
+  writer->Update();
+}
+
+template <typename TImage>
+typename TImage::Pointer
+Read(const std::string & fileName, bool & usedPlanarComponents)
+{
+  auto reader = itk::ImageFileReader<TImage>::New();
+  auto imageIO = itk::NrrdImageIO::New();
+  reader->SetImageIO(imageIO);
+  reader->SetFileName(fileName);
+  reader->Update();
+  usedPlanarComponents = imageIO->GetUsePlanarComponents();
+  return reader->GetOutput();
+}
+} // namespace
+
+int
+itkNrrdPlanarVectorImageReadWriteTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputDirectory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string planarFileName = std::string(argv[1]) + "/itkNrrdPlanarVectorImageReadWriteTest_planar.nrrd";
+  const std::string vectorFileName = std::string(argv[1]) + "/itkNrrdPlanarVectorImageReadWriteTest_vector.nrrd";
+
+  bool usedPlanarComponents = false;
+  ITK_TRY_EXPECT_NO_EXCEPTION(Write(MakeImage<PlanarImageType>().GetPointer(), planarFileName));
+  ITK_TRY_EXPECT_NO_EXCEPTION(Write(MakeImage<VectorImageType>().GetPointer(), vectorFileName));
+
+  // The planes are read without conversion.
+  PlanarImageType::Pointer planarImage;
+  ITK_TRY_EXPECT_NO_EXCEPTION(planarImage = Read<PlanarImageType>(planarFileName, usedPlanarComponents));
+  ITK_TEST_EXPECT_TRUE(usedPlanarComponents);
+  ITK_TEST_EXPECT_TRUE(HasComponentValues(planarImage.GetPointer()));
+
+  // The planes are interleaved.
+  VectorImageType::Pointer vectorImage;
+  ITK_TRY_EXPECT_NO_EXCEPTION(vectorImage = Read<VectorImageType>(planarFileName, usedPlanarComponents));
+  ITK_TEST_EXPECT_TRUE(!usedPlanarComponents);
+  ITK_TEST_EXPECT_TRUE(HasComponentValues(vectorImage.GetPointer()));
+
+  // The interleaved components are put in planes.
+  ITK_TRY_EXPECT_NO_EXCEPTION(planarImage = Read<PlanarImageType>(vectorFileName, usedPlanarComponents));
+  ITK_TEST_EXPECT_TRUE(usedPlanarComponents);
+  ITK_TEST_EXPECT_TRUE(HasComponentValues(planarImage.GetPointer()));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
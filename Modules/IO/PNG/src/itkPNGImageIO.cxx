@@ -300,6 +300,8 @@ PNGImageIO::PNGImageIO()
     this->AddSupportedWriteExtension(ext);
     this->AddSupportedReadExtension(ext);
   }
+
+  this->AddSupportedReadSignature(0, "\x89PNG\r\n\x1a\n");
 }
 
 PNGImageIO::~PNGImageIO() = default;
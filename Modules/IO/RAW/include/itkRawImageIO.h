@@ -123,6 +123,11 @@ public:
   void
   Read(void * buffer) override;
 
+  /** Get the location of the pixel data, when the file is binary and in
+   * the byte order of this machine. */
+  bool
+  GetPixelDataFileLocation(std::string & fileName, SizeValueType & offset) const override;
+
   /** Set/Get the Data mask. */
   itkGetConstReferenceMacro(ImageMask, unsigned short);
   void
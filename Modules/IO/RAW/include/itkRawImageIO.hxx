@@ -20,6 +20,7 @@
 
 #include "itkRawImageIO.h"
 #include "itkIntTypes.h"
+#include "itksys/SystemTools.hxx"
 
 
 namespace itk
@@ -162,6 +163,31 @@ RawImageIO<TPixel, VImageDimension>::Read(void * buffer)
   ReadRawBytesAfterSwapping(componentType, buffer, m_ByteOrder, numberOfComponents);
 }
 
+template <typename TPixel, unsigned int VImageDimension>
+bool
+RawImageIO<TPixel, VImageDimension>::GetPixelDataFileLocation(std::string & fileName, SizeValueType & offset) const
+{
+  const bool isBigEndian = (m_ByteOrder == IOByteOrderEnum::BigEndian);
+  if (m_FileType != IOFileEnum::Binary || m_FileName.empty() ||
+      (sizeof(ComponentType) > 1 && isBigEndian != ByteSwapperType::SystemIsBigEndian()))
+  {
+    return false;
+  }
+
+  const SizeValueType dataSize = this->GetImageSizeInBytes();
+  const SizeValueType fileSize = itksys::SystemTools::FileLength(m_FileName);
+  if (fileSize < dataSize)
+  {
+    return false;
+  }
+
+  fileName = m_FileName;
+  // Like GetHeaderSize(), the data are at the end of the file unless the
+  // header size was set.
+  offset = m_ManualHeaderSize ? m_HeaderSize : fileSize - dataSize;
+  return offset + dataSize <= fileSize;
+}
+
 template <typename TPixel, unsigned int VImageDimension>
 bool
 RawImageIO<TPixel, VImageDimension>::CanWriteFile(const char * fname)
@@ -83,6 +83,13 @@ public:
   virtual void
   ReadVolume(void * buffer);
 
+  /** The components of RGB images, stored with PLANARCONFIG_CONTIG or
+   * PLANARCONFIG_SEPARATE, can be read in planes. Multi-component images
+   * are written with PLANARCONFIG_SEPARATE when their components are in
+   * planes, unless they are compressed with JPEG. */
+  bool
+  CanUsePlanarComponents() override;
+
   /*-------- This part of the interfaces deals with writing data. ----- */
 
   /** Determine the file type. Returns true if this ImageIO can read the
@@ -259,6 +266,13 @@ private:
   void
   ReadGenericImage(void * _out, unsigned int width, unsigned int height);
 
+  /** Read the samples of an RGB image stored with PLANARCONFIG_SEPARATE,
+   * or read the samples of an RGB image in planes, see
+   * SetUsePlanarComponents(). */
+  template <typename TComponent>
+  void
+  ReadComponents(void * _out, unsigned int width, unsigned int height);
+
   template <typename TComponent>
   void
   RGBAImageToBuffer(void * out, const uint32_t * tempImage);
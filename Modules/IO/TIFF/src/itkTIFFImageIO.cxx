@@ -168,7 +168,9 @@ TIFFImageIO::ReadVolume(void * buffer)
     }
 
 
-    const size_t pixelOffset = width * height * this->GetNumberOfComponents() * page;
+    // The pages of the planes of the components follow each other.
+    const size_t pixelOffset =
+      width * height * (this->GetUsePlanarComponents() ? 1 : this->GetNumberOfComponents()) * page;
 
     ReadCurrentPage(buffer, pixelOffset);
 
@@ -189,6 +191,11 @@ TIFFImageIO::Read(void * buffer)
     }
   }
 
+  if (this->GetUsePlanarComponents() && !this->CanUsePlanarComponents())
+  {
+    itkExceptionMacro(<< "Cannot read the components of " << this->m_FileName << " in planes");
+  }
+
   // The IO region should be of dimensions 3 otherwise we read only the first
   // page
   if (m_InternalImage->m_NumberOfPages > 0 && this->GetIORegion().GetImageDimension() > 2)
@@ -203,6 +210,16 @@ TIFFImageIO::Read(void * buffer)
   m_InternalImage->Clean();
 }
 
+bool
+TIFFImageIO::CanUsePlanarComponents()
+{
+  if (m_InternalImage->m_IsOpen)
+  {
+    return m_InternalImage->CanRead() && this->GetFormat() == TIFFImageIO::RGB_;
+  }
+  return !(m_UseCompression && m_Compression == TIFFImageIO::JPEG);
+}
+
 TIFFImageIO::TIFFImageIO()
   : m_ColorPalette(0)
 
@@ -233,6 +250,12 @@ TIFFImageIO::TIFFImageIO()
     this->AddSupportedWriteExtension(ext);
     this->AddSupportedReadExtension(ext);
   }
+
+  // The byte order marks and the version numbers of classic TIFF and BigTIFF.
+  this->AddSupportedReadSignature(0, std::string("II\x2a\x00", 4));
+  this->AddSupportedReadSignature(0, std::string("MM\x00\x2a", 4));
+  this->AddSupportedReadSignature(0, std::string("II\x2b\x00", 4));
+  this->AddSupportedReadSignature(0, std::string("MM\x00\x2b", 4));
 }
 
 TIFFImageIO::~TIFFImageIO()
@@ -575,6 +598,9 @@ TIFFImageIO::InternalWrite(const void * buffer)
   }
 
   auto   scomponents = static_cast<uint16_t>(this->GetNumberOfComponents());
+  // The samples are written in separate planes when the components of the
+  // buffer are in planes.
+  const bool separate = this->GetUsePlanarComponents() && scomponents > 1 && this->CanUsePlanarComponents();
   double resolution_x{ m_Spacing[0] != 0.0 ? 25.4 / m_Spacing[0] : 0.0 };
   double resolution_y{ m_Spacing[1] != 0.0 ? 25.4 / m_Spacing[1] : 0.0 };
   // rowsperstrip is set to a default value but modified based on the tif scanlinesize before
@@ -655,7 +681,7 @@ TIFFImageIO::InternalWrite(const void * buffer)
     TIFFSetField(tif, TIFFTAG_ORIENTATION, ORIENTATION_TOPLEFT);
     TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, scomponents);
     TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, bps); // Fix for stype
-    TIFFSetField(tif, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+    TIFFSetField(tif, TIFFTAG_PLANARCONFIG, separate ? PLANARCONFIG_SEPARATE : PLANARCONFIG_CONTIG);
     if (this->GetComponentType() == IOComponentEnum::SHORT || this->GetComponentType() == IOComponentEnum::CHAR)
     {
       TIFFSetField(tif, TIFFTAG_SAMPLEFORMAT, SAMPLEFORMAT_INT);
@@ -816,18 +842,41 @@ TIFFImageIO::InternalWrite(const void * buffer)
         itkExceptionMacro(<< "TIFF supports unsigned/signed char, unsigned/signed short, and float");
     }
 
-    rowLength *= this->GetNumberOfComponents();
-    rowLength *= width;
-
-    uint32_t row = 0;
-    for (unsigned int idx2 = 0; idx2 < height; ++idx2)
+    if (separate)
     {
-      if (TIFFWriteScanline(tif, const_cast<char *>(outPtr), row, 0) < 0)
+      // The scanlines of each sample are in the plane of its component, at
+      // the offset of the page.
+      const SizeValueType componentSize = rowLength;
+      const SizeValueType planeLength = componentSize * width * height * pages;
+      const char *        pagePtr = static_cast<const char *>(buffer) + componentSize * width * height * page;
+      for (uint16_t sample = 0; sample < scomponents; ++sample)
       {
-        itkExceptionMacro(<< "TIFFImageIO: error out of disk space");
+        const char * samplePtr = pagePtr + sample * planeLength;
+        for (uint32_t row = 0; row < h; ++row)
+        {
+          if (TIFFWriteScanline(tif, const_cast<char *>(samplePtr), row, sample) < 0)
+          {
+            itkExceptionMacro(<< "TIFFImageIO: error out of disk space");
+          }
+          samplePtr += componentSize * width;
+        }
+      }
+    }
+    else
+    {
+      rowLength *= this->GetNumberOfComponents();
+      rowLength *= width;
+
+      uint32_t row = 0;
+      for (unsigned int idx2 = 0; idx2 < height; ++idx2)
+      {
+        if (TIFFWriteScanline(tif, const_cast<char *>(outPtr), row, 0) < 0)
+        {
+          itkExceptionMacro(<< "TIFFImageIO: error out of disk space");
+        }
+        outPtr += rowLength;
+        ++row;
       }
-      outPtr += rowLength;
-      ++row;
     }
 
     if (m_NumberOfDimensions == 3)
@@ -1352,6 +1401,23 @@ TIFFImageIO::ReadGenericImage(void * _out, unsigned int width, unsigned int heig
 {
   using ComponentType = TComponent;
 
+  if (m_InternalImage->m_Orientation != ORIENTATION_TOPLEFT && m_InternalImage->m_Orientation != ORIENTATION_BOTLEFT)
+  {
+    itkExceptionMacro(<< "This reader can only do ORIENTATION_TOPLEFT and  ORIENTATION_BOTLEFT.");
+  }
+
+  if (this->GetFormat() == TIFFImageIO::RGB_ &&
+      (this->GetUsePlanarComponents() || m_InternalImage->m_PlanarConfig == PLANARCONFIG_SEPARATE))
+  {
+    this->ReadComponents<ComponentType>(_out, width, height);
+    return;
+  }
+
+  if (m_InternalImage->m_PlanarConfig != PLANARCONFIG_CONTIG && m_InternalImage->m_SamplesPerPixel != 1)
+  {
+    itkExceptionMacro(<< "This reader can only do PLANARCONFIG_CONTIG, single-component or RGB PLANARCONFIG_SEPARATE");
+  }
+
 #ifdef TIFF_INT64_T // detect if libtiff4
   uint64_t isize = TIFFScanlineSize64(m_InternalImage->m_Image);
 #else
@@ -1365,16 +1431,6 @@ TIFFImageIO::ReadGenericImage(void * _out, unsigned int width, unsigned int heig
   auto *          out = static_cast<ComponentType *>(_out);
   ComponentType * image;
 
-  if (m_InternalImage->m_PlanarConfig != PLANARCONFIG_CONTIG && m_InternalImage->m_SamplesPerPixel != 1)
-  {
-    itkExceptionMacro(<< "This reader can only do PLANARCONFIG_CONTIG or single-component PLANARCONFIG_SEPARATE");
-  }
-
-  if (m_InternalImage->m_Orientation != ORIENTATION_TOPLEFT && m_InternalImage->m_Orientation != ORIENTATION_BOTLEFT)
-  {
-    itkExceptionMacro(<< "This reader can only do ORIENTATION_TOPLEFT and  ORIENTATION_BOTLEFT.");
-  }
-
 
   switch (this->GetFormat())
   {
@@ -1485,6 +1541,70 @@ TIFFImageIO::ReadGenericImage(void * _out, unsigned int width, unsigned int heig
   _TIFFfree(buf);
 }
 
+template <typename TComponent>
+void
+TIFFImageIO::ReadComponents(void * _out, unsigned int width, unsigned int height)
+{
+  using ComponentType = TComponent;
+
+  const size_t numberOfComponents = m_InternalImage->m_SamplesPerPixel;
+  const bool   separate = (m_InternalImage->m_PlanarConfig == PLANARCONFIG_SEPARATE);
+
+  // The distances between the components of a pixel, and between two
+  // pixels, in the output buffer.
+  const size_t componentStride = this->GetUsePlanarComponents() ? this->GetIORegion().GetNumberOfPixels() : 1;
+  const size_t pixelStride = this->GetUsePlanarComponents() ? 1 : numberOfComponents;
+
+#ifdef TIFF_INT64_T // detect if libtiff4
+  uint64_t isize = TIFFScanlineSize64(m_InternalImage->m_Image);
+#else
+  tsize_t isize = TIFFScanlineSize(m_InternalImage->m_Image);
+#endif
+  tdata_t buf = _TIFFmalloc(static_cast<tmsize_t>(isize));
+
+  auto * out = static_cast<ComponentType *>(_out);
+
+  // With PLANARCONFIG_SEPARATE, each sample is stored in its own plane of
+  // scanlines; otherwise the samples of a scanline are interleaved.
+  const size_t numberOfSamplePlanes = separate ? numberOfComponents : 1;
+  for (size_t sample = 0; sample < numberOfSamplePlanes; ++sample)
+  {
+    for (uint32_t row = 0; row < height; ++row)
+    {
+      if (TIFFReadScanline(m_InternalImage->m_Image, buf, row, static_cast<uint16_t>(sample)) <= 0)
+      {
+        _TIFFfree(buf);
+        itkExceptionMacro(<< "Problem reading the row: " << row);
+      }
+
+      const size_t    outputRow = (m_InternalImage->m_Orientation == ORIENTATION_TOPLEFT) ? row : height - (row + 1);
+      ComponentType * image = out + pixelStride * width * outputRow;
+      const auto *    line = static_cast<const ComponentType *>(buf);
+      if (separate)
+      {
+        ComponentType * component = image + sample * componentStride;
+        for (size_t x = 0; x < width; ++x)
+        {
+          component[x * pixelStride] = line[x];
+        }
+      }
+      else
+      {
+        for (size_t k = 0; k < numberOfComponents; ++k)
+        {
+          ComponentType * component = image + k * componentStride;
+          for (size_t x = 0; x < width; ++x)
+          {
+            component[x * pixelStride] = line[x * numberOfComponents + k];
+          }
+        }
+      }
+    }
+  }
+
+  _TIFFfree(buf);
+}
+
 // iso component scalar
 template <typename TType>
 void
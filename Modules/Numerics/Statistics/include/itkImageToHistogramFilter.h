@@ -21,7 +21,7 @@
 #include <mutex>
 
 #include "itkHistogram.h"
-#include "itkImageSink.h"
+#include "itkImageReduceFilter.h"
 #include "itkSimpleDataObjectDecorator.h"
 #include "itkProgressReporter.h"
 
@@ -29,6 +29,14 @@ namespace itk
 {
 namespace Statistics
 {
+namespace ImageToHistogramFilterDetail
+{
+/** The type of the histograms of ImageToHistogramFilter. */
+template <typename TImage>
+using HistogramType =
+  Histogram<typename NumericTraits<typename NumericTraits<typename TImage::PixelType>::ValueType>::RealType>;
+} // end namespace ImageToHistogramFilterDetail
+
 /**
  *\class ImageToHistogramFilter
  *  \brief This class generates a histogram from an image.
@@ -40,26 +48,29 @@ namespace Statistics
  * This filter is automatically multi-threaded. When
  * AutoMinimumMaximum is off and the NumberOfStreamDivisions is set to more than
  * one, then this filter streams its input in a series of requested
- * regions. A histogram is computed for each streamed and threaded
- * region then merged.
+ * regions. A histogram is computed for blocks of each streamed region
+ * then merged, see ImageReduceFilter. As the frequencies are integers,
+ * a region is split into at most one block per work unit, which bounds
+ * the memory of the histograms.
  *
  * \ingroup ITKStatistics
  */
 
 template <typename TImage>
-class ITK_TEMPLATE_EXPORT ImageToHistogramFilter : public ImageSink<TImage>
+class ITK_TEMPLATE_EXPORT ImageToHistogramFilter
+  : public ImageReduceFilter<TImage, typename ImageToHistogramFilterDetail::HistogramType<TImage>::Pointer>
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(ImageToHistogramFilter);
 
   /** Standard type alias */
   using Self = ImageToHistogramFilter;
-  using Superclass = ImageSink<TImage>;
+  using Superclass = ImageReduceFilter<TImage, typename ImageToHistogramFilterDetail::HistogramType<TImage>::Pointer>;
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
   /** Run-time type information (and related methods). */
-  itkTypeMacro(ImageToHistogramFilter, ImageSink);
+  itkTypeMacro(ImageToHistogramFilter, ImageReduceFilter);
 
   /** standard New() method support */
   itkNewMacro(Self);
@@ -164,19 +175,33 @@ protected:
   unsigned int
   GetNumberOfInputRequestedRegions() override;
 
+  /** Requests at most one block per work unit. */
+  unsigned int
+  GetRequestedNumberOfBlocks(const RegionType & region) const override;
+
+  /** Returns an empty histogram with the bins of the output. */
+  HistogramPointer
+  MakeAccumulator() override;
+
   void
-  ThreadedStreamedGenerateData(const RegionType &) override;
+  AccumulateRegion(const RegionType & region, HistogramPointer & histogram) override;
+
+  void
+  MergeAccumulators(HistogramPointer & histogram, HistogramPointer & other) override;
+
   virtual void
   ThreadedComputeMinimumAndMaximum(const RegionType & inputRegionForThread);
 
-
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
+  /** Merges a histogram into the accumulator of the filter, under a lock.
+   * \deprecated The histograms of the blocks are merged by
+   * MergeAccumulators(). */
   virtual void
   ThreadedMergeHistogram(HistogramPointer && histogram);
+#endif
 
   std::mutex m_Mutex;
 
-  HistogramPointer m_MergeHistogram;
-
   HistogramMeasurementVectorType m_Minimum;
   HistogramMeasurementVectorType m_Maximum;
 
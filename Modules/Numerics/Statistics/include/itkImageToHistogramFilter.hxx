@@ -20,6 +20,7 @@
 
 #include "itkImageToHistogramFilter.h"
 #include "itkImageRegionConstIterator.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -122,8 +123,6 @@ ImageToHistogramFilter<TImage>::InitializeOutputHistogram()
   m_Minimum.Fill(NumericTraits<ValueType>::max());
   m_Maximum.Fill(NumericTraits<ValueType>::NonpositiveMin());
 
-  m_MergeHistogram = nullptr;
-
   HistogramType * outputHistogram = this->GetOutput();
   outputHistogram->SetClipBinsAtEnds(true);
 
@@ -189,8 +188,8 @@ ImageToHistogramFilter<TImage>::AfterStreamedGenerateData()
   Superclass::AfterStreamedGenerateData();
 
   HistogramType * outputHistogram = this->GetOutput();
-  outputHistogram->Graft(m_MergeHistogram);
-  m_MergeHistogram = nullptr;
+  outputHistogram->Graft(this->GetAccumulator());
+  this->GetAccumulator() = nullptr;
 }
 
 
@@ -229,19 +228,34 @@ ImageToHistogramFilter<TImage>::ThreadedComputeMinimumAndMaximum(const RegionTyp
 }
 
 template <typename TImage>
-void
-ImageToHistogramFilter<TImage>::ThreadedStreamedGenerateData(const RegionType & inputRegionForThread)
+unsigned int
+ImageToHistogramFilter<TImage>::GetRequestedNumberOfBlocks(const RegionType & region) const
+{
+  // The sums of the frequencies do not depend on the number of blocks.
+  return std::min(Superclass::GetRequestedNumberOfBlocks(region),
+                  static_cast<unsigned int>(this->GetNumberOfWorkUnits()));
+}
+
+template <typename TImage>
+auto
+ImageToHistogramFilter<TImage>::MakeAccumulator() -> HistogramPointer
 {
-  const unsigned int    nbOfComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
   const HistogramType * outputHistogram = this->GetOutput();
 
   HistogramPointer histogram = HistogramType::New();
   histogram->SetClipBinsAtEnds(outputHistogram->GetClipBinsAtEnds());
-  histogram->SetMeasurementVectorSize(nbOfComponents);
+  histogram->SetMeasurementVectorSize(this->GetInput()->GetNumberOfComponentsPerPixel());
   histogram->Initialize(outputHistogram->GetSize(), m_Minimum, m_Maximum);
+  return histogram;
+}
 
+template <typename TImage>
+void
+ImageToHistogramFilter<TImage>::AccumulateRegion(const RegionType & region, HistogramPointer & histogram)
+{
+  const unsigned int nbOfComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
 
-  ImageRegionConstIterator<TImage> inputIt(this->GetInput(), inputRegionForThread);
+  ImageRegionConstIterator<TImage> inputIt(this->GetInput(), region);
   inputIt.GoToBegin();
   HistogramMeasurementVectorType m(nbOfComponents);
 
@@ -254,50 +268,36 @@ ImageToHistogramFilter<TImage>::ThreadedStreamedGenerateData(const RegionType &
     histogram->IncreaseFrequencyOfIndex(index, 1);
     ++inputIt;
   }
-
-  this->ThreadedMergeHistogram(std::move(histogram));
 }
 
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
 template <typename TImage>
 void
 ImageToHistogramFilter<TImage>::ThreadedMergeHistogram(HistogramPointer && histogram)
 {
-  while (true)
-  {
-
-    std::unique_lock<std::mutex> lock(m_Mutex);
-
-    if (m_MergeHistogram.IsNull())
-    {
-      m_MergeHistogram = std::move(histogram);
-      return;
-    }
-    else
-    {
-
-      // merge/reduce the local results with current values in m_MergeHistogram
-
-      // take ownership locally
-      HistogramPointer tomergeHistogram;
-      swap(m_MergeHistogram, tomergeHistogram);
-
-      // allow other threads to merge data
-      lock.unlock();
-
-      using HistogramIterator = typename HistogramType::ConstIterator;
+  const std::lock_guard<std::mutex> lock(m_Mutex);
 
-      HistogramIterator hit = tomergeHistogram->Begin();
-      HistogramIterator end = tomergeHistogram->End();
-
-      typename HistogramType::IndexType index;
+  HistogramPointer & mergeHistogram = this->GetAccumulator();
+  if (mergeHistogram.IsNull())
+  {
+    mergeHistogram = std::move(histogram);
+  }
+  else
+  {
+    this->MergeAccumulators(mergeHistogram, histogram);
+  }
+}
+#endif
 
-      while (hit != end)
-      {
-        histogram->GetIndex(hit.GetMeasurementVector(), index);
-        histogram->IncreaseFrequencyOfIndex(index, hit.GetFrequency());
-        ++hit;
-      }
-    }
+template <typename TImage>
+void
+ImageToHistogramFilter<TImage>::MergeAccumulators(HistogramPointer & histogram, HistogramPointer & other)
+{
+  // The histograms have the same bins.
+  const typename HistogramType::InstanceIdentifier numberOfBins = other->Size();
+  for (typename HistogramType::InstanceIdentifier bin = 0; bin < numberOfBins; ++bin)
+  {
+    histogram->IncreaseFrequency(bin, other->GetFrequency(bin));
   }
 }
 
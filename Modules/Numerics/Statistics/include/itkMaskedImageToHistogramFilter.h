@@ -90,7 +90,7 @@ protected:
   ~MaskedImageToHistogramFilter() override = default;
 
   void
-  ThreadedStreamedGenerateData(const RegionType & inputRegionForThread) override;
+  AccumulateRegion(const RegionType & region, HistogramPointer & histogram) override;
   void
   ThreadedComputeMinimumAndMaximum(const RegionType & inputRegionForThread) override;
 };
@@ -77,18 +77,13 @@ MaskedImageToHistogramFilter<TImage, TMaskImage>::ThreadedComputeMinimumAndMaxim
 
 template <typename TImage, typename TMaskImage>
 void
-MaskedImageToHistogramFilter<TImage, TMaskImage>::ThreadedStreamedGenerateData(const RegionType & inputRegionForThread)
+MaskedImageToHistogramFilter<TImage, TMaskImage>::AccumulateRegion(const RegionType & region,
+                                                                   HistogramPointer & histogram)
 {
-  const unsigned int    nbOfComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
-  const HistogramType * outputHistogram = this->GetOutput();
+  const unsigned int nbOfComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
 
-  HistogramPointer histogram = HistogramType::New();
-  histogram->SetClipBinsAtEnds(outputHistogram->GetClipBinsAtEnds());
-  histogram->SetMeasurementVectorSize(nbOfComponents);
-  histogram->Initialize(outputHistogram->GetSize(), this->m_Minimum, this->m_Maximum);
-
-  ImageRegionConstIterator<TImage>     inputIt(this->GetInput(), inputRegionForThread);
-  ImageRegionConstIterator<TMaskImage> maskIt(this->GetMaskImage(), inputRegionForThread);
+  ImageRegionConstIterator<TImage>     inputIt(this->GetInput(), region);
+  ImageRegionConstIterator<TMaskImage> maskIt(this->GetMaskImage(), region);
   inputIt.GoToBegin();
   maskIt.GoToBegin();
   HistogramMeasurementVectorType m(nbOfComponents);
@@ -107,9 +102,6 @@ MaskedImageToHistogramFilter<TImage, TMaskImage>::ThreadedStreamedGenerateData(c
     ++inputIt;
     ++maskIt;
   }
-
-
-  this->ThreadedMergeHistogram(std::move(histogram));
 }
 
 } // end of namespace Statistics
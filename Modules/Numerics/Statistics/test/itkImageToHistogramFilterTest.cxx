@@ -83,7 +83,7 @@ itkImageToHistogramFilterTest(int, char *[])
   HistogramFilterType::Pointer filter = HistogramFilterType::New();
   itk::SimpleFilterWatcher     watcher(filter, "filter");
 
-  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, ImageToHistogramFilter, ImageSink);
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, ImageToHistogramFilter, ImageReduceFilter);
   // Exercise the method NameOfClass();
   std::cout << filter->GetNameOfClass() << std::endl;
 
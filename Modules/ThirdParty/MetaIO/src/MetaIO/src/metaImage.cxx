@@ -345,6 +345,9 @@ MetaImage::PrintInfo() const
   std::cout << "ElementData = " << ((m_ElementData == nullptr) ? "NULL" : "Valid") << std::endl;
 
   std::cout << "ElementDataFileName = " << m_ElementDataFileName << std::endl;
+
+  std::cout << "CompressionChunkSize = " << m_CompressionChunkSize << std::endl;
+  std::cout << "CompressedDataChunks = " << m_CompressedDataChunkOffsets.size() << std::endl;
 }
 
 void
@@ -427,6 +430,10 @@ MetaImage::Clear()
 
   m_ElementDataFileName = "";
 
+  m_CompressionChunkSize = 0;
+  m_CompressedDataChunkSize = 0;
+  m_CompressedDataChunkOffsets.clear();
+
   MetaObject::Clear();
 
   strcpy(m_ObjectTypeName, "Image");
@@ -909,6 +916,36 @@ MetaImage::ElementData(void * _elementData, bool _autoFreeElementData)
   m_AutoFreeElementData = _autoFreeElementData;
 }
 
+std::streamoff
+MetaImage::CompressionChunkSize() const
+{
+  return m_CompressionChunkSize;
+}
+
+void
+MetaImage::CompressionChunkSize(std::streamoff _compressionChunkSize)
+{
+  m_CompressionChunkSize = _compressionChunkSize;
+}
+
+int
+MetaImage::CompressedDataChunks() const
+{
+  return static_cast<int>(m_CompressedDataChunkOffsets.size());
+}
+
+const MET_ParallelForFunctionType &
+MetaImage::ParallelForFunction() const
+{
+  return m_ParallelForFunction;
+}
+
+void
+MetaImage::ParallelForFunction(const MET_ParallelForFunctionType & _parallelForFunction)
+{
+  m_ParallelForFunction = _parallelForFunction;
+}
+
 bool
 MetaImage::ConvertElementDataTo(MET_ValueEnumType _elementType, double _toMin, double _toMax)
 {
@@ -1547,19 +1584,27 @@ MetaImage::WriteStream(std::ofstream * _stream, bool _writeElements, const void
     MET_SizeOfType(m_ElementType, &elementSize);
     int elementNumberOfBytes = elementSize * m_ElementNumberOfChannels;
 
-    if (_constElementData == nullptr)
+    const auto *   elementData =
+      static_cast<const unsigned char *>((_constElementData == nullptr) ? m_ElementData : _constElementData);
+    std::streamoff elementDataSize = m_Quantity * elementNumberOfBytes;
+
+    m_CompressedDataChunkSize = 0;
+    m_CompressedDataChunkOffsets.clear();
+    if (m_CompressionChunkSize > 0 && elementDataSize > m_CompressionChunkSize)
     {
-      compressedElementData = MET_PerformCompression(static_cast<const unsigned char *>(m_ElementData),
-                                                     m_Quantity * elementNumberOfBytes,
-                                                     &m_CompressedDataSize,
-                                                     m_CompressionLevel);
+      m_CompressedDataChunkSize = m_CompressionChunkSize;
+      compressedElementData = MET_PerformChunkedCompression(elementData,
+                                                            elementDataSize,
+                                                            &m_CompressedDataSize,
+                                                            m_CompressionLevel,
+                                                            &m_CompressedDataChunkSize,
+                                                            m_CompressedDataChunkOffsets,
+                                                            m_ParallelForFunction);
     }
     else
     {
-      compressedElementData = MET_PerformCompression(static_cast<const unsigned char *>(_constElementData),
-                                                     m_Quantity * elementNumberOfBytes,
-                                                     &m_CompressedDataSize,
-                                                     m_CompressionLevel);
+      compressedElementData =
+        MET_PerformCompression(elementData, elementDataSize, &m_CompressedDataSize, m_CompressionLevel);
     }
   }
 
@@ -1576,6 +1621,8 @@ MetaImage::WriteStream(std::ofstream * _stream, bool _writeElements, const void
 
       delete[] compressedElementData;
       m_CompressedDataSize = 0;
+      m_CompressedDataChunkSize = 0;
+      m_CompressedDataChunkOffsets.clear();
     }
     else
     {
@@ -2048,6 +2095,20 @@ MetaImage::M_SetupReadFields()
   MET_InitReadField(mF, "ElementToIntensityFunctionOffset", MET_FLOAT, false);
   m_Fields.push_back(mF);
 
+  mF = new MET_FieldRecordType;
+  MET_InitReadField(mF, "CompressedDataChunkSize", MET_ULONG_LONG, false);
+  m_Fields.push_back(mF);
+
+  mF = new MET_FieldRecordType;
+  MET_InitReadField(mF, "CompressedDataChunks", MET_INT, false);
+  m_Fields.push_back(mF);
+
+  int chunksRecNum = MET_GetFieldRecordNumber("CompressedDataChunks", &m_Fields);
+
+  mF = new MET_FieldRecordType;
+  MET_InitReadField(mF, "CompressedDataChunkOffsets", MET_ULONG_LONG_ARRAY, false, chunksRecNum);
+  m_Fields.push_back(mF);
+
   mF = new MET_FieldRecordType;
   MET_InitReadField(mF, "ElementType", MET_STRING, true);
   mF->required = true;
@@ -2148,6 +2209,23 @@ MetaImage::M_SetupWriteFields()
     m_Fields.push_back(mF);
   }
 
+  if (m_CompressedData && m_CompressedDataSize > 0 && m_CompressedDataChunkOffsets.size() > 1)
+  {
+    mF = new MET_FieldRecordType;
+    MET_InitWriteField(mF, "CompressedDataChunkSize", MET_ULONG_LONG, static_cast<double>(m_CompressedDataChunkSize));
+    m_Fields.push_back(mF);
+    mF = new MET_FieldRecordType;
+    MET_InitWriteField(mF, "CompressedDataChunks", MET_INT, static_cast<double>(m_CompressedDataChunkOffsets.size()));
+    m_Fields.push_back(mF);
+    mF = new MET_FieldRecordType;
+    MET_InitWriteField(mF,
+                       "CompressedDataChunkOffsets",
+                       MET_ULONG_LONG_ARRAY,
+                       m_CompressedDataChunkOffsets.size(),
+                       m_CompressedDataChunkOffsets.data());
+    m_Fields.push_back(mF);
+  }
+
   mF = new MET_FieldRecordType;
   MET_TypeToString(m_ElementType, s);
   MET_InitWriteField(mF, "ElementType", MET_STRING, strlen(s), s);
@@ -2276,6 +2354,22 @@ MetaImage::M_Read()
     m_ElementToIntensityFunctionOffset = mF->value[0];
   }
 
+  m_CompressedDataChunkSize = 0;
+  m_CompressedDataChunkOffsets.clear();
+  mF = MET_GetFieldRecord("CompressedDataChunkSize", &m_Fields);
+  if (mF && mF->defined)
+  {
+    m_CompressedDataChunkSize = static_cast<std::streamoff>(mF->value[0]);
+  }
+  mF = MET_GetFieldRecord("CompressedDataChunkOffsets", &m_Fields);
+  if (mF && mF->defined)
+  {
+    for (int i = 0; i < mF->length; i++)
+    {
+      m_CompressedDataChunkOffsets.push_back(static_cast<std::streamoff>(mF->value[i]));
+    }
+  }
+
   mF = MET_GetFieldRecord("ElementType", &m_Fields);
   if (mF && mF->defined)
   {
@@ -2291,6 +2385,14 @@ MetaImage::M_Read()
   return true;
 }
 
+bool
+MetaImage::M_HasValidChunkIndex(std::streamoff _uncompressedDataSize) const
+{
+  return m_CompressedDataChunkOffsets.size() > 1 &&
+         MET_IsValidChunkIndex(
+           m_CompressedDataSize, _uncompressedDataSize, m_CompressedDataChunkSize, m_CompressedDataChunkOffsets);
+}
+
 bool
 MetaImage::M_ReadElements(std::ifstream * _fstream, void * _data, std::streamoff _dataQuantity)
 {
@@ -2335,7 +2437,27 @@ MetaImage::M_ReadElements(std::ifstream * _fstream, void * _data, std::streamoff
 
     M_ReadElementData(_fstream, compr, m_CompressedDataSize);
 
-    MET_PerformUncompression(compr, m_CompressedDataSize, static_cast<unsigned char *>(_data), readSize);
+    // A chunk index lets the chunks be inflated concurrently.  The stream is
+    // still inflated as a whole if the index turns out not to match it.
+    bool uncompressed = false;
+    if (!compressedDataDeterminedFromFile && _dataQuantity == m_Quantity && M_HasValidChunkIndex(readSize))
+    {
+      uncompressed = MET_PerformChunkedUncompression(compr,
+                                                     m_CompressedDataSize,
+                                                     static_cast<unsigned char *>(_data),
+                                                     readSize,
+                                                     m_CompressedDataChunkSize,
+                                                     m_CompressedDataChunkOffsets,
+                                                     m_ParallelForFunction);
+      if (!uncompressed)
+      {
+        std::cerr << "MetaImage: M_ReadElements: chunk index does not match the data, ignoring it" << std::endl;
+      }
+    }
+    if (!uncompressed)
+    {
+      MET_PerformUncompression(compr, m_CompressedDataSize, static_cast<unsigned char *>(_data), readSize);
+    }
 
     if (compressedDataDeterminedFromFile)
     {
@@ -2904,13 +3026,95 @@ MetaImage::M_ReadElementsROI(std::ifstream * _fstream,
   {
     // if m_CompressedDataSize is not defined we assume the size of the
     // file is the size of the compressed data
+    bool compressedDataDeterminedFromFile = false;
     if (m_CompressedDataSize == 0)
     {
+      compressedDataDeterminedFromFile = true;
       _fstream->seekg(0, std::ios::end);
       m_CompressedDataSize = _fstream->tellg();
       _fstream->seekg(0, std::ios::beg);
     }
 
+    // With a chunk index, only the chunks spanning the region are inflated
+    // (concurrently) instead of the whole stream up to the region.
+    std::vector<unsigned char> span;
+    std::streamoff             spanBegin = 0;
+    std::streamoff             totalSize = _totalDataQuantity * elementNumberOfBytes;
+    if (!compressedDataDeterminedFromFile && _totalDataQuantity == m_Quantity && M_HasValidChunkIndex(totalSize))
+    {
+      std::streamoff regionBegin = 0;
+      std::streamoff regionEnd = elementNumberOfBytes;
+      for (i = 0; i < m_NDims; i++)
+      {
+        regionBegin += m_SubQuantity[i] * elementNumberOfBytes * _indexMin[i];
+        regionEnd += m_SubQuantity[i] * elementNumberOfBytes * _indexMax[i];
+      }
+      regionEnd = std::min(regionEnd, totalSize);
+
+      const std::streamoff chunkSize = m_CompressedDataChunkSize;
+      const int            numberOfChunks = static_cast<int>(m_CompressedDataChunkOffsets.size());
+      const int            firstChunk = static_cast<int>(regionBegin / chunkSize);
+      const int            lastChunk = static_cast<int>((regionEnd - 1) / chunkSize);
+      if (regionBegin < regionEnd && lastChunk < numberOfChunks)
+      {
+        const std::streamoff compressedBegin = m_CompressedDataChunkOffsets[firstChunk];
+        const std::streamoff compressedEnd =
+          (lastChunk == numberOfChunks - 1) ? m_CompressedDataSize - 4 : m_CompressedDataChunkOffsets[lastChunk + 1];
+        std::vector<unsigned char> compressed(static_cast<size_t>(compressedEnd - compressedBegin));
+        _fstream->seekg(dataPos + compressedBegin, std::ios::beg);
+        _fstream->read(reinterpret_cast<char *>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+        const bool compressedRead = _fstream->good();
+        _fstream->clear();
+        _fstream->seekg(dataPos, std::ios::beg);
+
+        spanBegin = firstChunk * chunkSize;
+        span.resize(static_cast<size_t>(std::min((lastChunk + 1) * chunkSize, totalSize) - spanBegin));
+        std::vector<char> succeeded(static_cast<size_t>(lastChunk - firstChunk + 1), 0);
+
+        auto uncompressChunk = [&](int c) {
+          const int            chunk = firstChunk + c;
+          const std::streamoff chunkBegin = m_CompressedDataChunkOffsets[chunk];
+          const std::streamoff chunkEnd =
+            (chunk == numberOfChunks - 1) ? m_CompressedDataSize - 4 : m_CompressedDataChunkOffsets[chunk + 1];
+          succeeded[c] = MET_UncompressChunk(compressed.data() + (chunkBegin - compressedBegin),
+                                             chunkEnd - chunkBegin,
+                                             span.data() + (chunk * chunkSize - spanBegin),
+                                             std::min(chunkSize, totalSize - chunk * chunkSize));
+        };
+        if (compressedRead)
+        {
+          if (m_ParallelForFunction && lastChunk > firstChunk)
+          {
+            m_ParallelForFunction(lastChunk - firstChunk + 1, uncompressChunk);
+          }
+          else
+          {
+            for (int c = 0; c <= lastChunk - firstChunk; c++)
+            {
+              uncompressChunk(c);
+            }
+          }
+        }
+        if (!compressedRead || std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end())
+        {
+          std::cerr << "MetaImage: M_ReadElementsROI: chunk index does not match the data, ignoring it" << std::endl;
+          span.clear();
+        }
+      }
+    }
+
+    // Copy from the inflated chunks when they cover the request, otherwise
+    // inflate the stream sequentially
+    auto uncompressStream = [&](std::streamoff _seekoff, unsigned char * _out, std::streamoff _size) {
+      if (!span.empty() && _seekoff >= spanBegin &&
+          _seekoff + _size <= spanBegin + static_cast<std::streamoff>(span.size()))
+      {
+        memcpy(_out, span.data() + (_seekoff - spanBegin), static_cast<size_t>(_size));
+        return _size;
+      }
+      return MET_UncompressStream(_fstream, _seekoff, _out, _size, m_CompressedDataSize, m_CompressionTable);
+    };
+
     auto * data = static_cast<unsigned char *>(_data);
     // Initialize the index
     int * currentIndex = new int[m_NDims];
@@ -2949,8 +3153,7 @@ MetaImage::M_ReadElementsROI(std::ifstream * _fstream,
       if (subSamplingFactor > 1)
       {
         auto *         subdata = new unsigned char[static_cast<size_t>(bytesToRead)];
-        std::streamoff rOff =
-          MET_UncompressStream(_fstream, seekoff, subdata, bytesToRead, m_CompressedDataSize, m_CompressionTable);
+        std::streamoff rOff = uncompressStream(seekoff, subdata, bytesToRead);
         // if there was a read error
         if (rOff == -1)
         {
@@ -2971,8 +3174,7 @@ MetaImage::M_ReadElementsROI(std::ifstream * _fstream,
       }
       else
       {
-        std::streamoff rOff =
-          MET_UncompressStream(_fstream, seekoff, data, bytesToRead, m_CompressedDataSize, m_CompressionTable);
+        std::streamoff rOff = uncompressStream(seekoff, data, bytesToRead);
         if (rOff == -1)
         {
           delete[] currentIndex;
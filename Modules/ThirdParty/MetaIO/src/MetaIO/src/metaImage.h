@@ -271,6 +271,28 @@ public:
   void
   ElementData(void * _elementData, bool _autoFreeElementData = false);
 
+  //    CompressionChunkSize(...)
+  //       Number of uncompressed bytes deflated independently of each other
+  //       when writing compressed data; 0 writes a single deflate stream.
+  //       Files with more than one chunk carry a chunk offset index in the
+  //       header so that they can be inflated in parallel and in part.
+  std::streamoff
+  CompressionChunkSize() const;
+  void
+  CompressionChunkSize(std::streamoff _compressionChunkSize);
+
+  // Number of chunks in the chunk index read from the header
+  int
+  CompressedDataChunks() const;
+
+  //    ParallelForFunction(...)
+  //       Used to compress and uncompress chunks concurrently; chunks are
+  //       processed one after the other when none is set.
+  const MET_ParallelForFunctionType &
+  ParallelForFunction() const;
+  void
+  ParallelForFunction(const MET_ParallelForFunctionType & _parallelForFunction);
+
   //    ConverTo(...)
   //       Converts to a new data type
   //       Rescales using Min and Max (see above)
@@ -356,6 +378,11 @@ protected:
 
   MET_CompressionTableType * m_CompressionTable{};
 
+  std::streamoff              m_CompressionChunkSize{};
+  std::streamoff              m_CompressedDataChunkSize{};
+  std::vector<std::streamoff> m_CompressedDataChunkOffsets;
+  MET_ParallelForFunctionType m_ParallelForFunction;
+
   int            m_DimSize[10]{};
   std::streamoff m_SubQuantity[10]{};
   std::streamoff m_Quantity{};
@@ -414,6 +441,10 @@ protected:
                     unsigned int    subSamplingFactor = 1,
                     std::streamoff  _totalDataQuantity = 0);
 
+  // True if the header carries a chunk index matching _uncompressedDataSize
+  bool
+  M_HasValidChunkIndex(std::streamoff _uncompressedDataSize) const;
+
   bool
   M_ReadElementData(std::ifstream * _fstream, void * _data, std::streamoff _dataQuantity);
 
@@ -192,6 +192,10 @@ constexpr char MET_InterpolationTypeName[MET_NUM_INTERPOLATION_TYPES][17] = {
 constexpr size_t MET_MAX_NUMBER_OF_FIELD_VALUES = 4096;
 constexpr size_t MET_MAX_NAME_SIZE = 255;
 
+// Upper bound on the number of independently compressed chunks, which keeps
+// the chunk offset index on a single header line.
+constexpr int MET_MAX_NUMBER_OF_COMPRESSED_CHUNKS = 1024;
+
 // Structure used to define a field
 // (variable = value definition) in a MetaFile
 typedef struct
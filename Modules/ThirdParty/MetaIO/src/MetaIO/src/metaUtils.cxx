@@ -788,6 +788,230 @@ MET_PerformUncompression(const unsigned char * sourceCompressed,
   return true;
 }
 
+// Run _function for every index in [0, _n), through the caller's
+// parallel-for when one is supplied.
+static void
+MET_ParallelFor(int _n, const MET_ParallelForFunctionType & _parallelFor, const std::function<void(int)> & _function)
+{
+  if (_parallelFor && _n > 1)
+  {
+    _parallelFor(_n, _function);
+  }
+  else
+  {
+    for (int i = 0; i < _n; i++)
+    {
+      _function(i);
+    }
+  }
+}
+
+unsigned char *
+MET_PerformChunkedCompression(const unsigned char *               source,
+                              std::streamoff                      sourceSize,
+                              std::streamoff *                    compressedDataSize,
+                              int                                 compressionLevel,
+                              std::streamoff *                    chunkSize,
+                              std::vector<std::streamoff> &       chunkOffsets,
+                              const MET_ParallelForFunctionType & parallelFor)
+{
+  const std::streamoff maxChunks = MET_MAX_NUMBER_OF_COMPRESSED_CHUNKS;
+  const std::streamoff minChunkSize = std::max(std::streamoff{ 1 }, (sourceSize + maxChunks - 1) / maxChunks);
+  *chunkSize = std::min(std::max(*chunkSize, minChunkSize), MET_MaxChunkSize);
+  const int numberOfChunks = std::max(1, static_cast<int>((sourceSize + *chunkSize - 1) / *chunkSize));
+
+  // Every chunk is a raw deflate stream with its own dictionary.  All but
+  // the last end on a byte boundary with a sync flush and without the final
+  // block bit, so that their concatenation is one valid deflate stream.
+  std::vector<std::vector<unsigned char>> chunks(static_cast<size_t>(numberOfChunks));
+  std::vector<uLong>                      checksums(static_cast<size_t>(numberOfChunks));
+  std::vector<char>                       succeeded(static_cast<size_t>(numberOfChunks), 0);
+
+  MET_ParallelFor(numberOfChunks, parallelFor, [&](int i) {
+    const std::streamoff begin = i * *chunkSize;
+    const std::streamoff size = std::min(*chunkSize, sourceSize - begin);
+    const bool           last_chunk = (i == numberOfChunks - 1);
+
+    z_stream z;
+    z.zalloc = (alloc_func) nullptr;
+    z.zfree = (free_func) nullptr;
+    z.opaque = (voidpf) nullptr;
+    if (deflateInit2(&z, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+      return;
+    }
+
+    std::vector<unsigned char> & chunk = chunks[static_cast<size_t>(i)];
+    chunk.resize(deflateBound(&z, static_cast<uLong>(size)) + 16);
+    z.next_in = const_cast<unsigned char *>(source + begin);
+    z.avail_in = static_cast<uInt>(size);
+    z.next_out = chunk.data();
+    z.avail_out = static_cast<uInt>(chunk.size());
+    const int ret = deflate(&z, last_chunk ? Z_FINISH : Z_SYNC_FLUSH);
+    succeeded[static_cast<size_t>(i)] =
+      (ret == (last_chunk ? Z_STREAM_END : Z_OK) && z.avail_in == 0 && z.avail_out > 0) ? 1 : 0;
+    chunk.resize(chunk.size() - z.avail_out);
+    deflateEnd(&z);
+
+    checksums[static_cast<size_t>(i)] = adler32(adler32(0L, nullptr, 0), source + begin, static_cast<uInt>(size));
+  });
+
+  if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end())
+  {
+    std::cerr << "MET_PerformChunkedCompression: chunk compression failed, compressing serially" << std::endl;
+    chunkOffsets.clear();
+    *chunkSize = 0;
+    return MET_PerformCompression(source, sourceSize, compressedDataSize, compressionLevel);
+  }
+
+  // The zlib header that deflateInit writes for the same settings
+  const int    level = (compressionLevel == Z_DEFAULT_COMPRESSION) ? 6 : compressionLevel;
+  unsigned int header = (Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8;
+  header |= static_cast<unsigned int>((level < 2) ? 0 : (level < 6) ? 1 : (level == 6) ? 2 : 3) << 6;
+  header += 31 - (header % 31);
+
+  uLong          checksum = checksums[0];
+  std::streamoff total = 2;
+  chunkOffsets.resize(static_cast<size_t>(numberOfChunks));
+  for (int i = 0; i < numberOfChunks; i++)
+  {
+    chunkOffsets[static_cast<size_t>(i)] = total;
+    total += static_cast<std::streamoff>(chunks[static_cast<size_t>(i)].size());
+    if (i > 0)
+    {
+      const std::streamoff size = std::min(*chunkSize, sourceSize - i * *chunkSize);
+      checksum = adler32_combine(checksum, checksums[static_cast<size_t>(i)], static_cast<z_off_t>(size));
+    }
+  }
+  total += 4;
+
+  auto * compressed_data = new unsigned char[static_cast<size_t>(total)];
+  compressed_data[0] = static_cast<unsigned char>(header >> 8);
+  compressed_data[1] = static_cast<unsigned char>(header & 0xff);
+  for (int i = 0; i < numberOfChunks; i++)
+  {
+    const std::vector<unsigned char> & chunk = chunks[static_cast<size_t>(i)];
+    memcpy(compressed_data + chunkOffsets[static_cast<size_t>(i)], chunk.data(), chunk.size());
+  }
+  for (int b = 0; b < 4; b++)
+  {
+    compressed_data[total - 4 + b] = static_cast<unsigned char>((checksum >> (8 * (3 - b))) & 0xff);
+  }
+
+  *compressedDataSize = total;
+  return compressed_data;
+}
+
+bool
+MET_IsValidChunkIndex(std::streamoff                      compressedDataSize,
+                      std::streamoff                      uncompressedDataSize,
+                      std::streamoff                      chunkSize,
+                      const std::vector<std::streamoff> & chunkOffsets)
+{
+  const auto numberOfChunks = static_cast<std::streamoff>(chunkOffsets.size());
+  if (numberOfChunks < 1 || numberOfChunks > MET_MAX_NUMBER_OF_COMPRESSED_CHUNKS || chunkSize <= 0 ||
+      chunkSize > MET_MaxChunkSize || uncompressedDataSize <= (numberOfChunks - 1) * chunkSize ||
+      uncompressedDataSize > numberOfChunks * chunkSize || chunkOffsets[0] != 2)
+  {
+    return false;
+  }
+  for (size_t i = 1; i < chunkOffsets.size(); i++)
+  {
+    if (chunkOffsets[i] <= chunkOffsets[i - 1])
+    {
+      return false;
+    }
+  }
+  return chunkOffsets.back() < compressedDataSize - 4;
+}
+
+bool
+MET_UncompressChunk(const unsigned char * sourceCompressed,
+                    std::streamoff        sourceCompressedSize,
+                    unsigned char *       uncompressedData,
+                    std::streamoff        uncompressedDataSize)
+{
+  if (sourceCompressedSize > MET_MaxChunkSize * 2 || uncompressedDataSize > MET_MaxChunkSize)
+  {
+    return false;
+  }
+
+  z_stream d_stream;
+  d_stream.zalloc = (alloc_func) nullptr;
+  d_stream.zfree = (free_func) nullptr;
+  d_stream.opaque = (voidpf) nullptr;
+  d_stream.next_in = const_cast<unsigned char *>(sourceCompressed);
+  d_stream.avail_in = static_cast<uInt>(sourceCompressedSize);
+  if (inflateInit2(&d_stream, -MAX_WBITS) != Z_OK)
+  {
+    return false;
+  }
+
+  d_stream.next_out = uncompressedData;
+  d_stream.avail_out = static_cast<uInt>(uncompressedDataSize);
+  const int err = inflate(&d_stream, Z_SYNC_FLUSH);
+  inflateEnd(&d_stream);
+
+  // Z_BUF_ERROR only means that the output buffer is full
+  return (err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR) && d_stream.avail_out == 0;
+}
+
+bool
+MET_PerformChunkedUncompression(const unsigned char *               sourceCompressed,
+                                std::streamoff                      sourceCompressedSize,
+                                unsigned char *                     uncompressedData,
+                                std::streamoff                      uncompressedDataSize,
+                                std::streamoff                      chunkSize,
+                                const std::vector<std::streamoff> & chunkOffsets,
+                                const MET_ParallelForFunctionType & parallelFor)
+{
+  if (!MET_IsValidChunkIndex(sourceCompressedSize, uncompressedDataSize, chunkSize, chunkOffsets) ||
+      (sourceCompressed[0] & 0x0f) != Z_DEFLATED || (sourceCompressed[1] & 0x20) != 0 ||
+      ((sourceCompressed[0] << 8) + sourceCompressed[1]) % 31 != 0)
+  {
+    return false;
+  }
+
+  const int         numberOfChunks = static_cast<int>(chunkOffsets.size());
+  std::vector<uLong> checksums(static_cast<size_t>(numberOfChunks));
+  std::vector<char>  succeeded(static_cast<size_t>(numberOfChunks), 0);
+
+  MET_ParallelFor(numberOfChunks, parallelFor, [&](int i) {
+    const std::streamoff begin = i * chunkSize;
+    const std::streamoff size = std::min(chunkSize, uncompressedDataSize - begin);
+    const std::streamoff compressedBegin = chunkOffsets[static_cast<size_t>(i)];
+    const std::streamoff compressedEnd =
+      (i == numberOfChunks - 1) ? sourceCompressedSize - 4 : chunkOffsets[static_cast<size_t>(i) + 1];
+
+    if (MET_UncompressChunk(
+          sourceCompressed + compressedBegin, compressedEnd - compressedBegin, uncompressedData + begin, size))
+    {
+      succeeded[static_cast<size_t>(i)] = 1;
+      checksums[static_cast<size_t>(i)] =
+        adler32(adler32(0L, nullptr, 0), uncompressedData + begin, static_cast<uInt>(size));
+    }
+  });
+
+  if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end())
+  {
+    return false;
+  }
+
+  uLong checksum = checksums[0];
+  for (int i = 1; i < numberOfChunks; i++)
+  {
+    const std::streamoff size = std::min(chunkSize, uncompressedDataSize - i * chunkSize);
+    checksum = adler32_combine(checksum, checksums[static_cast<size_t>(i)], static_cast<z_off_t>(size));
+  }
+
+  uLong expected = 0;
+  for (int b = 0; b < 4; b++)
+  {
+    expected = (expected << 8) | sourceCompressed[sourceCompressedSize - 4 + b];
+  }
+  return checksum == expected;
+}
+
 bool
 MET_StringToWordArray(const char * s, int * n, char *** val)
 {
@@ -1137,6 +1361,12 @@ MET_Read(std::istream &                       fp,
             if ((*fieldIter)->dependsOn >= 0)
             {
               (*fieldIter)->length = static_cast<int>((*fields)[(*fieldIter)->dependsOn]->value[0]);
+              if ((*fieldIter)->length < 0 ||
+                  static_cast<size_t>((*fieldIter)->length) > MET_MAX_NUMBER_OF_FIELD_VALUES)
+              {
+                std::cerr << "Array length out of range for " << (*fieldIter)->name << std::endl;
+                return false;
+              }
               for (j = 0; j < static_cast<size_t>((*fieldIter)->length); j++)
               {
                 fp >> (*fieldIter)->value[j];
@@ -46,6 +46,7 @@
 #    pragma warning(disable : 4996)
 #  endif
 
+#  include <functional>
 #  include <vector>
 #  include <string>
 #  include <sstream>
@@ -85,6 +86,11 @@ typedef struct MET_CompressionTable
   std::streamoff                bufferSize;
 } MET_CompressionTableType;
 
+// Runs _function(i) for every i in [0, _n), possibly concurrently. MetaIO
+// has no threading of its own; the application supplies this to let the
+// chunked compression routines use its thread pool.
+typedef std::function<void(int _n, const std::function<void(int)> & _function)> MET_ParallelForFunctionType;
+
 METAIO_EXPORT MET_FieldRecordType *
               MET_GetFieldRecord(const char * _fieldName, std::vector<MET_FieldRecordType *> * _fields);
 
@@ -338,6 +344,53 @@ MET_UncompressStream(std::ifstream *            stream,
                      std::streamoff             compressedDataSize,
                      MET_CompressionTableType * compressionTable);
 
+// Compress the source as a single zlib stream made of independently
+// deflated chunks of *chunkSize uncompressed bytes (the last one may be
+// shorter).  Any zlib inflater decodes the result as one stream, and each
+// chunk can also be inflated on its own from the offset stored in
+// chunkOffsets (relative to the start of the compressed data).  *chunkSize
+// is raised if needed to stay within MET_MAX_NUMBER_OF_COMPRESSED_CHUNKS.
+METAIO_EXPORT
+unsigned char *
+MET_PerformChunkedCompression(const unsigned char *               source,
+                              std::streamoff                      sourceSize,
+                              std::streamoff *                    compressedDataSize,
+                              int                                 compressionLevel,
+                              std::streamoff *                    chunkSize,
+                              std::vector<std::streamoff> &       chunkOffsets,
+                              const MET_ParallelForFunctionType & parallelFor = nullptr);
+
+// Check that a chunk index read from a header can describe compressed data
+// of the given sizes, so that a stale or damaged index is never used.
+METAIO_EXPORT
+bool
+MET_IsValidChunkIndex(std::streamoff                      compressedDataSize,
+                      std::streamoff                      uncompressedDataSize,
+                      std::streamoff                      chunkSize,
+                      const std::vector<std::streamoff> & chunkOffsets);
+
+// Inflate a single chunk written by MET_PerformChunkedCompression.
+// Returns false unless exactly uncompressedDataSize bytes were produced.
+METAIO_EXPORT
+bool
+MET_UncompressChunk(const unsigned char * sourceCompressed,
+                    std::streamoff        sourceCompressedSize,
+                    unsigned char *       uncompressedData,
+                    std::streamoff        uncompressedDataSize);
+
+// Inflate the whole output of MET_PerformChunkedCompression, one chunk per
+// task, and verify the stream checksum.  Returns false on any mismatch so
+// that the caller can fall back to MET_PerformUncompression.
+METAIO_EXPORT
+bool
+MET_PerformChunkedUncompression(const unsigned char *               sourceCompressed,
+                                std::streamoff                      sourceCompressedSize,
+                                unsigned char *                     uncompressedData,
+                                std::streamoff                      uncompressedDataSize,
+                                std::streamoff                      chunkSize,
+                                const std::vector<std::streamoff> & chunkOffsets,
+                                const MET_ParallelForFunctionType & parallelFor = nullptr);
+
 
 // FILES NAMES
 METAIO_EXPORT
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+
+"""CompareBenchmarks.py
+
+Compare the JSON results of ITKBenchmarks with those of a baseline, e.g.
+the previous release on the same machine, and report the regressions.
+
+A benchmark regresses when its pixels per second drop, or its peak memory
+grows, by more than the tolerance. The benchmarks are matched by name and
+number of threads. Exits with 1 when a benchmark regresses."""
+
+import argparse
+import json
+import sys
+
+
+def load_results(file_name):
+    with open(file_name) as results_file:
+        results = json.load(results_file)
+    return {
+        (benchmark["Name"], benchmark["Threads"]): benchmark
+        for benchmark in results["Benchmarks"]
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("baseline", help="JSON results of the baseline")
+    parser.add_argument("results", help="JSON results to compare")
+    parser.add_argument(
+        "--time-tolerance",
+        type=float,
+        default=0.1,
+        help="relative drop of the pixels per second tolerated (default: 0.1)",
+    )
+    parser.add_argument(
+        "--memory-tolerance",
+        type=float,
+        default=0.1,
+        help="relative growth of the peak memory tolerated (default: 0.1)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    results = load_results(args.results)
+
+    print(
+        "{:<48}{:>8}{:>16}{:>16}{:>10}{:>12}".format(
+            "Benchmark", "Threads", "Baseline px/s", "Pixels/s", "Change", "Memory"
+        )
+    )
+    regressions = []
+    for key in sorted(results):
+        if key not in baseline:
+            continue
+        before = baseline[key]
+        after = results[key]
+        # A baseline without pixels per second, e.g. of a benchmark which
+        # processed nothing, cannot be compared with.
+        speed = None
+        if before["PixelsPerSecond"] > 0:
+            speed = after["PixelsPerSecond"] / before["PixelsPerSecond"] - 1.0
+        memory = 0.0
+        if before["PeakMemory"] > 0:
+            memory = after["PeakMemory"] / before["PeakMemory"] - 1.0
+        status = ""
+        if speed is not None and speed < -args.time_tolerance:
+            status += " SLOWER"
+        if memory > args.memory_tolerance:
+            status += " MEMORY"
+        if status:
+            regressions.append(key)
+        change = "n/a" if speed is None else "{:+.1f}%".format(100.0 * speed)
+        print(
+            "{:<48}{:>8}{:>16.4g}{:>16.4g}{:>10}{:>+11.1f}%{}".format(
+                key[0],
+                key[1],
+                before["PixelsPerSecond"],
+                after["PixelsPerSecond"],
+                change,
+                100.0 * memory,
+                status,
+            )
+        )
+
+    for key in sorted(set(baseline) - set(results)):
+        print("Missing from the results: {} with {} threads".format(*key))
+
+    if regressions:
+        print("{} benchmarks regressed".format(len(regressions)))
+        return 1
+    print("No regression")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkBatchImageProcessor.h"
+#include "itkCastImageFilter.h"
+#include "itkEuler3DTransform.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkRegionOfInterestImageFilter.h"
+#include "itkRescaleIntensityImageFilter.h"
+#include "itkResampleImageFilter.h"
+
+namespace
+{
+using InputImageType = itk::Image<short, 3>;
+using RealImageType = itk::Image<float, 3>;
+using OutputImageType = itk::Image<unsigned char, 3>;
+using TransformType = itk::Euler3DTransform<double>;
+
+constexpr unsigned int PatchSize = 16;
+
+// Patches of PatchSize^3 pixels, covering the synthetic image.
+std::vector<InputImageType::ConstPointer>
+MakePatches(unsigned int imageSize)
+{
+  const auto image = itk::Benchmark::MakeImage<InputImageType>(imageSize);
+  const auto roi = itk::RegionOfInterestImageFilter<InputImageType, InputImageType>::New();
+  roi->SetInput(image);
+  std::vector<InputImageType::ConstPointer> patches;
+  for (unsigned int z = 0; z + PatchSize <= imageSize; z += PatchSize)
+  {
+    for (unsigned int y = 0; y + PatchSize <= imageSize; y += PatchSize)
+    {
+      for (unsigned int x = 0; x + PatchSize <= imageSize; x += PatchSize)
+      {
+        roi->SetRegionOfInterest({ { { x, y, z } }, InputImageType::SizeType::Filled(PatchSize) });
+        roi->Update();
+        InputImageType::Pointer patch = roi->GetOutput();
+        patch->DisconnectPipeline();
+        patches.push_back(patch);
+      }
+    }
+  }
+  return patches;
+}
+
+// The preprocessing of a patch: a small rotation, a rescaling to [0, 255],
+// and a cast to unsigned char. The transform is shared by the pipelines.
+itk::BatchImageProcessor<InputImageType, OutputImageType>::PipelineType
+MakePreprocessingPipeline(const TransformType * transform, unsigned int numberOfWorkUnits)
+{
+  auto resample = itk::ResampleImageFilter<InputImageType, RealImageType>::New();
+  resample->SetTransform(transform);
+  resample->SetInterpolator(itk::LinearInterpolateImageFunction<InputImageType, double>::New());
+  resample->SetUseReferenceImage(true);
+  auto rescale = itk::RescaleIntensityImageFilter<RealImageType, RealImageType>::New();
+  rescale->SetInput(resample->GetOutput());
+  rescale->SetOutputMinimum(0.0f);
+  rescale->SetOutputMaximum(255.0f);
+  auto cast = itk::CastImageFilter<RealImageType, OutputImageType>::New();
+  cast->SetInput(rescale->GetOutput());
+
+  auto pipeline = itk::BatchImageProcessor<InputImageType, OutputImageType>::MakePipeline(resample.GetPointer(),
+                                                                                          cast.GetPointer());
+  resample->SetNumberOfWorkUnits(numberOfWorkUnits);
+  rescale->SetNumberOfWorkUnits(numberOfWorkUnits);
+  cast->SetNumberOfWorkUnits(numberOfWorkUnits);
+  return [pipeline, resample](const InputImageType * input) {
+    resample->SetReferenceImage(input);
+    return pipeline(input);
+  };
+}
+
+TransformType::Pointer
+MakeTransform()
+{
+  auto transform = TransformType::New();
+  transform->SetRotation(0.05, 0.1, 0.0);
+  return transform;
+}
+
+// The patches processed one after the other, each with the threads.
+void
+PatchPipelineBenchmark(itk::Benchmark::State & state)
+{
+  const auto patches = MakePatches(state.GetImageSize());
+  const auto pipeline = MakePreprocessingPipeline(MakeTransform(), state.GetNumberOfThreads());
+  state.SetNumberOfPixels(patches.size() * PatchSize * PatchSize * PatchSize);
+  for (auto iteration : state)
+  {
+    for (const auto & patch : patches)
+    {
+      pipeline(patch);
+    }
+  }
+}
+ITK_BENCHMARK(PatchPipelineBenchmark, true);
+
+// The patches processed concurrently, one per thread.
+void
+BatchPatchPipelineBenchmark(itk::Benchmark::State & state)
+{
+  const auto patches = MakePatches(state.GetImageSize());
+  const auto transform = MakeTransform();
+  const auto processor = itk::BatchImageProcessor<InputImageType, OutputImageType>::New();
+  processor->SetPipelineFactory([transform] { return MakePreprocessingPipeline(transform, 1); });
+  processor->SetNumberOfWorkers(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(patches.size() * PatchSize * PatchSize * PatchSize);
+  for (auto iteration : state)
+  {
+    processor->Process(patches);
+  }
+}
+ITK_BENCHMARK(BatchPatchPipelineBenchmark, true);
+} // namespace
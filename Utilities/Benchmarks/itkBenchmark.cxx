@@ -0,0 +1,401 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkMultiThreaderBase.h"
+#include "itkVersion.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#  include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#  include <sys/resource.h>
+#endif
+
+namespace itk
+{
+namespace Benchmark
+{
+namespace
+{
+struct BenchmarkEntry
+{
+  std::string  Name;
+  FunctionType Function;
+  bool         MultiThreaded;
+};
+
+std::vector<BenchmarkEntry> &
+GetBenchmarks()
+{
+  static std::vector<BenchmarkEntry> benchmarks;
+  return benchmarks;
+}
+
+struct Result
+{
+  std::string     Name;
+  unsigned int    NumberOfThreads;
+  unsigned int    NumberOfIterations;
+  SizeValueType   NumberOfPixels;
+  double          MinimumTime;
+  double          MeanTime;
+  double          PixelsPerSecond;
+  double          Speedup;
+  OffsetValueType PeakMemory;
+};
+
+struct Options
+{
+  std::string               Filter;
+  std::vector<unsigned int> NumbersOfThreads;
+  unsigned int              NumberOfIterations{ 5 };
+  unsigned int              ImageSize{ 128 };
+  std::string               JSONFileName;
+  bool                      List{ false };
+};
+
+// Resets the peak resident memory of the process to its current resident
+// memory, where the system allows it.
+void
+ResetPeakMemory()
+{
+#if defined(__linux__)
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  clearRefs << "5";
+#endif
+}
+
+// The peak resident memory of the process, in kB.
+OffsetValueType
+GetPeakMemory()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return static_cast<OffsetValueType>(counters.PeakWorkingSetSize / 1024);
+  }
+  return 0;
+#else
+#  if defined(__linux__)
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+    {
+      return std::atol(line.c_str() + 6);
+    }
+  }
+#  endif
+#  if defined(__unix__) || defined(__APPLE__)
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#    if defined(__APPLE__)
+    return static_cast<OffsetValueType>(usage.ru_maxrss / 1024);
+#    else
+    return static_cast<OffsetValueType>(usage.ru_maxrss);
+#    endif
+  }
+#  endif
+  return 0;
+#endif
+}
+
+std::vector<unsigned int>
+GetDefaultNumbersOfThreads()
+{
+  const unsigned int        maximumNumberOfThreads = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  std::vector<unsigned int> numbersOfThreads;
+  for (unsigned int numberOfThreads = 1; numberOfThreads < maximumNumberOfThreads; numberOfThreads *= 2)
+  {
+    numbersOfThreads.push_back(numberOfThreads);
+  }
+  numbersOfThreads.push_back(maximumNumberOfThreads);
+  return numbersOfThreads;
+}
+
+void
+PrintUsage(const char * programName)
+{
+  std::cout << "Usage: " << programName << " [options]\n"
+            << "  --filter=<text>         Run the benchmarks whose name contains the text.\n"
+            << "  --threads=<n1,n2,...>   Numbers of threads of the multithreaded benchmarks.\n"
+            << "                          Defaults to the powers of two up to the number of CPUs.\n"
+            << "  --iterations=<n>        Number of timed iterations. Defaults to 5.\n"
+            << "  --size=<n>              Length of the sides of the synthetic images. Defaults to 128.\n"
+            << "  --json=<file>           Write the results to a JSON file, for CompareBenchmarks.py.\n"
+            << "  --list                  List the benchmarks.\n";
+}
+
+bool
+ParseOptions(int argc, char * argv[], Options & options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string argument = argv[i];
+    const auto        separator = argument.find('=');
+    const std::string name = argument.substr(0, separator);
+    const std::string value = separator == std::string::npos ? std::string() : argument.substr(separator + 1);
+    if (name == "--filter")
+    {
+      options.Filter = value;
+    }
+    else if (name == "--threads")
+    {
+      std::istringstream stream(value);
+      std::string        numberOfThreads;
+      while (std::getline(stream, numberOfThreads, ','))
+      {
+        options.NumbersOfThreads.push_back(static_cast<unsigned int>(std::max(1, std::atoi(numberOfThreads.c_str()))));
+      }
+    }
+    else if (name == "--iterations")
+    {
+      options.NumberOfIterations = static_cast<unsigned int>(std::max(1, std::atoi(value.c_str())));
+    }
+    else if (name == "--size")
+    {
+      options.ImageSize = static_cast<unsigned int>(std::max(8, std::atoi(value.c_str())));
+    }
+    else if (name == "--json")
+    {
+      options.JSONFileName = value;
+    }
+    else if (name == "--list")
+    {
+      options.List = true;
+    }
+    else
+    {
+      PrintUsage(argv[0]);
+      return false;
+    }
+  }
+  if (options.NumbersOfThreads.empty())
+  {
+    options.NumbersOfThreads = GetDefaultNumbersOfThreads();
+  }
+  return true;
+}
+
+Result
+Run(const BenchmarkEntry & benchmark, unsigned int numberOfThreads, const Options & options)
+{
+  MultiThreaderBase::SetGlobalDefaultNumberOfThreads(numberOfThreads);
+  ResetPeakMemory();
+
+  State state(numberOfThreads, options.NumberOfIterations, options.ImageSize);
+  benchmark.Function(state);
+
+  Result result;
+  result.Name = benchmark.Name;
+  result.NumberOfThreads = numberOfThreads;
+  result.NumberOfIterations = static_cast<unsigned int>(state.GetTimeProbe().GetNumberOfStops());
+  result.NumberOfPixels = state.GetNumberOfPixels();
+  result.MinimumTime = state.GetTimeProbe().GetMinimum();
+  result.MeanTime = state.GetTimeProbe().GetMean();
+  result.PixelsPerSecond =
+    result.MinimumTime > 0.0 ? static_cast<double>(result.NumberOfPixels) / result.MinimumTime : 0.0;
+  result.Speedup = 1.0;
+  result.PeakMemory = GetPeakMemory();
+  return result;
+}
+
+void
+WriteJSON(std::ostream & os, const std::vector<Result> & results, const Options & options)
+{
+  os << "{\n";
+  os << "  \"Context\": {\n";
+  os << "    \"ITKVersion\": \"" << Version::GetITKVersion() << "\",\n";
+  os << "    \"Iterations\": " << options.NumberOfIterations << ",\n";
+  os << "    \"ImageSize\": " << options.ImageSize << ",\n";
+  os << "    \"MaximumNumberOfThreads\": " << MultiThreaderBase::GetGlobalMaximumNumberOfThreads() << "\n";
+  os << "  },\n";
+  os << "  \"Benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    const Result & result = results[i];
+    os << (i == 0 ? "\n" : ",\n");
+    os << "    {\n";
+    os << "      \"Name\": \"" << result.Name << "\",\n";
+    os << "      \"Threads\": " << result.NumberOfThreads << ",\n";
+    os << "      \"Iterations\": " << result.NumberOfIterations << ",\n";
+    os << "      \"NumberOfPixels\": " << result.NumberOfPixels << ",\n";
+    os << "      \"MinimumTime\": " << result.MinimumTime << ",\n";
+    os << "      \"MeanTime\": " << result.MeanTime << ",\n";
+    os << "      \"PixelsPerSecond\": " << result.PixelsPerSecond << ",\n";
+    os << "      \"Speedup\": " << result.Speedup << ",\n";
+    os << "      \"PeakMemory\": " << result.PeakMemory << "\n";
+    os << "    }";
+  }
+  os << "\n  ]\n}" << std::endl;
+}
+} // end anonymous namespace
+
+
+State::State(unsigned int numberOfThreads, unsigned int numberOfIterations, unsigned int imageSize)
+  : m_NumberOfThreads(numberOfThreads)
+  , m_NumberOfIterations(numberOfIterations)
+  , m_ImageSize(imageSize)
+{}
+
+State::Iterator
+State::begin()
+{
+  m_TimeProbe.Start();
+  return Iterator(this, m_NumberOfIterations);
+}
+
+State::Iterator
+State::end()
+{
+  return Iterator(this, 0);
+}
+
+Registration::Registration(const char * name, FunctionType function, bool multiThreaded)
+{
+  GetBenchmarks().push_back({ name, function, multiThreaded });
+}
+
+int
+RunBenchmarks(int argc, char * argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<BenchmarkEntry> benchmarks = GetBenchmarks();
+  std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry & a, const BenchmarkEntry & b) {
+    return a.Name < b.Name;
+  });
+  if (options.List)
+  {
+    for (const auto & benchmark : benchmarks)
+    {
+      std::cout << benchmark.Name << (benchmark.MultiThreaded ? "" : " (single-threaded)") << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << std::left << std::setw(48) << "Benchmark" << std::setw(9) << "Threads" << std::setw(14) << "Time (s)"
+            << std::setw(16) << "Pixels/s" << std::setw(10) << "Speedup"
+            << "Peak memory (kB)" << std::endl;
+
+  std::vector<Result> results;
+  for (const auto & benchmark : benchmarks)
+  {
+    if (benchmark.Name.find(options.Filter) == std::string::npos)
+    {
+      continue;
+    }
+    double timeWithOneThread = 0.0;
+    for (const unsigned int numberOfThreads : options.NumbersOfThreads)
+    {
+      if (!benchmark.MultiThreaded && numberOfThreads != options.NumbersOfThreads.front())
+      {
+        continue;
+      }
+      const unsigned int runNumberOfThreads = benchmark.MultiThreaded ? numberOfThreads : 1;
+      Result             result = Run(benchmark, runNumberOfThreads, options);
+      if (runNumberOfThreads == 1)
+      {
+        timeWithOneThread = result.MinimumTime;
+      }
+      result.Speedup = (timeWithOneThread > 0.0 && result.MinimumTime > 0.0) ? timeWithOneThread / result.MinimumTime
+                                                                               : 0.0;
+
+      std::cout << std::left << std::setw(48) << result.Name << std::setw(9) << result.NumberOfThreads
+                << std::setw(14) << result.MinimumTime << std::setw(16) << result.PixelsPerSecond << std::setw(10)
+                << result.Speedup << result.PeakMemory << std::endl;
+      results.push_back(result);
+    }
+  }
+
+  if (!options.JSONFileName.empty())
+  {
+    std::ofstream json(options.JSONFileName.c_str());
+    if (!json)
+    {
+      std::cerr << "Cannot write " << options.JSONFileName << std::endl;
+      return EXIT_FAILURE;
+    }
+    WriteJSON(json, results, options);
+  }
+  return EXIT_SUCCESS;
+}
+
+Image<unsigned char, 3>::Pointer
+MakeBinaryImage(unsigned int imageSize)
+{
+  using ImageType = Image<unsigned char, 3>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { imageSize, imageSize, imageSize } });
+  image->Allocate(true);
+
+  // Spheres whose radii and centers are given by a linear congruential
+  // generator, for the same images on all systems.
+  uint32_t     random = 54321;
+  const auto   nextRandom = [&random](unsigned int modulus) {
+    random = random * 1664525u + 1013904223u;
+    return static_cast<int>((random >> 8) % modulus);
+  };
+  const int    size = static_cast<int>(imageSize);
+  const int    maximumRadius = std::max(2, size / 10);
+  unsigned int numberOfSpheres = std::max(8u, imageSize / 2);
+  while (numberOfSpheres-- > 0)
+  {
+    const int radius = 1 + nextRandom(static_cast<unsigned int>(maximumRadius));
+    const int center[3] = { nextRandom(imageSize), nextRandom(imageSize), nextRandom(imageSize) };
+    for (int z = std::max(0, center[2] - radius); z <= std::min(size - 1, center[2] + radius); ++z)
+    {
+      for (int y = std::max(0, center[1] - radius); y <= std::min(size - 1, center[1] + radius); ++y)
+      {
+        for (int x = std::max(0, center[0] - radius); x <= std::min(size - 1, center[0] + radius); ++x)
+        {
+          const int dx = x - center[0];
+          const int dy = y - center[1];
+          const int dz = z - center[2];
+          if (dx * dx + dy * dy + dz * dz <= radius * radius)
+          {
+            image->SetPixel({ { x, y, z } }, 1);
+          }
+        }
+      }
+    }
+  }
+  return image;
+}
+
+std::string
+GetTemporaryFileName(const std::string & extension)
+{
+  return std::string(ITK_BENCHMARKS_TEMPORARY_DIRECTORY) + "/ITKBenchmarksTemporaryFile" + extension;
+}
+} // end namespace Benchmark
+} // end namespace itk
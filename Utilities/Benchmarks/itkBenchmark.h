@@ -0,0 +1,202 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBenchmark_h
+#define itkBenchmark_h
+
+#include "itkImage.h"
+#include "itkTimeProbe.h"
+
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define ITK_BENCHMARK_UNUSED __attribute__((unused))
+#else
+#  define ITK_BENCHMARK_UNUSED
+#endif
+
+namespace itk
+{
+/** \namespace itk::Benchmark
+ * \brief A minimal harness for the benchmarks of the ITKBenchmarks
+ * executable, in the style of Google Benchmark.
+ *
+ * A benchmark is a function which prepares its input, tells the number of
+ * pixels it processes per iteration, and runs the timed code in a loop over
+ * the State:
+   \code
+   void
+   DiscreteGaussianImageFilterBenchmark(itk::Benchmark::State & state)
+   {
+     auto filter = FilterType::New();
+     filter->SetInput(itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()));
+     filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+     state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+     for (auto iteration : state)
+     {
+       filter->Modified();
+       filter->Update();
+     }
+   }
+   ITK_BENCHMARK(DiscreteGaussianImageFilterBenchmark, true);
+   \endcode
+ * Only the body of the loop is timed. The runner calls multithreaded
+ * benchmarks once per number of threads, and reports the pixels per second
+ * of the fastest iteration, the speedup over one thread, and the peak
+ * memory of the process during the benchmark.
+ */
+namespace Benchmark
+{
+/** \class State
+ * \brief The state of a run of a benchmark: its parameters, and the timer of
+ * its iterations.
+ */
+class State
+{
+public:
+  State(unsigned int numberOfThreads, unsigned int numberOfIterations, unsigned int imageSize);
+
+  /** The number of threads the benchmark should use. */
+  unsigned int
+  GetNumberOfThreads() const
+  {
+    return m_NumberOfThreads;
+  }
+
+  /** The length of the sides of the synthetic images. */
+  unsigned int
+  GetImageSize() const
+  {
+    return m_ImageSize;
+  }
+
+  /** Set/Get the number of pixels processed by each iteration. */
+  void
+  SetNumberOfPixels(SizeValueType numberOfPixels)
+  {
+    m_NumberOfPixels = numberOfPixels;
+  }
+  SizeValueType
+  GetNumberOfPixels() const
+  {
+    return m_NumberOfPixels;
+  }
+
+  /** The times of the iterations. */
+  const TimeProbe &
+  GetTimeProbe() const
+  {
+    return m_TimeProbe;
+  }
+
+  /** Iterates over the timed iterations: the time probe is started by
+   * begin(), and stopped and restarted by the increments. */
+  class Iterator
+  {
+  public:
+    /** The value of the iterations: an empty type, whose unused loop
+     * variables are not warned about. */
+    struct ITK_BENCHMARK_UNUSED Value
+    {};
+
+    Iterator(State * state, unsigned int numberOfRemainingIterations)
+      : m_State(state)
+      , m_NumberOfRemainingIterations(numberOfRemainingIterations)
+    {}
+
+    Value
+    operator*() const
+    {
+      return {};
+    }
+
+    Iterator &
+    operator++()
+    {
+      m_State->m_TimeProbe.Stop();
+      if (--m_NumberOfRemainingIterations > 0)
+      {
+        m_State->m_TimeProbe.Start();
+      }
+      return *this;
+    }
+
+    bool
+    operator!=(const Iterator & other) const
+    {
+      return m_NumberOfRemainingIterations != other.m_NumberOfRemainingIterations;
+    }
+
+  private:
+    State *      m_State;
+    unsigned int m_NumberOfRemainingIterations;
+  };
+
+  Iterator
+  begin();
+
+  Iterator
+  end();
+
+private:
+  unsigned int  m_NumberOfThreads;
+  unsigned int  m_NumberOfIterations;
+  unsigned int  m_ImageSize;
+  SizeValueType m_NumberOfPixels{ 0 };
+  TimeProbe     m_TimeProbe;
+};
+
+using FunctionType = void (*)(State &);
+
+/** Registers a benchmark with the runner. */
+struct Registration
+{
+  Registration(const char * name, FunctionType function, bool multiThreaded);
+};
+
+/** Runs the registered benchmarks, with the options of the command line.
+ * Returns the exit code of the ITKBenchmarks executable. */
+int
+RunBenchmarks(int argc, char * argv[]);
+
+/** Returns a 3D image of the given size filled with a smooth pattern and
+ * deterministic noise, from 0 to the maximum of integer pixel types, or
+ * to 255. */
+template <typename TImage>
+typename TImage::Pointer
+MakeImage(unsigned int imageSize);
+
+/** Returns a 3D binary image of the given size, with deterministic
+ * spheres of 1 over a background of 0. */
+Image<unsigned char, 3>::Pointer
+MakeBinaryImage(unsigned int imageSize);
+
+/** Returns a file name in the build directory of the benchmarks, for the
+ * IO benchmarks. */
+std::string
+GetTemporaryFileName(const std::string & extension);
+} // end namespace Benchmark
+} // end namespace itk
+
+/** Registers a benchmark function, multithreaded or not. */
+#define ITK_BENCHMARK(function, multiThreaded)                                                                         \
+  static const itk::Benchmark::Registration itkBenchmarkRegistration##function(#function, function, multiThreaded)
+
+#include "itkBenchmark.hxx"
+
+#endif // itkBenchmark_h
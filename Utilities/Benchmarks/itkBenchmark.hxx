@@ -0,0 +1,65 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBenchmark_hxx
+#define itkBenchmark_hxx
+
+#include "itkImageBufferRange.h"
+#include "itkNumericTraits.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace itk
+{
+namespace Benchmark
+{
+template <typename TImage>
+typename TImage::Pointer
+MakeImage(unsigned int imageSize)
+{
+  using PixelType = typename TImage::PixelType;
+  static_assert(TImage::ImageDimension == 3, "The synthetic images are 3D.");
+
+  const auto image = TImage::New();
+  image->SetRegions(typename TImage::SizeType{ { imageSize, imageSize, imageSize } });
+  image->Allocate();
+
+  const double maximum =
+    NumericTraits<PixelType>::is_integer ? static_cast<double>(NumericTraits<PixelType>::max()) : 255.0;
+  uint32_t random = 12345;
+  auto     pixel = MakeImageBufferRange(image.GetPointer()).begin();
+  for (unsigned int z = 0; z < imageSize; ++z)
+  {
+    for (unsigned int y = 0; y < imageSize; ++y)
+    {
+      for (unsigned int x = 0; x < imageSize; ++x, ++pixel)
+      {
+        // A linear congruential generator, for the same images on all systems.
+        random = random * 1664525u + 1013904223u;
+        const double noise = static_cast<double>(random >> 8) / static_cast<double>(1u << 24);
+        const double pattern = std::sin(0.11 * x) * std::cos(0.07 * y) * std::sin(0.05 * z + 0.3);
+        *pixel = static_cast<PixelType>(maximum * (0.5 + 0.4 * pattern + 0.1 * (noise - 0.5)));
+      }
+    }
+  }
+  return image;
+}
+} // end namespace Benchmark
+} // end namespace itk
+
+#endif // itkBenchmark_hxx
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkCastImageFilter.h"
+#include "itkComponentConverter.h"
+#include "itkVectorImage.h"
+#include <vector>
+
+namespace
+{
+void
+CastImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  using InputImageType = itk::Image<short, 3>;
+  using OutputImageType = itk::Image<float, 3>;
+
+  const auto filter = itk::CastImageFilter<InputImageType, OutputImageType>::New();
+  filter->SetInput(itk::Benchmark::MakeImage<InputImageType>(state.GetImageSize()));
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(CastImageFilterBenchmark, true);
+
+void
+CastVectorImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  using InputImageType = itk::VectorImage<unsigned char, 3>;
+  using OutputImageType = itk::VectorImage<float, 3>;
+  constexpr unsigned int numberOfComponents = 3;
+
+  const auto scalarImage = itk::Benchmark::MakeImage<itk::Image<unsigned char, 3>>(state.GetImageSize());
+  const auto input = InputImageType::New();
+  input->SetRegions(scalarImage->GetBufferedRegion());
+  input->SetNumberOfComponentsPerPixel(numberOfComponents);
+  input->Allocate();
+  const itk::SizeValueType numberOfPixels = input->GetBufferedRegion().GetNumberOfPixels();
+  for (itk::SizeValueType i = 0; i < numberOfPixels * numberOfComponents; ++i)
+  {
+    input->GetBufferPointer()[i] = scalarImage->GetBufferPointer()[i / numberOfComponents];
+  }
+
+  const auto filter = itk::CastImageFilter<InputImageType, OutputImageType>::New();
+  filter->SetInput(input);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(numberOfPixels);
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(CastVectorImageFilterBenchmark, true);
+
+// The conversions of CastImageFilter, on a single thread, with the given
+// maximum instruction set.
+void
+ConvertComponents(itk::Benchmark::State & state, itk::ComponentConverterEnums::InstructionSet instructionSet)
+{
+  const auto               input = itk::Benchmark::MakeImage<itk::Image<unsigned short, 3>>(state.GetImageSize());
+  const itk::SizeValueType numberOfPixels = input->GetBufferedRegion().GetNumberOfPixels();
+  const unsigned short *   inputBuffer = input->GetBufferPointer();
+  std::vector<float>       output(numberOfPixels);
+
+  itk::ComponentConverter::SetMaximumInstructionSet(instructionSet);
+  state.SetNumberOfPixels(numberOfPixels);
+  for (auto iteration : state)
+  {
+    itk::ComponentConverter::Convert(inputBuffer, inputBuffer + numberOfPixels, output.data());
+  }
+  itk::ComponentConverter::SetMaximumInstructionSet(itk::ComponentConverterEnums::InstructionSet::AVX512);
+}
+
+void
+ComponentConverterBaselineBenchmark(itk::Benchmark::State & state)
+{
+  ConvertComponents(state, itk::ComponentConverterEnums::InstructionSet::Baseline);
+}
+ITK_BENCHMARK(ComponentConverterBaselineBenchmark, false);
+
+void
+ComponentConverterBenchmark(itk::Benchmark::State & state)
+{
+  ConvertComponents(state, itk::ComponentConverterEnums::InstructionSet::AVX512);
+}
+ITK_BENCHMARK(ComponentConverterBenchmark, false);
+} // namespace
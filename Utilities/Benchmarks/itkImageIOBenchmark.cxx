@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkMetaImageIO.h"
+#include "itkNiftiImageIO.h"
+#include "itkNrrdImageIO.h"
+#include "itkPNGImageIO.h"
+#include "itkTIFFImageIO.h"
+#include "itksys/SystemTools.hxx"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Writes then reads the image with the given ImageIO, and removes the file.
+template <typename TImage>
+void
+ImageIOBenchmark(itk::Benchmark::State &          state,
+                 const typename TImage::Pointer & image,
+                 itk::ImageIOBase *               imageIO,
+                 const std::string &              extension,
+                 bool                             compress)
+{
+  const std::string fileName = itk::Benchmark::GetTemporaryFileName(extension);
+
+  const auto writer = itk::ImageFileWriter<TImage>::New();
+  writer->SetInput(image);
+  writer->SetImageIO(imageIO);
+  writer->SetFileName(fileName);
+  writer->SetUseCompression(compress);
+
+  const auto reader = itk::ImageFileReader<TImage>::New();
+  reader->SetImageIO(imageIO);
+  reader->SetFileName(fileName);
+
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    writer->Write();
+    reader->Modified();
+    reader->Update();
+  }
+  itksys::SystemTools::RemoveFile(fileName);
+}
+
+using ImageType = itk::Image<short, 3>;
+
+void
+MetaImageIOBenchmark(itk::Benchmark::State & state)
+{
+  ImageIOBenchmark<ImageType>(
+    state, itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()), itk::MetaImageIO::New(), ".mha", false);
+}
+ITK_BENCHMARK(MetaImageIOBenchmark, false);
+
+void
+MetaImageIOCompressedBenchmark(itk::Benchmark::State & state)
+{
+  ImageIOBenchmark<ImageType>(
+    state, itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()), itk::MetaImageIO::New(), ".mha", true);
+}
+ITK_BENCHMARK(MetaImageIOCompressedBenchmark, false);
+
+void
+NrrdImageIOBenchmark(itk::Benchmark::State & state)
+{
+  ImageIOBenchmark<ImageType>(
+    state, itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()), itk::NrrdImageIO::New(), ".nrrd", false);
+}
+ITK_BENCHMARK(NrrdImageIOBenchmark, false);
+
+void
+NiftiImageIOBenchmark(itk::Benchmark::State & state)
+{
+  ImageIOBenchmark<ImageType>(
+    state, itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()), itk::NiftiImageIO::New(), ".nii", false);
+}
+ITK_BENCHMARK(NiftiImageIOBenchmark, false);
+
+void
+TIFFImageIOBenchmark(itk::Benchmark::State & state)
+{
+  ImageIOBenchmark<ImageType>(
+    state, itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()), itk::TIFFImageIO::New(), ".tif", false);
+}
+ITK_BENCHMARK(TIFFImageIOBenchmark, false);
+
+// PNG only stores 2D images: a slice of the size of the 3D image.
+void
+PNGImageIOBenchmark(itk::Benchmark::State & state)
+{
+  using SliceImageType = itk::Image<unsigned char, 2>;
+  const unsigned int sliceSize = state.GetImageSize() * static_cast<unsigned int>(std::sqrt(state.GetImageSize()));
+
+  const auto                     image = SliceImageType::New();
+  const SliceImageType::SizeType size{ { sliceSize, sliceSize } };
+  image->SetRegions(size);
+  image->Allocate();
+  const auto volume = itk::Benchmark::MakeImage<itk::Image<unsigned char, 3>>(state.GetImageSize());
+  std::copy_n(volume->GetBufferPointer(),
+              std::min(volume->GetBufferedRegion().GetNumberOfPixels(), image->GetBufferedRegion().GetNumberOfPixels()),
+              image->GetBufferPointer());
+  ImageIOBenchmark<SliceImageType>(state, image, itk::PNGImageIO::New(), ".png", true);
+}
+ITK_BENCHMARK(PNGImageIOBenchmark, false);
+} // namespace
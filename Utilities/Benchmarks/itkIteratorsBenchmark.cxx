@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkImageBufferRange.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageScanlineConstIterator.h"
+#include "itkNeighborhoodIterator.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Keeps the compiler from optimizing the sums away.
+volatile double sumOfPixels = 0.0;
+
+void
+ImageRegionConstIteratorBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    double                                   sum = 0.0;
+    itk::ImageRegionConstIterator<ImageType> it(image, image->GetBufferedRegion());
+    for (; !it.IsAtEnd(); ++it)
+    {
+      sum += it.Get();
+    }
+    sumOfPixels = sum;
+  }
+}
+ITK_BENCHMARK(ImageRegionConstIteratorBenchmark, false);
+
+void
+ImageRegionConstIteratorWithIndexBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    double                                            sum = 0.0;
+    itk::ImageRegionConstIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion());
+    for (; !it.IsAtEnd(); ++it)
+    {
+      sum += it.Get();
+    }
+    sumOfPixels = sum;
+  }
+}
+ITK_BENCHMARK(ImageRegionConstIteratorWithIndexBenchmark, false);
+
+void
+ImageScanlineConstIteratorBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    double                                     sum = 0.0;
+    itk::ImageScanlineConstIterator<ImageType> it(image, image->GetBufferedRegion());
+    while (!it.IsAtEnd())
+    {
+      while (!it.IsAtEndOfLine())
+      {
+        sum += it.Get();
+        ++it;
+      }
+      it.NextLine();
+    }
+    sumOfPixels = sum;
+  }
+}
+ITK_BENCHMARK(ImageScanlineConstIteratorBenchmark, false);
+
+void
+ImageBufferRangeBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    double sum = 0.0;
+    for (const float pixel : itk::MakeImageBufferRange(image.GetPointer()))
+    {
+      sum += pixel;
+    }
+    sumOfPixels = sum;
+  }
+}
+ITK_BENCHMARK(ImageBufferRangeBenchmark, false);
+
+void
+ImageRegionIteratorFillBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    itk::ImageRegionIterator<ImageType> it(image, image->GetBufferedRegion());
+    for (float value = 0.0f; !it.IsAtEnd(); ++it, value += 1.0f)
+    {
+      it.Set(value);
+    }
+  }
+}
+ITK_BENCHMARK(ImageRegionIteratorFillBenchmark, false);
+
+void
+NeighborhoodIteratorBenchmark(itk::Benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  state.SetNumberOfPixels(image->GetBufferedRegion().GetNumberOfPixels());
+  const itk::NeighborhoodIterator<ImageType>::RadiusType radius{ { 1, 1, 1 } };
+  for (auto iteration : state)
+  {
+    double                               sum = 0.0;
+    itk::NeighborhoodIterator<ImageType> it(radius, image, image->GetBufferedRegion());
+    const itk::SizeValueType             numberOfNeighbors = it.Size();
+    for (; !it.IsAtEnd(); ++it)
+    {
+      for (itk::SizeValueType i = 0; i < numberOfNeighbors; ++i)
+      {
+        sum += it.GetPixel(i);
+      }
+    }
+    sumOfPixels = sum;
+  }
+}
+ITK_BENCHMARK(NeighborhoodIteratorBenchmark, false);
+} // namespace
@@ -0,0 +1,58 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkMattesMutualInformationImageToImageMetricv4.h"
+#include "itkTranslationTransform.h"
+
+namespace
+{
+void
+MattesMutualInformationImageToImageMetricv4Benchmark(itk::Benchmark::State & state)
+{
+  using ImageType = itk::Image<float, 3>;
+  using MetricType = itk::MattesMutualInformationImageToImageMetricv4<ImageType, ImageType>;
+  using TransformType = itk::TranslationTransform<double, 3>;
+
+  const auto fixedImage = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+  const auto movingImage = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+
+  const auto                    transform = TransformType::New();
+  TransformType::ParametersType parameters(3);
+  parameters[0] = 1.5;
+  parameters[1] = -0.5;
+  parameters[2] = 0.25;
+  transform->SetParameters(parameters);
+
+  const auto metric = MetricType::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetMovingTransform(transform);
+  metric->SetNumberOfHistogramBins(50);
+  metric->SetMaximumNumberOfWorkUnits(state.GetNumberOfThreads());
+  metric->Initialize();
+
+  state.SetNumberOfPixels(fixedImage->GetBufferedRegion().GetNumberOfPixels());
+  MetricType::MeasureType    value;
+  MetricType::DerivativeType derivative;
+  for (auto iteration : state)
+  {
+    metric->GetValueAndDerivative(value, derivative);
+  }
+}
+ITK_BENCHMARK(MattesMutualInformationImageToImageMetricv4Benchmark, true);
+} // namespace
@@ -0,0 +1,59 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkAffineTransform.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkResampleImageFilter.h"
+
+namespace
+{
+void
+ResampleImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  using ImageType = itk::Image<float, 3>;
+  using TransformType = itk::AffineTransform<double, 3>;
+
+  const auto input = itk::Benchmark::MakeImage<ImageType>(state.GetImageSize());
+
+  // A rotation about the center of the image, and a scaling.
+  const auto                    transform = TransformType::New();
+  TransformType::InputPointType center;
+  center.Fill(0.5 * state.GetImageSize());
+  transform->SetCenter(center);
+  TransformType::OutputVectorType axis;
+  axis[0] = 1.0;
+  axis[1] = 1.0;
+  axis[2] = 0.5;
+  transform->Rotate3D(axis, 0.3);
+  transform->Scale(1.1);
+
+  const auto filter = itk::ResampleImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(input);
+  filter->SetTransform(transform);
+  filter->SetInterpolator(itk::LinearInterpolateImageFunction<ImageType, double>::New());
+  filter->SetOutputParametersFromImage(input);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(input->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(ResampleImageFilterBenchmark, true);
+} // namespace
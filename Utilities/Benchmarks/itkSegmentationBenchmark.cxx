@@ -0,0 +1,58 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkConnectedComponentImageFilter.h"
+#include "itkSignedMaurerDistanceMapImageFilter.h"
+
+namespace
+{
+using BinaryImageType = itk::Image<unsigned char, 3>;
+
+void
+ConnectedComponentImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  const auto filter = itk::ConnectedComponentImageFilter<BinaryImageType, itk::Image<unsigned int, 3>>::New();
+  filter->SetInput(itk::Benchmark::MakeBinaryImage(state.GetImageSize()));
+  filter->SetFullyConnected(true);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(ConnectedComponentImageFilterBenchmark, true);
+
+void
+SignedMaurerDistanceMapImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  const auto filter = itk::SignedMaurerDistanceMapImageFilter<BinaryImageType, itk::Image<float, 3>>::New();
+  filter->SetInput(itk::Benchmark::MakeBinaryImage(state.GetImageSize()));
+  filter->SetUseImageSpacing(true);
+  filter->SetSquaredDistance(false);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(SignedMaurerDistanceMapImageFilterBenchmark, true);
+} // namespace
@@ -0,0 +1,74 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmark.h"
+#include "itkDiscreteGaussianImageFilter.h"
+#include "itkRecursiveGaussianImageFilter.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+void
+DiscreteGaussianImageFilterBenchmark(itk::Benchmark::State & state)
+{
+  const auto filter = itk::DiscreteGaussianImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()));
+  filter->SetVariance(4.0);
+  filter->SetMaximumKernelWidth(32);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+ITK_BENCHMARK(DiscreteGaussianImageFilterBenchmark, true);
+
+// Smooths along the given direction, whose pixels are contiguous in memory
+// for the direction 0 only.
+void
+RecursiveGaussianImageFilterBenchmark(itk::Benchmark::State & state, unsigned int direction)
+{
+  const auto filter = itk::RecursiveGaussianImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(itk::Benchmark::MakeImage<ImageType>(state.GetImageSize()));
+  filter->SetSigma(2.0);
+  filter->SetDirection(direction);
+  filter->SetNumberOfWorkUnits(state.GetNumberOfThreads());
+  state.SetNumberOfPixels(filter->GetInput()->GetBufferedRegion().GetNumberOfPixels());
+  for (auto iteration : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+}
+
+void
+RecursiveGaussianImageFilterXBenchmark(itk::Benchmark::State & state)
+{
+  RecursiveGaussianImageFilterBenchmark(state, 0);
+}
+ITK_BENCHMARK(RecursiveGaussianImageFilterXBenchmark, true);
+
+void
+RecursiveGaussianImageFilterZBenchmark(itk::Benchmark::State & state)
+{
+  RecursiveGaussianImageFilterBenchmark(state, 2);
+}
+ITK_BENCHMARK(RecursiveGaussianImageFilterZBenchmark, true);
+} // namespace
@@ -78,6 +78,8 @@ class SwigInputGenerator(object):
         "itk::SmartPointer< itk::Image.+ >",
         "itk::ObjectFactoryBasePrivate",
         "itk::ThreadPoolGlobals",
+        "itk::WorkStealingThreadPoolGlobals",
+        "itk::WorkStealingDeque",
         "itk::MultiThreaderBaseGlobals",
         ".+[(][*][)][(].+",  # functor functions
     ]